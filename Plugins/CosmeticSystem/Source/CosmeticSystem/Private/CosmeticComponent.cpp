@@ -19,6 +19,8 @@
 #include "CosmeticMeshStorage.h"
 #include "CosmeticBFL.h"
 #include "GameFramework/PawnMovementComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_CosmeticSystem_BodyType_Tag, "CosmeticSystem.Body");
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_CosmeticSystem_FaceType_Tag, "CosmeticSystem.Face");
@@ -103,9 +105,10 @@ void UCosmeticComponent::ApplyRetargetMeshPreset(FCosmeticItemID RetargetMeshPre
 		 if (CosmeticActorInstance)
 			 CosmeticActorInstance->ClearCreatedMergeTargetMeshes();
 
+		 CachedRetargetMeshData = RetargetMeshData;
+
 		 ApplyVisualMesh(GetOwner<ACharacter>(), RetargetMeshData);
 
-		 CachedRetargetMeshData = RetargetMeshData;
 		 CosmeticData.CosmeticMeshPartIDs.Empty(RetargetMeshData.DefaultPartTags.Num());
 		 for (auto& Ele : RetargetMeshData.DefaultPartTags)
 		 {
@@ -506,6 +509,17 @@ USkeletalMeshComponent* UCosmeticComponent::GetVisualMesh()
 void UCosmeticComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
+
+	if (CosmeticAssetsHandle.IsValid())
+	{
+		CosmeticAssetsHandle->CancelHandle();
+		CosmeticAssetsHandle.Reset();
+	}
+
+	++CosmeticRequestSerial;
+	++CosmeticApplySerial;
+	bPendingVisualMesh = false;
+	bPendingCosmeticData = false;
 	
 	CosmeticActorInstance = nullptr;
 }
@@ -549,6 +563,15 @@ void UCosmeticComponent::ApplyVisualMesh(ACharacter* Character, const FRetargetM
 
 		ChildActor->SetWorldScale3D(RetargetMeshData.VisualMeshScale);
 
+		bPendingVisualMesh = true;
+		RequestCosmeticAssets();
+	}
+}
+
+void UCosmeticComponent::ApplyVisualMeshAssets(ACharacter* Character, const FRetargetMeshData& RetargetMeshData)
+{
+	if (Character)
+	{
 		if (CosmeticActorInstance)
 		{
 			USkeletalMesh* VisualMesh = RetargetMeshData.VisualMeshObject.LoadSynchronous();
@@ -642,49 +665,146 @@ bool UCosmeticComponent::ProcessRemoveMeshPartID(FCosmeticItemID MeshPartID)
 }
 
 void UCosmeticComponent::CheckCosmeticData(const FCosmeticData& NewCosmeticData, bool DrawOnlyBody)
-{		
-	if (ACharacter* Character = GetOwner<ACharacter>())
-	{			
-		if (CosmeticActorInstance)
+{
+	PendingCosmeticData = NewCosmeticData;
+	bPendingDrawOnlyBody = DrawOnlyBody;
+	bPendingCosmeticData = true;
+
+	RequestCosmeticAssets();
+}
+
+void UCosmeticComponent::RequestCosmeticAssets()
+{
+	const uint32 RequestSerial = ++CosmeticRequestSerial;
+
+	if (CosmeticAssetsHandle.IsValid())
+	{
+		CosmeticAssetsHandle->CancelHandle();
+		CosmeticAssetsHandle.Reset();
+	}
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	AssetsToLoad.Add(CachedRetargetMeshData.VisualMeshObject.ToSoftObjectPath());
+	AssetsToLoad.Add(CachedRetargetMeshData.NewPhysicsAssetClass.ToSoftObjectPath());
+	for (auto& Elem : CachedRetargetMeshData.Materials)
+	{
+		AssetsToLoad.Add(Elem.Value.ToSoftObjectPath());
+	}
+
+	if (bPendingCosmeticData && CosmeticActorInstance)
+	{
+		TMap<FGameplayTag, FCachedMeshPartData> NewEquippedMeshes;
+		CollectEquippedMeshes(PendingCosmeticData, NewEquippedMeshes, &AssetsToLoad);
+
+		FGameplayTagContainer EquippedMeshPartTags;
+		for (auto& Elem : NewEquippedMeshes)
+			EquippedMeshPartTags.AddTag(Elem.Key);
+
+		TArray<FBodyMeshPartData> BodyTypeData;
+		if (GetBodyMeshData(CachedRetargetMeshData.CharacterTypeTag, EquippedMeshPartTags, BodyTypeData))
 		{
-			// Make list of new Mesh Parts
-			TMap<FGameplayTag, FCachedMeshPartData> NewEquippedMeshes;			
-			
-			TArray<FCosmeticItemID> IgnoreItemIDs;
-			for (FCosmeticItemID MeshPartID : NewCosmeticData.CosmeticMeshPartIDs)
+			for (FBodyMeshPartData& Elem : BodyTypeData)
 			{
-				TArray<FCosmeticItemID> RemoveItemIDs = AppendMeshPart(NewEquippedMeshes, MeshPartID);
-				IgnoreItemIDs.Append(RemoveItemIDs);
-			}			
+				AssetsToLoad.Add(Elem.BodyMeshObject.ToSoftObjectPath());
+			}
+		}
+	}
 
-			for (auto& Elem : CachedRetargetMeshData.DefaultPartTags)
+	bool bAllLoaded = true;
+	AssetsToLoad.RemoveAll([&bAllLoaded](const FSoftObjectPath& Path)
+	{
+		if (Path.IsNull())
+		{
+			return true;
+		}
+
+		bAllLoaded &= (Path.ResolveObject() != nullptr);
+		return false;
+	});
+
+	// nothing to stream (e.g. the same parts again), apply in this frame
+	if (bAllLoaded)
+	{
+		OnCosmeticAssetsLoaded(RequestSerial);
+		return;
+	}
+
+	CosmeticAssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnCosmeticAssetsLoaded, RequestSerial),
+		FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("CosmeticComponent"));
+}
+
+void UCosmeticComponent::OnCosmeticAssetsLoaded(uint32 RequestSerial)
+{
+	// replaced by a newer request
+	if (RequestSerial != CosmeticRequestSerial)
+	{
+		return;
+	}
+
+	if (bPendingVisualMesh)
+	{
+		bPendingVisualMesh = false;
+		ApplyVisualMeshAssets(GetOwner<ACharacter>(), CachedRetargetMeshData);
+	}
+
+	if (bPendingCosmeticData)
+	{
+		bPendingCosmeticData = false;
+		ApplyCosmeticData(PendingCosmeticData, bPendingDrawOnlyBody);
+	}
+}
+
+void UCosmeticComponent::CollectEquippedMeshes(const FCosmeticData& NewCosmeticData, TMap<FGameplayTag, FCachedMeshPartData>& NewEquippedMeshes, TArray<FSoftObjectPath>* OutAssetsToLoad)
+{
+	TArray<FCosmeticItemID> IgnoreItemIDs;
+	for (FCosmeticItemID MeshPartID : NewCosmeticData.CosmeticMeshPartIDs)
+	{
+		TArray<FCosmeticItemID> RemoveItemIDs = AppendMeshPart(NewEquippedMeshes, MeshPartID, OutAssetsToLoad);
+		IgnoreItemIDs.Append(RemoveItemIDs);
+	}
+
+	for (auto& Elem : CachedRetargetMeshData.DefaultPartTags)
+	{
+		bool bFind = false;
+		for (auto& NewEle : NewEquippedMeshes)
+		{
+			if (NewEle.Key.MatchesTag(Elem.Key))
 			{
-				bool bFind = false;
-				for (auto& NewEle : NewEquippedMeshes)
-				{
-					if (NewEle.Key.MatchesTag(Elem.Key))
-					{
-						bFind = true;
-						break;
-					}
-				}
+				bFind = true;
+				break;
+			}
+		}
 
-				if (!bFind)
+		if (!bFind)
+		{
+			bool bSkip = false;
+			for (FCosmeticItemID& ID : IgnoreItemIDs)
+			{
+				if (ID.GetPartAB() == Elem.Value.GetPartAB())
 				{
-					bool bSkip = false;
-					for (FCosmeticItemID& ID : IgnoreItemIDs)
-					{
-						if (ID.GetPartAB() == Elem.Value.GetPartAB())
-						{
-							bSkip = true;
-							break;
-						}
-					}
-
-					if (!bSkip)
-						AppendMeshPart(NewEquippedMeshes, Elem.Value);
+					bSkip = true;
+					break;
 				}
 			}
+
+			if (!bSkip)
+				AppendMeshPart(NewEquippedMeshes, Elem.Value, OutAssetsToLoad);
+		}
+	}
+}
+
+void UCosmeticComponent::ApplyCosmeticData(const FCosmeticData& NewCosmeticData, bool DrawOnlyBody)
+{
+	++CosmeticApplySerial;
+	TGuardValue<bool> ApplyingGuard(bApplyingCosmeticData, true);
+
+	if (ACharacter* Character = GetOwner<ACharacter>())
+	{			
+		if (CosmeticActorInstance)
+		{
+			TMap<FGameplayTag, FCachedMeshPartData> NewEquippedMeshes;
+			CollectEquippedMeshes(NewCosmeticData, NewEquippedMeshes);
 						
 			// Find Body Parts from blueprint
 			FGameplayTagContainer EquippedMeshPartTags;
@@ -790,114 +910,34 @@ void UCosmeticComponent::CheckCosmeticData(const FCosmeticData& NewCosmeticData,
 
 				if (!MergeMeshes.IsEmpty())
 				{
-					FSkeletalMeshMergeParams MergeParams;					
-
 					UPhysicsAsset* DefaultPhysAsset = CachedRetargetMeshData.NewPhysicsAssetClass.LoadSynchronous();
+					USkeleton* BaseSkeleton = CachedRetargetMeshData.VisualMeshObject->GetSkeleton();
+					const bool bUseMergedMeshStorage = UCosmeticSystemSettings::Get()->bUseMergedMeshStorage;
 
-					for (auto& Elem : MergeMeshes)
-					{					
-						Elem.Key->EmptyOverrideMaterials();
-						MergeParams.MeshesToMerge = Elem.Value.Meshes;
-						if (!CachedRetargetMeshData.bMergeSkeleton)
-						{
-							MergeParams.Skeleton = CachedRetargetMeshData.VisualMeshObject->GetSkeleton();
-						}
-						else
+					if (UCosmeticMeshStorage* Storage = UCosmeticMeshStorage::Get(Character->GetWorld()))
+					{
+						for (auto& Elem : MergeMeshes)
 						{
-							FSkeletonMergeParams SkeletonMergeParams;
-
-							for (USkeletalMesh* EleMesh : Elem.Value.Meshes)
+							FSkeletalMeshMergeParams MergeParams;
+							MergeParams.MeshesToMerge = Elem.Value.Meshes;
+							if (!CachedRetargetMeshData.bMergeSkeleton)
 							{
-								if (!SkeletonMergeParams.SkeletonsToMerge.Contains(EleMesh->GetSkeleton()))
-								{
-									SkeletonMergeParams.SkeletonsToMerge.Add(EleMesh->GetSkeleton());
-								}
+								MergeParams.Skeleton = BaseSkeleton;
 							}
 
-							MergeParams.Skeleton = USkeletalMergingLibrary::MergeSkeletons(SkeletonMergeParams);
-							if (!MergeParams.Skeleton)
-							{
-								FString Msg = FString::Printf(TEXT("MergeSkeletons failed, Instance [%s]. Skeletons involved: "), *GetOuter()->GetName());
-
-								const int32 SkeletonCount = SkeletonMergeParams.SkeletonsToMerge.Num();
-								for (int32 SkeletonIndex = 0; SkeletonIndex < SkeletonCount; ++SkeletonIndex)
+							// a cached mesh is applied right away, a new one once the storage has merged it
+							const FCosmeticMergedMeshKey Key = FCosmeticMergedMeshKey::Make(Elem.Value, BaseSkeleton, CachedRetargetMeshData.bMergeSkeleton);
+							TWeakObjectPtr<USkeletalMeshComponent> WeakTargetMesh = Elem.Key;
+							TWeakObjectPtr<UPhysicsAsset> WeakPhysAsset = DefaultPhysAsset;
+							const uint32 ApplySerial = CosmeticApplySerial;
+							Storage->RequestMergedMesh(Key, MergeParams, BaseSkeleton, bUseMergedMeshStorage, FOnCosmeticMeshMerged::CreateWeakLambda(this,
+								[this, WeakTargetMesh, WeakPhysAsset, ApplySerial, MergeData = Elem.Value](USkeletalMesh* MergedMesh)
 								{
-									Msg += FString::Printf(TEXT(" [%s]"), *SkeletonMergeParams.SkeletonsToMerge[SkeletonIndex].GetName());
-								}
-
-								UE_LOG(LogCosmeticSystem, Warning, TEXT("%s"), *Msg);
-
-								MergeParams.Skeleton = CachedRetargetMeshData.VisualMeshObject->GetSkeleton();
-							}
-						}
-
-						USkeletalMesh* MergedMesh = nullptr;
-						if (UCosmeticSystemSettings::Get()->bUseMergedMeshStorage)
-						{							
-							UCosmeticMeshStorage* Storage = UCosmeticMeshStorage::Get(Character->GetWorld());
-							MergedMesh = Storage->GetMergedMesh(Elem.Value.MeshPartIDs);
-							if (!MergedMesh)
-							{
-								MergedMesh = USkeletalMergingLibrary::MergeMeshes(MergeParams);
-								if (MergedMesh)
-								{
-									if (UCosmeticSystemSettings::Get()->bCheckClear)
+									if (ApplySerial == CosmeticApplySerial && WeakTargetMesh.IsValid())
 									{
-										if (UCosmeticSystemSettings::Get()->CheckClearCount <= Storage->GetStoredMergedMeshCount() + 1)
-										{
-											Storage->Clear();
-										}
+										ApplyMergedMesh(WeakTargetMesh.Get(), MergedMesh, MergeData, WeakPhysAsset.Get());
 									}
-
-									FMergedMeshHandle Data;
-									Data.MergedMesh = MergedMesh;
-									Data.MeshPartIDs = Elem.Value.MeshPartIDs;
-									Storage->RegisterMergedMesh(Data);
-								}
-							}
-						}
-						else
-						{
-							MergedMesh = USkeletalMergingLibrary::MergeMeshes(MergeParams);							
-						}
-						
-						if (MergedMesh)
-						{
-							Elem.Key->SetSkeletalMesh(MergedMesh);
-							Elem.Key->SetPhysicsAsset(DefaultPhysAsset);
-
-							// bUseSeparatelyMasterMesh 
-							if (CosmeticActorInstance->GetVisualMesh() != Elem.Key)
-							{							
-								Elem.Key->SetLeaderPoseComponent(CosmeticActorInstance->GetVisualMesh(), true);
-							}
-
-							for (auto& MateirlaElem : Elem.Value.OverrideMaterials)
-							{
-								Elem.Key->SetMaterialByName(MateirlaElem.Key, MateirlaElem.Value);
-							}
-
-							if (CachedRetargetMeshData.bMergePhysAsset)
-							{
-								TArray<UPhysicsAsset*> PhysicsAssets;
-
-								for (USkeletalMesh* SkeletalMesh : MergeParams.MeshesToMerge)
-								{
-									if (UPhysicsAsset* PhysicAsset = SkeletalMesh->GetPhysicsAsset())
-									{
-										PhysicsAssets.Add(PhysicAsset);
-									}
-								}
-
-								if (PhysicsAssets.Num() > 1)
-								{
-									CosmeticActorInstance->MergePhysicsAssets(PhysicsAssets, Elem.Key);									
-								}
-								else
-								{
-									UE_LOG(LogCosmeticSystem, Warning, TEXT("Error: Merge PhysAsset. There must be at least two meshes to which PhysAsset is assigned."));
-								}
-							}
+								}));
 						}
 					}
 				}
@@ -953,6 +993,57 @@ void UCosmeticComponent::CheckCosmeticData(const FCosmeticData& NewCosmeticData,
 	} // if (ACharacter* Character = GetOwner<ACharacter>())
 }
 
+void UCosmeticComponent::ApplyMergedMesh(USkeletalMeshComponent* TargetMesh, USkeletalMesh* MergedMesh, const FMeshesToMergeSkeletalMeshes& MergeData, UPhysicsAsset* DefaultPhysAsset)
+{
+	if (!MergedMesh || !CosmeticActorInstance)
+	{
+		return;
+	}
+
+	TargetMesh->EmptyOverrideMaterials();
+	TargetMesh->SetSkeletalMesh(MergedMesh);
+	TargetMesh->SetPhysicsAsset(DefaultPhysAsset);
+
+	// bUseSeparatelyMasterMesh 
+	if (CosmeticActorInstance->GetVisualMesh() != TargetMesh)
+	{
+		TargetMesh->SetLeaderPoseComponent(CosmeticActorInstance->GetVisualMesh(), true);
+	}
+
+	for (auto& MateirlaElem : MergeData.OverrideMaterials)
+	{
+		TargetMesh->SetMaterialByName(MateirlaElem.Key, MateirlaElem.Value);
+	}
+
+	if (CachedRetargetMeshData.bMergePhysAsset)
+	{
+		TArray<UPhysicsAsset*> PhysicsAssets;
+
+		for (USkeletalMesh* SkeletalMesh : MergeData.Meshes)
+		{
+			if (UPhysicsAsset* PhysicAsset = SkeletalMesh->GetPhysicsAsset())
+			{
+				PhysicsAssets.Add(PhysicAsset);
+			}
+		}
+
+		if (PhysicsAssets.Num() > 1)
+		{
+			CosmeticActorInstance->MergePhysicsAssets(PhysicsAssets, TargetMesh);
+		}
+		else
+		{
+			UE_LOG(LogCosmeticSystem, Warning, TEXT("Error: Merge PhysAsset. There must be at least two meshes to which PhysAsset is assigned."));
+		}
+	}
+
+	// merged after ApplyCosmeticData returned
+	if (!bApplyingCosmeticData)
+	{
+		CosmeticActorInstance->OnChangedSkeletalMesh();
+	}
+}
+
 void UCosmeticComponent::Debug_CheckCosmeticData(bool DrawOnlyBody)
 {
 	CheckCosmeticData(CosmeticData, DrawOnlyBody);
@@ -989,14 +1080,24 @@ UCosmeticGroomComponent* UCosmeticComponent::AddNewInstanceGroomAsset(FGameplayT
 	return nullptr;
 }
 
-TArray<FCosmeticItemID> UCosmeticComponent::AppendMeshPart(TMap<FGameplayTag, FCachedMeshPartData>& NewEquippedMeshes, FCosmeticItemID MeshPartID)
+TArray<FCosmeticItemID> UCosmeticComponent::AppendMeshPart(TMap<FGameplayTag, FCachedMeshPartData>& NewEquippedMeshes, FCosmeticItemID MeshPartID, TArray<FSoftObjectPath>* OutAssetsToLoad)
 {
 	FMeshPartData MeshPartData;
 	TArray<FCosmeticItemID> RemoveItemIDs;
 	if (GetMeshPartData(CachedRetargetMeshData.CharacterTypeTag, MeshPartID, MeshPartData))
 	{
-		USkeletalMesh* MeshPart = MeshPartData.MeshPartClass.LoadSynchronous();
-		UGroomAsset* Groom = MeshPartData.GroomAsset.LoadSynchronous();
+		if (OutAssetsToLoad)
+		{
+			OutAssetsToLoad->Add(MeshPartData.MeshPartClass.ToSoftObjectPath());
+			OutAssetsToLoad->Add(MeshPartData.GroomAsset.ToSoftObjectPath());
+			for (auto& Elem : MeshPartData.Materials)
+			{
+				OutAssetsToLoad->Add(Elem.Value.ToSoftObjectPath());
+			}
+		}
+
+		USkeletalMesh* MeshPart = OutAssetsToLoad ? MeshPartData.MeshPartClass.Get() : MeshPartData.MeshPartClass.LoadSynchronous();
+		UGroomAsset* Groom = OutAssetsToLoad ? MeshPartData.GroomAsset.Get() : MeshPartData.GroomAsset.LoadSynchronous();
 
 		UPhysicsAsset* NewPhysicsAsset = nullptr;		
 		RemoveItemIDs = MeshPartData.RemovePartIDs;
@@ -1010,7 +1111,7 @@ TArray<FCosmeticItemID> UCosmeticComponent::AppendMeshPart(TMap<FGameplayTag, FC
 			{
 				for (auto& Elem : MeshPartData.Materials)
 				{
-					UMaterialInterface* Inst = Elem.Value.LoadSynchronous();
+					UMaterialInterface* Inst = OutAssetsToLoad ? Elem.Value.Get() : Elem.Value.LoadSynchronous();
 					Materials.Add(Elem.Key, Inst);
 				}
 			}
@@ -2,11 +2,63 @@
 
 #include "CosmeticMeshStorage.h"
 #include "Engine/World.h"
-#include "Runtime/Engine/Classes/Kismet/KismetSystemLibrary.h"
+#include "Engine/SkeletalMesh.h"
+#include "Animation/Skeleton.h"
+#include "Materials/MaterialInterface.h"
 #include "CosmeticSystemSettings.h"
+#include "CosmeticSystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(CosmeticMeshStorage)
 
+FCosmeticMergedMeshKey FCosmeticMergedMeshKey::Make(const FMeshesToMergeSkeletalMeshes& MergeData, const USkeleton* Skeleton, bool bMergeSkeleton)
+{
+	FCosmeticMergedMeshKey Key;
+	Key.bMergeSkeleton = bMergeSkeleton;
+	// merged skeletons are created per merge, so only the source skeletons (part of the meshes) identify them
+	Key.Skeleton = bMergeSkeleton ? FObjectKey() : FObjectKey(Skeleton);
+
+	Key.MeshPartIDs.Reserve(MergeData.MeshPartIDs.Num());
+	for (const FCosmeticItemID& ID : MergeData.MeshPartIDs)
+	{
+		Key.MeshPartIDs.Add(ID.GetIntID());
+	}
+	Key.MeshPartIDs.Sort();
+
+	Key.Meshes.Reserve(MergeData.Meshes.Num());
+	for (const USkeletalMesh* Mesh : MergeData.Meshes)
+	{
+		Key.Meshes.Add(FObjectKey(Mesh));
+	}
+	Key.Meshes.Sort();
+
+	Key.OverrideMaterials.Reserve(MergeData.OverrideMaterials.Num());
+	for (const TPair<FName, UMaterialInterface*>& Elem : MergeData.OverrideMaterials)
+	{
+		Key.OverrideMaterials.Emplace(Elem.Key, FObjectKey(Elem.Value));
+	}
+	Key.OverrideMaterials.Sort([](const TPair<FName, FObjectKey>& Lhs, const TPair<FName, FObjectKey>& Rhs)
+	{
+		return Lhs.Key.FastLess(Rhs.Key);
+	});
+
+	uint32 Hash = HashCombineFast(GetTypeHash(Key.Skeleton), GetTypeHash(Key.bMergeSkeleton));
+	for (int32 ID : Key.MeshPartIDs)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(ID));
+	}
+	for (const FObjectKey& Mesh : Key.Meshes)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Mesh));
+	}
+	for (const TPair<FName, FObjectKey>& Elem : Key.OverrideMaterials)
+	{
+		Hash = HashCombineFast(Hash, HashCombineFast(GetTypeHash(Elem.Key), GetTypeHash(Elem.Value)));
+	}
+	Key.Hash = Hash;
+
+	return Key;
+}
+
 UCosmeticMeshStorage* UCosmeticMeshStorage::Get(const UWorld* InWorld)
 {
 	if (InWorld)
@@ -17,6 +69,93 @@ UCosmeticMeshStorage* UCosmeticMeshStorage::Get(const UWorld* InWorld)
 	return nullptr;
 }
 
+void UCosmeticMeshStorage::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingMerges.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 MaxMerges = FMath::Max(1, UCosmeticSystemSettings::Get()->MaxMergesPerFrame);
+	for (int32 MergeCount = 0; MergeCount < MaxMerges && !PendingMerges.IsEmpty(); ++MergeCount)
+	{
+		// callbacks may queue new merges, so take the request out of the queue first
+		FCosmeticPendingMerge Merge = MoveTemp(PendingMerges[0]);
+		PendingMerges.RemoveAt(0, 1, EAllowShrinking::No);
+
+		USkeletalMesh* MergedMesh = ProcessMerge(Merge);
+		if (MergedMesh && Merge.bUseCache)
+		{
+			RegisterMergedMesh(Merge.Key, MergedMesh);
+		}
+
+		for (FOnCosmeticMeshMerged& Callback : Merge.Callbacks)
+		{
+			Callback.ExecuteIfBound(MergedMesh);
+		}
+	}
+}
+
+TStatId UCosmeticMeshStorage::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCosmeticMeshStorage, STATGROUP_Tickables);
+}
+
+void UCosmeticMeshStorage::Deinitialize()
+{
+	PendingMerges.Empty();
+	Clear();
+
+	Super::Deinitialize();
+}
+
+void UCosmeticMeshStorage::RequestMergedMesh(const FCosmeticMergedMeshKey& Key, const FSkeletalMeshMergeParams& MergeParams, USkeleton* FallbackSkeleton, bool bUseCache, FOnCosmeticMeshMerged OnMerged)
+{
+	if (bUseCache)
+	{
+		if (USkeletalMesh* MergedMesh = FindMergedMesh(Key))
+		{
+			++CacheHits;
+			OnMerged.ExecuteIfBound(MergedMesh);
+			return;
+		}
+
+		++CacheMisses;
+
+		// same loadout already waiting, share its result
+		for (FCosmeticPendingMerge& Pending : PendingMerges)
+		{
+			if (Pending.bUseCache && Pending.Key == Key)
+			{
+				Pending.Callbacks.Add(MoveTemp(OnMerged));
+				return;
+			}
+		}
+	}
+
+	FCosmeticPendingMerge& Pending = PendingMerges.AddDefaulted_GetRef();
+	Pending.MergeParams = MergeParams;
+	Pending.FallbackSkeleton = FallbackSkeleton;
+	Pending.bMergeSkeleton = Key.bMergeSkeleton;
+	Pending.bUseCache = bUseCache;
+	Pending.Key = Key;
+	Pending.Callbacks.Add(MoveTemp(OnMerged));
+}
+
+USkeletalMesh* UCosmeticMeshStorage::FindMergedMesh(const FCosmeticMergedMeshKey& Key)
+{
+	if (const int32* Index = MergedMeshIndices.Find(Key))
+	{
+		FMergedMeshHandle& Data = MergedMeshes[*Index];
+		Data.LastUsedTime = FPlatformTime::Seconds();
+		return Data.MergedMesh;
+	}
+
+	return nullptr;
+}
+
 USkeletalMesh* UCosmeticMeshStorage::GetMergedMesh(const TSet<FCosmeticItemID>& MeshPartIDs)
 {
 	for (FMergedMeshHandle& Elem : MergedMeshes)
@@ -24,7 +163,7 @@ USkeletalMesh* UCosmeticMeshStorage::GetMergedMesh(const TSet<FCosmeticItemID>&
 		if (Equal(MeshPartIDs, Elem.MeshPartIDs))
 		{
 			return Elem.MergedMesh;
-		}		
+		}
 	}
 	return nullptr;
 }
@@ -32,7 +171,7 @@ USkeletalMesh* UCosmeticMeshStorage::GetMergedMesh(const TSet<FCosmeticItemID>&
 bool UCosmeticMeshStorage::Equal(const TSet<FCosmeticItemID>& lhs, const TSet<FCosmeticItemID>& rhs)
 {
 	if (lhs.Num() == rhs.Num())
-	{		
+	{
 		for (auto It = lhs.CreateConstIterator(); It; ++It)
 		{
 			if (!rhs.Contains(*It))
@@ -47,31 +186,125 @@ bool UCosmeticMeshStorage::Equal(const TSet<FCosmeticItemID>& lhs, const TSet<FC
 	return false;
 }
 
-void UCosmeticMeshStorage::RegisterMergedMesh(FMergedMeshHandle& Data)
+void UCosmeticMeshStorage::RegisterMergedMesh(const FCosmeticMergedMeshKey& Key, USkeletalMesh* MergedMesh)
+{
+	if (!MergedMesh || MergedMeshIndices.Contains(Key))
+	{
+		return;
+	}
+
+	FMergedMeshHandle& Data = MergedMeshes.AddDefaulted_GetRef();
+	Data.MergedMesh = MergedMesh;
+	for (int32 ID : Key.MeshPartIDs)
+	{
+		Data.MeshPartIDs.Add(FCosmeticItemID(ID));
+	}
+	Data.ResourceSize = MergedMesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	Data.LastUsedTime = FPlatformTime::Seconds();
+	StoredBytes += Data.ResourceSize;
+
+	const int32 Index = MergedMeshes.Num() - 1;
+	MergedMeshKeys.Add(Key);
+	MergedMeshIndices.Add(Key, Index);
+
+	UE_LOG(LogCosmeticSystem, Verbose, TEXT("MergedMeshStorage: stored %d meshes, %lld KB, hits %d, misses %d"),
+		MergedMeshes.Num(), StoredBytes / 1024, CacheHits, CacheMisses);
+
+	TrimToBudget(Index);
+}
+
+void UCosmeticMeshStorage::RemoveMergedMeshAt(int32 Index)
 {
-	//skip already have value 
-	MergedMeshes.Add(Data);
-	//UKismetSystemLibrary::PrintString(this, FString::Printf(TEXT("RegisterMergedMesh %d"), MergedMeshes.Num()), true, true, FLinearColor::Red, 1.0f);
+	StoredBytes -= MergedMeshes[Index].ResourceSize;
+	MergedMeshIndices.Remove(MergedMeshKeys[Index]);
+
+	MergedMeshes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MergedMeshKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (MergedMeshKeys.IsValidIndex(Index))
+	{
+		MergedMeshIndices[MergedMeshKeys[Index]] = Index;
+	}
 }
 
-void UCosmeticMeshStorage::Clear()
-{	
-	MergedMeshes.Empty(UCosmeticSystemSettings::Get()->CheckClearCount);
+void UCosmeticMeshStorage::TrimToBudget(int32 KeepIndex)
+{
+	const UCosmeticSystemSettings* Settings = UCosmeticSystemSettings::Get();
+	const int64 MaxBytes = int64(Settings->MaxStorageMemoryMB) * 1024 * 1024;
 
-	/*
-	TArray<UObject*> ReferredToObjects;
-	for (int32 Index = 0; Index < MergedMeshes.Num(); Index++)
+	auto IsOverBudget = [this, Settings, MaxBytes]()
 	{
-		ReferredToObjects.Empty(ReferredToObjects.Num());
-		FReferenceFinder ObjectReferenceCollector(ReferredToObjects, MergedMeshes[Index].MergedMesh, false, true, true, false);
-		ObjectReferenceCollector.FindReferences(MergedMeshes[Index].MergedMesh);
+		return (Settings->bCheckClear && MergedMeshes.Num() > Settings->CheckClearCount) || (MaxBytes > 0 && StoredBytes > MaxBytes);
+	};
 
-		if (ReferredToObjects.Num() <= 1)
+	while (MergedMeshes.Num() > 1 && IsOverBudget())
+	{
+		// drop the least recently used mesh, components using it keep their own reference
+		int32 OldestIndex = INDEX_NONE;
+		double OldestTime = TNumericLimits<double>::Max();
+		for (int32 Index = 0; Index < MergedMeshes.Num(); ++Index)
 		{
-			MergedMeshes.RemoveAtSwap(Index, 1, false);
-			Index--;
+			if (Index != KeepIndex && MergedMeshes[Index].LastUsedTime < OldestTime)
+			{
+				OldestTime = MergedMeshes[Index].LastUsedTime;
+				OldestIndex = Index;
+			}
+		}
+
+		if (OldestIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		const int32 LastIndex = MergedMeshes.Num() - 1;
+		RemoveMergedMeshAt(OldestIndex);
+		if (KeepIndex == LastIndex)
+		{
+			KeepIndex = OldestIndex;
 		}
 	}
-	MergedMeshes.Shrink();	
-	*/
+}
+
+USkeletalMesh* UCosmeticMeshStorage::ProcessMerge(FCosmeticPendingMerge& Merge)
+{
+	FSkeletalMeshMergeParams& MergeParams = Merge.MergeParams;
+
+	if (Merge.bMergeSkeleton)
+	{
+		FSkeletonMergeParams SkeletonMergeParams;
+
+		for (USkeletalMesh* EleMesh : MergeParams.MeshesToMerge)
+		{
+			if (EleMesh && !SkeletonMergeParams.SkeletonsToMerge.Contains(EleMesh->GetSkeleton()))
+			{
+				SkeletonMergeParams.SkeletonsToMerge.Add(EleMesh->GetSkeleton());
+			}
+		}
+
+		MergeParams.Skeleton = USkeletalMergingLibrary::MergeSkeletons(SkeletonMergeParams);
+		if (!MergeParams.Skeleton)
+		{
+			FString Msg = FString::Printf(TEXT("MergeSkeletons failed, World [%s]. Skeletons involved: "), *GetNameSafe(GetWorld()));
+
+			const int32 SkeletonCount = SkeletonMergeParams.SkeletonsToMerge.Num();
+			for (int32 SkeletonIndex = 0; SkeletonIndex < SkeletonCount; ++SkeletonIndex)
+			{
+				Msg += FString::Printf(TEXT(" [%s]"), *SkeletonMergeParams.SkeletonsToMerge[SkeletonIndex].GetName());
+			}
+
+			UE_LOG(LogCosmeticSystem, Warning, TEXT("%s"), *Msg);
+
+			MergeParams.Skeleton = Merge.FallbackSkeleton;
+		}
+	}
+
+	return USkeletalMergingLibrary::MergeMeshes(MergeParams);
+}
+
+void UCosmeticMeshStorage::Clear()
+{
+	MergedMeshes.Empty(UCosmeticSystemSettings::Get()->CheckClearCount);
+	MergedMeshKeys.Empty(UCosmeticSystemSettings::Get()->CheckClearCount);
+	MergedMeshIndices.Empty();
+	StoredBytes = 0;
 }
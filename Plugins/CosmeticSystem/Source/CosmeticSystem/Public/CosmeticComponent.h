@@ -15,6 +15,8 @@
 #include "CosmeticGroomComponent.h"
 #include "CosmeticComponent.generated.h"
 
+struct FStreamableHandle;
+
 
 DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FChangedMeshPartSignature, UCosmeticComponent, OnChangedMeshPart, UCosmeticComponent*, Component);
 DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_OneParam(FCreatedCosmeticActorSignature, UCosmeticComponent, OnCreatedCosmeticActor, ACosmeticActor*, CosmeticActor);
@@ -124,14 +126,31 @@ public:
 	bool IsDefaultPartItem(FCosmeticItemID MeshPartID) const;
 
 protected:
+	// Sets up the cosmetic actor, the visual mesh assets are applied once they are loaded
 	void ApplyVisualMesh(ACharacter* Character, const FRetargetMeshData& RetargetMeshData);
+
+	void ApplyVisualMeshAssets(ACharacter* Character, const FRetargetMeshData& RetargetMeshData);
 		
 	bool ProcessAddMeshPartID(FCosmeticItemID MeshPartID);
 
 	bool ProcessRemoveMeshPartID(FCosmeticItemID MeshPartID);
 		
+	// Loads every asset of NewCosmeticData asynchronously, then applies it
 	virtual void CheckCosmeticData(const FCosmeticData& NewCosmeticData, bool DrawOnlyBody = false);
 
+	// Applies NewCosmeticData, its assets must be loaded already
+	virtual void ApplyCosmeticData(const FCosmeticData& NewCosmeticData, bool DrawOnlyBody);
+
+	// Starts one streamable request for everything pending, replacing the previous request
+	void RequestCosmeticAssets();
+
+	void OnCosmeticAssetsLoaded(uint32 RequestSerial);
+
+	// Make list of new Mesh Parts, including the default parts
+	void CollectEquippedMeshes(const FCosmeticData& NewCosmeticData, TMap<FGameplayTag, FCachedMeshPartData>& NewEquippedMeshes, TArray<FSoftObjectPath>* OutAssetsToLoad = nullptr);
+
+	void ApplyMergedMesh(USkeletalMeshComponent* TargetMesh, USkeletalMesh* MergedMesh, const FMeshesToMergeSkeletalMeshes& MergeData, UPhysicsAsset* DefaultPhysAsset);
+
 	UFUNCTION(BlueprintCallable, Category = "CosmeticSystem Debug")
 	void Debug_CheckCosmeticData(bool DrawOnlyBody);
 
@@ -141,8 +160,8 @@ protected:
 	UCosmeticGroomComponent* AddNewInstanceGroomAsset(FGameplayTag PartTag, FName SocketName = NAME_None, 
 						TSubclassOf<UCosmeticGroomComponent> OverrideGroomComponent = nullptr);
 
-	// return RemoveItemIDs
-	TArray<FCosmeticItemID> AppendMeshPart(TMap<FGameplayTag, FCachedMeshPartData>& NewEquippedMeshes, FCosmeticItemID MeshPartID);
+	// return RemoveItemIDs, only collects the assets to load when OutAssetsToLoad is set
+	TArray<FCosmeticItemID> AppendMeshPart(TMap<FGameplayTag, FCachedMeshPartData>& NewEquippedMeshes, FCosmeticItemID MeshPartID, TArray<FSoftObjectPath>* OutAssetsToLoad = nullptr);
 
 	bool EquipFaceMeshToVisualMesh(FGameplayTag EquippedMesheTag, const FCachedMeshPartData& EquippedMeshe);
 	
@@ -181,4 +200,22 @@ protected:
 
 	UPROPERTY(Transient)
 	FName CachedMeshCollisionProfileName;
+
+	// Assets of the pending visual mesh and cosmetic data
+	TSharedPtr<FStreamableHandle> CosmeticAssetsHandle;
+
+	uint32 CosmeticRequestSerial = 0;
+
+	// Merges finishing after a newer ApplyCosmeticData are ignored
+	uint32 CosmeticApplySerial = 0;
+
+	FCosmeticData PendingCosmeticData;
+
+	bool bPendingVisualMesh = false;
+
+	bool bPendingCosmeticData = false;
+
+	bool bPendingDrawOnlyBody = false;
+
+	bool bApplyingCosmeticData = false;
 };
\ No newline at end of file
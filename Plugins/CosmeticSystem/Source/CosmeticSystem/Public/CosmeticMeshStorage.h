@@ -4,27 +4,95 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SkeletalMergingLibrary.h"
 #include "CosmeticItemID.h"
 #include "CosmeticStructure.h"
 #include "CosmeticMeshStorage.generated.h"
 
+DECLARE_DELEGATE_OneParam(FOnCosmeticMeshMerged, USkeletalMesh* /*MergedMesh*/);
+
+/**
+* Identifies a merged mesh by its content: the sorted MeshPartIDs, the meshes without part id (body meshes),
+* the override materials and the skeleton the parts are merged onto.
+**/
+struct COSMETICSYSTEM_API FCosmeticMergedMeshKey
+{
+	TArray<int32> MeshPartIDs;
+	TArray<FObjectKey> Meshes;
+	TArray<TPair<FName, FObjectKey>> OverrideMaterials;
+	FObjectKey Skeleton;
+	bool bMergeSkeleton = false;
+	uint32 Hash = 0;
+
+	static FCosmeticMergedMeshKey Make(const FMeshesToMergeSkeletalMeshes& MergeData, const USkeleton* Skeleton, bool bMergeSkeleton);
+
+	friend bool operator==(const FCosmeticMergedMeshKey& Lhs, const FCosmeticMergedMeshKey& Rhs)
+	{
+		return Lhs.Hash == Rhs.Hash && Lhs.bMergeSkeleton == Rhs.bMergeSkeleton && Lhs.Skeleton == Rhs.Skeleton
+			&& Lhs.MeshPartIDs == Rhs.MeshPartIDs && Lhs.Meshes == Rhs.Meshes && Lhs.OverrideMaterials == Rhs.OverrideMaterials;
+	}
+
+	friend uint32 GetTypeHash(const FCosmeticMergedMeshKey& Key) { return Key.Hash; }
+};
+
+/**
+* A merge waiting for its turn, every request for the same key shares it
+**/
+USTRUCT()
+struct FCosmeticPendingMerge
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FSkeletalMeshMergeParams MergeParams;
+
+	// used when merging skeletons fails
+	UPROPERTY()
+	TObjectPtr<USkeleton> FallbackSkeleton = nullptr;
+
+	bool bMergeSkeleton = false;
+
+	bool bUseCache = true;
+
+	FCosmeticMergedMeshKey Key;
+
+	TArray<FOnCosmeticMeshMerged> Callbacks;
+};
+
 /**
 * Prevent duplicate generation of the same merged mesh.
-* Depending on the project, you should call Clear at the right time.
+* Merges are queued and run a few per frame, identical loadouts share one merge and one merged mesh.
+* The cache is bounded by UCosmeticSystemSettings (entry count and memory), least recently used meshes are dropped first.
 **/
 UCLASS(BlueprintType)
-class COSMETICSYSTEM_API UCosmeticMeshStorage : public UWorldSubsystem
+class COSMETICSYSTEM_API UCosmeticMeshStorage : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	static UCosmeticMeshStorage* Get(const UWorld* InWorld);
 
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Calls OnMerged with the merged mesh for this key, right away on a cache hit,
+	 * otherwise once the queued merge has run. MergeParams.Skeleton is filled in when merging skeletons.
+	 */
+	void RequestMergedMesh(const FCosmeticMergedMeshKey& Key, const FSkeletalMeshMergeParams& MergeParams, USkeleton* FallbackSkeleton, bool bUseCache, FOnCosmeticMeshMerged OnMerged);
+
+	USkeletalMesh* FindMergedMesh(const FCosmeticMergedMeshKey& Key);
+
 	USkeletalMesh* GetMergedMesh(const TSet<FCosmeticItemID>& MeshPartIDs);
 
 	bool Equal(const TSet<FCosmeticItemID>& lhs, const TSet<FCosmeticItemID>& rhs);
-	
-	void RegisterMergedMesh(FMergedMeshHandle& Data);
+
+	void RegisterMergedMesh(const FCosmeticMergedMeshKey& Key, USkeletalMesh* MergedMesh);
 
 	// remove sored merged meshes
 	UFUNCTION(BlueprintCallable, Category = "CosmeticMeshStorage")
@@ -33,8 +101,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CosmeticMeshStorage")
 	int32 GetStoredMergedMeshCount() { return MergedMeshes.Num(); }
 
+	UFUNCTION(BlueprintCallable, Category = "CosmeticMeshStorage")
+	int32 GetCacheHitCount() const { return CacheHits; }
+
+	UFUNCTION(BlueprintCallable, Category = "CosmeticMeshStorage")
+	int32 GetCacheMissCount() const { return CacheMisses; }
+
+	// estimated size of all stored merged meshes
+	UFUNCTION(BlueprintCallable, Category = "CosmeticMeshStorage")
+	int64 GetStoredMergedMeshBytes() const { return StoredBytes; }
+
+	UFUNCTION(BlueprintCallable, Category = "CosmeticMeshStorage")
+	int32 GetPendingMergeCount() const { return PendingMerges.Num(); }
+
+protected:
+	USkeletalMesh* ProcessMerge(FCosmeticPendingMerge& Merge);
+
+	void RemoveMergedMeshAt(int32 Index);
+
+	void TrimToBudget(int32 KeepIndex);
+
 protected:
 	UPROPERTY()
 	TArray<FMergedMeshHandle> MergedMeshes;
-};
 
+	// parallel to MergedMeshes
+	TArray<FCosmeticMergedMeshKey> MergedMeshKeys;
+
+	// Key -> index in MergedMeshes
+	TMap<FCosmeticMergedMeshKey, int32> MergedMeshIndices;
+
+	UPROPERTY()
+	TArray<FCosmeticPendingMerge> PendingMerges;
+
+	int32 CacheHits = 0;
+
+	int32 CacheMisses = 0;
+
+	int64 StoredBytes = 0;
+};
@@ -298,6 +298,11 @@ public:
 	TObjectPtr<USkeletalMesh> MergedMesh = nullptr;
 
 	TSet<FCosmeticItemID> MeshPartIDs;
+
+	// estimated size of MergedMesh, counted against the storage memory budget
+	int64 ResourceSize = 0;
+
+	double LastUsedTime = 0.0;
 };
 
 /**
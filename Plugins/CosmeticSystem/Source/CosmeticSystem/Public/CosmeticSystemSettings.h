@@ -26,12 +26,20 @@ public:
 public:
 	// Prevent duplicate generation of the same merged mesh.
 	UPROPERTY(EditAnywhere, config, Category = "CosmeticSystem")
-	bool bUseMergedMeshStorage = false;
+	bool bUseMergedMeshStorage = true;
 
-	// If there are more stored numbers than CheckClearCount before adding a new merged mesh, remove all merged meshes in the Storage
+	// Mesh merges are queued and run at most this many per frame
+	UPROPERTY(EditAnywhere, config, Category = "CosmeticSystem", meta = (ClampMin = "1"))
+	int32 MaxMergesPerFrame = 1;
+
+	// If there are more stored merged meshes than CheckClearCount, remove the least recently used ones
 	UPROPERTY(EditAnywhere, config, Category = "CosmeticSystem|Storage")
 	bool bCheckClear = true;
 
 	UPROPERTY(EditAnywhere, config, Category = "CosmeticSystem|Storage")
 	int32 CheckClearCount = 50;
+
+	// If the stored merged meshes are bigger than this (estimated), remove the least recently used ones. 0 is no limit
+	UPROPERTY(EditAnywhere, config, Category = "CosmeticSystem|Storage", meta = (ClampMin = "0"))
+	int32 MaxStorageMemoryMB = 256;
 };
@@ -13,6 +13,13 @@
 #include "Algo/Reverse.h"
 
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonAimSolver Solves"), STAT_DragonAimSolver_Solves, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonAimSolver Cached Solves"), STAT_DragonAimSolver_CachedSolves, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonAimSolver Traces"), STAT_DragonAimSolver_Traces, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonAimSolver Reduced LOD"), STAT_DragonAimSolver_ReducedLOD, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonAimSolver Minimal LOD"), STAT_DragonAimSolver_MinimalLOD, STATGROUP_Anim);
+
+
 
 
 
@@ -328,7 +335,8 @@ void FAnimNode_DragonAimSolver::UpdateInternal(const FAnimationUpdateContext& Co
 	FVector TTS_Ref_Down = TTS_Ref_Pos;
 
 
-	if (Adaptive_Terrain_Tail)
+	// Lower IK LOD levels keep the last terrain hit for a few updates
+	if (Adaptive_Terrain_Tail && ShouldFireIKLODTraceThisFrame())
 		line_trace_func(owning_skel, TTS_Ref_Pos + FVector(0, 0, Trace_Up_Height) * component_scale, TTS_Ref_Down + FVector(0, 0, -Trace_Down_Height) * component_scale, TTS_Aim_Hit, FName(), FName(), TTS_Aim_Hit, FLinearColor::Blue, true);
 
 
@@ -372,6 +380,27 @@ void FAnimNode_DragonAimSolver::EvaluateComponentSpaceInternal(FComponentSpacePo
 
 
 
+void FAnimNode_DragonAimSolver::OnIKLODEvaluated(bool bFullSolve)
+{
+	if (bFullSolve)
+	{
+		INC_DWORD_STAT(STAT_DragonAimSolver_Solves);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_DragonAimSolver_CachedSolves);
+	}
+
+	if (IK_LOD_Level == EDragonIKLODLevel::Reduced)
+	{
+		INC_DWORD_STAT(STAT_DragonAimSolver_ReducedLOD);
+	}
+	else if (IK_LOD_Level == EDragonIKLODLevel::Minimal)
+	{
+		INC_DWORD_STAT(STAT_DragonAimSolver_MinimalLOD);
+	}
+}
+
 void FAnimNode_DragonAimSolver::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms)
 {
 	if (toggle_alpha > 0.01f)
@@ -1357,6 +1386,8 @@ void FAnimNode_DragonAimSolver::line_trace_func(USkeletalMeshComponent* skelmesh
 
 	if (owning_skel->GetOwner())
 	{
+		INC_DWORD_STAT(STAT_DragonAimSolver_Traces);
+
 		ignoreActors.Add(owning_skel->GetOwner());
 		UKismetSystemLibrary::LineTraceSingle(owning_skel->GetOwner(), startpoint, endpoint, Trace_Channel, true, ignoreActors, EDrawDebugTrace::None, RV_Ragdoll_Hit, true, debug_color);
 	}
@@ -8,6 +8,8 @@
 #include "AnimNode_DragonControlBase.h"
 
 #include "DragonIK_Library.h"
+#include "DragonIKTraceManagerComponent.h"
+#include "Animation/AnimInstance.h"
 #include "Animation/AnimInstanceProxy.h"
 #include "Engine/SkeletalMeshSocket.h"
 
@@ -79,6 +81,19 @@ void FAnimNode_DragonControlBase::Initialize_AnyThread(const FAnimationInitializ
 
 	AlphaBoolBlend.Reinitialize();
 	AlphaScaleBiasClamp.Reinitialize();
+
+	IK_LOD_Level = EDragonIKLODLevel::Full;
+	IK_LOD_Cache_Valid = false;
+}
+
+void FAnimNode_DragonControlBase::OnInitializeAnimInstance(const FAnimInstanceProxy* InProxy, const UAnimInstance* InAnimInstance)
+{
+	FAnimNode_Base::OnInitializeAnimInstance(InProxy, InAnimInstance);
+
+	// Runs on the game thread, component lookups are not safe from the worker thread update
+	const USkeletalMeshComponent* SkelMesh = InAnimInstance ? InAnimInstance->GetSkelMeshComponent() : nullptr;
+	const AActor* Owner = SkelMesh ? SkelMesh->GetOwner() : nullptr;
+	IK_LOD_Trace_Manager = Owner ? Owner->FindComponentByClass<UDragonIKTraceManagerComponent>() : nullptr;
 }
 
 void FAnimNode_DragonControlBase::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
@@ -87,6 +102,9 @@ void FAnimNode_DragonControlBase::CacheBones_AnyThread(const FAnimationCacheBone
 	FAnimNode_Base::CacheBones_AnyThread(Context);
 	InitializeBoneReferences(Context.AnimInstanceProxy->GetRequiredBones());
 	ComponentPose.CacheBones(Context);
+
+	// Compact bone indices of the cached solve are no longer valid
+	IK_LOD_Cache_Valid = false;
 }
 
 void FAnimNode_DragonControlBase::UpdateInternal(const FAnimationUpdateContext& Context)
@@ -135,13 +153,188 @@ void FAnimNode_DragonControlBase::Update_AnyThread(const FAnimationUpdateContext
 		
 		if (FAnimWeight::IsRelevant(ActualAlpha) && IsValidToEvaluate(Context.AnimInstanceProxy->GetSkeleton(), Context.AnimInstanceProxy->GetRequiredBones()))
 		{
+			UpdateIKLOD(Context);
+
 			UpdateInternal(Context);
 		}
 	}
 
 	if(ActualAlpha <= 0.01f)
+	{
 		Last_Alpha = 0;
 
+		// Don't reapply a stale solve when the node blends back in
+		IK_LOD_Cache_Valid = false;
+	}
+
+}
+
+bool FAnimNode_DragonControlBase::IsIKLODActive() const
+{
+	const FDragonIKLODSettings* Settings = GetIKLODSettings();
+	return Settings != nullptr && Settings->Enable_IK_LOD;
+}
+
+void FAnimNode_DragonControlBase::UpdateIKLOD(const FAnimationUpdateContext& Context)
+{
+	const FDragonIKLODSettings* Settings = GetIKLODSettings();
+
+	if (Settings == nullptr || !Settings->Enable_IK_LOD)
+	{
+		IK_LOD_Level = EDragonIKLODLevel::Full;
+		IK_LOD_Solve_This_Frame = true;
+		return;
+	}
+
+	IK_LOD_Delta_Time = Context.GetDeltaTime();
+
+	const USkeletalMeshComponent* SkelMesh = Context.AnimInstanceProxy->GetSkelMeshComponent();
+
+	float significance = Settings->Significance;
+	int32 update_rate = 1;
+	int32 mesh_lod = 0;
+
+	if (SkelMesh)
+	{
+		// The trace manager's budget scale doubles as the significance hook for characters that use one
+		if (const UDragonIKTraceManagerComponent* Trace_Manager = IK_LOD_Trace_Manager.Get())
+		{
+			significance = FMath::Min(significance, Trace_Manager->GetTraceBudgetScale());
+		}
+
+		if (SkelMesh->bEnableUpdateRateOptimizations && SkelMesh->AnimUpdateRateParams != nullptr)
+		{
+			update_rate = FMath::Max(1, SkelMesh->AnimUpdateRateParams->UpdateRate);
+		}
+
+		mesh_lod = SkelMesh->GetPredictedLODLevel();
+	}
+
+	if (significance <= Settings->Minimal_Significance || update_rate >= Settings->Minimal_Update_Rate || mesh_lod >= Settings->Minimal_Mesh_LOD)
+	{
+		IK_LOD_Level = EDragonIKLODLevel::Minimal;
+	}
+	else if (significance <= Settings->Reduced_Significance || update_rate >= Settings->Reduced_Update_Rate || mesh_lod >= Settings->Reduced_Mesh_LOD)
+	{
+		IK_LOD_Level = EDragonIKLODLevel::Reduced;
+	}
+	else
+	{
+		IK_LOD_Level = EDragonIKLODLevel::Full;
+	}
+
+	int32 solve_interval = 1;
+
+	if (IK_LOD_Level == EDragonIKLODLevel::Minimal)
+	{
+		solve_interval = FMath::Max(1, Settings->Minimal_Solve_Interval);
+	}
+	else if (IK_LOD_Level == EDragonIKLODLevel::Reduced)
+	{
+		solve_interval = FMath::Max(1, Settings->Reduced_Solve_Interval);
+	}
+
+	IK_LOD_Frame_Counter++;
+
+	IK_LOD_Solve_This_Frame = !IK_LOD_Cache_Valid || solve_interval <= 1 || (IK_LOD_Frame_Counter % solve_interval) == 0;
+}
+
+float FAnimNode_DragonControlBase::GetIKLODTraceIntervalMultiplier() const
+{
+	const FDragonIKLODSettings* Settings = GetIKLODSettings();
+
+	if (Settings == nullptr || !Settings->Enable_IK_LOD)
+	{
+		return 1.0f;
+	}
+
+	switch (IK_LOD_Level)
+	{
+	case EDragonIKLODLevel::Reduced:
+		return FMath::Max(1.0f, Settings->Reduced_Trace_Interval_Multiplier);
+	case EDragonIKLODLevel::Minimal:
+		return FMath::Max(1.0f, Settings->Minimal_Trace_Interval_Multiplier);
+	default:
+		return 1.0f;
+	}
+}
+
+int32 FAnimNode_DragonControlBase::GetIKLODIterations(int32 FullIterations) const
+{
+	const FDragonIKLODSettings* Settings = GetIKLODSettings();
+
+	if (Settings == nullptr || !Settings->Enable_IK_LOD || IK_LOD_Level == EDragonIKLODLevel::Full)
+	{
+		return FullIterations;
+	}
+
+	const float iteration_scale = (IK_LOD_Level == EDragonIKLODLevel::Minimal) ? Settings->Minimal_Iteration_Scale : Settings->Reduced_Iteration_Scale;
+
+	return FMath::Max(1, FMath::CeilToInt(FullIterations * iteration_scale));
+}
+
+bool FAnimNode_DragonControlBase::ShouldTraceFootForIKLOD(int32 FlatFootIndex) const
+{
+	const FDragonIKLODSettings* Settings = GetIKLODSettings();
+
+	if (Settings == nullptr || !Settings->Enable_IK_LOD || IK_LOD_Level != EDragonIKLODLevel::Minimal)
+	{
+		return true;
+	}
+
+	const int32 groups = FMath::Max(1, Settings->Minimal_Feet_Trace_Groups);
+
+	return (uint32)(FlatFootIndex % groups) == (IK_LOD_Trace_Phase % (uint32)groups);
+}
+
+bool FAnimNode_DragonControlBase::ShouldFireIKLODTraceThisFrame() const
+{
+	const int32 frame_interval = FMath::RoundToInt(GetIKLODTraceIntervalMultiplier());
+
+	return frame_interval <= 1 || (IK_LOD_Frame_Counter % (uint32)frame_interval) == 0;
+}
+
+void FAnimNode_DragonControlBase::ApplyCachedIKSolve(FComponentSpacePoseContext& Output)
+{
+	BoneTransforms.Reset(IK_LOD_Cached_Deltas.Num());
+
+	// Cached solve is stored relative to the animated pose so the skipped frames still follow the animation
+	for (const FBoneTransform& Cached_Delta : IK_LOD_Cached_Deltas)
+	{
+		BoneTransforms.Add(FBoneTransform(Cached_Delta.BoneIndex, Cached_Delta.Transform * Output.Pose.GetComponentSpaceTransform(Cached_Delta.BoneIndex)));
+	}
+}
+
+void FAnimNode_DragonControlBase::CacheIKSolve(FComponentSpacePoseContext& Output)
+{
+	const FDragonIKLODSettings* Settings = GetIKLODSettings();
+
+	const bool bBlendFromCache = IK_LOD_Cache_Valid && IK_LOD_Level != EDragonIKLODLevel::Full && Settings->Cached_Solve_Blend_Speed > 0 && IK_LOD_Cached_Deltas.Num() == BoneTransforms.Num();
+
+	const float blend_alpha = FMath::Clamp<float>(IK_LOD_Delta_Time * Settings->Cached_Solve_Blend_Speed, 0.f, 1.f);
+
+	IK_LOD_Cached_Deltas.SetNum(BoneTransforms.Num(), EAllowShrinking::No);
+
+	for (int32 i = 0; i < BoneTransforms.Num(); i++)
+	{
+		const FTransform Animated_Transform = Output.Pose.GetComponentSpaceTransform(BoneTransforms[i].BoneIndex);
+
+		FTransform Solve_Delta = BoneTransforms[i].Transform.GetRelativeTransform(Animated_Transform);
+
+		// Ease the fresh solve in over the one that was held during the skipped frames
+		if (bBlendFromCache && IK_LOD_Cached_Deltas[i].BoneIndex == BoneTransforms[i].BoneIndex)
+		{
+			FTransform Blended_Delta;
+			Blended_Delta.Blend(IK_LOD_Cached_Deltas[i].Transform, Solve_Delta, blend_alpha);
+			Solve_Delta = Blended_Delta;
+
+			BoneTransforms[i].Transform = Solve_Delta * Animated_Transform;
+		}
+
+		IK_LOD_Cached_Deltas[i] = FBoneTransform(BoneTransforms[i].BoneIndex, Solve_Delta);
+	}
+
+	IK_LOD_Cache_Valid = true;
 }
 
 bool FAnimNode_DragonControlBase::DragonContainsNaN(const TArray<FBoneTransform> & BoneTransforms_input)
@@ -190,21 +383,32 @@ void FAnimNode_DragonControlBase::EvaluateComponentSpace_AnyThread(FComponentSpa
 	if (FAnimWeight::IsRelevant(ActualAlpha) && IsValidToEvaluate(Output.AnimInstanceProxy->GetSkeleton(), Output.AnimInstanceProxy->GetRequiredBones()))
 	{
 
-		EvaluateComponentSpaceInternal(Output);
+		const bool bUseCachedSolve = IsIKLODActive() && !IK_LOD_Solve_This_Frame && IK_LOD_Cache_Valid;
 
-		//BoneTransforms.Reset(BoneTransforms.Num());
+		if (bUseCachedSolve)
+		{
+			ApplyCachedIKSolve(Output);
+		}
+		else
+		{
+			EvaluateComponentSpaceInternal(Output);
+
+			//BoneTransforms.Reset(BoneTransforms.Num());
 		
-		BoneTransforms.Reset(BoneTransforms.Num());
+			BoneTransforms.Reset(BoneTransforms.Num());
 
-		EvaluateSkeletalControl_AnyThread(Output, BoneTransforms);
+			EvaluateSkeletalControl_AnyThread(Output, BoneTransforms);
 
 
 
-		// A fix contributed by shadow, potentially improving global solver performance
-		Algo::Sort(BoneTransforms, [](const FBoneTransform& A, const FBoneTransform& B)
-			{
-				return A.BoneIndex < B.BoneIndex;
-			});
+			// A fix contributed by shadow, potentially improving global solver performance
+			Algo::Sort(BoneTransforms, [](const FBoneTransform& A, const FBoneTransform& B)
+				{
+					return A.BoneIndex < B.BoneIndex;
+				});
+		}
+
+		OnIKLODEvaluated(!bUseCachedSolve);
 
 		/*
 		bool is_swapped = false;
@@ -243,6 +447,11 @@ void FAnimNode_DragonControlBase::EvaluateComponentSpace_AnyThread(FComponentSpa
 
 
 
+		if (!bUseCachedSolve && IsIKLODActive() && !DragonContainsNaN(BoneTransforms))
+		{
+			CacheIKSolve(Output);
+		}
+
 		if (BoneTransforms.Num() > 0 && !DragonContainsNaN(BoneTransforms) && Output.Pose.GetPose().IsValid())
 		{
 			const float BlendWeight = FMath::Clamp<float>(ActualAlpha, 0.f, 1.f);
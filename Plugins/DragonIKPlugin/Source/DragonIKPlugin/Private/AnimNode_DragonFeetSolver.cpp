@@ -19,6 +19,11 @@
 
 
 DECLARE_CYCLE_STAT(TEXT("DragonFeetSolver Eval"), STAT_DragonFeetSolver_Eval, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonFeetSolver Solves"), STAT_DragonFeetSolver_Solves, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonFeetSolver Cached Solves"), STAT_DragonFeetSolver_CachedSolves, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonFeetSolver Traces"), STAT_DragonFeetSolver_Traces, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonFeetSolver Reduced LOD"), STAT_DragonFeetSolver_ReducedLOD, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonFeetSolver Minimal LOD"), STAT_DragonFeetSolver_MinimalLOD, STATGROUP_Anim);
 
 
 
@@ -913,6 +918,8 @@ void FAnimNode_DragonFeetSolver::UpdateInternal(const FAnimationUpdateContext& C
 		current_trace_interval *= Interval_Velocity_Curve.GetRichCurve()->Eval(Character_Speed);
 	}
 
+	current_trace_interval *= GetIKLODTraceIntervalMultiplier();
+
 
 	if (Use_Trace_Distance_Adapting)
 	{
@@ -1277,8 +1284,10 @@ void FAnimNode_DragonFeetSolver::UpdateInternal(const FAnimationUpdateContext& C
 							float end_const = FeetRootHeights[i][j] + (line_trace_down_height * Trace_Down_Multiplier_Curve.GetRichCurve()->Eval(Character_Speed) * scale_mode);
 
 
-							
+							// In minimal IK LOD only one group of feet is traced per trace tick, the rest keep their last hits
+							const bool lod_trace_this_foot = ShouldTraceFootForIKLOD(multi_to_single_index);
 
+							if (lod_trace_this_foot)
 							line_trace_func(owning_skel, offseted_linetrace_location + character_direction_vector * start_const,
 								offseted_linetrace_location - character_direction_vector * end_const,
 								//					offseted_linetrace_location,
@@ -1287,7 +1296,7 @@ void FAnimNode_DragonFeetSolver::UpdateInternal(const FAnimationUpdateContext& C
 								spine_hit_pairs[i].RV_Feet_Hits[j], FLinearColor::Blue, true, false);
 
 
-							if(Use_Four_Point_Feets)
+							if(Use_Four_Point_Feets && lod_trace_this_foot)
 							{
 								line_trace_func(owning_skel, Front_point_location + character_direction_vector * start_const,
 									Front_point_location - character_direction_vector * end_const,
@@ -1335,7 +1344,7 @@ void FAnimNode_DragonFeetSolver::UpdateInternal(const FAnimationUpdateContext& C
 
 							//	GEngine->AddOnScreenDebugMessage(-1, 0.01f, FColor::Red, " FeetRootHeights : " + FString::SanitizeFloat(FeetRootHeights[i][j]) );
 
-							if(Affect_Toes_Always)
+							if(Affect_Toes_Always && lod_trace_this_foot)
 							{
 								for (int32 k_finger = 0; k_finger < spine_Transform_pairs[i].Associated_Fingers[j].Num(); k_finger++)
 								{
@@ -1512,11 +1521,36 @@ void FAnimNode_DragonFeetSolver::UpdateInternal(const FAnimationUpdateContext& C
 
 
 	if (trace_timer_count > current_trace_interval && trace_distance_legal)
+	{
 		trace_timer_count = 0;
+
+		AdvanceIKLODTracePhase();
+	}
 }
 
 
 
+void FAnimNode_DragonFeetSolver::OnIKLODEvaluated(bool bFullSolve)
+{
+	if (bFullSolve)
+	{
+		INC_DWORD_STAT(STAT_DragonFeetSolver_Solves);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_DragonFeetSolver_CachedSolves);
+	}
+
+	if (IK_LOD_Level == EDragonIKLODLevel::Reduced)
+	{
+		INC_DWORD_STAT(STAT_DragonFeetSolver_ReducedLOD);
+	}
+	else if (IK_LOD_Level == EDragonIKLODLevel::Minimal)
+	{
+		INC_DWORD_STAT(STAT_DragonFeetSolver_MinimalLOD);
+	}
+}
+
 /*
 void FAnimNode_DragonFeetSolver::EvaluateBoneTransforms(USkeletalMeshComponent * SkelComp, FCSPose<FCompactPose>& MeshBases, TArray<FBoneTransform>& OutBoneTransforms)
 {
@@ -4841,6 +4875,8 @@ void FAnimNode_DragonFeetSolver::line_trace_func(USkeletalMeshComponent* skelmes
 	{
 		if (trace_timer_count > current_trace_interval && trace_distance_legal)
 		{
+			INC_DWORD_STAT(STAT_DragonFeetSolver_Traces);
+
 			ignoreActors.Add(owning_skel->GetOwner());
 
 			//float trace_radius_cs = owner_skel_w_transform.GetScale3D().Z*Trace_Radius;
@@ -13,6 +13,13 @@
 #include "Algo/Reverse.h"
 
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonSpineSolver Solves"), STAT_DragonSpineSolver_Solves, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonSpineSolver Cached Solves"), STAT_DragonSpineSolver_CachedSolves, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonSpineSolver Traces"), STAT_DragonSpineSolver_Traces, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonSpineSolver Reduced LOD"), STAT_DragonSpineSolver_ReducedLOD, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonSpineSolver Minimal LOD"), STAT_DragonSpineSolver_MinimalLOD, STATGROUP_Anim);
+
+
 
 
 
@@ -1067,6 +1074,8 @@ void FAnimNode_DragonSpineSolver::UpdateInternal(const FAnimationUpdateContext&
 		current_trace_interval *= Interval_Velocity_Curve.GetRichCurve()->Eval(Character_Speed);
 	}
 
+	current_trace_interval *= GetIKLODTraceIntervalMultiplier();
+
 
 
 	if (Use_Trace_Distance_Adapting)
@@ -1767,6 +1776,27 @@ FName FAnimNode_DragonSpineSolver::GetChildBone(FName BoneName, USkeletalMeshCom
 
 
 
+void FAnimNode_DragonSpineSolver::OnIKLODEvaluated(bool bFullSolve)
+{
+	if (bFullSolve)
+	{
+		INC_DWORD_STAT(STAT_DragonSpineSolver_Solves);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_DragonSpineSolver_CachedSolves);
+	}
+
+	if (IK_LOD_Level == EDragonIKLODLevel::Reduced)
+	{
+		INC_DWORD_STAT(STAT_DragonSpineSolver_ReducedLOD);
+	}
+	else if (IK_LOD_Level == EDragonIKLODLevel::Minimal)
+	{
+		INC_DWORD_STAT(STAT_DragonSpineSolver_MinimalLOD);
+	}
+}
+
 void FAnimNode_DragonSpineSolver::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms)
 {
 	//GEngine->AddOnScreenDebugMessage(-1, 0.01f, FColor::Red, " combined_indices : " + FString::SanitizeFloat( combined_indices.Num()) );
@@ -3382,6 +3412,8 @@ void FAnimNode_DragonSpineSolver::line_trace_func(USkeletalMeshComponent& skelme
 	//if (RV_Ragdoll_Hit.ImpactNormal.Equals(FVector::ZeroVector))
 	if (owning_skel->GetOwner() && (trace_timer_count > current_trace_interval && trace_distance_legal) && !startpoint.ContainsNaN() && !endpoint.ContainsNaN())
 	{
+		INC_DWORD_STAT(STAT_DragonSpineSolver_Traces);
+
 		ignoreActors.Add(owning_skel->GetOwner());
 
 
@@ -6046,7 +6078,7 @@ DragonSpineOutput FAnimNode_DragonSpineSolver::DragonSpineProcessor(FTransform&
 	output.NumChainLinks = NumChainLinks;
 
 
-	int customized_iterations = MaxIterations;
+	int customized_iterations = GetIKLODIterations(MaxIterations);
 
 	if (complexity_type == ESolverComplexityPluginEnum::VE_Simple)
 	{
@@ -6349,7 +6381,7 @@ DragonSpineOutput FAnimNode_DragonSpineSolver::DragonSpineProcessor_Direct(FTran
 
 	//	GEngine->AddOnScreenDebugMessage(-1, 0.025f, FColor::Red, " DIRECT ");
 
-	int customized_iterations = MaxIterations;
+	int customized_iterations = GetIKLODIterations(MaxIterations);
 
 	if (complexity_type == ESolverComplexityPluginEnum::VE_Simple || is_single_spine)
 	{
@@ -6623,7 +6655,7 @@ DragonSpineOutput FAnimNode_DragonSpineSolver::DragonSpineProcessor_Snake(FTrans
 
 
 
-	int customized_iterations = MaxIterations;
+	int customized_iterations = GetIKLODIterations(MaxIterations);
 	/*
 	if (complexity_type == ESolverComplexityPluginEnum::VE_Simple)
 	{
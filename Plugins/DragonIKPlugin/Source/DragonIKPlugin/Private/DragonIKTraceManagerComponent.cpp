@@ -4,7 +4,13 @@
 #include "DragonIKTraceManagerComponent.h"
 
 #include "DragonIK_Library.h"
-#include "Kismet/KismetSystemLibrary.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "DrawDebugHelpers.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("DragonIKTraceManager Tick"), STAT_DragonIKTraceManager_Tick, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonIKTraceManager Traces Submitted"), STAT_DragonIKTraceManager_Submitted, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DragonIKTraceManager Traces Deferred"), STAT_DragonIKTraceManager_Deferred, STATGROUP_Anim);
 
 // Sets default values for this component's properties
 UDragonIKTraceManagerComponent::UDragonIKTraceManagerComponent()
@@ -20,71 +26,84 @@ void UDragonIKTraceManagerComponent::IssueTraceInput(FDragonIKTraceMParams& Trac
 {
 	test_count++;
 	
-	if(hand_shaked)
+	if(hand_shaked && !TraceParams.TraceIdentifier.IsNone())
 	{
-		
-		if(!Solver_Markers.Contains(TraceParams.TraceIdentifier))
-			Solver_Markers.AddUnique(TraceParams.TraceIdentifier);
-	
-		TraceParams.allow = true;
-		
-		PendingTraces_SetValueOnKey(PendingTraces,TraceParams.TraceIdentifier,TraceParams);
+		FScopeLock Lock(&trace_slot_lock);
 
-		if(HitResultMap.Num() > 0)
-		{
-			if(Solver_Markers.Contains(TraceParams.TraceIdentifier) && HitResultMap.IsEmpty() == false && HitResultMap.Num() > 0 && !TraceParams.TraceIdentifier.IsEqual(""))
-			{
-				if(Hitmap_FindKeyExists(HitResultMap,TraceParams.TraceIdentifier) )
-				{
-					//TraceParams.hit_result = HitResultMap[TraceParams.TraceIdentifier];
-
-					TraceParams.hit_result = Hitmap_GetValueFromKey(HitResultMap,TraceParams.TraceIdentifier);
+		const int32 slot_index = FindOrAddTraceSlot(TraceParams);
+		FDragonIKTraceSlot& Slot = TraceSlots[slot_index];
 
-					//GEngine->AddOnScreenDebugMessage(-1, 0.01f, FColor::Red, " HitResultMap " + FString::SanitizeFloat(HitResultMap.Num()));
-				}
-			}
-		}
+		TraceParams.allow = true;
 
-		
+		Slot.Request = TraceParams;
+		Slot.BoneName = TraceParams.bone_text;
+		Slot.bRequested = true;
 
+		// Solvers always consume the result of the previous frame's batch
+		TraceParams.hit_result = Slot.LastResult;
+	}
+}
 
+int32 UDragonIKTraceManagerComponent::FindOrAddTraceSlot(const FDragonIKTraceMParams& TraceParams)
+{
+	if(const int32* existing_index = TraceSlotIndex.Find(TraceParams.TraceIdentifier))
+	{
+		return *existing_index;
+	}
 
-		
+	const int32 slot_index = TraceSlots.AddDefaulted();
+	FDragonIKTraceSlot& Slot = TraceSlots[slot_index];
+	Slot.TraceIdentifier = TraceParams.TraceIdentifier;
+	Slot.BoneName = TraceParams.bone_text;
 
+	// Resolve the solver type once here instead of parsing the identifier every tick
+	const FString identifier_string = TraceParams.TraceIdentifier.ToString();
+	if(identifier_string.StartsWith(TEXT("F"), ESearchCase::CaseSensitive))
+	{
+		Slot.SolverType = EDragonIKTraceSolverType::Foot;
+	}
+	else if(identifier_string.StartsWith(TEXT("S"), ESearchCase::CaseSensitive))
+	{
+		Slot.SolverType = EDragonIKTraceSolverType::Spine;
 	}
-}
 
+	TraceSlotIndex.Add(TraceParams.TraceIdentifier, slot_index);
+	Solver_Markers.Add(TraceParams.TraceIdentifier);
 
+	FDragonIKTraceKeyValuePair& hit_pair = HitResultMap.AddDefaulted_GetRef();
+	hit_pair.Key = TraceParams.TraceIdentifier;
+	hit_pair.BoneName = TraceParams.bone_text;
 
-bool UDragonIKTraceManagerComponent::Hitmap_FindKeyExists(TArray<FDragonIKTraceKeyValuePair> array, FName key)
+	return slot_index;
+}
+
+void UDragonIKTraceManagerComponent::SetTraceBudgetScale(float InScale)
 {
+	trace_budget_scale = FMath::Clamp(InScale, 0.0f, 1.0f);
+}
 
 
-	if(array.Num()>0)
+
+bool UDragonIKTraceManagerComponent::Hitmap_FindKeyExists(const TArray<FDragonIKTraceKeyValuePair>& array, FName key) const
+{
+	for (const FDragonIKTraceKeyValuePair& pair : array)
 	{
-		for (int i=0;i<array.Num();i++)
+		if(pair.Key == key)
 		{
-			if(array[i].Key == key)
-			{
-				return true;
-			}
+			return true;
 		}
 	}
 
 	return false;
 }
 
-FHitResult UDragonIKTraceManagerComponent::Hitmap_GetValueFromKey(TArray<FDragonIKTraceKeyValuePair> array, FName key)
+FHitResult UDragonIKTraceManagerComponent::Hitmap_GetValueFromKey(const TArray<FDragonIKTraceKeyValuePair>& array, FName key) const
 {
-
-	if(array.Num()>0)
+	for (const FDragonIKTraceKeyValuePair& pair : array)
 	{
-		for (int i=0;i<array.Num();i++)
+		if(pair.Key == key)
 		{
-			if(array[i].Key == key)
-			{
-				return array[i].hit_result;
-			}
+			return pair.hit_result;
 		}
 	}
 
@@ -92,226 +111,254 @@ FHitResult UDragonIKTraceManagerComponent::Hitmap_GetValueFromKey(TArray<FDragon
 }
 
 void UDragonIKTraceManagerComponent::Hitmap_SetValueOnKey(TArray<FDragonIKTraceKeyValuePair> &array, FName key,
-	FHitResult value,FName bone_input)
+	const FHitResult& value,FName bone_input)
 {
-
+	for (FDragonIKTraceKeyValuePair& pair : array)
 	{
-		bool key_found = false;
-		for (int i=0;i<array.Num();i++)
+		if(pair.Key == key)
 		{
-			if(array[i].Key == key)
-			{
-				array[i].hit_result = value;
-				key_found = true;
-				return;
-			}
-		}
-
-		if(key_found == false)
-		{
-			FDragonIKTraceKeyValuePair trace_value_pair = FDragonIKTraceKeyValuePair();
-			trace_value_pair.Key = key;
-			trace_value_pair.hit_result = value;
-			trace_value_pair.BoneName = bone_input;
-			
-			array.Add(trace_value_pair);
+			pair.hit_result = value;
+			return;
 		}
 	}
-/*	else
+
+	FDragonIKTraceKeyValuePair& trace_value_pair = array.AddDefaulted_GetRef();
+	trace_value_pair.Key = key;
+	trace_value_pair.hit_result = value;
+	trace_value_pair.BoneName = bone_input;
+}
+
+// Called when the game starts
+void UDragonIKTraceManagerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
 	{
-		array = TArray<FDragonIKTraceKeyValuePair>();
-	}*/
+		FScopeLock Lock(&trace_slot_lock);
+
+		Solver_Markers.Reset();
+		HitResultMap.Reset();
+		TraceSlots.Reset();
+		TraceSlotIndex.Reset();
+	}
+
+	query_params_owner.Reset();
+	
+	OnDragonikFootHitData.AddDynamic(this, &UDragonIKTraceManagerComponent::SpineSolverTraceData);
+	
+	// ...
 	
 }
 
-bool UDragonIKTraceManagerComponent::PendingTraces_FindKeyExists(TArray<FDragonIKTraceParamKeyValuePair> array, FName key)
+void UDragonIKTraceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if(array.Num()>0)
 	{
-		for (int i=0;i<array.Num();i++)
+		FScopeLock Lock(&trace_slot_lock);
+
+		// Outstanding async handles simply expire with the frame, there is nothing to cancel
+		for (FDragonIKTraceSlot& Slot : TraceSlots)
 		{
-			if(array[i].Key == key)
-			{
-				return true;
-			}
+			Slot.PendingHandle = FTraceHandle();
 		}
 	}
 
-	return false;
+	Super::EndPlay(EndPlayReason);
 }
 
-FDragonIKTraceMParams UDragonIKTraceManagerComponent::PendingTraces_GetValueFromKey(TArray<FDragonIKTraceParamKeyValuePair> array, FName key)
+const FCollisionQueryParams& UDragonIKTraceManagerComponent::GetQueryParams(bool bTraceComplex)
 {
-	if(array.Num()>0)
+	AActor* owner_actor = GetOwner();
+
+	if(query_params_owner.Get() != owner_actor)
 	{
-		for (int i=0;i<array.Num();i++)
+		query_params_owner = owner_actor;
+
+		query_params_complex = FCollisionQueryParams(SCENE_QUERY_STAT(DragonIKTraceManager), true, owner_actor);
+		query_params_simple = FCollisionQueryParams(SCENE_QUERY_STAT(DragonIKTraceManager), false, owner_actor);
+	}
+
+	return bTraceComplex ? query_params_complex : query_params_simple;
+}
+
+int32 UDragonIKTraceManagerComponent::ComputeTraceBudget(int32 NumRequested) const
+{
+	int32 budget = (Max_Traces_Per_Frame > 0) ? FMath::Min(Max_Traces_Per_Frame, NumRequested) : NumRequested;
+
+	float scale = trace_budget_scale;
+
+	if(bScale_Budget_By_Update_Rate)
+	{
+		if(const AActor* owner_actor = GetOwner())
 		{
-			if(array[i].Key == key)
+			if(const USkeletalMeshComponent* owner_mesh = owner_actor->FindComponentByClass<USkeletalMeshComponent>())
 			{
-				return array[i].trace_params;
+				if(owner_mesh->bEnableUpdateRateOptimizations && owner_mesh->AnimUpdateRateParams != nullptr)
+				{
+					const int32 update_rate = FMath::Max(1, owner_mesh->AnimUpdateRateParams->UpdateRate);
+					scale /= (float)update_rate;
+				}
 			}
 		}
 	}
 
-	return FDragonIKTraceMParams();
+	if(scale < 1.0f)
+	{
+		budget = FMath::CeilToInt(budget * scale);
+	}
+
+	// Always let at least one trace through so results never go completely stale
+	return FMath::Clamp(budget, FMath::Min(1, NumRequested), NumRequested);
 }
 
-void UDragonIKTraceManagerComponent::PendingTraces_SetValueOnKey(TArray<FDragonIKTraceParamKeyValuePair>& array, FName key,FDragonIKTraceMParams value)
+void UDragonIKTraceManagerComponent::GatherCompletedTraces(UWorld* World)
 {
+	for (int32 slot_index = 0; slot_index < TraceSlots.Num(); slot_index++)
 	{
-		bool key_found = false;
-		for (int i=0;i<array.Num();i++)
+		FDragonIKTraceSlot& Slot = TraceSlots[slot_index];
+
+		if(!Slot.PendingHandle.IsValid())
 		{
-			if(array[i].Key == key)
-			{
-				array[i].trace_params = value;
-				key_found = true;
-				return;
-			}
+			continue;
 		}
 
-		if(key_found == false)
+		FTraceDatum trace_datum;
+		if(World->QueryTraceData(Slot.PendingHandle, trace_datum))
 		{
-			FDragonIKTraceParamKeyValuePair trace_value_pair = FDragonIKTraceParamKeyValuePair();
-			trace_value_pair.Key = key;
-			trace_value_pair.trace_params = value;
-			
-			array.Add(trace_value_pair);
+			if(trace_datum.OutHits.Num() > 0)
+			{
+				Slot.LastResult = trace_datum.OutHits[0];
+			}
+			else
+			{
+				Slot.LastResult = FHitResult(trace_datum.Start, trace_datum.End);
+			}
+
+			HitResultMap[slot_index].hit_result = Slot.LastResult;
+			HitResultMap[slot_index].BoneName = Slot.BoneName;
 		}
+
+		Slot.PendingHandle = FTraceHandle();
 	}
 }
 
-// Called when the game starts
-void UDragonIKTraceManagerComponent::BeginPlay()
+void UDragonIKTraceManagerComponent::SubmitTraceBatch(UWorld* World)
 {
-	Super::BeginPlay();
-	
-	Solver_Markers = TArray<FName>();
+	requested_slots.Reset();
 
-	PendingTraces = TArray<FDragonIKTraceParamKeyValuePair>();
-	//PendingTraces.AddDefaulted(20);
-	HitResultMap = TArray<FDragonIKTraceKeyValuePair>();
-	HitResultMap.AddDefaulted(100);
-	
-	OnDragonikFootHitData.AddDynamic(this, &UDragonIKTraceManagerComponent::SpineSolverTraceData);
-	
-	// ...
-	
-}
+	for (int32 slot_index = 0; slot_index < TraceSlots.Num(); slot_index++)
+	{
+		if(TraceSlots[slot_index].bRequested && TraceSlots[slot_index].Request.allow)
+		{
+			requested_slots.Add(slot_index);
+		}
+	}
 
+	const int32 budget = ComputeTraceBudget(requested_slots.Num());
 
-// Called every frame
-void UDragonIKTraceManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if(budget < requested_slots.Num())
+	{
+		// Over budget, the slots that waited the longest go first
+		requested_slots.Sort([this](int32 A, int32 B)
+		{
+			return TraceSlots[A].LastSubmitFrame < TraceSlots[B].LastSubmitFrame;
+		});
+	}
 
-	const TArray<FName> Solver_Const_Markers = Solver_Markers;
+	submit_frame_counter++;
 
-	if(Solver_Const_Markers.Num() > 0 && hand_shaked && Is_Enabled)
+	for (int32 request_index = 0; request_index < budget; request_index++)
 	{
-		{
-			//for (FDragonIKTraceMParams TraceParams : PendingTraces)
-			for (int i=0;i<Solver_Const_Markers.Num();i++)
-			{
-				if(Solver_Const_Markers[i].IsValid())
-				{
+		FDragonIKTraceSlot& Slot = TraceSlots[requested_slots[request_index]];
+		const FDragonIKTraceMParams& current_param = Slot.Request;
 
-					FString solver_type = Solver_Const_Markers[i].ToString();
-					solver_type = solver_type.Mid(0,1);
+		const ECollisionChannel collision_channel = UEngineTypes::ConvertToCollisionChannel(current_param.ChannelInput);
+		const FCollisionQueryParams& query_params = GetQueryParams(current_param.trace_complex);
 
-					
-					FDragonIKTraceMParams current_param = PendingTraces_GetValueFromKey(PendingTraces,Solver_Const_Markers[i]);
-				
-					if (current_param.TraceType == EDragonIKTraceMType::LineTrace)
-					{
-						// Perform a line trace
-						FHitResult HitResult;
+		if(current_param.TraceType == EDragonIKTraceMType::SphereTrace)
+		{
+			Slot.PendingHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, current_param.StartLocation, current_param.EndLocation, FQuat::Identity, collision_channel, FCollisionShape::MakeSphere(current_param.SphereRadius), query_params);
+		}
+		else
+		{
+			Slot.PendingHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, current_param.StartLocation, current_param.EndLocation, collision_channel, query_params);
+		}
 
-						TArray<AActor*> actor_to_ignore;
-						
-						actor_to_ignore.Add(GetOwner());
+		Slot.bRequested = false;
+		Slot.LastSubmitFrame = submit_frame_counter;
 
-						if((solver_type=="F" && bShow_Foot_Trace_Lines_InGame) || (solver_type=="S" && bShow_Spine_Trace_Lines_InGame))
-						{
-							UKismetSystemLibrary::LineTraceSingle(GetWorld(),current_param.StartLocation,current_param.EndLocation,current_param.ChannelInput,current_param.trace_complex,actor_to_ignore,EDrawDebugTrace::ForOneFrame,HitResult,true);
-						}
-						else
-						{
-							UKismetSystemLibrary::LineTraceSingle(GetWorld(),current_param.StartLocation,current_param.EndLocation,current_param.ChannelInput,current_param.trace_complex,actor_to_ignore,EDrawDebugTrace::None,HitResult,true);
-						}
+		DrawSlotDebug(World, Slot);
+	}
 
-						//PendingTraces[Solver_Const_Markers[i]].hit_result = HitResult;
-						current_param.hit_result = HitResult;
-						PendingTraces_SetValueOnKey(PendingTraces,current_param.TraceIdentifier,current_param);
+	traces_submitted_last_frame = budget;
+	traces_deferred_last_frame = requested_slots.Num() - budget;
 
-						Hitmap_SetValueOnKey(HitResultMap,current_param.TraceIdentifier,HitResult,current_param.bone_text);
+	INC_DWORD_STAT_BY(STAT_DragonIKTraceManager_Submitted, traces_submitted_last_frame);
+	INC_DWORD_STAT_BY(STAT_DragonIKTraceManager_Deferred, traces_deferred_last_frame);
+}
 
+void UDragonIKTraceManagerComponent::DrawSlotDebug(UWorld* World, const FDragonIKTraceSlot& Slot) const
+{
+#if ENABLE_DRAW_DEBUG
+	const bool bShow = (Slot.SolverType == EDragonIKTraceSolverType::Foot && bShow_Foot_Trace_Lines_InGame) || (Slot.SolverType == EDragonIKTraceSolverType::Spine && bShow_Spine_Trace_Lines_InGame);
 
+	if(bShow)
+	{
+		const FDragonIKTraceMParams& current_param = Slot.Request;
 
-					
-					}
-					else if (current_param.TraceType == EDragonIKTraceMType::SphereTrace)
-					{
-						// Perform a sphere trace
-						FHitResult HitResult;
-						TArray<AActor*> actor_to_ignore;
+		// The matching result arrives next frame, the last completed hit is drawn alongside the new request
+		DrawDebugLine(World, current_param.StartLocation, current_param.EndLocation, Slot.LastResult.bBlockingHit ? FColor::Green : FColor::Red, false, -1.0f);
 
-						actor_to_ignore.Add(GetOwner());
+		if(current_param.TraceType == EDragonIKTraceMType::SphereTrace)
+		{
+			DrawDebugSphere(World, current_param.EndLocation, current_param.SphereRadius, 8, FColor::Red, false, -1.0f);
+		}
 
-						if((solver_type=="F" && bShow_Foot_Trace_Lines_InGame) || (solver_type=="S" && bShow_Spine_Trace_Lines_InGame))
-						{
-							UKismetSystemLibrary::SphereTraceSingle(GetWorld(),current_param.StartLocation,current_param.EndLocation,current_param.SphereRadius,current_param.ChannelInput,current_param.trace_complex,actor_to_ignore,EDrawDebugTrace::ForOneFrame,HitResult,true);
+		if(Slot.LastResult.bBlockingHit)
+		{
+			DrawDebugPoint(World, Slot.LastResult.ImpactPoint, 10.0f, FColor::Green, false, -1.0f);
+		}
+	}
+#endif
+}
 
-						}
-						else
-						{
-							UKismetSystemLibrary::SphereTraceSingle(GetWorld(),current_param.StartLocation,current_param.EndLocation,current_param.SphereRadius,current_param.ChannelInput,current_param.trace_complex,actor_to_ignore,EDrawDebugTrace::None,HitResult,true);
 
-						}
+// Called every frame
+void UDragonIKTraceManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SCOPE_CYCLE_COUNTER(STAT_DragonIKTraceManager_Tick);
 
+	UWorld* World = GetWorld();
 
-						
+	if(World == nullptr || !hand_shaked || !Is_Enabled)
+	{
+		return;
+	}
 
-						//FDragonIKTraceMParams current_param = PendingTraces_GetValueFromKey(PendingTraces,Solver_Const_Markers[i]);
-						//current_param.hit_result = Data.OutHits[0];
-						current_param.hit_result = HitResult;
-					
-						//PendingTraces[Solver_Const_Markers[i]].hit_result = HitResult;
-						PendingTraces_SetValueOnKey(PendingTraces,current_param.TraceIdentifier,current_param);
+	{
+		FScopeLock Lock(&trace_slot_lock);
 
-						Hitmap_SetValueOnKey(HitResultMap,current_param.TraceIdentifier,HitResult,current_param.bone_text);
-						
-					
-					}
+		if(TraceSlots.Num() == 0)
+		{
+			return;
+		}
 
-					
-					
-				}
-			}
+		GatherCompletedTraces(World);
 
-			TArray<FDragonIKTraceKeyValuePair> footsolver_hitdata = TArray<FDragonIKTraceKeyValuePair>();
+		footsolver_hitdata.Reset();
 
-			for(int j=0;j<Solver_Const_Markers.Num();j++)
+		for (int32 slot_index = 0; slot_index < TraceSlots.Num(); slot_index++)
+		{
+			if(TraceSlots[slot_index].SolverType == EDragonIKTraceSolverType::Foot)
 			{
-				if(Solver_Const_Markers[j].IsValid())
-				{
-					FString solver_type = Solver_Const_Markers[j].ToString();
-					solver_type = solver_type.Mid(0,1);
-
-					if(solver_type.Equals("F") && HitResultMap.Num() > j)
-					{
-						footsolver_hitdata.Add(HitResultMap[j]);
-					}
-				}
+				footsolver_hitdata.Add(HitResultMap[slot_index]);
 			}
-
-			//if(bShow_Spine_Trace_Lines_InGame)
-			OnDragonikFootHitData.Broadcast(footsolver_hitdata);
-			
 		}
+
+		SubmitTraceBatch(World);
 	}
 
-	
-	
+	//if(bShow_Spine_Trace_Lines_InGame)
+	OnDragonikFootHitData.Broadcast(footsolver_hitdata);
 }
-
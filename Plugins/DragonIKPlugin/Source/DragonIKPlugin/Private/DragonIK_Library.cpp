@@ -930,6 +930,7 @@ bool UDragonIK_Library::TraceSelectorFire(UDragonIKTraceManagerComponent* TraceC
 	trace_params.SphereRadius = trace_radius;
 	trace_params.is_line_type = is_line;
 	trace_params.bone_text = bone_text;
+	trace_params.trace_complex = bTraceComplex;
 
 	if(is_line)
 	  trace_params.TraceType = EDragonIKTraceMType::LineTrace;
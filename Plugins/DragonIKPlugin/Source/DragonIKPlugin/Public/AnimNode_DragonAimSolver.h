@@ -719,6 +719,13 @@ public:
 		float Trace_Down_Height = 250;
 
 
+	/*
+	* Significance driven LOD. Fires the terrain trace less often and reuses the previous solve between solve frames.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Performance, meta = (DisplayName = "IK LOD Settings"))
+		FDragonIKLODSettings IK_LOD_Settings;
+
+
 
 	FHitResult TTS_Aim_Hit;
 
@@ -1161,6 +1168,9 @@ public:
 	virtual void EvaluateComponentSpaceInternal(FComponentSpacePoseContext& Context) override;
 	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
 
+	virtual const FDragonIKLODSettings* GetIKLODSettings() const override { return &IK_LOD_Settings; }
+	virtual void OnIKLODEvaluated(bool bFullSolve) override;
+
 	// initialize any bone references you have
 	virtual void InitializeBoneReferences(FBoneContainer& RequiredBones) override;
 
@@ -298,6 +298,100 @@ struct DRAGONIKPLUGIN_API  FBoneDragonSocketTarget
 	}
 };
 
+class UDragonIKTraceManagerComponent;
+
+/*
+* Quality level picked every update by the IK LOD policy of the feet, spine and aim solvers.
+*/
+UENUM(BlueprintType)
+enum class EDragonIKLODLevel : uint8
+{
+	Full UMETA(DisplayName = "Full"),
+	Reduced UMETA(DisplayName = "Reduced"),
+	Minimal UMETA(DisplayName = "Minimal"),
+};
+
+
+/*
+* Significance driven IK LOD.
+* The level is picked from the bound significance (or the owner's trace manager budget scale), the skeletal mesh URO update rate and the predicted mesh LOD, whichever is lowest.
+* Lower levels fire traces less often, trace fewer feet per trace tick, run fewer solver iterations and reuse the previous solve on in-between frames.
+*/
+USTRUCT(BlueprintType)
+struct DRAGONIKPLUGIN_API FDragonIKLODSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Enable IK LOD ?"))
+		bool Enable_IK_LOD = false;
+
+	/*
+	* 0..1 significance of this character, bind it to the game's significance value. 1 is hero quality.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Significance", ClampMin = "0", ClampMax = "1", PinHiddenByDefault))
+		float Significance = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Reduced below significance", ClampMin = "0", ClampMax = "1"))
+		float Reduced_Significance = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal below significance", ClampMin = "0", ClampMax = "1"))
+		float Minimal_Significance = 0.2f;
+
+	/*
+	* Animation update rate (URO frame skip) from which the reduced / minimal levels are used.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Reduced from URO update rate", ClampMin = "1"))
+		int32 Reduced_Update_Rate = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal from URO update rate", ClampMin = "1"))
+		int32 Minimal_Update_Rate = 4;
+
+	/*
+	* Predicted skeletal mesh LOD from which the reduced / minimal levels are used.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Reduced from mesh LOD", ClampMin = "0"))
+		int32 Reduced_Mesh_LOD = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal from mesh LOD", ClampMin = "0"))
+		int32 Minimal_Mesh_LOD = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Reduced trace interval multiplier", ClampMin = "1"))
+		float Reduced_Trace_Interval_Multiplier = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal trace interval multiplier", ClampMin = "1"))
+		float Minimal_Trace_Interval_Multiplier = 4.0f;
+
+	/*
+	* In minimal level the feet are split into this many groups and only one group is traced per trace tick.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal feet trace groups", ClampMin = "1"))
+		int32 Minimal_Feet_Trace_Groups = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Reduced iteration scale", ClampMin = "0", ClampMax = "1"))
+		float Reduced_Iteration_Scale = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal iteration scale", ClampMin = "0", ClampMax = "1"))
+		float Minimal_Iteration_Scale = 0.2f;
+
+	/*
+	* The solve runs every N evaluations, the frames in between reuse the cached solve on top of the current animated pose.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Reduced solve every N frames", ClampMin = "1"))
+		int32 Reduced_Solve_Interval = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Minimal solve every N frames", ClampMin = "1"))
+		int32 Minimal_Solve_Interval = 3;
+
+	/*
+	* How fast a fresh solve blends in over the cached one after skipped frames. 0 snaps.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = IKLOD, meta = (DisplayName = "Cached solve blend speed", ClampMin = "0"))
+		float Cached_Solve_Blend_Speed = 20.0f;
+};
+
+
 USTRUCT(BlueprintInternalUseOnly)
 struct DRAGONIKPLUGIN_API FAnimNode_DragonControlBase : public FAnimNode_Base
 {
@@ -368,6 +462,8 @@ public:
 	// FAnimNode_Base interface
 	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
 	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)  override;
+	virtual bool NeedsOnInitializeAnimInstance() const override { return true; }
+	virtual void OnInitializeAnimInstance(const FAnimInstanceProxy* InProxy, const UAnimInstance* InAnimInstance) override;
 	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) final;
 	virtual void EvaluateComponentSpace_AnyThread(FComponentSpacePoseContext& Output) final;
 	virtual int32 GetLODThreshold() const override { return LODThreshold; }
@@ -397,10 +493,60 @@ protected:
 
 	/** Allow base to add info to the node debug output */
 	void AddDebugNodeData(FString& OutDebugData);
+
+	// IK LOD. Solvers that support it return their settings, everything else keeps the full quality path.
+	virtual const FDragonIKLODSettings* GetIKLODSettings() const { return nullptr; }
+
+	// Called once per evaluation with whether the solve ran or the cached solve was reused, used for the per solver stats
+	virtual void OnIKLODEvaluated(bool bFullSolve) {}
+
+	bool IsIKLODActive() const;
+
+	EDragonIKLODLevel GetIKLODLevel() const { return IK_LOD_Level; }
+
+	// Multiplier applied on top of the solver's own trace interval
+	float GetIKLODTraceIntervalMultiplier() const;
+
+	// Scales an iteration count down for the current level, never below one
+	int32 GetIKLODIterations(int32 FullIterations) const;
+
+	// Whether the foot with this flat index is traced on the current trace tick
+	bool ShouldTraceFootForIKLOD(int32 FlatFootIndex) const;
+
+	// Advances the foot group that gets traced, call once per trace tick
+	void AdvanceIKLODTracePhase() { IK_LOD_Trace_Phase++; }
+
+	// Frame based gate for solvers without their own trace interval
+	bool ShouldFireIKLODTraceThisFrame() const;
+
+	EDragonIKLODLevel IK_LOD_Level = EDragonIKLODLevel::Full;
+
 private:
 
+	void UpdateIKLOD(const FAnimationUpdateContext& Context);
+
+	void ApplyCachedIKSolve(FComponentSpacePoseContext& Output);
+
+	void CacheIKSolve(FComponentSpacePoseContext& Output);
+
 	// Resused bone transform array to avoid reallocating in skeletal controls
 	TArray<FBoneTransform> BoneTransforms;
+
+	// Solved transforms relative to the animated input pose, reapplied on frames where the solve is skipped
+	TArray<FBoneTransform> IK_LOD_Cached_Deltas;
+
+	bool IK_LOD_Cache_Valid = false;
+
+	bool IK_LOD_Solve_This_Frame = true;
+
+	uint32 IK_LOD_Frame_Counter = 0;
+
+	uint32 IK_LOD_Trace_Phase = 0;
+
+	float IK_LOD_Delta_Time = 0.0f;
+
+	// Resolved on the game thread in OnInitializeAnimInstance, only read during update
+	TWeakObjectPtr<UDragonIKTraceManagerComponent> IK_LOD_Trace_Manager;
 };
 
 
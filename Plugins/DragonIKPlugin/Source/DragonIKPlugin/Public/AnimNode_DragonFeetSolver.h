@@ -189,6 +189,13 @@ public:
 		FRuntimeFloatCurve Interval_Velocity_Curve;
 
 
+	/*
+	* Significance driven LOD. Scales the trace interval, traces only a group of feet per trace tick in minimal level and reuses the previous solve between solve frames.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TracePerformance, meta = (DisplayName = "IK LOD Settings"))
+		FDragonIKLODSettings IK_LOD_Settings;
+
+
 
 	/////////
 	/*
@@ -1053,6 +1060,9 @@ public:
 	virtual void EvaluateComponentSpaceInternal(FComponentSpacePoseContext& Context) override;
 	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
 
+	virtual const FDragonIKLODSettings* GetIKLODSettings() const override { return &IK_LOD_Settings; }
+	virtual void OnIKLODEvaluated(bool bFullSolve) override;
+
 
 	virtual void Evaluate_AnyThread(FPoseContext& Output);
 
@@ -301,6 +301,13 @@ public:
 		FRuntimeFloatCurve Interval_Velocity_Curve;
 
 
+	/*
+	* Significance driven LOD. Scales the trace interval and the FABRIK iterations, and reuses the previous solve between solve frames.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = TracePerformance, meta = (DisplayName = "IK LOD Settings"))
+		FDragonIKLODSettings IK_LOD_Settings;
+
+
 
 
 
@@ -1480,6 +1487,9 @@ protected:
 
 	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms) override;
 
+	virtual const FDragonIKLODSettings* GetIKLODSettings() const override { return &IK_LOD_Settings; }
+	virtual void OnIKLODEvaluated(bool bFullSolve) override;
+
 	void EvaluateSkeletalControl_Internal(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms);
 
 	void LineTraceControl_AnyThread(FComponentSpacePoseContext& Output, TArray<FBoneTransform>& OutBoneTransforms);
@@ -164,6 +164,40 @@ public:
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDragonIKFootSolverTraceData,const TArray<FDragonIKTraceKeyValuePair>&,hit_data_pair);
 
 
+// Which solver registered a trace, resolved once from the first character of the identifier ("F" feet, "S" spine)
+enum class EDragonIKTraceSolverType : uint8
+{
+	Other,
+	Foot,
+	Spine,
+};
+
+// One registered trace identifier. Slots are stable, so the index handed out at registration never changes.
+struct FDragonIKTraceSlot
+{
+	FName TraceIdentifier;
+
+	FName BoneName;
+
+	EDragonIKTraceSolverType SolverType = EDragonIKTraceSolverType::Other;
+
+	// Latest request written by the solver, consumed by the next component tick
+	FDragonIKTraceMParams Request;
+
+	// True when the solver asked for this trace since the last submission
+	bool bRequested = false;
+
+	// Async trace submitted last frame, queried at the start of the next tick
+	FTraceHandle PendingHandle;
+
+	// Frame counter of the last submission, used to pick the stalest slots first when over budget
+	uint64 LastSubmitFrame = 0;
+
+	// Result of the last completed trace, this is what the solvers read back
+	FHitResult LastResult;
+};
+
+
 UCLASS( ClassGroup=(DragonIK), meta=(DisplayName = "Dragonik Trace Manager",BlueprintSpawnableComponent) )
 class DRAGONIKPLUGIN_API UDragonIKTraceManagerComponent : public UActorComponent
 {
@@ -175,17 +209,13 @@ public:
 
 
 
-	//UPROPERTY(EditAnywhere,BlueprintReadWrite)
-	// bool use_async_trace_mode = true;
-
-
-
 	/*
 *
 * This is a new optional feature which centrally manages the trace firing logic, of the spine and foot solvers of your character's animation blueprint.
 * Enable "Use External Trace Management Component" boolean parameter in the dragonik foot solver and spine solver.
 * Using this could potentially improve editor stability and avoid certain rare niche crashes such as during multithreading.
 * This lets the spine and foot solvers to do it's calculations without the burden of firing traces from it's internal update thread.
+* Traces are submitted as one async batch per frame and the solvers consume the previous frame's results.
 * You also get access to the trace hit info from the "On Dragonik Foot Hit Data" callback event.
 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly,Category = DragonIKTraceManager, meta = (DisplayName = "HOVER MOUSE HERE FOR TIPS!", PinHiddenByDefault))
@@ -201,22 +231,51 @@ public:
 	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category = DragonIKTraceManager, meta = (DisplayName = "Show Foot Solver Traces"))
 	 bool bShow_Foot_Trace_Lines_InGame = false;
 
+	/*
+	* Maximum number of traces submitted per frame for this character (0 = unlimited).
+	* Traces over budget keep their previous result and are submitted on a later frame, stalest first.
+	*/
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category = DragonIKTraceManager, meta = (DisplayName = "Max Traces Per Frame", ClampMin = "0"))
+	 int32 Max_Traces_Per_Frame = 0;
+
+	/*
+	* Scales the trace budget down when the owner's skeletal mesh is running a reduced animation update rate (URO).
+	* A mesh updating every 3rd frame gets a third of the budget, never less than one trace per frame.
+	*/
+	UPROPERTY(EditAnywhere,BlueprintReadWrite,Category = DragonIKTraceManager, meta = (DisplayName = "Scale Budget By Update Rate"))
+	 bool bScale_Budget_By_Update_Rate = true;
+
 	int test_count = 0;
 
 	bool hand_shaked = false;
 
 	bool tick_busy = false;
 
-	TArray<FDragonIKTraceParamKeyValuePair> PendingTraces = TArray<FDragonIKTraceParamKeyValuePair>();
-
+	// Last completed result per slot, parallel to TraceSlots
 	TArray<FDragonIKTraceKeyValuePair> HitResultMap = TArray<FDragonIKTraceKeyValuePair>();
 
+	// Registered identifiers in slot order
 	TArray<FName> Solver_Markers;
 	
-	// Function to issue a trace input request
+	// Records a trace request for the next batch and writes the previous frame's result into TraceParams.hit_result
 	//UFUNCTION(BlueprintCallable, Category = "DragonIK Trace Input Issue")
 	 void IssueTraceInput(FDragonIKTraceMParams& TraceParams);
 
+	/*
+	* Significance hook for the owning game. 1 = full budget, 0.25 = a quarter of Max_Traces_Per_Frame (or of the registered traces if unlimited).
+	*/
+	UFUNCTION(BlueprintCallable, Category = DragonIKTraceManager)
+	void SetTraceBudgetScale(float InScale);
+
+	UFUNCTION(BlueprintPure, Category = DragonIKTraceManager)
+	float GetTraceBudgetScale() const { return trace_budget_scale; }
+
+	// Number of traces submitted in the last tick
+	int32 GetNumTracesSubmittedLastFrame() const { return traces_submitted_last_frame; }
+
+	// Number of requested traces that were deferred by the budget in the last tick
+	int32 GetNumTracesDeferredLastFrame() const { return traces_deferred_last_frame; }
+
 
 	UPROPERTY(BlueprintCallable, BlueprintAssignable)
 	FDragonIKFootSolverTraceData OnDragonikFootHitData;
@@ -226,28 +285,61 @@ public:
 
 	
 	
-	bool Hitmap_FindKeyExists(TArray<FDragonIKTraceKeyValuePair> array,FName key);
-	FHitResult Hitmap_GetValueFromKey(TArray<FDragonIKTraceKeyValuePair> array,FName key);
-	void Hitmap_SetValueOnKey(TArray<FDragonIKTraceKeyValuePair> &array,FName key,FHitResult value,FName bone_input);
-
-
-	bool PendingTraces_FindKeyExists(TArray<FDragonIKTraceParamKeyValuePair> array,FName key);
-	FDragonIKTraceMParams PendingTraces_GetValueFromKey(TArray<FDragonIKTraceParamKeyValuePair> array,FName key);
-	void PendingTraces_SetValueOnKey(TArray<FDragonIKTraceParamKeyValuePair> &array,FName key,FDragonIKTraceMParams value);
+	bool Hitmap_FindKeyExists(const TArray<FDragonIKTraceKeyValuePair>& array,FName key) const;
+	FHitResult Hitmap_GetValueFromKey(const TArray<FDragonIKTraceKeyValuePair>& array,FName key) const;
+	void Hitmap_SetValueOnKey(TArray<FDragonIKTraceKeyValuePair> &array,FName key,const FHitResult& value,FName bone_input);
 
 	
-	//TArray<bool> bWantsTrace;
-	//TArray<FTraceHandle> LastTraceHandle;
-//	TArray<FDragonIKTraceHandlerStruct> LastTraceHandle;
-	//FTraceDelegate TraceDelegate;
-	
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+private:
+
+	int32 FindOrAddTraceSlot(const FDragonIKTraceMParams& TraceParams);
+
+	// Reads back the async results submitted last frame
+	void GatherCompletedTraces(UWorld* World);
+
+	// Submits this frame's requests as one async batch, limited by the current budget
+	void SubmitTraceBatch(UWorld* World);
+
+	int32 ComputeTraceBudget(int32 NumRequested) const;
+
+	const FCollisionQueryParams& GetQueryParams(bool bTraceComplex);
+
+	void DrawSlotDebug(UWorld* World, const FDragonIKTraceSlot& Slot) const;
+
+	// Solvers may issue traces from worker threads during the anim update, the slot tables are guarded by this lock
+	mutable FCriticalSection trace_slot_lock;
+
+	TArray<FDragonIKTraceSlot> TraceSlots;
+
+	TMap<FName, int32> TraceSlotIndex;
+
+	// One set of query params per owner, shared by every trace in the batch
+	FCollisionQueryParams query_params_complex;
+	FCollisionQueryParams query_params_simple;
+	TWeakObjectPtr<AActor> query_params_owner;
+
+	// Reused every tick for the foot hit data broadcast
+	TArray<FDragonIKTraceKeyValuePair> footsolver_hitdata;
+
+	// Scratch list of requested slot indices, reused every tick
+	TArray<int32> requested_slots;
+
+	float trace_budget_scale = 1.0f;
+
+	uint64 submit_frame_counter = 0;
+
+	int32 traces_submitted_last_frame = 0;
+
+	int32 traces_deferred_last_frame = 0;
 		
 };
@@ -4,6 +4,7 @@
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
 #include "UObject/ScriptMacros.h"
 #include "UObject/Stack.h"
 
@@ -19,6 +20,31 @@ namespace UE
 		static FAutoConsoleVariableRef CVarShouldLogMessages(TEXT("GameplayMessageSubsystem.LogMessages"),
 			ShouldLogMessages,
 			TEXT("Should messages broadcast through the gameplay message subsystem be logged?"));
+
+		static int32 DeferBroadcasts = 0;
+		static FAutoConsoleVariableRef CVarDeferBroadcasts(TEXT("GameplayMessageSubsystem.DeferBroadcasts"),
+			DeferBroadcasts,
+			TEXT("If set, BroadcastMessage queues every message and delivers it at the end of the frame instead of immediately"));
+
+		static FAutoConsoleCommandWithWorld DumpStatsCommand(TEXT("GameplayMessageSubsystem.DumpStats"),
+			TEXT("Logs per-channel broadcast counters of the gameplay message subsystem"),
+			FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+			{
+				if (UGameplayMessageSubsystem* Router = World ? UGameInstance::GetSubsystem<UGameplayMessageSubsystem>(World->GetGameInstance()) : nullptr)
+				{
+					Router->LogChannelStats();
+				}
+			}));
+
+		static FAutoConsoleCommandWithWorld ResetStatsCommand(TEXT("GameplayMessageSubsystem.ResetStats"),
+			TEXT("Resets per-channel broadcast counters of the gameplay message subsystem"),
+			FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+			{
+				if (UGameplayMessageSubsystem* Router = World ? UGameInstance::GetSubsystem<UGameplayMessageSubsystem>(World->GetGameInstance()) : nullptr)
+				{
+					Router->ResetChannelStats();
+				}
+			}));
 	}
 }
 
@@ -55,14 +81,41 @@ bool UGameplayMessageSubsystem::HasInstance(const UObject* WorldContextObject)
 	return Router != nullptr;
 }
 
+void UGameplayMessageSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &ThisClass::HandleEndFrame);
+}
+
 void UGameplayMessageSubsystem::Deinitialize()
 {
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	QueuedMessages.Reset();
+	FlushingMessages.Reset();
+
+	PendingRegistrations.Reset();
+	ListsNeedingCompaction.Reset();
+	ResolvedChannels.Reset();
 	ListenerMap.Reset();
 
 	Super::Deinitialize();
 }
 
 void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes)
+{
+	if (UE::GameplayMessageSubsystem::DeferBroadcasts != 0)
+	{
+		QueueMessageInternal(Channel, StructType, MessageBytes);
+		return;
+	}
+
+	DeliverMessage(Channel, StructType, MessageBytes, /*bFromQueue=*/ false);
+}
+
+void UGameplayMessageSubsystem::DeliverMessage(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes, bool bFromQueue)
 {
 	// Log the message if enabled
 	if (UE::GameplayMessageSubsystem::ShouldLogMessages != 0)
@@ -78,46 +131,188 @@ void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, c
 
 		FString HumanReadableMessage;
 		StructType->ExportText(/*out*/ HumanReadableMessage, MessageBytes, /*Defaults=*/ nullptr, /*OwnerObject=*/ nullptr, PPF_None, /*ExportRootScope=*/ nullptr);
-		UE_LOG(LogGameplayMessageSubsystem, Log, TEXT("BroadcastMessage(%s, %s, %s)"), pContextString ? **pContextString : *GetPathNameSafe(this), *Channel.ToString(), *HumanReadableMessage);
+		UE_LOG(LogGameplayMessageSubsystem, Log, TEXT("BroadcastMessage(%s, %s, %s%s)"), pContextString ? **pContextString : *GetPathNameSafe(this), *Channel.ToString(), *HumanReadableMessage, bFromQueue ? TEXT(", queued") : TEXT(""));
 	}
 
-	// Broadcast the message
-	bool bOnInitialTag = true;
-	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	FResolvedChannel& Resolved = ResolveChannel(Channel);
+	++Resolved.Stats.NumBroadcasts;
+
+	// Copy the (small, inline) list of lists: callbacks may broadcast on new channels, which can reallocate ResolvedChannels
+	const TArray<FResolvedListenerList, TInlineAllocator<4>> Lists = Resolved.Lists;
+	int64 NumListenerCalls = 0;
+
+	// Listener arrays are not modified while BroadcastDepth is non-zero: removals are flagged and registrations are deferred
+	++BroadcastDepth;
+
+	for (const FResolvedListenerList& ResolvedList : Lists)
 	{
-		if (const FChannelListenerList* pList = ListenerMap.Find(Tag))
+		for (FGameplayMessageListenerData& Listener : ResolvedList.List->Listeners)
 		{
-			// Copy in case there are removals while handling callbacks
-			TArray<FGameplayMessageListenerData> ListenerArray(pList->Listeners);
+			if (Listener.bPendingRemoval)
+			{
+				continue;
+			}
 
-			for (const FGameplayMessageListenerData& Listener : ListenerArray)
+			if (ResolvedList.bExactMatch || (Listener.MatchType == EGameplayMessageMatch::PartialMatch))
 			{
-				if (bOnInitialTag || (Listener.MatchType == EGameplayMessageMatch::PartialMatch))
+				if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
+				{
+					UE_LOG(LogGameplayMessageSubsystem, Warning, TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"), *Channel.ToString());
+					Listener.bPendingRemoval = true;
+					MarkNeedsCompaction(*ResolvedList.List);
+					continue;
+				}
+
+				// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
+				if (!Listener.bHadValidType || StructType->IsChildOf(Listener.ListenerStructType.Get()))
+				{
+					Listener.ReceivedCallback(Channel, StructType, MessageBytes);
+					++NumListenerCalls;
+				}
+				else
 				{
-					if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
-					{
-						UE_LOG(LogGameplayMessageSubsystem, Warning, TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"), *Channel.ToString());
-						UnregisterListenerInternal(Channel, Listener.HandleID);
-						continue;
-					}
-
-					// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
-					if (!Listener.bHadValidType || StructType->IsChildOf(Listener.ListenerStructType.Get()))
-					{
-						Listener.ReceivedCallback(Channel, StructType, MessageBytes);
-					}
-					else
-					{
-						UE_LOG(LogGameplayMessageSubsystem, Error, TEXT("Struct type mismatch on channel %s (broadcast type %s, listener at %s was expecting type %s)"),
-							*Channel.ToString(),
-							*StructType->GetPathName(),
-							*Tag.ToString(),
-							*Listener.ListenerStructType->GetPathName());
-					}
+					UE_LOG(LogGameplayMessageSubsystem, Error, TEXT("Struct type mismatch on channel %s (broadcast type %s, listener was expecting type %s)"),
+						*Channel.ToString(),
+						*StructType->GetPathName(),
+						*Listener.ListenerStructType->GetPathName());
 				}
 			}
 		}
-		bOnInitialTag = false;
+	}
+
+	--BroadcastDepth;
+
+	// Look the channel up again, the reference above may have been invalidated by nested broadcasts
+	if (FResolvedChannel* ResolvedAfter = ResolvedChannels.Find(Channel))
+	{
+		ResolvedAfter->Stats.NumListenerCalls += NumListenerCalls;
+		if (bFromQueue)
+		{
+			++ResolvedAfter->Stats.NumQueued;
+		}
+	}
+
+	if (BroadcastDepth == 0)
+	{
+		ApplyDeferredListenerChanges();
+	}
+}
+
+UGameplayMessageSubsystem::FResolvedChannel& UGameplayMessageSubsystem::ResolveChannel(FGameplayTag Channel)
+{
+	FResolvedChannel& Resolved = ResolvedChannels.FindOrAdd(Channel);
+	if (Resolved.Generation != ListenerTopologyGeneration)
+	{
+		// Only done when a new channel is first broadcast on or after a listener list was created / destroyed
+		Resolved.Lists.Reset();
+		bool bOnInitialTag = true;
+		for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+		{
+			if (const TUniquePtr<FChannelListenerList>* pList = ListenerMap.Find(Tag))
+			{
+				FResolvedListenerList& Entry = Resolved.Lists.AddDefaulted_GetRef();
+				Entry.List = pList->Get();
+				Entry.bExactMatch = bOnInitialTag;
+			}
+			bOnInitialTag = false;
+		}
+		Resolved.Generation = ListenerTopologyGeneration;
+	}
+	return Resolved;
+}
+
+void UGameplayMessageSubsystem::QueueMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes)
+{
+	check(StructType);
+
+	FMessageQueue& Queue = QueuedMessages;
+	const int32 Offset = Align(Queue.Bytes.Num(), FMath::Max(StructType->GetMinAlignment(), 1));
+	Queue.Bytes.SetNumUninitialized(Offset + StructType->GetStructureSize(), EAllowShrinking::No);
+
+	void* Dest = Queue.Bytes.GetData() + Offset;
+	StructType->InitializeStruct(Dest);
+	StructType->CopyScriptStruct(Dest, MessageBytes);
+
+	FQueuedMessage& Message = Queue.Messages.AddDefaulted_GetRef();
+	Message.Channel = Channel;
+	Message.StructType = StructType;
+	Message.Offset = Offset;
+}
+
+void UGameplayMessageSubsystem::FlushQueuedMessages()
+{
+	// Re-entrant flushes (from a listener) would swap out the buffer being delivered
+	if (bFlushingQueue || QueuedMessages.Messages.Num() == 0)
+	{
+		return;
+	}
+
+	TGuardValue<bool> FlushGuard(bFlushingQueue, true);
+
+	// Swap buffers first: listeners may queue new messages while we deliver, those wait for the next flush
+	Swap(QueuedMessages, FlushingMessages);
+
+	for (const FQueuedMessage& Message : FlushingMessages.Messages)
+	{
+		DeliverMessage(Message.Channel, Message.StructType, FlushingMessages.Bytes.GetData() + Message.Offset, /*bFromQueue=*/ true);
+	}
+
+	FlushingMessages.Reset();
+}
+
+void UGameplayMessageSubsystem::HandleEndFrame()
+{
+	FlushQueuedMessages();
+}
+
+void UGameplayMessageSubsystem::FMessageQueue::Reset()
+{
+	for (const FQueuedMessage& Message : Messages)
+	{
+		Message.StructType->DestroyStruct(Bytes.GetData() + Message.Offset);
+	}
+
+	// Keep the allocations, the queue is refilled every frame
+	Messages.Reset();
+	Bytes.Reset();
+}
+
+TMap<FGameplayTag, FGameplayMessageChannelStats> UGameplayMessageSubsystem::GetChannelStats() const
+{
+	TMap<FGameplayTag, FGameplayMessageChannelStats> Result;
+	Result.Reserve(ResolvedChannels.Num());
+	for (const TPair<FGameplayTag, FResolvedChannel>& Pair : ResolvedChannels)
+	{
+		Result.Add(Pair.Key, Pair.Value.Stats);
+	}
+	return Result;
+}
+
+void UGameplayMessageSubsystem::ResetChannelStats()
+{
+	for (TPair<FGameplayTag, FResolvedChannel>& Pair : ResolvedChannels)
+	{
+		Pair.Value.Stats = FGameplayMessageChannelStats();
+	}
+}
+
+void UGameplayMessageSubsystem::LogChannelStats() const
+{
+	TArray<TPair<FGameplayTag, FGameplayMessageChannelStats>> SortedStats;
+	for (const TPair<FGameplayTag, FResolvedChannel>& Pair : ResolvedChannels)
+	{
+		SortedStats.Emplace(Pair.Key, Pair.Value.Stats);
+	}
+	SortedStats.Sort([](const TPair<FGameplayTag, FGameplayMessageChannelStats>& A, const TPair<FGameplayTag, FGameplayMessageChannelStats>& B)
+	{
+		return A.Value.NumBroadcasts > B.Value.NumBroadcasts;
+	});
+
+	UE_LOG(LogGameplayMessageSubsystem, Log, TEXT("Gameplay message channel stats (%d channels, %d queued):"), SortedStats.Num(), QueuedMessages.Messages.Num());
+	for (const TPair<FGameplayTag, FGameplayMessageChannelStats>& Pair : SortedStats)
+	{
+		UE_LOG(LogGameplayMessageSubsystem, Log, TEXT("  %s: %lld broadcasts (%lld queued), %lld listener calls"),
+			*Pair.Key.ToString(), Pair.Value.NumBroadcasts, Pair.Value.NumQueued, Pair.Value.NumListenerCalls);
 	}
 }
 
@@ -146,16 +341,36 @@ DEFINE_FUNCTION(UGameplayMessageSubsystem::execK2_BroadcastMessage)
 
 FGameplayMessageListenerHandle UGameplayMessageSubsystem::RegisterListenerInternal(FGameplayTag Channel, TFunction<void(FGameplayTag, const UScriptStruct*, const void*)>&& Callback, const UScriptStruct* StructType, EGameplayMessageMatch MatchType)
 {
-	FChannelListenerList& List = ListenerMap.FindOrAdd(Channel);
-
-	FGameplayMessageListenerData& Entry = List.Listeners.AddDefaulted_GetRef();
+	FGameplayMessageListenerData Entry;
 	Entry.ReceivedCallback = MoveTemp(Callback);
 	Entry.ListenerStructType = StructType;
 	Entry.bHadValidType = StructType != nullptr;
-	Entry.HandleID = ++List.HandleID;
+	Entry.HandleID = ++LastHandleID;
 	Entry.MatchType = MatchType;
 
-	return FGameplayMessageListenerHandle(this, Channel, Entry.HandleID);
+	const int32 HandleID = Entry.HandleID;
+	AddListener(Channel, MoveTemp(Entry));
+
+	return FGameplayMessageListenerHandle(this, Channel, HandleID);
+}
+
+void UGameplayMessageSubsystem::AddListener(FGameplayTag Channel, FGameplayMessageListenerData&& Entry)
+{
+	if (BroadcastDepth > 0)
+	{
+		// Don't grow a listener array that may be iterated further up the stack
+		PendingRegistrations.Emplace(Channel, MoveTemp(Entry));
+		return;
+	}
+
+	TUniquePtr<FChannelListenerList>& List = ListenerMap.FindOrAdd(Channel);
+	if (!List.IsValid())
+	{
+		List = MakeUnique<FChannelListenerList>();
+		++ListenerTopologyGeneration;
+	}
+
+	List->Listeners.Add(MoveTemp(Entry));
 }
 
 void UGameplayMessageSubsystem::UnregisterListener(FGameplayMessageListenerHandle Handle)
@@ -174,18 +389,62 @@ void UGameplayMessageSubsystem::UnregisterListener(FGameplayMessageListenerHandl
 
 void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID)
 {
-	if (FChannelListenerList* pList = ListenerMap.Find(Channel))
+	// Registered and unregistered within the same broadcast
+	const int32 PendingIndex = PendingRegistrations.IndexOfByPredicate([ID = HandleID](const TPair<FGameplayTag, FGameplayMessageListenerData>& Pending) { return Pending.Value.HandleID == ID; });
+	if (PendingIndex != INDEX_NONE)
+	{
+		PendingRegistrations.RemoveAt(PendingIndex);
+		return;
+	}
+
+	if (TUniquePtr<FChannelListenerList>* pList = ListenerMap.Find(Channel))
 	{
-		int32 MatchIndex = pList->Listeners.IndexOfByPredicate([ID = HandleID](const FGameplayMessageListenerData& Other) { return Other.HandleID == ID; });
+		FChannelListenerList& List = **pList;
+		int32 MatchIndex = List.Listeners.IndexOfByPredicate([ID = HandleID](const FGameplayMessageListenerData& Other) { return Other.HandleID == ID; });
 		if (MatchIndex != INDEX_NONE)
 		{
-			pList->Listeners.RemoveAtSwap(MatchIndex);
+			if (BroadcastDepth > 0)
+			{
+				// The array may be iterated (or this very callback may be running), remove it afterwards
+				List.Listeners[MatchIndex].bPendingRemoval = true;
+				MarkNeedsCompaction(List);
+			}
+			else
+			{
+				List.Listeners.RemoveAtSwap(MatchIndex);
+			}
 		}
+	}
+}
+
+void UGameplayMessageSubsystem::MarkNeedsCompaction(FChannelListenerList& List)
+{
+	if (!List.bNeedsCompaction)
+	{
+		List.bNeedsCompaction = true;
+		ListsNeedingCompaction.Add(&List);
+	}
+}
 
-		if (pList->Listeners.Num() == 0)
+void UGameplayMessageSubsystem::ApplyDeferredListenerChanges()
+{
+	check(BroadcastDepth == 0);
+
+	for (FChannelListenerList* List : ListsNeedingCompaction)
+	{
+		List->Listeners.RemoveAllSwap([](const FGameplayMessageListenerData& Listener) { return Listener.bPendingRemoval; }, EAllowShrinking::No);
+		List->bNeedsCompaction = false;
+	}
+	ListsNeedingCompaction.Reset();
+
+	if (PendingRegistrations.Num() > 0)
+	{
+		TArray<TPair<FGameplayTag, FGameplayMessageListenerData>> Registrations = MoveTemp(PendingRegistrations);
+		PendingRegistrations.Reset();
+
+		for (TPair<FGameplayTag, FGameplayMessageListenerData>& Registration : Registrations)
 		{
-			ListenerMap.Remove(Channel);
+			AddListener(Registration.Key, MoveTemp(Registration.Value));
 		}
 	}
 }
-
@@ -68,6 +68,24 @@ struct FGameplayMessageListenerData
 	// Adding some logging and extra variables around some potential problems with this
 	TWeakObjectPtr<const UScriptStruct> ListenerStructType = nullptr;
 	bool bHadValidType = false;
+
+	// Set when unregistered during a broadcast, the entry is removed once the outermost broadcast finishes
+	bool bPendingRemoval = false;
+};
+
+/**
+ * Counters for a single broadcast channel
+ */
+struct FGameplayMessageChannelStats
+{
+	// Messages delivered on this channel (immediately or from the queue)
+	int64 NumBroadcasts = 0;
+
+	// Messages that went through the frame-end queue
+	int64 NumQueued = 0;
+
+	// Listener callbacks invoked for messages on this channel
+	int64 NumListenerCalls = 0;
 };
 
 /**
@@ -104,6 +122,7 @@ public:
 	static UE_API bool HasInstance(const UObject* WorldContextObject);
 
 	//~USubsystem interface
+	UE_API virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	UE_API virtual void Deinitialize() override;
 	//~End of USubsystem interface
 
@@ -120,6 +139,31 @@ public:
 		BroadcastMessageInternal(Channel, StructType, &Message);
 	}
 
+	/**
+	 * Queue a message on the specified channel, it is delivered to listeners at the end of the frame
+	 * Use for high frequency messages whose listeners do not need to react within the same call stack.
+	 * The message is copied; messages queued while the queue is being flushed are delivered next frame.
+	 *
+	 * @param Channel			The message channel to broadcast on
+	 * @param Message			The message to send (must be the same type of UScriptStruct expected by the listeners for this channel, otherwise an error will be logged)
+	 */
+	template <typename FMessageStructType>
+	void QueueMessage(FGameplayTag Channel, const FMessageStructType& Message)
+	{
+		const UScriptStruct* StructType = TBaseStructure<FMessageStructType>::Get();
+		QueueMessageInternal(Channel, StructType, &Message);
+	}
+
+	/** Deliver all queued messages now (called automatically at the end of every frame) */
+	UE_API void FlushQueuedMessages();
+
+	/** @return counters for every channel that has been broadcast on */
+	UE_API TMap<FGameplayTag, FGameplayMessageChannelStats> GetChannelStats() const;
+
+	UE_API void ResetChannelStats();
+
+	UE_API void LogChannelStats() const;
+
 	/**
 	 * Register to receive messages on a specified channel
 	 *
@@ -213,9 +257,17 @@ protected:
 	DECLARE_FUNCTION(execK2_BroadcastMessage);
 
 private:
-	// Internal helper for broadcasting a message
+	// Internal helper for broadcasting a message, defers to the queue if GameplayMessageSubsystem.DeferBroadcasts is set
 	UE_API void BroadcastMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes);
 
+	// Deliver a message to the listeners of the channel and its ancestors
+	UE_API void DeliverMessage(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes, bool bFromQueue);
+
+	// Internal helper for queueing a message until the end of the frame
+	UE_API void QueueMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes);
+
+	void HandleEndFrame();
+
 	// Internal helper for registering a message listener
 	UE_API FGameplayMessageListenerHandle RegisterListenerInternal(
 		FGameplayTag Channel, 
@@ -225,16 +277,87 @@ private:
 
 	UE_API void UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID);
 
+	// Adds a listener to its channel list, or defers it while a broadcast is running
+	void AddListener(FGameplayTag Channel, FGameplayMessageListenerData&& Entry);
+
+	// Removes entries flagged bPendingRemoval and applies registrations made during broadcasts
+	void ApplyDeferredListenerChanges();
+
+	struct FChannelListenerList;
+	void MarkNeedsCompaction(FChannelListenerList& List);
+
+	struct FResolvedChannel;
+
+	// Returns the precomputed (ancestor, listener list) chain for a broadcast channel
+	FResolvedChannel& ResolveChannel(FGameplayTag Channel);
+
 private:
 	// List of all entries for a given channel
+	// Lists are heap allocated so resolved channels can point at them, and are kept (possibly empty) until Deinitialize,
+	// so adding or removing a listener only invalidates resolved channels the first time a tag gets a list
 	struct FChannelListenerList
 	{
 		TArray<FGameplayMessageListenerData> Listeners;
-		int32 HandleID = 0;
+		bool bNeedsCompaction = false;
+	};
+
+	// A listener list reached from a broadcast channel; bExactMatch is set for the channel's own list
+	struct FResolvedListenerList
+	{
+		FChannelListenerList* List = nullptr;
+		bool bExactMatch = false;
+	};
+
+	// Broadcast channel -> every listener list on the channel and its ancestors, rebuilt when ListenerTopologyGeneration changes
+	struct FResolvedChannel
+	{
+		TArray<FResolvedListenerList, TInlineAllocator<4>> Lists;
+		uint32 Generation = 0;
+		FGameplayMessageChannelStats Stats;
+	};
+
+	// A message waiting for the frame-end flush; its bytes live in the queue's byte buffer
+	struct FQueuedMessage
+	{
+		FGameplayTag Channel;
+		const UScriptStruct* StructType = nullptr;
+		int32 Offset = 0;
+	};
+
+	struct FMessageQueue
+	{
+		TArray<FQueuedMessage> Messages;
+		TArray<uint8, TAlignedHeapAllocator<16>> Bytes;
+
+		void Reset();
 	};
 
 private:
-	TMap<FGameplayTag, FChannelListenerList> ListenerMap;
+	TMap<FGameplayTag, TUniquePtr<FChannelListenerList>> ListenerMap;
+
+	TMap<FGameplayTag, FResolvedChannel> ResolvedChannels;
+
+	// Bumped whenever a listener list is created or destroyed
+	uint32 ListenerTopologyGeneration = 1;
+
+	// Number of broadcasts currently on the stack, listener arrays are not modified while this is non-zero
+	int32 BroadcastDepth = 0;
+
+	// Registrations made from inside a listener callback, applied when the outermost broadcast finishes
+	TArray<TPair<FGameplayTag, FGameplayMessageListenerData>> PendingRegistrations;
+
+	// Lists with listeners flagged bPendingRemoval
+	TArray<FChannelListenerList*> ListsNeedingCompaction;
+
+	// Handle IDs are unique across all channels
+	int32 LastHandleID = 0;
+
+	// Double buffered so messages queued during a flush go to the next frame
+	FMessageQueue QueuedMessages;
+	FMessageQueue FlushingMessages;
+	bool bFlushingQueue = false;
+
+	FDelegateHandle EndFrameHandle;
 };
 
 #undef UE_API
@@ -55,6 +55,15 @@ void UGoreSkeletalMeshComponent::TickComponent(float DeltaTime, ELevelTick TickT
 	}
 }
 
+void UGoreSkeletalMeshComponent::ResetGoreState()
+{
+	NewRootBone = NAME_None;
+	StretchFixEnabled = false;
+	InitialVisibilityFired = false;
+	DetachImpulse = FVector::ZeroVector;
+	On_DetachPhysicsEnabled.Clear();
+}
+
 void UGoreSkeletalMeshComponent::HideBoneByNameGore(const FName BoneName, const EPhysBodyOp PhysBodyOption, const bool bAvoidChildren)
 {
 	// Find appropriate BoneIndex
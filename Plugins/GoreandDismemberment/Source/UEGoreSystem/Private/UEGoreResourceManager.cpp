@@ -0,0 +1,486 @@
+// Copyright 2019-2023 Henry Galimberti. All Rights Reserved.
+
+#include "UEGoreResourceManager.h"
+#include "UEGoreSystemComponent.h"
+#include "GoreSkeletalMeshComponent.h"
+#include "UEGoreSystem.h"
+#include "Engine/DecalActor.h"
+#include "Engine/Engine.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "Animation/AnimInstance.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Gore Resource Manager Tick"), STAT_UEGoreResourceManagerTick, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gore Decals Recycled"), STAT_UEGoreDecalsRecycled, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gore Limbs Recycled"), STAT_UEGoreLimbsRecycled, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gore Physics Asset Clones"), STAT_UEGorePhysicsAssetClones, STATGROUP_Game);
+
+UUEGoreResourceManager* UUEGoreResourceManager::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UUEGoreResourceManager>() : nullptr;
+}
+
+bool UUEGoreResourceManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE || WorldType == EWorldType::GamePreview || WorldType == EWorldType::EditorPreview;
+}
+
+void UUEGoreResourceManager::Deinitialize()
+{
+	PendingDecals.Empty();
+	ActiveDecals.Empty();
+	DecalPools.Empty();
+	ActiveLimbs.Empty();
+	LimbPools.Empty();
+	ActiveFX.Empty();
+	PhysicsAssetVariants.Empty();
+	PhysicsAssetVariantObjects.Empty();
+	PoolActor = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UUEGoreResourceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUEGoreResourceManager, STATGROUP_Tickables);
+}
+
+void UUEGoreResourceManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UEGoreResourceManagerTick);
+
+	HitFXThisFrame = 0;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	if (ActiveDecals.Num() > 0) {
+		ExpireDecals(Now);
+	}
+
+	if (PendingDecals.Num() > 0) {
+		FlushPendingDecals(Now);
+	}
+
+	if (ActiveFX.Num() > 0) {
+		PruneAttachedFX();
+	}
+}
+
+// Decals
+void UUEGoreResourceManager::RequestDecal(UUEGoreSystemComponent* Instigator, const TSubclassOf<ADecalActor> DecalClass, const FTransform& DecalTransform, const float Lifespan, const float Delay)
+{
+	if (!DecalClass || MaxDecals <= 0)
+		return;
+
+	FUEGorePendingDecal& Request = PendingDecals.AddDefaulted_GetRef();
+	Request.DecalClass = DecalClass;
+	Request.Transform = DecalTransform;
+	Request.Lifespan = Lifespan;
+	Request.SpawnTime = GetWorld()->GetTimeSeconds() + FMath::Max(Delay, 0.0f);
+	Request.Instigator = Instigator;
+}
+
+void UUEGoreResourceManager::FlushPendingDecals(const double Now)
+{
+	// Decals spawned in this batch, used to drop requests landing on top of each other (shotgun hits, hordes)
+	TArray<TPair<UClass*, FVector>, TInlineAllocator<16>> BatchLocations;
+	const float MergeDistanceSq = FMath::Square(DecalMergeDistance);
+
+	int32 Spawned = 0;
+	int32 WriteIndex = 0;
+
+	for (int32 ReadIndex = 0; ReadIndex < PendingDecals.Num(); ReadIndex++) {
+		FUEGorePendingDecal& Request = PendingDecals[ReadIndex];
+
+		// Not due yet or over this frame's budget, keep it for a later tick
+		if (Request.SpawnTime > Now || Spawned >= MaxDecalSpawnsPerFrame) {
+			if (WriteIndex != ReadIndex) {
+				PendingDecals[WriteIndex] = MoveTemp(Request);
+			}
+			WriteIndex++;
+			continue;
+		}
+
+		const FVector Location = Request.Transform.GetLocation();
+		const bool bMerged = BatchLocations.ContainsByPredicate([&](const TPair<UClass*, FVector>& Other) {
+			return Other.Key == Request.DecalClass.Get() && FVector::DistSquared(Other.Value, Location) <= MergeDistanceSq;
+			});
+
+		if (bMerged)
+			continue;
+
+		// Budget reached, recycle the oldest visible decal
+		if (ActiveDecals.Num() >= MaxDecals) {
+			ReleaseDecalAt(0);
+			INC_DWORD_STAT(STAT_UEGoreDecalsRecycled);
+		}
+
+		ADecalActor* DecalAct = AcquireDecal(Request.DecalClass);
+		if (!DecalAct)
+			continue;
+
+		DecalAct->SetActorTransform(Request.Transform);
+		DecalAct->AddActorLocalRotation(FQuat(FRotator(0.0f, 0.0f, FMath::FRandRange(0.0f, 360.0f))));
+		DecalAct->SetActorHiddenInGame(false);
+
+		FUEGoreActiveDecal& Active = ActiveDecals.AddDefaulted_GetRef();
+		Active.Decal = DecalAct;
+		Active.Instigator = Request.Instigator;
+		Active.ExpireTime = Request.Lifespan > 0.0f ? Now + Request.Lifespan : TNumericLimits<double>::Max();
+
+		BatchLocations.Emplace(Request.DecalClass.Get(), Location);
+		Spawned++;
+	}
+
+	PendingDecals.SetNum(WriteIndex, EAllowShrinking::No);
+}
+
+void UUEGoreResourceManager::ExpireDecals(const double Now)
+{
+	for (int32 Idx = ActiveDecals.Num() - 1; Idx >= 0; Idx--) {
+		if (ActiveDecals[Idx].ExpireTime <= Now || !IsValid(ActiveDecals[Idx].Decal)) {
+			ReleaseDecalAt(Idx);
+		}
+	}
+}
+
+ADecalActor* UUEGoreResourceManager::AcquireDecal(const TSubclassOf<ADecalActor> DecalClass)
+{
+	FUEGoreDecalPool& Pool = DecalPools.FindOrAdd(DecalClass.Get());
+
+	while (Pool.FreeDecals.Num() > 0) {
+		ADecalActor* DecalAct = Pool.FreeDecals.Pop(EAllowShrinking::No);
+		if (IsValid(DecalAct)) {
+			return DecalAct;
+		}
+	}
+
+	FActorSpawnParameters Params;
+	Params.bNoFail = true;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags |= RF_Transient;
+
+	return GetWorld()->SpawnActor<ADecalActor>(DecalClass, FTransform::Identity, Params);
+}
+
+void UUEGoreResourceManager::ReleaseDecalAt(const int32 ActiveIndex)
+{
+	ADecalActor* DecalAct = ActiveDecals[ActiveIndex].Decal;
+	ActiveDecals.RemoveAt(ActiveIndex, 1, EAllowShrinking::No);
+
+	if (IsValid(DecalAct)) {
+		DecalAct->SetActorHiddenInGame(true);
+		DecalPools.FindOrAdd(DecalAct->GetClass()).FreeDecals.Add(DecalAct);
+	}
+}
+
+void UUEGoreResourceManager::ReleaseDecalsOwnedBy(UUEGoreSystemComponent* Owner)
+{
+	for (int32 Idx = ActiveDecals.Num() - 1; Idx >= 0; Idx--) {
+		if (ActiveDecals[Idx].Instigator == Owner) {
+			ReleaseDecalAt(Idx);
+		}
+	}
+
+	PendingDecals.RemoveAll([Owner](const FUEGorePendingDecal& Request) { return Request.Instigator == Owner; });
+}
+
+// FX
+bool UUEGoreResourceManager::TryConsumeHitFXBudget()
+{
+	if (HitFXThisFrame >= MaxHitFXPerFrame)
+		return false;
+
+	HitFXThisFrame++;
+	return true;
+}
+
+UNiagaraComponent* UUEGoreResourceManager::SpawnAttachedFX(UUEGoreSystemComponent* Owner, UNiagaraSystem* System, USceneComponent* AttachTo, const FName AttachPointName, const FVector& Location, const FRotator& Rotation)
+{
+	if (!System || !AttachTo || MaxAttachedFX <= 0)
+		return nullptr;
+
+	UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(System, AttachTo, AttachPointName, Location, Rotation, EAttachLocation::KeepWorldPosition, false, true, ENCPoolMethod::ManualRelease);
+
+	if (NiagaraComp) {
+		RegisterAttachedFX(Owner, NiagaraComp);
+	}
+
+	return NiagaraComp;
+}
+
+void UUEGoreResourceManager::RegisterAttachedFX(UUEGoreSystemComponent* Owner, UFXSystemComponent* Component)
+{
+	if (!Component)
+		return;
+
+	// Budget reached, stop the oldest spill
+	while (ActiveFX.Num() >= FMath::Max(MaxAttachedFX, 1)) {
+		ReleaseFXAt(0, true);
+	}
+
+	FUEGoreActiveFX& Active = ActiveFX.AddDefaulted_GetRef();
+	Active.Component = Component;
+	Active.Owner = Owner;
+}
+
+void UUEGoreResourceManager::ReleaseAttachedFX(UFXSystemComponent* Component)
+{
+	const int32 ActiveIndex = ActiveFX.IndexOfByPredicate([Component](const FUEGoreActiveFX& Active) { return Active.Component == Component; });
+
+	if (ActiveIndex != INDEX_NONE) {
+		ReleaseFXAt(ActiveIndex, false);
+	}
+	else if (IsValid(Component)) {
+		Component->DestroyComponent();
+	}
+}
+
+void UUEGoreResourceManager::ReleaseFXAt(const int32 ActiveIndex, const bool bNotifyOwner)
+{
+	const FUEGoreActiveFX Active = ActiveFX[ActiveIndex];
+	ActiveFX.RemoveAt(ActiveIndex, 1, EAllowShrinking::No);
+
+	UFXSystemComponent* Component = Active.Component.Get();
+	if (!Component)
+		return;
+
+	if (bNotifyOwner && Active.Owner.IsValid()) {
+		Active.Owner->OnGoreResourceRecycled(Component);
+	}
+
+	UNiagaraComponent* NiagaraComp = Cast<UNiagaraComponent>(Component);
+	if (NiagaraComp && NiagaraComp->PoolingMethod == ENCPoolMethod::ManualRelease) {
+		NiagaraComp->ReleaseToPool();
+	}
+	else {
+		Component->DestroyComponent();
+	}
+}
+
+void UUEGoreResourceManager::PruneAttachedFX()
+{
+	// Finished spills go straight back to the Niagara pool instead of waiting for the owner to clean up
+	for (int32 Idx = ActiveFX.Num() - 1; Idx >= 0; Idx--) {
+		const UFXSystemComponent* Component = ActiveFX[Idx].Component.Get();
+
+		if (!IsValid(Component)) {
+			ActiveFX.RemoveAt(Idx, 1, EAllowShrinking::No);
+		}
+		else if (!Component->IsActive()) {
+			ReleaseFXAt(Idx, true);
+		}
+	}
+}
+
+// Limbs
+AActor* UUEGoreResourceManager::GetOrCreatePoolActor()
+{
+	if (IsValid(PoolActor))
+		return PoolActor;
+
+	FActorSpawnParameters Params;
+	Params.Name = MakeUniqueObjectName(GetWorld()->PersistentLevel, AActor::StaticClass(), TEXT("GoreResourcePool"));
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags |= RF_Transient;
+
+	PoolActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+
+	if (PoolActor) {
+		USceneComponent* Root = NewObject<USceneComponent>(PoolActor, TEXT("Root"));
+		PoolActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	return PoolActor;
+}
+
+USkeletalMeshComponent* UUEGoreResourceManager::AcquireLimb(UUEGoreSystemComponent* Owner, const TSubclassOf<USkeletalMeshComponent> LimbClass)
+{
+	if (!LimbClass || MaxLimbs <= 0)
+		return nullptr;
+
+	// Budget reached, recycle the oldest limb (its gore component forgets about it)
+	while (ActiveLimbs.Num() >= MaxLimbs) {
+		ReleaseLimbAt(0, true);
+		INC_DWORD_STAT(STAT_UEGoreLimbsRecycled);
+	}
+
+	USkeletalMeshComponent* Limb = nullptr;
+
+	FUEGoreLimbPool& Pool = LimbPools.FindOrAdd(LimbClass.Get());
+	while (Pool.FreeLimbs.Num() > 0 && !Limb) {
+		Limb = Pool.FreeLimbs.Pop(EAllowShrinking::No);
+		Limb = IsValid(Limb) ? Limb : nullptr;
+	}
+
+	if (!Limb) {
+		AActor* Outer = GetOrCreatePoolActor();
+		if (!Outer)
+			return nullptr;
+
+		Limb = NewObject<USkeletalMeshComponent>(Outer, LimbClass, MakeUniqueObjectName(Outer, LimbClass, TEXT("PooledLimbComponent_")));
+		Limb->SetVisibility(false);
+		Limb->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Limb->RegisterComponent();
+	}
+
+	Limb->SetComponentTickEnabled(true);
+
+	FUEGoreActiveLimb& Active = ActiveLimbs.AddDefaulted_GetRef();
+	Active.Limb = Limb;
+	Active.Owner = Owner;
+
+	return Limb;
+}
+
+void UUEGoreResourceManager::ReleaseLimb(USkeletalMeshComponent* Limb)
+{
+	const int32 ActiveIndex = ActiveLimbs.IndexOfByPredicate([Limb](const FUEGoreActiveLimb& Active) { return Active.Limb == Limb; });
+
+	if (ActiveIndex != INDEX_NONE) {
+		ReleaseLimbAt(ActiveIndex, false);
+	}
+}
+
+void UUEGoreResourceManager::ReleaseLimbAt(const int32 ActiveIndex, const bool bNotifyOwner)
+{
+	const FUEGoreActiveLimb Active = ActiveLimbs[ActiveIndex];
+	ActiveLimbs.RemoveAt(ActiveIndex, 1, EAllowShrinking::No);
+
+	USkeletalMeshComponent* Limb = Active.Limb;
+	if (!IsValid(Limb))
+		return;
+
+	if (bNotifyOwner && Active.Owner.IsValid()) {
+		Active.Owner->OnGoreResourceRecycled(Limb);
+	}
+
+	ReleaseAttachedChildren(Limb);
+
+	// Make sure a pending EnablePhys from the old anim instance can't wake the limb up again
+	if (UAnimInstance* AnimInst = Limb->GetAnimInstance()) {
+		GetWorld()->GetTimerManager().ClearAllTimersForObject(AnimInst);
+	}
+
+	Limb->SetSimulatePhysics(false);
+	Limb->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Limb->SetVisibility(false);
+	Limb->SetAnimInstanceClass(nullptr);
+	Limb->SetPhysicsAsset(nullptr);
+	Limb->EmptyOverrideMaterials();
+	Limb->SetComponentTickEnabled(false);
+
+	// Bring back every bone hidden while the limb was in use
+	TArray<int32> HiddenBones;
+	for (int32 BoneIndex = 0; BoneIndex < Limb->GetNumBones(); BoneIndex++) {
+		if (Limb->IsBoneHidden(BoneIndex)) {
+			HiddenBones.Add(BoneIndex);
+		}
+	}
+
+	if (UGoreSkeletalMeshComponent* GoreLimb = Cast<UGoreSkeletalMeshComponent>(Limb)) {
+		GoreLimb->UnhideBonesGore(HiddenBones);
+		GoreLimb->ResetGoreState();
+	}
+	else {
+		for (const int32 BoneIndex : HiddenBones) {
+			Limb->UnHideBone(BoneIndex);
+		}
+	}
+
+	LimbPools.FindOrAdd(Limb->GetClass()).FreeLimbs.Add(Limb);
+}
+
+void UUEGoreResourceManager::ReleaseAttachedChildren(USceneComponent* Parent)
+{
+	const TArray<USceneComponent*> Children = Parent->GetAttachChildren();
+
+	for (USceneComponent* Child : Children) {
+		if (!IsValid(Child))
+			continue;
+
+		if (UFXSystemComponent* FXComp = Cast<UFXSystemComponent>(Child)) {
+			ReleaseAttachedFX(FXComp);
+		}
+		else {
+			Child->DestroyComponent();
+		}
+	}
+}
+
+void UUEGoreResourceManager::ReleaseResourcesOwnedBy(UUEGoreSystemComponent* Owner)
+{
+	for (int32 Idx = ActiveLimbs.Num() - 1; Idx >= 0; Idx--) {
+		if (ActiveLimbs[Idx].Owner == Owner) {
+			ReleaseLimbAt(Idx, false);
+		}
+	}
+
+	for (int32 Idx = ActiveFX.Num() - 1; Idx >= 0; Idx--) {
+		if (ActiveFX[Idx].Owner == Owner) {
+			ReleaseFXAt(Idx, false);
+		}
+	}
+
+	PendingDecals.RemoveAll([Owner](const FUEGorePendingDecal& Request) { return Request.Instigator == Owner; });
+}
+
+// Physics assets
+UPhysicsAsset* UUEGoreResourceManager::GetPhysicsAssetVariant(const UPhysicsAsset* SourceAsset, const USkeletalMesh* ReferenceMesh, const FName CutBone)
+{
+	if (!SourceAsset)
+		return nullptr;
+
+	const TTuple<TObjectKey<UPhysicsAsset>, TObjectKey<USkeletalMesh>, FName> Key(SourceAsset, ReferenceMesh, CutBone);
+
+	if (const TWeakObjectPtr<UPhysicsAsset>* Cached = PhysicsAssetVariants.Find(Key)) {
+		if (UPhysicsAsset* Variant = Cached->Get()) {
+			return Variant;
+		}
+	}
+
+	UPhysicsAsset* Variant = BuildPhysicsAssetVariant(this, SourceAsset, ReferenceMesh, CutBone);
+	if (Variant) {
+		PhysicsAssetVariants.Add(Key, Variant);
+		PhysicsAssetVariantObjects.Add(Variant);
+		INC_DWORD_STAT(STAT_UEGorePhysicsAssetClones);
+	}
+
+	return Variant;
+}
+
+UPhysicsAsset* UUEGoreResourceManager::BuildPhysicsAssetVariant(UObject* Outer, const UPhysicsAsset* SourceAsset, const USkeletalMesh* ReferenceMesh, const FName CutBone)
+{
+	//Duplicate Physics Asset
+	UPhysicsAsset* PhAt = DuplicateObject(SourceAsset, Outer, MakeUniqueObjectName(Outer, UPhysicsAsset::StaticClass(), TEXT("ClonedPhAt_")));
+
+	if (!PhAt)
+		return nullptr;
+
+	if (CutBone != FName() && ReferenceMesh)
+	{
+		TArray<int32> InstBelow;
+
+		//Gather bodies before
+		PhAt->GetBodyIndicesBelow(InstBelow, CutBone, ReferenceMesh, true);
+
+		for (int32 Idx = 0; Idx < PhAt->SkeletalBodySetups.Num(); Idx++)
+		{
+			if (!InstBelow.Contains(Idx))
+			{
+				PhAt->SkeletalBodySetups[Idx]->AggGeom.EmptyElements();
+				PhAt->SkeletalBodySetups[Idx]->bConsiderForBounds = false;
+			}
+		}
+	}
+
+	return PhAt;
+}
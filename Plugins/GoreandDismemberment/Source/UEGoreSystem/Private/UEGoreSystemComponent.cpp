@@ -27,6 +27,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "UEGoreSystem.h"
+#include "UEGoreResourceManager.h"
 
 // Sets default values for this component's properties
 UUEGoreSystemComponent::UUEGoreSystemComponent(const FObjectInitializer& ObjInit)
@@ -88,11 +89,23 @@ void UUEGoreSystemComponent::DestroyAllAttachedGoreFXs()
 
 void UUEGoreSystemComponent::DestroyAllAttachedGoreFXs_Multi_Implementation()
 {
+	UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this);
 	const uint32 FXNum = AttachedGoreFXs.Num();
 	
 	for (uint32 i = 0; i < FXNum; i++) {
-		AttachedGoreFXs[i]->DestroyComponent();
+		if (!IsValid(AttachedGoreFXs[i]))
+			continue;
+
+		// Pooled spills go back to the Niagara pool
+		if (ResourceManager) {
+			ResourceManager->ReleaseAttachedFX(AttachedGoreFXs[i]);
+		}
+		else {
+			AttachedGoreFXs[i]->DestroyComponent();
+		}
 	}
+
+	AttachedGoreFXs.Empty();
 }
 
 // Called when the game starts
@@ -104,6 +117,31 @@ void UUEGoreSystemComponent::BeginPlay()
 	Init(nullptr); 
 }
 
+void UUEGoreSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Detached limbs belong to the pool actor, release them like they used to be destroyed with this actor
+	if (UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this)) {
+		ResourceManager->ReleaseResourcesOwnedBy(this);
+	}
+
+	AttachedGoreFXs.Empty();
+	SpawnedComponents.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UUEGoreSystemComponent::OnGoreResourceRecycled(UObject* Resource)
+{
+	AttachedGoreFXs.RemoveSingleSwap(Cast<UFXSystemComponent>(Resource));
+	SpawnedComponents.RemoveSingleSwap(Cast<USceneComponent>(Resource));
+
+	for (TPair<FName, FUEGoreSystemStruct>& Entry : GoreSettings.BodyMap) {
+		if (Entry.Value.DetachedMesh == Resource) {
+			Entry.Value.DetachedMesh = nullptr;
+		}
+	}
+}
+
 // Called every frame
 void UUEGoreSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
@@ -125,19 +163,9 @@ void UUEGoreSystemComponent::Init(USkeletalMeshComponent* NewRootMesh)
 
 void UUEGoreSystemComponent::SpawnDecalAt(const TSubclassOf<ADecalActor> DecalActorClass,const FTransform DecalTransform, const float InLifespan)
 {
-	//Set spawn parameters to No Fail (Always Spawn)
-	FActorSpawnParameters params;
-	params.bNoFail = true;
-	params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	//Spawn Decal Actor
-	ADecalActor* DecalAct = GetWorld()->SpawnActor<ADecalActor>(DecalActorClass, DecalTransform, params);
-
-	if (DecalAct) {
-		//If Actor is valid, set new random rotation
-		DecalAct->AddActorLocalRotation(FQuat(FRotator(0.0f, 0.0f, UKismetMathLibrary::RandomFloatInRange(0.0f, 360.0f))));
-		DecalAct->SetLifeSpan(InLifespan);
-		DecalsList.Add(DecalAct);
+	// Decals are pooled and spawned in batches by the resource manager (random roll is applied there)
+	if (UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this)) {
+		ResourceManager->RequestDecal(this, DecalActorClass, DecalTransform, InLifespan, 0.0f);
 	}
 }
 
@@ -162,7 +190,10 @@ void UUEGoreSystemComponent::HitBones_Multi_Implementation(const TArray<FUEGoreS
 
 void UUEGoreSystemComponent::Int_HitBones(const TArray<FUEGoreSystemHit> Bones)
 {
-	ParallelFor(Bones.Num(), [&](int32 Idx)
+	UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this);
+
+	// Runs on the game thread, spawning and the resource pools are not thread safe
+	for (int32 Idx = 0; Idx < Bones.Num(); Idx++)
 		{
 			FUEGoreSystemEffects EffectsToUse = FUEGoreSystemEffects();			
 			USoundCue* SoundToUse = nullptr;
@@ -190,9 +221,9 @@ void UUEGoreSystemComponent::Int_HitBones(const TArray<FUEGoreSystemHit> Bones)
 				SoundToUse = GoreSettings.GlobalSounds.Hit;
 			}
 
-			// Spawn Niagara hit effect
-			if (EffectsToUse.Hit) {
-				UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetOwner(), EffectsToUse.Hit, Bones[Idx].Location, Bones[Idx].Normal.Rotation(), FVector(1.0f), true, true);
+			// Spawn Niagara hit effect (pooled, returns itself to the pool once finished)
+			if (EffectsToUse.Hit && (!ResourceManager || ResourceManager->TryConsumeHitFXBudget())) {
+				UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetOwner(), EffectsToUse.Hit, Bones[Idx].Location, Bones[Idx].Normal.Rotation(), FVector(1.0f), true, true, ENCPoolMethod::AutoRelease);
 			}
 
 			if (EffectsToUse.HitLegacy) {
@@ -210,7 +241,7 @@ void UUEGoreSystemComponent::Int_HitBones(const TArray<FUEGoreSystemHit> Bones)
 				UGameplayStatics::SpawnSoundAtLocation(GetOwner(), Cast<USoundBase>(SoundToUse), Bones[Idx].Location, Bones[Idx].Normal.Rotation());
 
 			// Spawn decal
-			if (EffectsToUse.Decal) {
+			if (EffectsToUse.Decal && ResourceManager) {
 				FTransform DecalTransf = FTransform();
 				FHitResult FeetResult;
 				FCollisionQueryParams QParams;
@@ -234,14 +265,12 @@ void UUEGoreSystemComponent::Int_HitBones(const TArray<FUEGoreSystemHit> Bones)
 						FeetResult.Location, //Given location
 						FVector(UKismetMathLibrary::RandomFloatInRange(1.0f, 1.5f))); //Random scale	
 
-					FTimerHandle DecalHandle;
-					FTimerDelegate TimerDel;
-					TimerDel.BindUFunction(this, FName(TEXT("SpawnDecalAt")), EffectsToUse.Decal, DecalTransf, EffectsToUse.DecalLifespan);
-					GetOwner()->GetWorldTimerManager().SetTimer(DecalHandle, TimerDel, FeetResult.Distance / 500.0f, false);
+					// Delay the decal like the blood needs time to reach the ground
+					ResourceManager->RequestDecal(this, EffectsToUse.Decal, DecalTransf, EffectsToUse.DecalLifespan, FeetResult.Distance / 500.0f);
 				}
 			}
 
-		});
+		}
 }
 
 void UUEGoreSystemComponent::HitBone(const FUEGoreSystemHit BoneHit)
@@ -284,6 +313,12 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 {
 	UE_CLOG(bEnableDebugLogging, LogUEGoreSystem, Log, TEXT("[DestroyBones] with %i bone input(s)"), Bones.Num());
 
+	UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this);
+	if (!ResourceManager) {
+		UE_CLOG(bEnableDebugLogging, LogUEGoreSystem, Warning, TEXT("No gore resource manager in this world"));
+		return;
+	}
+
 	FCriticalSection Mutex;
 	// ParallelFor(Bones.Num(), [&](int32 Idx)
 	for (int32 Idx = 0; Idx < Bones.Num(); Idx++) {
@@ -362,7 +397,7 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 		}
 
 		if (SelectEffects.Spill && CSKComp) {
-			NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(SelectEffects.Spill, CSKComp, CSKComp->GetParentBone(CSKComp->GetSocketBoneName(SocketToUse)), CSKComp->GetSocketLocation(SocketToUse), BloodDirection.Rotation(), EAttachLocation::KeepWorldPosition, true);
+			NiagaraComp = ResourceManager->SpawnAttachedFX(this, SelectEffects.Spill, CSKComp, CSKComp->GetParentBone(CSKComp->GetSocketBoneName(SocketToUse)), CSKComp->GetSocketLocation(SocketToUse), BloodDirection.Rotation());
 
 			if (NiagaraComp) {
 				NiagaraComp->SetWorldScale3D(CSKComp->GetComponentScale());
@@ -379,6 +414,7 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 				Delegate.BindUFunction(this, "SpawnDecalOnParticleHit");
 				CParticleSyst->OnParticleCollide.Add(Delegate);
 				AttachedGoreFXs.Add(CParticleSyst);
+				ResourceManager->RegisterAttachedFX(this, CParticleSyst);
 			}
 		}		
 
@@ -432,10 +468,7 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 			if (FeetResult.bBlockingHit) {
 				UE_CLOG(bEnableDebugLogging, LogUEGoreSystem, Log, TEXT("Trace for decal found a spot"));
 
-				FTimerHandle DecalHandle;
-				FTimerDelegate TimerDel;
-				TimerDel.BindUFunction(this, FName(TEXT("SpawnDecalAt")), SelectEffects.Decal, DecalTransf, SelectEffects.DecalLifespan);
-				GetOwner()->GetWorldTimerManager().SetTimer(DecalHandle, TimerDel, FeetResult.Distance / 500.0f, false);
+				ResourceManager->RequestDecal(this, SelectEffects.Decal, DecalTransf, SelectEffects.DecalLifespan, FeetResult.Distance / 500.0f);
 			}
 		}
 
@@ -457,7 +490,7 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 		}
 
 		if (bEnableAutoDismemberment && !NewStruct.Mesh) {
-			NewStruct.DetachedMesh = NewObject<USkeletalMeshComponent>(CSKComp->GetOwner(), UGoreSkeletalMeshComponent::StaticClass(), MakeUniqueObjectName(CSKComp->GetOwner(), UGoreSkeletalMeshComponent::StaticClass(), TEXT("AutoLimbSkeletalComponent_")));
+			NewStruct.DetachedMesh = ResourceManager->AcquireLimb(this, UGoreSkeletalMeshComponent::StaticClass());
 
 			USkeletalMesh* NewMesh = nullptr;
 			if (VisualMeshComponent) {
@@ -472,18 +505,18 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 				}
 			}
 
-			NewStruct.DetachedMesh->SetSkeletalMesh(NewMesh);
+			if (NewStruct.DetachedMesh) {
+				NewStruct.DetachedMesh->SetSkeletalMesh(NewMesh);
+			}
 		}
 		else {
 			if (NewStruct.Mesh)	{
-				NewStruct.DetachedMesh = NewObject<USkeletalMeshComponent>(
-					CSKComp->GetOwner(),
-					USkeletalMeshComponent::StaticClass(),
-					MakeUniqueObjectName(CSKComp->GetOwner(), USkeletalMeshComponent::StaticClass(), TEXT("LimbSkeletalComponent_")));
-
-				//Set new skeletal mesh parameters before registration
-				
-				NewStruct.DetachedMesh->SetSkeletalMesh(NewStruct.Mesh, false);				
+				NewStruct.DetachedMesh = ResourceManager->AcquireLimb(this, USkeletalMeshComponent::StaticClass());
+
+				//Set new skeletal mesh parameters
+				if (NewStruct.DetachedMesh) {
+					NewStruct.DetachedMesh->SetSkeletalMesh(NewStruct.Mesh, false);
+				}
 			}
 		}				
 
@@ -491,8 +524,7 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 			NewStruct.DetachedMesh->bDisableClothSimulation = true;
 			NewStruct.DetachedMesh->SetVisibility(false);
 			NewStruct.DetachedMesh->SetSimulatePhysics(false);
-			NewStruct.DetachedMesh->SetWorldTransform(CSKComp->GetComponentTransform());			
-			NewStruct.DetachedMesh->RegisterComponent(); //DuplicateObject(CSKComp, CSKComp->GetOuter(), MakeUniqueObjectName(CSKComp->GetOuter(), UPhysicsAsset::StaticClass(), TEXT("ClonedModel")));		
+			NewStruct.DetachedMesh->SetWorldTransform(CSKComp->GetComponentTransform(), false, nullptr, ETeleportType::ResetPhysics); // Pooled limbs are registered already
 			
 
 			const USkeletalMeshComponent* SKMatRef = VisualMeshComponent ? VisualMeshComponent : CSKComp;
@@ -537,6 +569,10 @@ void UUEGoreSystemComponent::Int_DestroyBones(const TArray<FUEGoreSystemHit> Bon
 					UE_CLOG(bEnableDebugLogging, LogUEGoreSystem, Warning, TEXT("No Physics Asset applied!"));
 				}
 			}
+			else {
+				// A recycled limb had its bodies terminated by the previous detach
+				NewStruct.DetachedMesh->RecreatePhysicsState();
+			}
 
 			NewStruct.DetachedMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
@@ -692,36 +728,19 @@ bool UUEGoreSystemComponent::DestroyBone(const FUEGoreSystemHit InBone, const fl
 // Clone Physics Asset utility
 UPhysicsAsset* UUEGoreSystemComponent::ClonePhysicsAsset(const UPhysicsAsset* PhysicsAssetToClone, const FName RemoveBefore)
 {
+	const USkeletalMesh* ReferenceMesh = MeshRoot ? MeshRoot->GetSkeletalMeshAsset() : nullptr;
 
-	//Duplicate Physics Asset
-	UPhysicsAsset* PhAt = DuplicateObject(PhysicsAssetToClone, GetOwner(), MakeUniqueObjectName(PhysicsAssetToClone->GetOuter(), UPhysicsAsset::StaticClass(), TEXT("ClonedPhAt_")));
-
-	if (!PhAt)
-	{
-		UE_CLOG(bEnableDebugLogging, LogUEGoreSystem, Log, TEXT("Can't clone physics asset, return nullptr"));
-
-		return nullptr;
+	// Variants are shared between all limbs cut at the same bone, they are never modified after cloning
+	UPhysicsAsset* PhAt = nullptr;
+	if (UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this)) {
+		PhAt = ResourceManager->GetPhysicsAssetVariant(PhysicsAssetToClone, ReferenceMesh, RemoveBefore);
 	}
-
-	if (RemoveBefore != FName())
-	{
-		UE_CLOG(bEnableDebugLogging, LogUEGoreSystem, Log, TEXT("Removing physics bodies before %s"), *RemoveBefore.ToString());
-
-		TArray<int32> InstBelow;
-
-		//Gather bodies before
-		PhAt->GetBodyIndicesBelow(InstBelow, RemoveBefore, MeshRoot->GetSkeletalMeshAsset(), true);
-
-		for (int32 Idx = 0; Idx < PhAt->SkeletalBodySetups.Num(); Idx++)
-		{
-			if (!InstBelow.Contains(Idx))
-			{
-				PhAt ->SkeletalBodySetups[Idx]->AggGeom.EmptyElements();
-				PhAt->SkeletalBodySetups[Idx]->bConsiderForBounds = false;
-			}
-		}		
+	else if (PhysicsAssetToClone) {
+		PhAt = UUEGoreResourceManager::BuildPhysicsAssetVariant(GetOwner(), PhysicsAssetToClone, ReferenceMesh, RemoveBefore);
 	}
 
+	UE_CLOG(bEnableDebugLogging && !PhAt, LogUEGoreSystem, Log, TEXT("Can't clone physics asset, return nullptr"));
+
 	//Return new Physics Asset
 	return PhAt;
 }
@@ -856,6 +875,8 @@ void UUEGoreSystemComponent::RemoveAllSpawnedComponents_Server_Implementation(co
 
 void UUEGoreSystemComponent::RemoveAllSpawnedComponents_Multi_Implementation(const bool KeepDecals)
 {
+	UUEGoreResourceManager* ResourceManager = UUEGoreResourceManager::Get(this);
+
 	TArray<FName> BodyMapKeys = TArray<FName>();
 	GoreSettings.BodyMap.GetKeys(BodyMapKeys);
 
@@ -866,28 +887,28 @@ void UUEGoreSystemComponent::RemoveAllSpawnedComponents_Multi_Implementation(con
 		if (!TargetMesh)
 			continue;
 
-		TArray<USceneComponent*> AttachedComps = TargetMesh->GetAttachChildren();
-		for (int32 IdxC = 0; IdxC < AttachedComps.Num(); IdxC++) {
-			AttachedComps[IdxC]->DestroyComponent();
+		for (USceneComponent* AttachedComp : TargetMesh->GetAttachChildren()) {
+			AttachedGoreFXs.RemoveSingleSwap(Cast<UFXSystemComponent>(AttachedComp));
 		}
 
 		FUEGoreSystemStruct StructToEmplace = GoreSettings.BodyMap.FindRef(BodyMapKeys[Idx]);
 		StructToEmplace.DetachedMesh = nullptr;
-		TargetMesh->DestroyComponent();
+
+		// Attached components are released/destroyed together with the limb
+		if (ResourceManager) {
+			ResourceManager->ReleaseLimb(TargetMesh);
+		}
+		else {
+			TargetMesh->DestroyComponent();
+		}
 
 		GoreSettings.BodyMap.Emplace(BodyMapKeys[Idx], StructToEmplace);
 	}
 
 	SpawnedComponents.Empty();
 
-	if (!KeepDecals) {
-		for (int32 Idx = 0; Idx < DecalsList.Num(); Idx++) {
-			if (DecalsList[Idx]) {
-				DecalsList[Idx]->Destroy();
-			}
-		};
-
-		DecalsList.Empty();
+	if (!KeepDecals && ResourceManager) {
+		ResourceManager->ReleaseDecalsOwnedBy(this);
 	}
 }
 
@@ -60,6 +60,9 @@ public:
 	UFUNCTION()
 		void UnhideBonesGore(const TArray<int32> BoneIndexes);
 
+	/**[Internal] Clear the detach state so a pooled component can be used for another limb*/
+		void ResetGoreState();
+
 		/**
 	 * Rebuild BoneVisibilityStates array. Mostly refresh information of bones for BVS_HiddenByParent
 	 */
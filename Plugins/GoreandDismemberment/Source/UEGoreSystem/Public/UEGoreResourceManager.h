@@ -0,0 +1,199 @@
+// Copyright 2019-2023 Henry Galimberti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UEGoreResourceManager.generated.h"
+
+class ADecalActor;
+class UFXSystemComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class UPhysicsAsset;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+class UUEGoreSystemComponent;
+
+/** Free decal actors of a single decal class */
+USTRUCT()
+struct FUEGoreDecalPool
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+		TArray<TObjectPtr<ADecalActor>> FreeDecals;
+};
+
+/** Free limb components of a single skeletal mesh component class */
+USTRUCT()
+struct FUEGoreLimbPool
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+		TArray<TObjectPtr<USkeletalMeshComponent>> FreeLimbs;
+};
+
+/** A decal currently visible in the world */
+USTRUCT()
+struct FUEGoreActiveDecal
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+		TObjectPtr<ADecalActor> Decal = nullptr;
+
+	TWeakObjectPtr<UUEGoreSystemComponent> Instigator;
+	double ExpireTime = 0.0;
+};
+
+/** A limb component currently handed out to a gore component */
+USTRUCT()
+struct FUEGoreActiveLimb
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+		TObjectPtr<USkeletalMeshComponent> Limb = nullptr;
+
+	TWeakObjectPtr<UUEGoreSystemComponent> Owner;
+};
+
+/** A (pooled) spill effect attached to a character or limb */
+struct FUEGoreActiveFX
+{
+	TWeakObjectPtr<UFXSystemComponent> Component;
+	TWeakObjectPtr<UUEGoreSystemComponent> Owner;
+};
+
+/** A decal waiting for its spawn time, spawned in batches by the manager tick */
+struct FUEGorePendingDecal
+{
+	TSubclassOf<ADecalActor> DecalClass;
+	FTransform Transform;
+	float Lifespan = 0.0f;
+	double SpawnTime = 0.0;
+	TWeakObjectPtr<UUEGoreSystemComponent> Instigator;
+};
+
+/**
+ * World wide owner of every gore resource that is spawned at runtime.
+ * Decals, spill FX and detached limb components are recycled instead of spawned/destroyed per hit,
+ * physics asset variants are cloned once per (source asset, mesh, cut bone) and global budgets
+ * recycle the oldest resource first, so horde fights keep a flat cost.
+ */
+UCLASS(config = Game)
+class UEGORESYSTEM_API UUEGoreResourceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UUEGoreResourceManager* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
+	/** Maximum number of gore decals visible at once, the oldest is recycled when exceeded*/
+	UPROPERTY(Config)
+		int32 MaxDecals = 96;
+	/** Maximum number of queued decals turned into real decals per frame, the rest are spawned next frame*/
+	UPROPERTY(Config)
+		int32 MaxDecalSpawnsPerFrame = 8;
+	/** Decals of the same class closer than this to one spawned in the same batch are dropped*/
+	UPROPERTY(Config)
+		float DecalMergeDistance = 20.0f;
+	/** Maximum number of attached spill effects alive at once, the oldest is released when exceeded*/
+	UPROPERTY(Config)
+		int32 MaxAttachedFX = 32;
+	/** Maximum number of hit effects started per frame, further hits in the same frame skip their FX*/
+	UPROPERTY(Config)
+		int32 MaxHitFXPerFrame = 16;
+	/** Maximum number of detached limbs alive at once, the oldest is recycled when exceeded*/
+	UPROPERTY(Config)
+		int32 MaxLimbs = 24;
+
+	/** Queue a decal to appear after Delay seconds. Requests are spawned in batches from the manager tick*/
+	void RequestDecal(UUEGoreSystemComponent* Instigator, const TSubclassOf<ADecalActor> DecalClass, const FTransform& DecalTransform, const float Lifespan, const float Delay);
+
+	/** Returns false if the hit FX budget of this frame is used up*/
+	bool TryConsumeHitFXBudget();
+
+	/** Start a pooled spill effect attached to a component, registered against the attached FX budget*/
+	UNiagaraComponent* SpawnAttachedFX(UUEGoreSystemComponent* Owner, UNiagaraSystem* System, USceneComponent* AttachTo, const FName AttachPointName, const FVector& Location, const FRotator& Rotation);
+
+	/** Register a non pooled effect against the attached FX budget*/
+	void RegisterAttachedFX(UUEGoreSystemComponent* Owner, UFXSystemComponent* Component);
+
+	/** Stop an attached effect, returning it to the Niagara pool when it came from there*/
+	void ReleaseAttachedFX(UFXSystemComponent* Component);
+
+	/** Get a registered, hidden limb component ready to be set up by the gore component*/
+	USkeletalMeshComponent* AcquireLimb(UUEGoreSystemComponent* Owner, const TSubclassOf<USkeletalMeshComponent> LimbClass);
+
+	/** Hide a limb and return it to the pool, components attached to it are released/destroyed*/
+	void ReleaseLimb(USkeletalMeshComponent* Limb);
+
+	/** Return the cached physics asset without bodies above CutBone, cloning it on first use*/
+	UPhysicsAsset* GetPhysicsAssetVariant(const UPhysicsAsset* SourceAsset, const USkeletalMesh* ReferenceMesh, const FName CutBone);
+
+	/** Release every limb, attached effect and queued decal owned by a gore component, visible decals keep their lifespan*/
+	void ReleaseResourcesOwnedBy(UUEGoreSystemComponent* Owner);
+
+	/** Remove every visible and queued decal spawned by a gore component*/
+	void ReleaseDecalsOwnedBy(UUEGoreSystemComponent* Owner);
+
+	/** Clone a physics asset, emptying every body that isn't CutBone or one of its children*/
+	static UPhysicsAsset* BuildPhysicsAssetVariant(UObject* Outer, const UPhysicsAsset* SourceAsset, const USkeletalMesh* ReferenceMesh, const FName CutBone);
+
+	int32 GetNumActiveDecals() const { return ActiveDecals.Num(); }
+	int32 GetNumPendingDecals() const { return PendingDecals.Num(); }
+	int32 GetNumActiveLimbs() const { return ActiveLimbs.Num(); }
+	int32 GetNumPhysicsAssetVariants() const { return PhysicsAssetVariants.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void FlushPendingDecals(const double Now);
+	void ExpireDecals(const double Now);
+	ADecalActor* AcquireDecal(const TSubclassOf<ADecalActor> DecalClass);
+	void ReleaseDecalAt(const int32 ActiveIndex);
+	void ReleaseLimbAt(const int32 ActiveIndex, const bool bNotifyOwner);
+	void ReleaseFXAt(const int32 ActiveIndex, const bool bNotifyOwner);
+
+	void PruneAttachedFX();
+	void ReleaseAttachedChildren(USceneComponent* Parent);
+	AActor* GetOrCreatePoolActor();
+
+	UPROPERTY()
+		TMap<TObjectPtr<UClass>, FUEGoreDecalPool> DecalPools;
+	/** Oldest first*/
+	UPROPERTY()
+		TArray<FUEGoreActiveDecal> ActiveDecals;
+	TArray<FUEGorePendingDecal> PendingDecals;
+
+	UPROPERTY()
+		TMap<TObjectPtr<UClass>, FUEGoreLimbPool> LimbPools;
+	/** Oldest first*/
+	UPROPERTY()
+		TArray<FUEGoreActiveLimb> ActiveLimbs;
+	/** Actor owning every pooled limb component, limbs outlive the characters they were cut from*/
+	UPROPERTY()
+		TObjectPtr<AActor> PoolActor;
+
+	/** Oldest first*/
+	TArray<FUEGoreActiveFX> ActiveFX;
+	int32 HitFXThisFrame = 0;
+
+	/** Keeps the cloned assets alive, PhysicsAssetVariants only indexes them*/
+	UPROPERTY()
+		TArray<TObjectPtr<UPhysicsAsset>> PhysicsAssetVariantObjects;
+	TMap<TTuple<TObjectKey<UPhysicsAsset>, TObjectKey<USkeletalMesh>, FName>, TWeakObjectPtr<UPhysicsAsset>> PhysicsAssetVariants;
+};
@@ -70,8 +70,6 @@ public:
 
 	UPROPERTY()
 		TArray<FName> DestroyedBones;
-	UPROPERTY()
-		TArray<ADecalActor*> DecalsList;
 	UPROPERTY()
 		TArray<USceneComponent*> SpawnedComponents;
 	UPROPERTY()
@@ -90,6 +88,8 @@ public:
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
+	// Hands pooled limbs and FX back to the resource manager
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(BlueprintReadOnly, Category = "GoreSystem|Runtime")
 	class USkeletalMeshComponent* MeshRoot;
@@ -158,9 +158,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GoreSystem")
 		bool DestroyBone(const FUEGoreSystemHit InBone, const float InForce = 3000.0f);
 
+	/** Returns the physics asset variant without bodies before RemoveBefore, cloned once and shared through the gore resource manager*/
 	UFUNCTION()
 		class UPhysicsAsset* ClonePhysicsAsset(const UPhysicsAsset* PhysicsAssetToClone, const FName RemoveBefore);
 
+	/**[Internal] Called by the gore resource manager when a budget takes back a limb or effect owned by this component*/
+		void OnGoreResourceRecycled(UObject* Resource);
+
 	/** Damage multiple bones with multiple damage values, this function will only modify the health value stored in the system
 	* No VFXs or SFXs involved
 	* >BonesDamage - Double Array pairing BoneName and Damage, you should use this variable as a TMap
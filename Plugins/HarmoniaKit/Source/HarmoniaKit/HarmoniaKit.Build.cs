@@ -58,6 +58,7 @@ public class HarmoniaKit : ModuleRules
                 "OnlineSubsystemUtils",
                 "CommonUI",
                 "CommonGame",
+                "CommonLoadingScreen",     // 시작 데이터 로드 중 로딩 화면 유지
                 "NavigationSystem",
                 "AIModule",
                 
@@ -8,16 +8,17 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
-#include "AbilitySystem/HarmoniaAttributeSet.h"
+#include "System/HarmoniaProjectileSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/DamageEvents.h"
-#include "Engine/OverlapResult.h"
+#include "System/LyraSignificanceManager.h"
 
 AHarmoniaProjectile::AHarmoniaProjectile()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false; // Only boomerangs need to tick
 	bReplicates = true;
 	SetReplicateMovement(true);
 
@@ -69,20 +70,27 @@ void AHarmoniaProjectile::BeginPlay()
 	{
 		GetWorldTimerManager().SetTimer(LifetimeTimerHandle, this, &AHarmoniaProjectile::DestroyProjectile, ProjectileData.Lifetime, false);
 	}
+
+	if (ULyraSignificanceManager* SignificanceManager = ULyraSignificanceManager::Get(this))
+	{
+		SignificanceManager->RegisterSignificantObject(this, LyraSignificanceTags::Projectile, CollisionComponent->GetScaledSphereRadius());
+	}
 }
 
-void AHarmoniaProjectile::Tick(float DeltaTime)
+void AHarmoniaProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
-
-	// Update homing
-	if (HomingTarget.IsValid() && ProjectileData.MovementType == EHarmoniaProjectileMovement::Homing)
+	if (ULyraSignificanceManager* SignificanceManager = ULyraSignificanceManager::Get(this))
 	{
-		MovementComponent->bIsHomingProjectile = true;
-		MovementComponent->HomingTargetComponent = HomingTarget->GetRootComponent();
-		MovementComponent->HomingAccelerationMagnitude = ProjectileData.HomingAcceleration;
+		SignificanceManager->UnregisterSignificantObject(this);
 	}
 
+	Super::EndPlay(EndPlayReason);
+}
+
+void AHarmoniaProjectile::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
 	// Update boomerang
 	if (ProjectileData.MovementType == EHarmoniaProjectileMovement::Boomerang && ProjectileOwner)
 	{
@@ -165,6 +173,7 @@ void AHarmoniaProjectile::InitializeProjectile(const FHarmoniaProjectileData& In
 	case EHarmoniaProjectileMovement::Homing:
 		MovementComponent->ProjectileGravityScale = 0.0f;
 		MovementComponent->bIsHomingProjectile = true;
+		MovementComponent->HomingAccelerationMagnitude = ProjectileData.HomingAcceleration;
 		break;
 
 	case EHarmoniaProjectileMovement::Parabolic:
@@ -177,6 +186,7 @@ void AHarmoniaProjectile::InitializeProjectile(const FHarmoniaProjectileData& In
 		BoomerangStartLocation = GetActorLocation();
 		BoomerangElapsedTime = 0.0f;
 		bBoomerangReturning = false;
+		SetActorTickEnabled(true);
 		break;
 
 	case EHarmoniaProjectileMovement::Hitscan:
@@ -225,6 +235,12 @@ void AHarmoniaProjectile::LaunchProjectile(const FVector& Direction, float Speed
 void AHarmoniaProjectile::SetHomingTarget(AActor* Target)
 {
 	HomingTarget = Target;
+
+	// The movement component does the steering, no need to tick for it
+	if (ProjectileData.MovementType == EHarmoniaProjectileMovement::Homing)
+	{
+		MovementComponent->HomingTargetComponent = Target ? Target->GetRootComponent() : nullptr;
+	}
 }
 
 // ============================================================================
@@ -306,105 +322,9 @@ void AHarmoniaProjectile::ApplyDamageToTarget(AActor* Target, const FHitResult&
 		return;
 	}
 
-	// Get ability system component from owner
-	UAbilitySystemComponent* OwnerASC = GetOwnerAbilitySystemComponent();
-	if (!OwnerASC)
-	{
-		return;
-	}
-
-	// Get target ability system component
-	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Target);
-	if (!TargetASC)
-	{
-		return;
-	}
-
-	// Calculate final damage using AttackPower from attributes as base
-	float BaseDamage = 0.0f;
-	float CriticalChance = ProjectileData.DamageConfig.CriticalChance;
-	float CriticalMultiplier = ProjectileData.DamageConfig.CriticalMultiplier;
-
-	if (OwnerASC)
-	{
-		const UHarmoniaAttributeSet* CombatSet = OwnerASC->GetSet<UHarmoniaAttributeSet>();
-		if (CombatSet)
-		{
-			BaseDamage = CombatSet->GetAttackPower();
-			// Use attribute values if available
-			CriticalChance = CombatSet->GetCriticalChance();
-			CriticalMultiplier = CombatSet->GetCriticalDamage();
-		}
-	}
-
-	float FinalDamage = BaseDamage * ProjectileData.DamageConfig.DamageMultiplier * DamageMultiplier;
-
-	// Apply critical hit
-	bool bWasCriticalHit = false;
-	if (ProjectileData.DamageConfig.bCanCritical && FMath::FRand() < CriticalChance)
-	{
-		bWasCriticalHit = true;
-		FinalDamage *= CriticalMultiplier;
-	}
-
-	// Apply penetration damage falloff
-	int32 PenetrationsUsed = ProjectileData.PenetrationCount - RemainingPenetrations;
-	if (PenetrationsUsed > 0)
-	{
-		FinalDamage *= FMath::Pow(ProjectileData.PenetrationDamageFalloff, PenetrationsUsed);
-	}
-
-	// Create gameplay effect context
-	FGameplayEffectContextHandle EffectContext = OwnerASC->MakeEffectContext();
-	EffectContext.AddSourceObject(this);
-	EffectContext.AddInstigator(ProjectileOwner, ProjectileOwner);
-	EffectContext.AddHitResult(HitResult);
-
-	// Apply damage via gameplay effect
-	if (ProjectileData.DamageConfig.DamageEffectClass)
-	{
-		FGameplayEffectSpecHandle SpecHandle = OwnerASC->MakeOutgoingSpec(ProjectileData.DamageConfig.DamageEffectClass, 1.0f, EffectContext);
-		if (SpecHandle.IsValid())
-		{
-			// Set damage magnitude using configured SetByCaller tag
-			if (ProjectileData.DamageConfig.SetByCallerDamageTag.IsValid())
-			{
-				SpecHandle.Data->SetSetByCallerMagnitude(ProjectileData.DamageConfig.SetByCallerDamageTag, FinalDamage);
-			}
-
-			// Add damage tags
-			SpecHandle.Data->DynamicGrantedTags.AppendTags(ProjectileData.DamageConfig.DamageTags);
-
-			// Apply effect to target
-			OwnerASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-		}
-	}
-
-	// Apply additional effects
-	for (const TSubclassOf<UGameplayEffect>& AdditionalEffect : ProjectileData.DamageConfig.AdditionalEffects)
-	{
-		if (AdditionalEffect)
-		{
-			FGameplayEffectSpecHandle SpecHandle = OwnerASC->MakeOutgoingSpec(AdditionalEffect, 1.0f, EffectContext);
-			if (SpecHandle.IsValid())
-			{
-				OwnerASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-			}
-		}
-	}
-
-	// Trigger gameplay cue
-	if (ProjectileData.ImpactGameplayCueTag.IsValid())
-	{
-		FGameplayCueParameters CueParams;
-		CueParams.Location = HitResult.ImpactPoint;
-		CueParams.Normal = HitResult.ImpactNormal;
-		CueParams.PhysicalMaterial = HitResult.PhysMaterial;
-		CueParams.Instigator = ProjectileOwner;
-		CueParams.EffectCauser = this;
-
-		TargetASC->ExecuteGameplayCue(ProjectileData.ImpactGameplayCueTag, CueParams);
-	}
+	// Shared with the managed projectiles of UHarmoniaProjectileSubsystem
+	const int32 PenetrationsUsed = ProjectileData.PenetrationCount - RemainingPenetrations;
+	UHarmoniaProjectileSubsystem::ApplyProjectileDamage(ProjectileData, ProjectileOwner, this, Target, HitResult, DamageMultiplier, PenetrationsUsed);
 }
 
 bool AHarmoniaProjectile::HandlePenetration(AActor* HitActor)
@@ -446,49 +366,8 @@ void AHarmoniaProjectile::Explode(const FVector& ExplosionLocation)
 	OnProjectileExplode.Broadcast(ExplosionLocation);
 
 	// Apply explosion damage
-	if (ProjectileData.ExplosionRadius > 0.0f)
-	{
-		TArray<FOverlapResult> OverlapResults;
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(this);
-		if (ProjectileOwner)
-		{
-			QueryParams.AddIgnoredActor(ProjectileOwner);
-		}
-
-		GetWorld()->OverlapMultiByChannel(
-			OverlapResults,
-			ExplosionLocation,
-			FQuat::Identity,
-			ECC_Pawn,
-			FCollisionShape::MakeSphere(ProjectileData.ExplosionRadius),
-			QueryParams
-		);
-
-		for (const FOverlapResult& Overlap : OverlapResults)
-		{
-			if (AActor* HitActor = Overlap.GetActor())
-			{
-				// Calculate distance falloff
-				float Distance = FVector::Dist(ExplosionLocation, HitActor->GetActorLocation());
-				float DamageFalloff = 1.0f - FMath::Pow(Distance / ProjectileData.ExplosionRadius, ProjectileData.DamageConfig.ExplosionFalloff);
-				DamageFalloff = FMath::Clamp(DamageFalloff, 0.0f, 1.0f);
-
-				// Apply damage
-				FHitResult HitResult;
-				HitResult.ImpactPoint = HitActor->GetActorLocation();
-				HitResult.Location = HitActor->GetActorLocation();
-				HitResult.HitObjectHandle = FActorInstanceHandle(HitActor);
-
-				// Apply damage with distance falloff
-				// Store original multiplier and apply falloff
-				float OriginalMultiplier = ProjectileData.DamageConfig.DamageMultiplier;
-				ProjectileData.DamageConfig.DamageMultiplier *= DamageFalloff;
-				ApplyDamageToTarget(HitActor, HitResult);
-				ProjectileData.DamageConfig.DamageMultiplier = OriginalMultiplier;
-			}
-		}
-	}
+	const int32 PenetrationsUsed = ProjectileData.PenetrationCount - RemainingPenetrations;
+	UHarmoniaProjectileSubsystem::ApplyProjectileExplosion(GetWorld(), ProjectileData, ProjectileOwner, this, ExplosionLocation, DamageMultiplier, PenetrationsUsed);
 
 	// Spawn explosion effects
 	if (ExplosionEffect)
@@ -8,6 +8,7 @@
 #include "Engine/World.h"
 #include "Camera/PlayerCameraManager.h"
 #include "DrawDebugHelpers.h"
+#include "System/LyraSignificanceManager.h"
 
 UHarmoniaAILODComponent::UHarmoniaAILODComponent()
 {
@@ -125,6 +126,16 @@ void UHarmoniaAILODComponent::UpdateLODLevel()
 		return;
 	}
 
+	// Owners scored by the significance manager reuse its result instead of scanning players again
+	if (const ULyraSignificanceManager* SignificanceManager = ULyraSignificanceManager::Get(this))
+	{
+		if (SignificanceManager->IsSignificantObjectRegistered(GetOwner()))
+		{
+			UpdateLODLevelFromSignificance(*SignificanceManager);
+			return;
+		}
+	}
+
 	// Find nearest player
 	FindNearestPlayer();
 
@@ -210,6 +221,41 @@ void UHarmoniaAILODComponent::UpdateLODLevel()
 	}
 }
 
+void UHarmoniaAILODComponent::UpdateLODLevelFromSignificance(const ULyraSignificanceManager& SignificanceManager)
+{
+	const AActor* Owner = GetOwner();
+
+	DistanceToNearestPlayer = SignificanceManager.GetDistanceToNearestViewpoint(Owner);
+	bIsVisibleOnScreen = SignificanceManager.IsObjectVisible(Owner);
+
+	// The distance part comes from this component's thresholds, the bucket only contributes what it adds on top of its
+	// own distance bucket (visibility, screen size, combat). No viewpoint at all is MAX_flt and ends up VeryLow like the no player case below
+	const int32 BucketOffset = static_cast<int32>(SignificanceManager.GetBucket(Owner)) - static_cast<int32>(SignificanceManager.GetBucketForDistance(DistanceToNearestPlayer));
+	const int32 LODIndex = static_cast<int32>(CalculateLODFromDistance(DistanceToNearestPlayer)) + BucketOffset;
+	EHarmoniaAILODLevel NewLOD = static_cast<EHarmoniaAILODLevel>(FMath::Clamp(LODIndex, static_cast<int32>(EHarmoniaAILODLevel::VeryHigh), static_cast<int32>(EHarmoniaAILODLevel::VeryLow)));
+
+	// Combat override - always high LOD when in combat and close
+	if (bForceHighLODInCombat && IsInCombat() && DistanceToNearestPlayer <= CombatHighLODDistance)
+	{
+		NewLOD = EHarmoniaAILODLevel::VeryHigh;
+	}
+
+	if (CurrentLODLevel != NewLOD)
+	{
+		EHarmoniaAILODLevel OldLevel = CurrentLODLevel;
+		CurrentLODLevel = NewLOD;
+		OnLODLevelChanged.Broadcast(OldLevel, CurrentLODLevel);
+		TimeSinceLastUpdate = 0.0f;
+
+		UE_LOG(LogHarmoniaAI, Verbose, TEXT("%s LOD changed from significance: %s -> %s (Distance: %.0f, Visible: %s)"),
+			*Owner->GetName(),
+			*UEnum::GetValueAsString(OldLevel),
+			*UEnum::GetValueAsString(NewLOD),
+			DistanceToNearestPlayer,
+			bIsVisibleOnScreen ? TEXT("Yes") : TEXT("No"));
+	}
+}
+
 EHarmoniaAILODLevel UHarmoniaAILODComponent::CalculateLODFromDistance(float Distance) const
 {
 	if (Distance <= VeryHighDistance)
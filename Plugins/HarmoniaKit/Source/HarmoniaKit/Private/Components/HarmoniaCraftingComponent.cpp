@@ -10,6 +10,7 @@
 #include "Animation/AnimInstance.h"
 #include "GameFramework/Character.h"
 #include "TimerManager.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 UHarmoniaCraftingComponent::UHarmoniaCraftingComponent()
 {
@@ -191,14 +192,32 @@ bool UHarmoniaCraftingComponent::StartCrafting(FHarmoniaID RecipeId)
 	// Broadcast start event
 	OnCraftingStarted.Broadcast(RecipeId, RecipeData.CastingTime);
 
-	// Play crafting animation on all clients (including server)
-	if (RecipeData.CraftingMontage.IsValid())
+	// Play crafting animation on all clients (including server), once the montage is resident
+	if (!RecipeData.CraftingMontage.IsNull())
 	{
-		UAnimMontage* Montage = RecipeData.CraftingMontage.LoadSynchronous();
-		if (Montage)
+		TSoftObjectPtr<UAnimMontage> CraftingMontage = RecipeData.CraftingMontage;
+		FSimpleDelegate PlayCraftingMontage = FSimpleDelegate::CreateWeakLambda(this, [this, CraftingMontage, RecipeId]()
 		{
-			// Use Multicast RPC to sync animation to all clients
-			MulticastPlayCraftingAnimation(Montage);
+			// Cancelled or finished while loading
+			if (!ActiveSession.bIsActive || ActiveSession.RecipeId != RecipeId)
+			{
+				return;
+			}
+
+			if (UAnimMontage* Montage = CraftingMontage.LoadSynchronous())
+			{
+				// Use Multicast RPC to sync animation to all clients
+				MulticastPlayCraftingAnimation(Montage);
+			}
+		});
+
+		if (UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this))
+		{
+			AssetResolver->RequestAsset(CraftingMontage.ToSoftObjectPath(), MoveTemp(PlayCraftingMontage));
+		}
+		else
+		{
+			PlayCraftingMontage.Execute();
 		}
 	}
 
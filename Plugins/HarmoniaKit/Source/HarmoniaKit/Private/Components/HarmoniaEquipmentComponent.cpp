@@ -14,6 +14,7 @@
 #include "Net/UnrealNetwork.h"
 #include "GameplayEffect.h"
 #include "MnhTracerComponent.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 UHarmoniaEquipmentComponent::UHarmoniaEquipmentComponent()
 {
@@ -944,7 +945,26 @@ void UHarmoniaEquipmentComponent::ApplyVisualMesh(const FHarmoniaEquipmentData&
 		return;
 	}
 
-	// Load mesh
+	// Stream the mesh in and come back once it is resident, the slot may have changed by then
+	UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this);
+	if (AssetResolver && !UHarmoniaAssetResolverSubsystem::IsResident(EquipmentData.EquipmentMesh.ToSoftObjectPath()))
+	{
+		AssetResolver->RequestAsset(EquipmentData.EquipmentMesh.ToSoftObjectPath(), FSimpleDelegate::CreateWeakLambda(this, [this, EquipmentData]()
+		{
+			const bool bStillEquipped = EquippedItems.ContainsByPredicate([&EquipmentData](const FEquippedItem& Item)
+			{
+				return Item.Slot == EquipmentData.EquipmentSlot && Item.EquipmentId == EquipmentData.EquipmentId;
+			});
+
+			if (bStillEquipped && !EquipmentMeshes.Contains(EquipmentData.EquipmentSlot))
+			{
+				ApplyVisualMesh(EquipmentData);
+			}
+		}));
+		return;
+	}
+
+	// Load mesh (already resident unless there is no resolver)
 	USkeletalMesh* LoadedMesh = EquipmentData.EquipmentMesh.LoadSynchronous();
 	if (!LoadedMesh)
 	{
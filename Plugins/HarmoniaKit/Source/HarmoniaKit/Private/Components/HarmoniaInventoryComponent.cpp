@@ -10,17 +10,37 @@
 #include "Interfaces/HarmoniaAdminInterface.h"
 #include "GameFramework/PlayerState.h"
 #include "Net/UnrealNetwork.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 UHarmoniaInventoryComponent::UHarmoniaInventoryComponent()
 {
 	SetIsReplicatedByDefault(true);
+
+	InventoryData.OwnerComponent = this;
 }
 
 void UHarmoniaInventoryComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	InventoryData.Slots.SetNum(InventoryData.MaxSlotCount);
+	InventoryData.OwnerComponent = this;
+
+	// Clients receive their slots through replication
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		InventoryData.Initialize(this);
+	}
+}
+
+void UHarmoniaInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Item preloads are held per inventory (see PreloadItemAssets)
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this))
+	{
+		AssetResolver->ReleaseAllPreloads(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UHarmoniaInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -30,10 +50,19 @@ void UHarmoniaInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimePro
 	DOREPLIFETIME_CONDITION(UHarmoniaInventoryComponent, InventoryData, COND_OwnerOnly);
 }
 
-void UHarmoniaInventoryComponent::OnRep_InventoryData()
+void UHarmoniaInventoryComponent::HandleSlotReplicated(const FInventorySlot& Slot)
 {
-	// Broadcast on client for UI auto-update
-	OnInventoryChanged.Broadcast();
+	// Broadcast on client for per-slot UI update
+	OnInventorySlotChanged.Broadcast(Slot.Index, Slot);
+}
+
+void UHarmoniaInventoryComponent::NotifySlotChanged(int32 SlotIndex)
+{
+	if (InventoryData.Slots.IsValidIndex(SlotIndex))
+	{
+		InventoryData.MarkSlotDirty(SlotIndex);
+		OnInventorySlotChanged.Broadcast(SlotIndex, InventoryData.Slots[SlotIndex]);
+	}
 }
 
 void UHarmoniaInventoryComponent::RequestPickupItem(AHarmoniaItemActor* Item)
@@ -154,6 +183,7 @@ bool UHarmoniaInventoryComponent::AddItem(const FHarmoniaID& ItemID, int32 Count
 			{
 				Slot.Durability = Durability;
 				Slot.Count += Count;
+				NotifySlotChanged(Slot.Index);
 				OnInventoryChanged.Broadcast(); // Server-side broadcast
 				return true;
 			}
@@ -167,6 +197,8 @@ bool UHarmoniaInventoryComponent::AddItem(const FHarmoniaID& ItemID, int32 Count
 				Slot.ItemID = ItemID;
 				Slot.Durability = Durability;
 				Slot.Count = Count;
+				PreloadItemAssets(ItemID);
+				NotifySlotChanged(Slot.Index);
 				OnInventoryChanged.Broadcast(); // Server-side broadcast
 				return true;
 			}
@@ -195,7 +227,9 @@ bool UHarmoniaInventoryComponent::RemoveItem(const FHarmoniaID& ItemID, int32 Co
 				{
 					Slot.ItemID = FHarmoniaID();
 					Slot.Durability = 0.f;
+					ReleaseItemAssets(ItemID);
 				}
+				NotifySlotChanged(Slot.Index);
 				OnInventoryChanged.Broadcast(); // Server-side broadcast
 				return true;
 			}
@@ -211,7 +245,13 @@ void UHarmoniaInventoryComponent::SwapSlots(int32 SlotA, int32 SlotB)
 
 	if (InventoryData.Slots.IsValidIndex(SlotA) && InventoryData.Slots.IsValidIndex(SlotB) && SlotA != SlotB)
 	{
-		InventoryData.Slots.Swap(SlotA, SlotB);
+		// Swap contents rather than array elements so each slot keeps its index and replication key
+		const FInventorySlot SlotACopy = InventoryData.Slots[SlotA];
+		InventoryData.Slots[SlotA].CopyContentsFrom(InventoryData.Slots[SlotB]);
+		InventoryData.Slots[SlotB].CopyContentsFrom(SlotACopy);
+
+		NotifySlotChanged(SlotA);
+		NotifySlotChanged(SlotB);
 		OnInventoryChanged.Broadcast(); // Server-side broadcast
 	}
 }
@@ -221,10 +261,19 @@ void UHarmoniaInventoryComponent::Clear()
 	// Server-only execution
 	HARMONIA_REQUIRE_SERVER(this);
 
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this))
+	{
+		AssetResolver->ReleaseAllPreloads(this);
+	}
+
 	for (FInventorySlot& Slot : InventoryData.Slots)
 	{
-		Slot.ItemID = FHarmoniaID();
-		Slot.Count = 0;
+		if (!Slot.IsEmpty())
+		{
+			Slot.ItemID = FHarmoniaID();
+			Slot.Count = 0;
+			NotifySlotChanged(Slot.Index);
+		}
 	}
 	OnInventoryChanged.Broadcast(); // Server-side broadcast
 }
@@ -242,6 +291,16 @@ int32 UHarmoniaInventoryComponent::GetTotalCount(const FHarmoniaID& ItemID) cons
 	return Total;
 }
 
+bool UHarmoniaInventoryComponent::GetSlot(int32 SlotIndex, FInventorySlot& OutSlot) const
+{
+	if (const FInventorySlot* Slot = InventoryData.FindSlot(SlotIndex))
+	{
+		OutSlot = *Slot;
+		return true;
+	}
+	return false;
+}
+
 void UHarmoniaInventoryComponent::PickupItem(AHarmoniaItemActor* Item)
 {
 	if (GetOwner() && GetOwner()->HasAuthority() && Item)
@@ -299,33 +358,97 @@ void UHarmoniaInventoryComponent::DropItem(int32 SlotIndex)
 				FHarmoniaItemData* Item = ItemDataTable->FindRow<FHarmoniaItemData>(Slot.ItemID.Id, TEXT("FindItemRow"));
 
 				// Spawn dropped item actor
-				if (Item && Item->WorldActorClass)
+				if (Item && !Item->WorldActorClass.IsNull())
 				{
-					AActor* OwnerActor = GetOwner();
-					FVector DropLocation = OwnerActor ? OwnerActor->GetActorLocation() + OwnerActor->GetActorForwardVector() * 100.f : FVector::ZeroVector;
-					FActorSpawnParameters SpawnParams;
-					SpawnParams.Owner = OwnerActor;
-
-					AHarmoniaItemActor* DropActor = GetWorld()->SpawnActor<AHarmoniaItemActor>(
-						Item->WorldActorClass.LoadSynchronous(),
-						DropLocation,
-						FRotator::ZeroRotator,
-						SpawnParams
-					);
-
-					if (DropActor)
-					{
-						DropActor->InitItem(Slot.ItemID, Slot.Count, Slot.Durability);
-					}
+					SpawnDroppedItem(Item->WorldActorClass, Slot.ItemID, Slot.Count, Slot.Durability);
 				}
 
-				// Reset inventory slot
-				Slot = FInventorySlot();
+				// Reset inventory slot (keeps its index and replication key)
+				const FHarmoniaID DroppedItemID = Slot.ItemID;
+				Slot.ResetContents();
+				ReleaseItemAssets(DroppedItemID);
+				NotifySlotChanged(SlotIndex);
+				OnInventoryChanged.Broadcast(); // Server-side broadcast
 			}
 		}
 	}
 }
 
+void UHarmoniaInventoryComponent::PreloadItemAssets(const FHarmoniaID& ItemID) const
+{
+	UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this);
+	UDataTable* ItemDataTable = GETITEMDATATABLE();
+	if (!AssetResolver || !ItemDataTable)
+	{
+		return;
+	}
+
+	// Held per inventory under the item id, so one inventory emptying a stack never unloads another's
+	if (AssetResolver->IsPreloaded(this, ItemID.Id))
+	{
+		return;
+	}
+
+	if (const FHarmoniaItemData* Item = ItemDataTable->FindRow<FHarmoniaItemData>(ItemID.Id, TEXT("FindItemRow")))
+	{
+		AssetResolver->Preload(this, ItemID.Id, { Item->WorldActorClass.ToSoftObjectPath() });
+	}
+}
+
+void UHarmoniaInventoryComponent::ReleaseItemAssets(const FHarmoniaID& ItemID) const
+{
+	if (GetTotalCount(ItemID) > 0)
+	{
+		return;
+	}
+
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this))
+	{
+		AssetResolver->ReleasePreload(this, ItemID.Id);
+	}
+}
+
+void UHarmoniaInventoryComponent::SpawnDroppedItem(const TSoftClassPtr<AActor>& WorldActorClass, const FHarmoniaID& ItemID, int32 Count, float Durability)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// The item already left the inventory, so the drop is bound to the world rather than to this component
+	AActor* OwnerActor = GetOwner();
+	const FVector DropLocation = OwnerActor ? OwnerActor->GetActorLocation() + OwnerActor->GetActorForwardVector() * 100.f : FVector::ZeroVector;
+	TWeakObjectPtr<AActor> WeakOwner = OwnerActor;
+
+	FSimpleDelegate SpawnDropActor = FSimpleDelegate::CreateWeakLambda(World, [World, WorldActorClass, ItemID, Count, Durability, DropLocation, WeakOwner]()
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = WeakOwner.Get();
+
+		AHarmoniaItemActor* DropActor = World->SpawnActor<AHarmoniaItemActor>(
+			WorldActorClass.LoadSynchronous(),
+			DropLocation,
+			FRotator::ZeroRotator,
+			SpawnParams
+		);
+
+		if (DropActor)
+		{
+			DropActor->InitItem(ItemID, Count, Durability);
+		}
+	});
+
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this))
+	{
+		AssetResolver->RequestAsset(WorldActorClass.ToSoftObjectPath(), MoveTemp(SpawnDropActor));
+	}
+	else
+	{
+		SpawnDropActor.Execute();
+	}
+}
+
 void UHarmoniaInventoryComponent::ServerDropItem_Implementation(int32 SlotIndex)
 {
 	DropItem(SlotIndex);
@@ -440,8 +563,11 @@ void UHarmoniaInventoryComponent::SortInventory(EInventorySortMethod Method)
 	// Server-only execution
 	HARMONIA_REQUIRE_SERVER(this);
 
+	// Sort a copy of the contents; slots themselves never move so only slots whose contents changed get replicated
+	TArray<FInventorySlot> SortedSlots = InventoryData.Slots;
+
 	// Sort logic
-	InventoryData.Slots.Sort([Method](const FInventorySlot& A, const FInventorySlot& B)
+	SortedSlots.StableSort([Method](const FInventorySlot& A, const FInventorySlot& B)
 	{
 		// Empty slots always go to the end
 		bool bAValid = A.ItemID.IsValid() && A.Count > 0;
@@ -495,10 +621,17 @@ void UHarmoniaInventoryComponent::SortInventory(EInventorySortMethod Method)
 		return false;
 	});
 
-	// Re-assign indices
+	// Write the sorted contents back into the fixed slots
 	for (int32 i = 0; i < InventoryData.Slots.Num(); ++i)
 	{
-		InventoryData.Slots[i].Index = i;
+		FInventorySlot& Slot = InventoryData.Slots[i];
+		Slot.Index = i;
+
+		if (!Slot.HasSameContents(SortedSlots[i]))
+		{
+			Slot.CopyContentsFrom(SortedSlots[i]);
+			NotifySlotChanged(i);
+		}
 	}
 
 	OnInventoryChanged.Broadcast(); // Server-side broadcast
@@ -33,6 +33,16 @@ void UHarmoniaMapComponent::BeginPlay()
 	// Get map subsystem
 	MapSubsystem = GetMapSubsystem();
 
+	// Size the exploration grid before any saved data is loaded into it
+	if (CurrentMapData)
+	{
+		ExplorationGrid.Initialize(CurrentMapData->CapturedMapData.WorldBounds, CurrentMapData->ExplorationGridResolution, this);
+	}
+	else
+	{
+		ExplorationGrid.OwnerComponent = this;
+	}
+
 	// Load exploration data if available
 	LoadExplorationData();
 
@@ -57,7 +67,7 @@ void UHarmoniaMapComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 
 	// Only replicate exploration data to the owning client to save bandwidth
 	// Each player only needs to see their own explored regions and discovered locations
-	DOREPLIFETIME_CONDITION(UHarmoniaMapComponent, ExploredRegions, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION(UHarmoniaMapComponent, ExplorationGrid, COND_OwnerOnly);
 	DOREPLIFETIME_CONDITION(UHarmoniaMapComponent, DiscoveredLocations, COND_OwnerOnly);
 
 	// Pings are shared with all clients (for team coordination)
@@ -91,20 +101,31 @@ void UHarmoniaMapComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	}
 }
 
-void UHarmoniaMapComponent::OnRep_ExploredRegions()
+void UHarmoniaMapComponent::HandleExplorationReplicated()
 {
-	// Update fog of war renderer when explored regions are replicated
+	// Only the changed tiles are uploaded
 	// This only happens on the owning client (due to COND_OwnerOnly)
-	if (FogOfWarRenderer)
+	FlushFogOfWarUpdates();
+
+	// The regions the server revealed arrive through ClientRegionExplored, raise them once their tiles are here
+	TArray<FExploredRegion> ExploredRegions = MoveTemp(PendingExploredRegions);
+	PendingExploredRegions.Reset();
+	for (const FExploredRegion& Region : ExploredRegions)
 	{
-		FogOfWarRenderer->UpdateFogOfWar(ExploredRegions);
+		OnRegionExplored.Broadcast(Region);
 	}
+}
 
-	// Broadcast event for the newly added region (last in array)
-	if (ExploredRegions.Num() > 0)
+void UHarmoniaMapComponent::ClientRegionExplored_Implementation(const FExploredRegion& Region)
+{
+	// The server (or listen server host) already broadcast this region in AddExploredRegion
+	if (GetOwnerRole() == ROLE_Authority)
 	{
-		OnRegionExplored.Broadcast(ExploredRegions.Last());
+		return;
 	}
+
+	// The reliable RPC is sent ahead of the property update carrying the tiles, hold it until they are received
+	PendingExploredRegions.Add(Region);
 }
 
 void UHarmoniaMapComponent::OnRep_DiscoveredLocations()
@@ -129,15 +150,7 @@ bool UHarmoniaMapComponent::IsLocationExplored(const FVector& WorldLocation) con
 		return true;
 	}
 
-	for (const FExploredRegion& Region : ExploredRegions)
-	{
-		if (Region.ContainsPoint(WorldLocation))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return ExplorationGrid.GetAlpha(WorldLocation) == FHarmoniaExplorationGrid::MaxAlpha;
 }
 
 float UHarmoniaMapComponent::GetExplorationAlpha(const FVector& WorldLocation) const
@@ -147,62 +160,28 @@ float UHarmoniaMapComponent::GetExplorationAlpha(const FVector& WorldLocation) c
 		return 1.0f;
 	}
 
-	// Find the closest explored region and calculate fade
-	float ClosestDistanceRatio = FLT_MAX;
-
-	for (const FExploredRegion& Region : ExploredRegions)
-	{
-		float Distance = FVector::Dist(Region.Center, WorldLocation);
-		float DistanceRatio = Distance / Region.Radius;
-
-		if (DistanceRatio < ClosestDistanceRatio)
-		{
-			ClosestDistanceRatio = DistanceRatio;
-		}
-	}
-
-	if (ClosestDistanceRatio <= 1.0f)
-	{
-		return 1.0f; // Fully explored
-	}
-	else if (ClosestDistanceRatio <= 1.5f)
-	{
-		// Fade out from 1.0 to 0.0 over distance
-		return FMath::Clamp(1.0f - ((ClosestDistanceRatio - 1.0f) / 0.5f), 0.0f, 1.0f);
-	}
-
-	return 0.0f; // Not explored
+	// The grid stores the fade band baked in when the region was revealed
+	return static_cast<float>(ExplorationGrid.GetAlpha(WorldLocation)) / FHarmoniaExplorationGrid::MaxAlpha;
 }
 
 void UHarmoniaMapComponent::AddExploredRegion(const FVector& Center, float Radius)
 {
 	if (GetOwnerRole() == ROLE_Authority)
 	{
-		// Check if we already have a region nearby
-		bool bMerged = false;
-		for (FExploredRegion& ExistingRegion : ExploredRegions)
+		// Only tiles that actually gained exploration are marked for replication
+		if (ExplorationGrid.RevealCircle(Center, Radius))
 		{
-			float Distance = FVector::Dist(ExistingRegion.Center, Center);
-			if (Distance < (ExistingRegion.Radius + Radius) * 0.5f)
-			{
-				// Merge regions by expanding the existing one
-				FVector NewCenter = (ExistingRegion.Center + Center) * 0.5f;
-				float NewRadius = FMath::Max(ExistingRegion.Radius, Radius) + Distance * 0.5f;
-
-				ExistingRegion.Center = NewCenter;
-				ExistingRegion.Radius = NewRadius;
-				bMerged = true;
-				break;
-			}
-		}
+			FlushFogOfWarUpdates();
 
-		if (!bMerged)
-		{
-			// Add new region
 			FExploredRegion NewRegion(Center, Radius);
 			NewRegion.ExploredTime = GetWorld()->GetTimeSeconds();
-			ExploredRegions.Add(NewRegion);
-			// Event will be broadcast via OnRep_ExploredRegions on the owning client
+			OnRegionExplored.Broadcast(NewRegion);
+
+			// Remote owners raise the same region once its tiles replicate (see HandleExplorationReplicated)
+			if (GetNetMode() != NM_Standalone)
+			{
+				ClientRegionExplored(NewRegion);
+			}
 		}
 	}
 	else
@@ -407,8 +386,8 @@ FVector UHarmoniaMapComponent::MapUVToWorld(const FVector2D& UV, float WorldZ) c
 void UHarmoniaMapComponent::SaveExplorationData()
 {
 	// Save exploration data - integrate with save system
-	UE_LOG(LogTemp, Log, TEXT("SaveExplorationData called (%d regions, %d locations)"),
-		ExploredRegions.Num(), DiscoveredLocations.Num());
+	UE_LOG(LogTemp, Log, TEXT("SaveExplorationData called (%d explored tiles, %d locations)"),
+		ExplorationGrid.GetNumExploredTiles(), DiscoveredLocations.Num());
 
 	// Integrate with HarmoniaSaveGameSubsystem
 	UWorld* World = GetWorld();
@@ -463,15 +442,16 @@ void UHarmoniaMapComponent::SaveExplorationData()
 		PlayerData.PlayerName = PC->PlayerState ? PC->PlayerState->GetPlayerName() : TEXT("Player");
 	}
 
-	// Update exploration data
-	PlayerData.ExploredRegions = ExploredRegions;
+	// Update exploration data (the legacy region list is migrated into the grid on load)
+	ExplorationGrid.SaveRLE(PlayerData.ExplorationGridData);
+	PlayerData.ExploredRegions.Reset();
 	PlayerData.DiscoveredLocations = DiscoveredLocations;
 
 	// Save back to save game
 	SaveGame->SetPlayerData(SteamID, PlayerData);
 
-	UE_LOG(LogTemp, Log, TEXT("SaveExplorationData: Saved %d regions and %d locations for player %s"),
-		ExploredRegions.Num(), DiscoveredLocations.Num(), *SteamID);
+	UE_LOG(LogTemp, Log, TEXT("SaveExplorationData: Saved %d explored tiles (%d bytes) and %d locations for player %s"),
+		ExplorationGrid.GetNumExploredTiles(), PlayerData.ExplorationGridData.Num(), DiscoveredLocations.Num(), *SteamID);
 }
 
 void UHarmoniaMapComponent::LoadExplorationData()
@@ -527,16 +507,27 @@ void UHarmoniaMapComponent::LoadExplorationData()
 	FHarmoniaPlayerSaveData PlayerData;
 	if (SaveGame->GetPlayerData(SteamID, PlayerData))
 	{
-		// Load exploration data
-		ExploredRegions = PlayerData.ExploredRegions;
+		// Load exploration data. The grid is server owned, clients receive its tiles through replication
+		if (GetOwnerRole() == ROLE_Authority && ExplorationGrid.IsInitialized())
+		{
+			if (!ExplorationGrid.LoadRLE(PlayerData.ExplorationGridData))
+			{
+				// Older saves only have the region list (grids saved with another resolution are resampled by LoadRLE)
+				ExplorationGrid.Reset();
+				for (const FExploredRegion& Region : PlayerData.ExploredRegions)
+				{
+					ExplorationGrid.RevealCircle(Region.Center, Region.Radius);
+				}
+			}
+		}
 		DiscoveredLocations = PlayerData.DiscoveredLocations;
 
 		// Trigger replication callbacks to update fog of war and UI
-		OnRep_ExploredRegions();
+		FlushFogOfWarUpdates();
 		OnRep_DiscoveredLocations();
 
-		UE_LOG(LogTemp, Log, TEXT("LoadExplorationData: Loaded %d regions and %d locations for player %s"),
-			ExploredRegions.Num(), DiscoveredLocations.Num(), *SteamID);
+		UE_LOG(LogTemp, Log, TEXT("LoadExplorationData: Loaded %d explored tiles and %d locations for player %s"),
+			ExplorationGrid.GetNumExploredTiles(), DiscoveredLocations.Num(), *SteamID);
 	}
 	else
 	{
@@ -757,15 +748,26 @@ void UHarmoniaMapComponent::InitializeFogOfWarRenderer()
 	FogOfWarRenderer = NewObject<UHarmoniaFogOfWarRenderer>(this);
 	if (FogOfWarRenderer)
 	{
-		// Initialize with map bounds
+		// One texel per exploration cell
 		FogOfWarRenderer->Initialize(
 			CurrentMapData->CapturedMapData.WorldBounds,
-			FIntPoint(1024, 1024)
+			FIntPoint(ExplorationGrid.GetCellsPerSide(), ExplorationGrid.GetCellsPerSide())
 		);
 
-		// Initial update with current explored regions
-		FogOfWarRenderer->UpdateFogOfWar(ExploredRegions);
+		// Initial upload of every explored tile
+		FogOfWarRenderer->UpdateAllTiles(ExplorationGrid);
 
 		UE_LOG(LogTemp, Log, TEXT("Fog of War renderer initialized"));
 	}
 }
+
+void UHarmoniaMapComponent::FlushFogOfWarUpdates()
+{
+	// Consume even without a renderer (dedicated server) so the dirty list stays short
+	ExplorationGrid.ConsumeDirtyTiles(DirtyTileScratch);
+
+	if (FogOfWarRenderer && DirtyTileScratch.Num() > 0)
+	{
+		FogOfWarRenderer->UpdateTiles(ExplorationGrid, DirtyTileScratch);
+	}
+}
@@ -20,6 +20,7 @@ void UHarmoniaMinimapComponent::BeginPlay()
 	Super::BeginPlay();
 
 	InitializeMinimap();
+	RefreshHiddenCategoryMask();
 }
 
 void UHarmoniaMinimapComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -43,7 +44,7 @@ void UHarmoniaMinimapComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 	// Clean up icons for destroyed actors
 	CleanupInvalidIcons();
 
-	// Update all icon positions
+	// Update icons around the capture area
 	UpdateIconPositions();
 }
 
@@ -97,7 +98,14 @@ void UHarmoniaMinimapComponent::CleanupMinimap()
 		SceneCaptureComponent = nullptr;
 	}
 
-	Icons.Empty();
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->UnregisterAll(this);
+	}
+
+	IconSlots.Empty();
+	IconSlotById.Empty();
+	VisibleIconIndices.Empty();
 	bIsInitialized = false;
 }
 
@@ -194,7 +202,18 @@ FGuid UHarmoniaMinimapComponent::AddIcon(const FHarmoniaMinimapIcon& Icon)
 		NewIcon.IconID = FGuid::NewGuid();
 	}
 
-	Icons.Add(NewIcon);
+	// Re-adding an existing ID replaces that icon
+	if (UpdateIcon(NewIcon.IconID, NewIcon))
+	{
+		return NewIcon.IconID;
+	}
+
+	FIconSlot NewSlot;
+	NewSlot.Data = NewIcon;
+	const int32 SlotIndex = IconSlots.Add(MoveTemp(NewSlot));
+	IconSlotById.Add(NewIcon.IconID, SlotIndex);
+	RegisterSlot(SlotIndex);
+
 	OnIconAdded.Broadcast(NewIcon);
 
 	return NewIcon.IconID;
@@ -230,115 +249,140 @@ FGuid UHarmoniaMinimapComponent::AddLocationIcon(FVector WorldLocation, UTexture
 
 bool UHarmoniaMinimapComponent::RemoveIcon(FGuid IconID)
 {
-	for (int32 i = Icons.Num() - 1; i >= 0; --i)
+	const int32 SlotIndex = FindSlot(IconID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Icons[i].IconID == IconID)
-		{
-			Icons.RemoveAt(i);
-			OnIconRemoved.Broadcast(IconID);
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	RemoveSlot(SlotIndex);
+	return true;
 }
 
 void UHarmoniaMinimapComponent::RemoveAllIcons()
 {
-	for (const FHarmoniaMinimapIcon& Icon : Icons)
+	TArray<FGuid> RemovedIDs;
+	IconSlotById.GenerateKeyArray(RemovedIDs);
+
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->UnregisterAll(this);
+	}
+
+	IconSlots.Empty();
+	IconSlotById.Empty();
+	VisibleIconIndices.Empty();
+
+	for (const FGuid& RemovedID : RemovedIDs)
 	{
-		OnIconRemoved.Broadcast(Icon.IconID);
+		OnIconRemoved.Broadcast(RemovedID);
 	}
-	Icons.Empty();
 }
 
 void UHarmoniaMinimapComponent::RemoveIconsByCategory(FGameplayTag Category)
 {
-	for (int32 i = Icons.Num() - 1; i >= 0; --i)
+	TArray<int32> SlotsToRemove;
+	for (auto It = IconSlots.CreateConstIterator(); It; ++It)
 	{
-		if (Icons[i].CategoryTag.MatchesTag(Category))
+		if (It->Data.CategoryTag.MatchesTag(Category))
 		{
-			FGuid RemovedID = Icons[i].IconID;
-			Icons.RemoveAt(i);
-			OnIconRemoved.Broadcast(RemovedID);
+			SlotsToRemove.Add(It.GetIndex());
 		}
 	}
+
+	for (int32 SlotIndex : SlotsToRemove)
+	{
+		RemoveSlot(SlotIndex);
+	}
 }
 
 bool UHarmoniaMinimapComponent::UpdateIcon(FGuid IconID, const FHarmoniaMinimapIcon& NewData)
 {
-	for (FHarmoniaMinimapIcon& Icon : Icons)
+	const int32 SlotIndex = FindSlot(IconID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Icon.IconID == IconID)
-		{
-			FGuid OriginalID = Icon.IconID;
-			Icon = NewData;
-			Icon.IconID = OriginalID;
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	FHarmoniaMinimapIcon& Icon = IconSlots[SlotIndex].Data;
+	Icon = NewData;
+	Icon.IconID = IconID;
+
+	RegisterSlot(SlotIndex);
+	return true;
 }
 
 bool UHarmoniaMinimapComponent::UpdateIconLocation(FGuid IconID, FVector NewWorldLocation)
 {
-	for (FHarmoniaMinimapIcon& Icon : Icons)
+	const int32 SlotIndex = FindSlot(IconID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Icon.IconID == IconID)
-		{
-			Icon.WorldLocation = NewWorldLocation;
-			Icon.TrackedActor = nullptr; // Clear tracked actor when manually setting location
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	FHarmoniaMinimapIcon& Icon = IconSlots[SlotIndex].Data;
+	Icon.WorldLocation = NewWorldLocation;
+	Icon.TrackedActor = nullptr; // Clear tracked actor when manually setting location
+
+	RegisterSlot(SlotIndex);
+	return true;
 }
 
 // ============================================================================
 // Icon Queries
 // ============================================================================
 
-TArray<FHarmoniaMinimapIcon> UHarmoniaMinimapComponent::GetVisibleIcons() const
+TArray<FHarmoniaMinimapIcon> UHarmoniaMinimapComponent::GetAllIcons() const
 {
-	TArray<FHarmoniaMinimapIcon> VisibleIcons;
-
-	for (const FHarmoniaMinimapIcon& Icon : Icons)
+	TArray<FHarmoniaMinimapIcon> Result;
+	Result.Reserve(IconSlots.Num());
+	for (const FIconSlot& Slot : IconSlots)
 	{
-		if (Icon.bVisible && IsCategoryVisible(Icon.CategoryTag))
-		{
-			VisibleIcons.Add(Icon);
-		}
+		Result.Add(Slot.Data);
 	}
+	return Result;
+}
 
-	// Sort by priority
-	VisibleIcons.Sort([](const FHarmoniaMinimapIcon& A, const FHarmoniaMinimapIcon& B)
+TArray<FHarmoniaMinimapIcon> UHarmoniaMinimapComponent::GetVisibleIcons() const
+{
+	TArray<FHarmoniaMinimapIcon> VisibleIcons;
+	VisibleIcons.Reserve(VisibleIconIndices.Num());
+	ForEachVisibleIcon([&VisibleIcons](const FHarmoniaMinimapIcon& Icon)
 	{
-		return A.Priority > B.Priority;
+		VisibleIcons.Add(Icon);
 	});
-
 	return VisibleIcons;
 }
 
+void UHarmoniaMinimapComponent::ForEachVisibleIcon(TFunctionRef<void(const FHarmoniaMinimapIcon&)> Visitor) const
+{
+	// Already filtered by category and sorted by priority
+	for (int32 SlotIndex : VisibleIconIndices)
+	{
+		Visitor(IconSlots[SlotIndex].Data);
+	}
+}
+
 bool UHarmoniaMinimapComponent::GetIconByID(FGuid IconID, FHarmoniaMinimapIcon& OutIcon) const
 {
-	for (const FHarmoniaMinimapIcon& Icon : Icons)
+	const int32 SlotIndex = FindSlot(IconID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Icon.IconID == IconID)
-		{
-			OutIcon = Icon;
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	OutIcon = IconSlots[SlotIndex].Data;
+	return true;
 }
 
 TArray<FHarmoniaMinimapIcon> UHarmoniaMinimapComponent::GetIconsByCategory(FGameplayTag Category) const
 {
 	TArray<FHarmoniaMinimapIcon> Result;
-	for (const FHarmoniaMinimapIcon& Icon : Icons)
+	for (const FIconSlot& Slot : IconSlots)
 	{
-		if (Icon.CategoryTag.MatchesTag(Category))
+		if (Slot.Data.CategoryTag.MatchesTag(Category))
 		{
-			Result.Add(Icon);
+			Result.Add(Slot.Data);
 		}
 	}
 	return Result;
@@ -358,6 +402,8 @@ void UHarmoniaMinimapComponent::SetCategoryVisible(FGameplayTag Category, bool b
 	{
 		HiddenCategories.AddUnique(Category);
 	}
+
+	RefreshHiddenCategoryMask();
 }
 
 bool UHarmoniaMinimapComponent::IsCategoryVisible(FGameplayTag Category) const
@@ -501,23 +547,43 @@ void UHarmoniaMinimapComponent::UpdateSceneCaptureTransform()
 
 void UHarmoniaMinimapComponent::UpdateIconPositions()
 {
-	for (FHarmoniaMinimapIcon& Icon : Icons)
+	// Icons that leave the query area are no longer visible
+	for (int32 SlotIndex : VisibleIconIndices)
 	{
-		// Update location for tracked actors
-		if (Icon.TrackedActor.IsValid())
+		if (IconSlots.IsValidIndex(SlotIndex))
 		{
-			Icon.WorldLocation = Icon.TrackedActor->GetActorLocation();
+			IconSlots[SlotIndex].Data.bVisible = false;
+		}
+	}
+	VisibleIconIndices.Reset();
 
-			// Update rotation if tracking actor
-			if (Icon.bRotateWithActor)
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	if (!Registry || !SceneCaptureComponent || IconSlots.Num() == 0)
+	{
+		return;
+	}
+
+	// The capture square can rotate with the player, query the circle through its corners
+	const float QueryRadius = GetCurrentZoomRadius() * UE_SQRT_2;
+	Registry->QueryRadius(this, SceneCaptureComponent->GetComponentLocation(), QueryRadius, HiddenCategoryMask, QueryHits);
+
+	for (const FHarmoniaMarkerQueryHit& Hit : QueryHits)
+	{
+		FHarmoniaMinimapIcon& Icon = IconSlots[Hit.PayloadIndex].Data;
+		Icon.WorldLocation = Hit.Location;
+
+		// Update rotation if tracking actor
+		if (Icon.bRotateWithActor)
+		{
+			if (const AActor* TrackedActor = Icon.TrackedActor.Get())
 			{
-				Icon.IconRotation = Icon.TrackedActor->GetActorRotation().Yaw;
+				Icon.IconRotation = TrackedActor->GetActorRotation().Yaw;
 			}
 		}
 
 		// Calculate minimap position
 		Icon.MinimapPosition = WorldToMinimapUV(Icon.WorldLocation);
-		Icon.bVisible = IsWorldLocationVisible(Icon.WorldLocation);
+		Icon.bVisible = Icon.MinimapPosition.X >= 0.0f && Icon.MinimapPosition.X <= 1.0f && Icon.MinimapPosition.Y >= 0.0f && Icon.MinimapPosition.Y <= 1.0f;
 
 		// Clamp off-screen icons to edge if configured
 		if (!Icon.bVisible && Icon.bClampToEdge)
@@ -525,19 +591,37 @@ void UHarmoniaMinimapComponent::UpdateIconPositions()
 			Icon.MinimapPosition = ClampToMinimapEdge(Icon.MinimapPosition);
 			Icon.bVisible = true; // Show at edge
 		}
+
+		if (Icon.bVisible)
+		{
+			VisibleIconIndices.Add(Hit.PayloadIndex);
+		}
 	}
+
+	// Sort by priority, slot order keeps ties stable between frames
+	VisibleIconIndices.Sort([this](int32 A, int32 B)
+	{
+		const int32 PriorityA = IconSlots[A].Data.Priority;
+		const int32 PriorityB = IconSlots[B].Data.Priority;
+		return PriorityA != PriorityB ? PriorityA > PriorityB : A < B;
+	});
 }
 
 void UHarmoniaMinimapComponent::CleanupInvalidIcons()
 {
-	for (int32 i = Icons.Num() - 1; i >= 0; --i)
+	// Remove icons tracking destroyed actors, the registry reports them
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	if (!Registry)
 	{
-		// Check if tracking an actor that was destroyed
-		if (Icons[i].TrackedActor.IsValid() == false && Icons[i].TrackedActor.IsExplicitlyNull() == false)
+		return;
+	}
+
+	Registry->ConsumeLostMarkers(this, LostSlots);
+	for (int32 SlotIndex : LostSlots)
+	{
+		if (IconSlots.IsValidIndex(SlotIndex))
 		{
-			FGuid RemovedID = Icons[i].IconID;
-			Icons.RemoveAt(i);
-			OnIconRemoved.Broadcast(RemovedID);
+			RemoveSlot(SlotIndex);
 		}
 	}
 }
@@ -580,27 +664,28 @@ void UHarmoniaMinimapComponent::RemoveActorIcons(AActor* Actor)
 	{
 		return;
 	}
-	
-	for (int32 i = Icons.Num() - 1; i >= 0; --i)
+
+	TArray<int32> SlotsToRemove;
+	for (auto It = IconSlots.CreateConstIterator(); It; ++It)
 	{
-		if (Icons[i].TrackedActor.Get() == Actor)
+		if (It->Data.TrackedActor.Get() == Actor)
 		{
-			FGuid RemovedID = Icons[i].IconID;
-			Icons.RemoveAt(i);
-			OnIconRemoved.Broadcast(RemovedID);
+			SlotsToRemove.Add(It.GetIndex());
 		}
 	}
+
+	for (int32 SlotIndex : SlotsToRemove)
+	{
+		RemoveSlot(SlotIndex);
+	}
 }
 
 void UHarmoniaMinimapComponent::SetIconVisible(FGuid IconID, bool bVisible)
 {
-	for (FHarmoniaMinimapIcon& Icon : Icons)
+	const int32 SlotIndex = FindSlot(IconID);
+	if (SlotIndex != INDEX_NONE)
 	{
-		if (Icon.IconID == IconID)
-		{
-			Icon.bVisible = bVisible;
-			return;
-		}
+		IconSlots[SlotIndex].Data.bVisible = bVisible;
 	}
 }
 
@@ -614,6 +699,8 @@ void UHarmoniaMinimapComponent::ToggleCategoryVisibility(FGameplayTag Category)
 	{
 		HiddenCategories.Add(Category);
 	}
+
+	RefreshHiddenCategoryMask();
 }
 
 bool UHarmoniaMinimapComponent::IsPositionInMinimapBounds(FVector WorldPosition) const
@@ -636,3 +723,66 @@ float UHarmoniaMinimapComponent::GetDirectionToPosition(FVector WorldPosition) c
 	
 	return FMath::Atan2(Direction.Y, Direction.X) * (180.0f / PI);
 }
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+void UHarmoniaMinimapComponent::RegisterSlot(int32 SlotIndex)
+{
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	if (!Registry)
+	{
+		return;
+	}
+
+	// Edge clamped icons show at any distance, the others only around the capture area
+	FIconSlot& Slot = IconSlots[SlotIndex];
+	const FHarmoniaMinimapIcon& Icon = Slot.Data;
+	if (Registry->IsRegistered(Slot.Handle))
+	{
+		Registry->Update(Slot.Handle, Icon.WorldLocation, Icon.TrackedActor.Get(), Icon.CategoryTag, Icon.bClampToEdge);
+	}
+	else
+	{
+		Slot.Handle = Registry->Register(this, SlotIndex, Icon.WorldLocation, Icon.TrackedActor.Get(), Icon.CategoryTag, Icon.bClampToEdge);
+	}
+}
+
+void UHarmoniaMinimapComponent::RemoveSlot(int32 SlotIndex)
+{
+	FIconSlot& Slot = IconSlots[SlotIndex];
+	const FGuid RemovedID = Slot.Data.IconID;
+
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->Unregister(Slot.Handle);
+	}
+
+	IconSlotById.Remove(RemovedID);
+	IconSlots.RemoveAt(SlotIndex);
+	VisibleIconIndices.RemoveSingle(SlotIndex);
+
+	OnIconRemoved.Broadcast(RemovedID);
+}
+
+int32 UHarmoniaMinimapComponent::FindSlot(const FGuid& IconID) const
+{
+	const int32* SlotIndex = IconSlotById.Find(IconID);
+	return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+void UHarmoniaMinimapComponent::RefreshHiddenCategoryMask()
+{
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	HiddenCategoryMask = Registry ? Registry->GetCategoryMask(HiddenCategories) : 0;
+}
+
+UHarmoniaMarkerRegistrySubsystem* UHarmoniaMinimapComponent::GetRegistry() const
+{
+	if (!CachedRegistry.IsValid())
+	{
+		const_cast<UHarmoniaMinimapComponent*>(this)->CachedRegistry = UHarmoniaMarkerRegistrySubsystem::Get(this);
+	}
+	return CachedRegistry.Get();
+}
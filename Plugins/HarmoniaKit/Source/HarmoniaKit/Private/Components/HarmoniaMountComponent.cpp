@@ -8,6 +8,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/DataTable.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 UHarmoniaMountComponent::UHarmoniaMountComponent()
 {
@@ -686,24 +687,44 @@ void UHarmoniaMountComponent::SpawnMountMesh(const FHarmoniaMountData& MountData
 			FAttachmentTransformRules::SnapToTargetIncludingScale
 		);
 
-		// Load and set mount mesh
-		if (!MountData.MountMesh.IsNull())
+		// Mesh and animation blueprint are streamed in, the component picks them up once resident
+		TWeakObjectPtr<USkeletalMeshComponent> WeakMountMesh = MountMeshComponent;
+		FSimpleDelegate ApplyMountAssets = FSimpleDelegate::CreateWeakLambda(this, [this, WeakMountMesh, MountData]()
 		{
-			USkeletalMesh* LoadedMesh = MountData.MountMesh.LoadSynchronous();
-			if (LoadedMesh)
+			// Dismounted or remounted while loading
+			if (!WeakMountMesh.IsValid() || WeakMountMesh.Get() != MountMeshComponent)
 			{
-				MountMeshComponent->SetSkeletalMesh(LoadedMesh);
+				return;
 			}
-		}
 
-		// Load and set animation blueprint
-		if (!MountData.AnimationBlueprint.IsNull())
-		{
-			TSubclassOf<UAnimInstance> AnimClass = MountData.AnimationBlueprint.LoadSynchronous();
-			if (AnimClass)
+			// Load and set mount mesh
+			if (!MountData.MountMesh.IsNull())
+			{
+				USkeletalMesh* LoadedMesh = MountData.MountMesh.LoadSynchronous();
+				if (LoadedMesh)
+				{
+					MountMeshComponent->SetSkeletalMesh(LoadedMesh);
+				}
+			}
+
+			// Load and set animation blueprint
+			if (!MountData.AnimationBlueprint.IsNull())
 			{
-				MountMeshComponent->SetAnimInstanceClass(AnimClass);
+				TSubclassOf<UAnimInstance> AnimClass = MountData.AnimationBlueprint.LoadSynchronous();
+				if (AnimClass)
+				{
+					MountMeshComponent->SetAnimInstanceClass(AnimClass);
+				}
 			}
+		});
+
+		if (UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this))
+		{
+			AssetResolver->RequestAssets({ MountData.MountMesh.ToSoftObjectPath(), MountData.AnimationBlueprint.ToSoftObjectPath() }, MoveTemp(ApplyMountAssets));
+		}
+		else
+		{
+			ApplyMountAssets.Execute();
 		}
 	}
 }
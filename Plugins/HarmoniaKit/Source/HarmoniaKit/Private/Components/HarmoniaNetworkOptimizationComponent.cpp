@@ -1,16 +1,14 @@
 ﻿// Copyright 2025 Snow Game Studio.
 
 #include "Components/HarmoniaNetworkOptimizationComponent.h"
-#include "GameFramework/PlayerController.h"
-#include "GameFramework/Character.h"
+#include "System/HarmoniaNetRelevancySubsystem.h"
+#include "GameFramework/Actor.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
-#include "Net/UnrealNetwork.h"
 
 UHarmoniaNetworkOptimizationComponent::UHarmoniaNetworkOptimizationComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 0.1f; // Low frequency tick
+	// Levels are recalculated in one pass by UHarmoniaNetRelevancySubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(false); // This component runs server-side
 }
 
@@ -21,7 +19,6 @@ void UHarmoniaNetworkOptimizationComponent::BeginPlay()
 	// Only run on server/authority
 	if (!GetOwner()->HasAuthority())
 	{
-		SetComponentTickEnabled(false);
 		return;
 	}
 
@@ -35,12 +32,20 @@ void UHarmoniaNetworkOptimizationComponent::BeginPlay()
 		GetOwner()->SetNetCullDistanceSquared(Config.NetCullDistanceSquared);
 	}
 
-	// Initial calculation
-	RecalculateLevel();
+	// Levelled from the next tier pass on
+	if (UHarmoniaNetRelevancySubsystem* NetRelevancy = UHarmoniaNetRelevancySubsystem::Get(this))
+	{
+		NetRelevancy->Register(this);
+	}
 }
 
 void UHarmoniaNetworkOptimizationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UHarmoniaNetRelevancySubsystem* NetRelevancy = UHarmoniaNetRelevancySubsystem::Get(this))
+	{
+		NetRelevancy->Unregister(this);
+	}
+
 	// Restore original values
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
@@ -51,35 +56,6 @@ void UHarmoniaNetworkOptimizationComponent::EndPlay(const EEndPlayReason::Type E
 	Super::EndPlay(EndPlayReason);
 }
 
-void UHarmoniaNetworkOptimizationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Only run on server
-	if (!GetOwner()->HasAuthority())
-	{
-		return;
-	}
-
-	// Recalculation timer
-	TimeSinceRecalculation += DeltaTime;
-	if (TimeSinceRecalculation >= Config.RecalculationInterval)
-	{
-		TimeSinceRecalculation = 0.0f;
-		RecalculateLevel();
-	}
-
-	// Update dormancy timer
-	if (CurrentLevel == EHarmoniaNetOptLevel::Dormant && Config.bEnableDormancy && !bDormancyActive)
-	{
-		DormantEligibleTime += DeltaTime;
-		if (DormantEligibleTime >= Config.DormancyDelay)
-		{
-			HandleDormancyTransition(true);
-		}
-	}
-}
-
 bool UHarmoniaNetworkOptimizationComponent::IsDormant() const
 {
 	return bDormancyActive;
@@ -146,44 +122,55 @@ void UHarmoniaNetworkOptimizationComponent::FlushNetDormancy()
 
 void UHarmoniaNetworkOptimizationComponent::RecalculateLevel()
 {
-	if (bLevelForced)
+	if (bLevelForced || !GetOwner())
 	{
 		return;
 	}
 
-	// Calculate distance
-	CachedDistanceToNearestPlayer = CalculateDistanceToNearestPlayer();
+	const UHarmoniaNetRelevancySubsystem* NetRelevancy = UHarmoniaNetRelevancySubsystem::Get(this);
+	const float Distance = NetRelevancy ? NetRelevancy->GetDistanceToNearestPlayer(GetOwner()->GetActorLocation()) : CachedDistanceToNearestPlayer;
 
-	// Convert to level
-	EHarmoniaNetOptLevel NewLevel = DistanceToLevel(CachedDistanceToNearestPlayer);
+	SetLevel(CalculateLevel(Config, Distance, CurrentLevel, bIsInCombat), Distance);
+}
 
-	// Apply combat boost
-	if (bIsInCombat && Config.bUseCombatBoost)
+bool UHarmoniaNetworkOptimizationComponent::SetLevel(EHarmoniaNetOptLevel NewLevel, float DistanceToNearestPlayer)
+{
+	CachedDistanceToNearestPlayer = DistanceToNearestPlayer;
+
+	if (bLevelForced || NewLevel == CurrentLevel)
 	{
-		if (NewLevel > Config.CombatMinLevel)
-		{
-			NewLevel = Config.CombatMinLevel;
-		}
+		return false;
 	}
 
-	// Check for change
-	if (NewLevel != CurrentLevel)
-	{
-		EHarmoniaNetOptLevel OldLevel = CurrentLevel;
-		CurrentLevel = NewLevel;
+	EHarmoniaNetOptLevel OldLevel = CurrentLevel;
+	CurrentLevel = NewLevel;
 
-		// Reset dormancy timer if no longer dormant-eligible
-		if (NewLevel != EHarmoniaNetOptLevel::Dormant)
+	// Reset dormancy timer if no longer dormant-eligible
+	if (NewLevel != EHarmoniaNetOptLevel::Dormant)
+	{
+		DormantEligibleTime = 0.0f;
+		if (bDormancyActive)
 		{
-			DormantEligibleTime = 0.0f;
-			if (bDormancyActive)
-			{
-				HandleDormancyTransition(false);
-			}
+			HandleDormancyTransition(false);
 		}
+	}
 
-		ApplyLevelSettings();
-		OnLevelChanged.Broadcast(OldLevel, CurrentLevel);
+	ApplyLevelSettings();
+	OnLevelChanged.Broadcast(OldLevel, CurrentLevel);
+	return true;
+}
+
+void UHarmoniaNetworkOptimizationComponent::UpdateDormancyDelay(float DeltaTime)
+{
+	if (CurrentLevel != EHarmoniaNetOptLevel::Dormant || !Config.bEnableDormancy || bDormancyActive)
+	{
+		return;
+	}
+
+	DormantEligibleTime += DeltaTime;
+	if (DormantEligibleTime >= Config.DormancyDelay)
+	{
+		HandleDormancyTransition(true);
 	}
 }
 
@@ -209,50 +196,25 @@ void UHarmoniaNetworkOptimizationComponent::ApplyLevelSettings()
 #endif
 }
 
-float UHarmoniaNetworkOptimizationComponent::CalculateDistanceToNearestPlayer() const
-{
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return 0.0f;
-	}
-
-	FVector OwnerLocation = GetOwner()->GetActorLocation();
-	float NearestDistSq = FLT_MAX;
-
-	// Check all player controllers
-	for (TActorIterator<APlayerController> It(World); It; ++It)
-	{
-		APlayerController* PC = *It;
-		if (PC && PC->GetPawn())
-		{
-			float DistSq = FVector::DistSquared(OwnerLocation, PC->GetPawn()->GetActorLocation());
-			NearestDistSq = FMath::Min(NearestDistSq, DistSq);
-		}
-	}
-
-	return (NearestDistSq < FLT_MAX) ? FMath::Sqrt(NearestDistSq) : 0.0f;
-}
-
-EHarmoniaNetOptLevel UHarmoniaNetworkOptimizationComponent::DistanceToLevel(float Distance) const
+EHarmoniaNetOptLevel UHarmoniaNetworkOptimizationComponent::DistanceToLevel(const FHarmoniaNetOptConfig& InConfig, float Distance)
 {
-	if (Distance <= Config.CriticalDistance)
+	if (Distance <= InConfig.CriticalDistance)
 	{
 		return EHarmoniaNetOptLevel::Critical;
 	}
-	else if (Distance <= Config.HighDistance)
+	else if (Distance <= InConfig.HighDistance)
 	{
 		return EHarmoniaNetOptLevel::High;
 	}
-	else if (Distance <= Config.MediumDistance)
+	else if (Distance <= InConfig.MediumDistance)
 	{
 		return EHarmoniaNetOptLevel::Medium;
 	}
-	else if (Distance <= Config.LowDistance)
+	else if (Distance <= InConfig.LowDistance)
 	{
 		return EHarmoniaNetOptLevel::Low;
 	}
-	else if (Distance <= Config.MinimalDistance)
+	else if (Distance <= InConfig.MinimalDistance)
 	{
 		return EHarmoniaNetOptLevel::Minimal;
 	}
@@ -262,6 +224,26 @@ EHarmoniaNetOptLevel UHarmoniaNetworkOptimizationComponent::DistanceToLevel(floa
 	}
 }
 
+EHarmoniaNetOptLevel UHarmoniaNetworkOptimizationComponent::CalculateLevel(const FHarmoniaNetOptConfig& InConfig, float Distance, EHarmoniaNetOptLevel InCurrentLevel, bool bInCombat)
+{
+	EHarmoniaNetOptLevel NewLevel = DistanceToLevel(InConfig, Distance);
+
+	// Dropping to a lower level needs the distance to clear the threshold by HysteresisDistance,
+	// i.e. never drop below the level the actor would have HysteresisDistance closer
+	if (NewLevel > InCurrentLevel)
+	{
+		NewLevel = FMath::Max(InCurrentLevel, DistanceToLevel(InConfig, Distance - InConfig.HysteresisDistance));
+	}
+
+	// Apply combat boost
+	if (bInCombat && InConfig.bUseCombatBoost && NewLevel > InConfig.CombatMinLevel)
+	{
+		NewLevel = InConfig.CombatMinLevel;
+	}
+
+	return NewLevel;
+}
+
 float UHarmoniaNetworkOptimizationComponent::GetNetUpdateFrequencyForLevel(EHarmoniaNetOptLevel Level) const
 {
 	switch (Level)
@@ -7,20 +7,22 @@
 #include "Net/UnrealNetwork.h"
 #include "Engine/DataTable.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/GameStateBase.h"
 #include "TimerManager.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 
 UHarmoniaQuestComponent::UHarmoniaQuestComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true; // Always tick for time-limited quests
+	// Time limits, hints and polled fail conditions are scheduled on the timer wheel, nothing needs a per-frame tick
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
 
 	QuestDataTable = nullptr;
 	InventoryComponent = nullptr;
 	CraftingComponent = nullptr;
 	TrackedQuest = FHarmoniaID();
+	ActiveQuests.OwnerComponent = this;
 
 	// Security: Rate limiting
 	LastOperationTime = 0.0f;
@@ -37,17 +39,21 @@ void UHarmoniaQuestComponent::BeginPlay()
 	GetCraftingComponent();
 }
 
-void UHarmoniaQuestComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UHarmoniaQuestComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Only server updates time-limited quests and fail conditions
-	if (GetOwnerRole() == ROLE_Authority)
+	if (UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel())
 	{
-		UpdateTimeLimitedQuests(DeltaTime);
-		CheckFailConditions(DeltaTime);
-		UpdateHintSystem(DeltaTime);
+		for (TPair<FHarmoniaID, TArray<FHarmoniaTimerWheelHandle>>& Pair : QuestTimerHandles)
+		{
+			for (FHarmoniaTimerWheelHandle& Handle : Pair.Value)
+			{
+				TimerWheel->Cancel(Handle);
+			}
+		}
 	}
+	QuestTimerHandles.Empty();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UHarmoniaQuestComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -62,10 +68,65 @@ void UHarmoniaQuestComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 	// Clients can query them via GetQuestStatistics() and GetQuestLogEntry()
 }
 
-void UHarmoniaQuestComponent::OnRep_ActiveQuests()
+void UHarmoniaQuestComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	FlushPendingQuestUpdates();
+}
+
+void UHarmoniaQuestComponent::MarkQuestProgressDirty(FHarmoniaID QuestId)
 {
-	// Client-side notification when active quests change
-	// UI can listen to delegate events
+	PendingDirtyQuests.Add(QuestId);
+}
+
+void UHarmoniaQuestComponent::FlushPendingQuestUpdates()
+{
+	if (PendingDirtyQuests.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FHarmoniaID& QuestId : PendingDirtyQuests)
+	{
+		// Quests completed or abandoned since they were queued are already gone from the list
+		if (FActiveQuestProgress* Progress = ActiveQuests.Find(QuestId))
+		{
+			ActiveQuests.MarkQuestDirty(*Progress);
+		}
+	}
+	PendingDirtyQuests.Reset();
+}
+
+void UHarmoniaQuestComponent::HandleActiveQuestReplicated(const FActiveQuestProgress& Progress, bool bAdded)
+{
+	FReplicatedObjectiveCounts& Known = ReplicatedObjectiveCounts.FindOrAdd(Progress.QuestId);
+
+	// New quest or new phase: objective list was replaced, nothing to diff against
+	const bool bObjectivesReplaced = bAdded || Known.Phase != Progress.CurrentPhase || Known.Counts.Num() != Progress.ObjectiveProgress.Num();
+
+	if (!bObjectivesReplaced)
+	{
+		for (int32 i = 0; i < Progress.ObjectiveProgress.Num(); ++i)
+		{
+			if (Known.Counts[i] != Progress.ObjectiveProgress[i].CurrentCount)
+			{
+				OnQuestObjectiveUpdated.Broadcast(Progress.QuestId, i, Progress.ObjectiveProgress[i]);
+			}
+		}
+	}
+
+	Known.Phase = Progress.CurrentPhase;
+	Known.Counts.SetNum(Progress.ObjectiveProgress.Num());
+	for (int32 i = 0; i < Progress.ObjectiveProgress.Num(); ++i)
+	{
+		Known.Counts[i] = Progress.ObjectiveProgress[i].CurrentCount;
+	}
+}
+
+void UHarmoniaQuestComponent::HandleActiveQuestRemovedReplicated(const FActiveQuestProgress& Progress)
+{
+	ReplicatedObjectiveCounts.Remove(Progress.QuestId);
 }
 
 void UHarmoniaQuestComponent::OnRep_TrackedQuest()
@@ -131,7 +192,7 @@ bool UHarmoniaQuestComponent::StartQuest(FHarmoniaID QuestId)
 	}
 
 	// Check max active quests limit
-	if (ActiveQuests.Num() >= MaxActiveQuests)
+	if (ActiveQuests.Items.Num() >= MaxActiveQuests)
 	{
 		UE_LOG(LogHarmoniaQuest, Warning, TEXT("Max active quests limit reached (%d)"), MaxActiveQuests);
 		return false;
@@ -158,7 +219,7 @@ bool UHarmoniaQuestComponent::StartQuest(FHarmoniaID QuestId)
 	NewProgress.bTracked = false;
 
 	// Add to active quests
-	ActiveQuests.Add(NewProgress);
+	IndexActiveQuest(ActiveQuests.Add(NewProgress));
 
 	// Update quest log
 	UpdateQuestLog(QuestId, QuestData, false);
@@ -240,6 +301,7 @@ bool UHarmoniaQuestComponent::CompleteQuest(FHarmoniaID QuestId, const TArray<in
 	}
 
 	// Calculate completion time
+	RefreshElapsedTime(*Progress);
 	float CompletionTime = Progress->ElapsedTime;
 
 	// Grant rewards
@@ -259,15 +321,11 @@ bool UHarmoniaQuestComponent::CompleteQuest(FHarmoniaID QuestId, const TArray<in
 	UpdateQuestLog(QuestId, QuestData, true);
 
 	// Remove from active quests
-	ActiveQuests.RemoveAll([QuestId](const FActiveQuestProgress& Item) {
-		return Item.QuestId == QuestId;
-	});
+	ActiveQuests.Remove(QuestId);
+	UnindexActiveQuest(QuestId);
 
 	// Add to completed quests
-	if (!CompletedQuests.Contains(QuestId))
-	{
-		CompletedQuests.Add(QuestId);
-	}
+	CompletedQuests.Add(QuestId);
 
 	// Remove from failed quests if it was there
 	FailedQuests.Remove(QuestId);
@@ -332,9 +390,8 @@ bool UHarmoniaQuestComponent::AbandonQuest(FHarmoniaID QuestId)
 	}
 
 	// Remove from active quests
-	ActiveQuests.RemoveAll([QuestId](const FActiveQuestProgress& Item) {
-		return Item.QuestId == QuestId;
-	});
+	ActiveQuests.Remove(QuestId);
+	UnindexActiveQuest(QuestId);
 
 	// Untrack if this was tracked quest
 	if (TrackedQuest == QuestId)
@@ -385,15 +442,11 @@ bool UHarmoniaQuestComponent::FailQuest(FHarmoniaID QuestId)
 	}
 
 	// Remove from active quests
-	ActiveQuests.RemoveAll([QuestId](const FActiveQuestProgress& Item) {
-		return Item.QuestId == QuestId;
-	});
+	ActiveQuests.Remove(QuestId);
+	UnindexActiveQuest(QuestId);
 
 	// Add to failed quests
-	if (!FailedQuests.Contains(QuestId))
-	{
-		FailedQuests.Add(QuestId);
-	}
+	FailedQuests.Add(QuestId);
 
 	// Untrack if this was tracked quest
 	if (TrackedQuest == QuestId)
@@ -454,6 +507,9 @@ bool UHarmoniaQuestComponent::UpdateQuestObjective(FHarmoniaID QuestId, int32 Ob
 	// Check if objective was completed
 	bool bObjectiveCompleted = Objective.IsCompleted() && OldCount < Objective.RequiredCount;
 
+	// Replicated with the next net update, together with any other progress made this frame
+	MarkQuestProgressDirty(QuestId);
+
 	// Broadcast event
 	OnQuestObjectiveUpdated.Broadcast(QuestId, ObjectiveIndex, Objective);
 
@@ -464,12 +520,6 @@ bool UHarmoniaQuestComponent::UpdateQuestObjective(FHarmoniaID QuestId, int32 Ob
 		TriggerQuestEvents(QuestId, EQuestEventTrigger::OnObjectiveComplete);
 	}
 
-	// Notify client
-	if (GetOwnerRole() == ROLE_Authority)
-	{
-		ClientObjectiveUpdated(QuestId, ObjectiveIndex);
-	}
-
 	// Get quest data
 	FHarmoniaQuestData QuestData;
 	if (GetQuestData(QuestId, QuestData))
@@ -499,6 +549,7 @@ bool UHarmoniaQuestComponent::UpdateQuestObjective(FHarmoniaID QuestId, int32 Ob
 				{
 					// Last phase complete, quest is ready to complete
 					QuestProgress->State = EQuestState::ReadyToComplete;
+					MarkQuestProgressDirty(QuestId);
 					OnQuestReadyToComplete.Broadcast(QuestId, QuestData);
 
 					if (QuestData.bAutoComplete)
@@ -511,6 +562,7 @@ bool UHarmoniaQuestComponent::UpdateQuestObjective(FHarmoniaID QuestId, int32 Ob
 			{
 				// Non-phased quest, ready to complete
 				QuestProgress->State = EQuestState::ReadyToComplete;
+				MarkQuestProgressDirty(QuestId);
 				OnQuestReadyToComplete.Broadcast(QuestId, QuestData);
 
 				// Auto-complete if enabled
@@ -536,22 +588,15 @@ void UHarmoniaQuestComponent::UpdateQuestObjectivesByType(EQuestObjectiveType Ob
 		return;
 	}
 
-	// Update all matching objectives in active quests
-	for (FActiveQuestProgress& QuestProgress : ActiveQuests)
+	const TArray<FQuestObjectiveRef>* Matches = ObjectiveIndex.Find(FQuestObjectiveIndexKey(ObjectiveType, TargetId));
+	if (!Matches)
 	{
-		for (int32 i = 0; i < QuestProgress.ObjectiveProgress.Num(); ++i)
-		{
-			FQuestObjective& Objective = QuestProgress.ObjectiveProgress[i];
-
-			// Check if objective matches
-			if (Objective.ObjectiveType == ObjectiveType &&
-				Objective.TargetId == TargetId &&
-				!Objective.IsCompleted())
-			{
-				UpdateQuestObjective(QuestProgress.QuestId, i, Progress);
-			}
-		}
+		return;
 	}
+
+	// Copy: completing an objective can complete the quest or advance its phase, both of which edit the index
+	TArray<FQuestObjectiveRef, TInlineAllocator<8>> MatchesCopy(*Matches);
+	ApplyObjectiveProgress(MatchesCopy, Progress);
 }
 
 void UHarmoniaQuestComponent::UpdateQuestObjectivesByTags(EQuestObjectiveType ObjectiveType, FGameplayTagContainer TargetTags, int32 Progress)
@@ -562,22 +607,38 @@ void UHarmoniaQuestComponent::UpdateQuestObjectivesByTags(EQuestObjectiveType Ob
 		return;
 	}
 
-	// Update all matching objectives in active quests
-	for (FActiveQuestProgress& QuestProgress : ActiveQuests)
+	// Objectives are indexed under their tags and all parent tags, so an exact lookup per event tag
+	// gives the same matches as Objective.TargetTags.HasAny(TargetTags)
+	TArray<FQuestObjectiveRef, TInlineAllocator<8>> AllMatches;
+	for (const FGameplayTag& Tag : TargetTags)
 	{
-		for (int32 i = 0; i < QuestProgress.ObjectiveProgress.Num(); ++i)
+		if (const TArray<FQuestObjectiveRef>* Matches = ObjectiveIndex.Find(FQuestObjectiveIndexKey(ObjectiveType, Tag)))
 		{
-			FQuestObjective& Objective = QuestProgress.ObjectiveProgress[i];
-
-			// Check if objective matches by tags
-			if (Objective.ObjectiveType == ObjectiveType &&
-				!Objective.IsCompleted() &&
-				Objective.TargetTags.HasAny(TargetTags))
+			for (const FQuestObjectiveRef& Match : *Matches)
 			{
-				UpdateQuestObjective(QuestProgress.QuestId, i, Progress);
+				AllMatches.AddUnique(Match);
 			}
 		}
 	}
+
+	ApplyObjectiveProgress(AllMatches, Progress);
+}
+
+void UHarmoniaQuestComponent::ApplyObjectiveProgress(TConstArrayView<FQuestObjectiveRef> Matches, int32 Progress)
+{
+	for (const FQuestObjectiveRef& Match : Matches)
+	{
+		const FActiveQuestProgress* QuestProgress = FindActiveQuest(Match.QuestId);
+		if (!QuestProgress || QuestProgress->CurrentPhase != Match.Phase || !QuestProgress->ObjectiveProgress.IsValidIndex(Match.ObjectiveIndex))
+		{
+			continue;
+		}
+
+		if (!QuestProgress->ObjectiveProgress[Match.ObjectiveIndex].IsCompleted())
+		{
+			UpdateQuestObjective(Match.QuestId, Match.ObjectiveIndex, Progress);
+		}
+	}
 }
 
 void UHarmoniaQuestComponent::SetTrackedQuest(FHarmoniaID QuestId)
@@ -597,10 +658,15 @@ void UHarmoniaQuestComponent::SetTrackedQuest(FHarmoniaID QuestId)
 
 	TrackedQuest = QuestId;
 
-	// Update tracked flag on quest progress
-	for (FActiveQuestProgress& Progress : ActiveQuests)
+	// Update tracked flag on quest progress, only the entries that flip need to replicate
+	for (FActiveQuestProgress& Progress : ActiveQuests.Items)
 	{
-		Progress.bTracked = (Progress.QuestId == QuestId);
+		const bool bTracked = (Progress.QuestId == QuestId);
+		if (Progress.bTracked != bTracked)
+		{
+			Progress.bTracked = bTracked;
+			ActiveQuests.MarkQuestDirty(Progress);
+		}
 	}
 }
 
@@ -631,11 +697,31 @@ bool UHarmoniaQuestComponent::GetActiveQuestProgress(FHarmoniaID QuestId, FActiv
 	if (Progress)
 	{
 		OutProgress = *Progress;
+		RefreshElapsedTime(OutProgress);
 		return true;
 	}
 	return false;
 }
 
+float UHarmoniaQuestComponent::GetQuestElapsedTime(FHarmoniaID QuestId) const
+{
+	const FActiveQuestProgress* Progress = FindActiveQuest(QuestId);
+	return Progress ? FMath::Max(0.0f, GetQuestTimeSeconds() - Progress->StartTime) : 0.0f;
+}
+
+float UHarmoniaQuestComponent::GetQuestRemainingTime(FHarmoniaID QuestId) const
+{
+	const FActiveQuestProgress* Progress = FindActiveQuest(QuestId);
+	const FHarmoniaQuestData* QuestData = Progress ? FindQuestData(QuestId) : nullptr;
+	if (!QuestData || !Progress->HasTimeLimit(*QuestData))
+	{
+		return 0.0f;
+	}
+
+	const float ElapsedTime = FMath::Max(0.0f, GetQuestTimeSeconds() - Progress->StartTime);
+	return FMath::Max(0.0f, QuestData->TimeLimit - ElapsedTime);
+}
+
 bool UHarmoniaQuestComponent::IsQuestActive(FHarmoniaID QuestId) const
 {
 	return FindActiveQuest(QuestId) != nullptr;
@@ -938,39 +1024,66 @@ void UHarmoniaQuestComponent::CheckQuestChain(FHarmoniaID CompletedQuestId)
 //~ Time-Limited Quests
 //~==============================================
 
-void UHarmoniaQuestComponent::UpdateTimeLimitedQuests(float DeltaTime)
+void UHarmoniaQuestComponent::OnQuestTimeLimitExpired(FHarmoniaID QuestId)
 {
-	TArray<FHarmoniaID> QuestsToFail;
+	FActiveQuestProgress* Progress = FindActiveQuest(QuestId);
+	if (!Progress)
+	{
+		return;
+	}
 
-	// Update elapsed time for all active quests
-	for (FActiveQuestProgress& Progress : ActiveQuests)
+	const FHarmoniaQuestData* QuestData = FindQuestData(QuestId);
+	if (!QuestData)
 	{
-		Progress.ElapsedTime += DeltaTime;
+		return;
+	}
 
-		// Check time limit
-		FHarmoniaQuestData QuestData;
-		if (GetQuestData(Progress.QuestId, QuestData))
+	RefreshElapsedTime(*Progress);
+	if (!Progress->IsTimeUp(*QuestData))
+	{
+		return;
+	}
+
+	// TimeLimit fail conditions share the quest's time limit
+	for (const FQuestFailCondition& Condition : QuestData->FailConditions)
+	{
+		if (Condition.ConditionType == EQuestFailConditionType::TimeLimit)
 		{
-			if (Progress.IsTimeUp(QuestData))
-			{
-				QuestsToFail.Add(Progress.QuestId);
-			}
+			OnFailConditionTriggered(QuestId, Condition);
+			break;
 		}
 	}
 
-	// Fail quests that exceeded time limit
-	for (const FHarmoniaID& QuestId : QuestsToFail)
+	FailQuest(QuestId);
+}
+
+void UHarmoniaQuestComponent::RefreshElapsedTime(FActiveQuestProgress& Progress) const
+{
+	if (GetWorld())
 	{
-		FailQuest(QuestId);
+		Progress.ElapsedTime = FMath::Max(0.0f, GetQuestTimeSeconds() - Progress.StartTime);
 	}
 }
 
+float UHarmoniaQuestComponent::GetQuestTimeSeconds() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0f;
+	}
+
+	// Start times are stamped on the server, clients read them against the synced server clock
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? (float)GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
 bool UHarmoniaQuestComponent::CheckQuestTimeLimit(FHarmoniaID QuestId, const FActiveQuestProgress& Progress)
 {
-	FHarmoniaQuestData QuestData;
-	if (GetQuestData(QuestId, QuestData))
+	const FHarmoniaQuestData* QuestData = FindQuestData(QuestId);
+	if (QuestData && Progress.HasTimeLimit(*QuestData))
 	{
-		return Progress.IsTimeUp(QuestData);
+		return GetWorld()->GetTimeSeconds() - Progress.StartTime >= QuestData->TimeLimit;
 	}
 	return false;
 }
@@ -1086,11 +1199,6 @@ void UHarmoniaQuestComponent::ClientQuestAbandoned_Implementation(FHarmoniaID Qu
 	// Client notification
 }
 
-void UHarmoniaQuestComponent::ClientObjectiveUpdated_Implementation(FHarmoniaID QuestId, int32 ObjectiveIndex)
-{
-	// Client notification
-}
-
 //~==============================================
 //~ Save/Load System
 //~==============================================
@@ -1098,17 +1206,33 @@ void UHarmoniaQuestComponent::ClientObjectiveUpdated_Implementation(FHarmoniaID
 FQuestSaveData UHarmoniaQuestComponent::GetQuestSaveData() const
 {
 	FQuestSaveData SaveData;
-	SaveData.ActiveQuests = ActiveQuests;
-	SaveData.CompletedQuests = CompletedQuests;
-	SaveData.FailedQuests = FailedQuests;
+	SaveData.ActiveQuests = ActiveQuests.Items;
+	SaveData.CompletedQuests = CompletedQuests.GetIds();
+	SaveData.FailedQuests = FailedQuests.GetIds();
+
+	// Elapsed time is derived from StartTime while the quest runs, store the current value
+	for (FActiveQuestProgress& Progress : SaveData.ActiveQuests)
+	{
+		RefreshElapsedTime(Progress);
+	}
 	return SaveData;
 }
 
 void UHarmoniaQuestComponent::LoadQuestFromSaveData(const FQuestSaveData& SaveData)
 {
-	ActiveQuests = SaveData.ActiveQuests;
-	CompletedQuests = SaveData.CompletedQuests;
-	FailedQuests = SaveData.FailedQuests;
+	ActiveQuests.Reset(SaveData.ActiveQuests);
+	CompletedQuests.Reset(SaveData.CompletedQuests);
+	FailedQuests.Reset(SaveData.FailedQuests);
+	PendingDirtyQuests.Reset();
+
+	// Saved start times belong to another session, continue from the saved elapsed time
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	for (FActiveQuestProgress& Progress : ActiveQuests.Items)
+	{
+		Progress.StartTime = CurrentTime - Progress.ElapsedTime;
+	}
+
+	RebuildActiveQuestIndex();
 }
 
 //~==============================================
@@ -1168,16 +1292,22 @@ FGameplayTagContainer UHarmoniaQuestComponent::GetCharacterTags() const
 
 FActiveQuestProgress* UHarmoniaQuestComponent::FindActiveQuest(FHarmoniaID QuestId)
 {
-	return ActiveQuests.FindByPredicate([QuestId](const FActiveQuestProgress& Item) {
-		return Item.QuestId == QuestId;
-	});
+	return ActiveQuests.Find(QuestId);
 }
 
 const FActiveQuestProgress* UHarmoniaQuestComponent::FindActiveQuest(FHarmoniaID QuestId) const
 {
-	return ActiveQuests.FindByPredicate([QuestId](const FActiveQuestProgress& Item) {
-		return Item.QuestId == QuestId;
-	});
+	return ActiveQuests.Find(QuestId);
+}
+
+const FHarmoniaQuestData* UHarmoniaQuestComponent::FindQuestData(FHarmoniaID QuestId) const
+{
+	if (!QuestDataTable || !QuestId.IsValid())
+	{
+		return nullptr;
+	}
+
+	return QuestDataTable->FindRow<FHarmoniaQuestData>(QuestId.Id, TEXT("FindQuestData"));
 }
 
 void UHarmoniaQuestComponent::CheckAutoComplete(FHarmoniaID QuestId)
@@ -1192,6 +1322,175 @@ void UHarmoniaQuestComponent::CheckAutoComplete(FHarmoniaID QuestId)
 	}
 }
 
+//~==============================================
+//~ Objective Index
+//~==============================================
+
+void UHarmoniaQuestComponent::IndexActiveQuest(const FActiveQuestProgress& Progress)
+{
+	// Objective progress, fail conditions and timers are all server driven
+	if (GetOwnerRole() < ROLE_Authority)
+	{
+		return;
+	}
+
+	const FHarmoniaID QuestId = Progress.QuestId;
+	IndexObjectives(Progress);
+
+	const FHarmoniaQuestData* QuestData = FindQuestData(QuestId);
+	if (!QuestData)
+	{
+		return;
+	}
+
+	bool bHasPolledFailCondition = false;
+	for (const FQuestFailCondition& Condition : QuestData->FailConditions)
+	{
+		FailConditionIndex.FindOrAdd(Condition.ConditionType).AddUnique(QuestId);
+		bHasPolledFailCondition |= (Condition.ConditionType == EQuestFailConditionType::LocationLeft);
+	}
+
+	UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel();
+	if (!TimerWheel)
+	{
+		return;
+	}
+
+	TArray<FHarmoniaTimerWheelHandle>& Handles = QuestTimerHandles.FindOrAdd(QuestId);
+
+	if (Progress.HasTimeLimit(*QuestData))
+	{
+		Handles.Add(TimerWheel->ScheduleAt(Progress.StartTime + QuestData->TimeLimit,
+			FSimpleDelegate::CreateUObject(this, &UHarmoniaQuestComponent::OnQuestTimeLimitExpired, QuestId)));
+	}
+
+	for (int32 HintIndex = 0; HintIndex < QuestData->Hints.Num(); ++HintIndex)
+	{
+		Handles.Add(TimerWheel->ScheduleAt(Progress.StartTime + QuestData->Hints[HintIndex].ShowAfterSeconds,
+			FSimpleDelegate::CreateUObject(this, &UHarmoniaQuestComponent::OnHintDelayElapsed, QuestId, HintIndex)));
+	}
+
+	if (bHasPolledFailCondition)
+	{
+		Handles.Add(TimerWheel->ScheduleAfter(FailConditionCheckInterval,
+			FSimpleDelegate::CreateUObject(this, &UHarmoniaQuestComponent::CheckFailConditions, QuestId)));
+	}
+}
+
+void UHarmoniaQuestComponent::UnindexActiveQuest(FHarmoniaID QuestId)
+{
+	UnindexObjectives(QuestId);
+
+	for (auto It = FailConditionIndex.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveSwap(QuestId);
+		if (It.Value().Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<FHarmoniaTimerWheelHandle> Handles;
+	if (QuestTimerHandles.RemoveAndCopyValue(QuestId, Handles))
+	{
+		if (UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel())
+		{
+			for (FHarmoniaTimerWheelHandle& Handle : Handles)
+			{
+				TimerWheel->Cancel(Handle);
+			}
+		}
+	}
+}
+
+void UHarmoniaQuestComponent::IndexObjectives(const FActiveQuestProgress& Progress)
+{
+	if (GetOwnerRole() < ROLE_Authority)
+	{
+		return;
+	}
+
+	TArray<FQuestObjectiveIndexKey>& QuestKeys = ObjectiveIndexKeysByQuest.FindOrAdd(Progress.QuestId);
+
+	auto AddEntry = [this, &QuestKeys](const FQuestObjectiveIndexKey& Key, const FQuestObjectiveRef& Ref)
+	{
+		ObjectiveIndex.FindOrAdd(Key).Add(Ref);
+		QuestKeys.AddUnique(Key);
+	};
+
+	for (int32 i = 0; i < Progress.ObjectiveProgress.Num(); ++i)
+	{
+		const FQuestObjective& Objective = Progress.ObjectiveProgress[i];
+
+		FQuestObjectiveRef Ref;
+		Ref.QuestId = Progress.QuestId;
+		Ref.Phase = Progress.CurrentPhase;
+		Ref.ObjectiveIndex = i;
+
+		if (Objective.TargetId.IsValid())
+		{
+			AddEntry(FQuestObjectiveIndexKey(Objective.ObjectiveType, Objective.TargetId), Ref);
+		}
+
+		// Parents included: an event tagged Enemy matches an objective targeting Enemy.Goblin, as HasAny does
+		for (const FGameplayTag& Tag : Objective.TargetTags.GetGameplayTagParents())
+		{
+			AddEntry(FQuestObjectiveIndexKey(Objective.ObjectiveType, Tag), Ref);
+		}
+	}
+}
+
+void UHarmoniaQuestComponent::UnindexObjectives(FHarmoniaID QuestId)
+{
+	TArray<FQuestObjectiveIndexKey> QuestKeys;
+	if (!ObjectiveIndexKeysByQuest.RemoveAndCopyValue(QuestId, QuestKeys))
+	{
+		return;
+	}
+
+	for (const FQuestObjectiveIndexKey& Key : QuestKeys)
+	{
+		if (TArray<FQuestObjectiveRef>* Refs = ObjectiveIndex.Find(Key))
+		{
+			Refs->RemoveAllSwap([&QuestId](const FQuestObjectiveRef& Ref) { return Ref.QuestId == QuestId; });
+			if (Refs->Num() == 0)
+			{
+				ObjectiveIndex.Remove(Key);
+			}
+		}
+	}
+}
+
+void UHarmoniaQuestComponent::RebuildActiveQuestIndex()
+{
+	TArray<FHarmoniaID> IndexedQuests;
+	QuestTimerHandles.GetKeys(IndexedQuests);
+	for (const TPair<FHarmoniaID, TArray<FQuestObjectiveIndexKey>>& Pair : ObjectiveIndexKeysByQuest)
+	{
+		IndexedQuests.AddUnique(Pair.Key);
+	}
+
+	for (const FHarmoniaID& QuestId : IndexedQuests)
+	{
+		UnindexActiveQuest(QuestId);
+	}
+
+	ObjectiveIndex.Reset();
+	ObjectiveIndexKeysByQuest.Reset();
+	FailConditionIndex.Reset();
+
+	for (const FActiveQuestProgress& Progress : ActiveQuests.Items)
+	{
+		IndexActiveQuest(Progress);
+	}
+}
+
+UHarmoniaTimerWheelSubsystem* UHarmoniaQuestComponent::GetTimerWheel() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UHarmoniaTimerWheelSubsystem>() : nullptr;
+}
+
 //~==============================================
 //~ Quest Phase System
 //~==============================================
@@ -1251,6 +1550,7 @@ bool UHarmoniaQuestComponent::AdvanceToNextPhase(FHarmoniaID QuestId)
 
 	// Advance to next phase
 	Progress->CurrentPhase = NextPhase;
+	MarkQuestProgressDirty(QuestId);
 
 	// Update objectives for new phase
 	if (QuestData.Phases.IsValidIndex(NextPhase))
@@ -1258,6 +1558,10 @@ bool UHarmoniaQuestComponent::AdvanceToNextPhase(FHarmoniaID QuestId)
 		Progress->ObjectiveProgress = QuestData.Phases[NextPhase].PhaseObjectives;
 	}
 
+	// Re-index: the previous phase's objectives no longer receive progress
+	UnindexObjectives(QuestId);
+	IndexObjectives(*Progress);
+
 	// Trigger next phase start events
 	TriggerQuestEvents(QuestId, EQuestEventTrigger::OnPhaseChange);
 
@@ -1359,7 +1663,7 @@ TArray<FQuestMarker> UHarmoniaQuestComponent::GetAllActiveMarkers() const
 {
 	TArray<FQuestMarker> AllMarkers;
 
-	for (const FActiveQuestProgress& Progress : ActiveQuests)
+	for (const FActiveQuestProgress& Progress : ActiveQuests.Items)
 	{
 		TArray<FQuestMarker> QuestMarkers = GetActiveMarkers(Progress.QuestId);
 		AllMarkers.Append(QuestMarkers);
@@ -1395,7 +1699,7 @@ TArray<FQuestHint> UHarmoniaQuestComponent::GetAvailableHints(FHarmoniaID QuestI
 		return AvailableHints;
 	}
 
-	float CurrentTime = GetWorld()->GetTimeSeconds();
+	float CurrentTime = GetQuestTimeSeconds();
 	float QuestTime = CurrentTime - Progress->StartTime;
 
 	// Check each hint if it should be shown
@@ -1414,7 +1718,7 @@ TArray<FQuestHint> UHarmoniaQuestComponent::GetAvailableHints(FHarmoniaID QuestI
 		}
 
 		// Check if quest is stuck (no progress for a while)
-		if (Hint.bShowIfStuck && Progress->ElapsedTime < Hint.ShowAfterSeconds)
+		if (Hint.bShowIfStuck && QuestTime < Hint.ShowAfterSeconds)
 		{
 			continue;
 		}
@@ -1450,23 +1754,19 @@ void UHarmoniaQuestComponent::MarkHintShown(FHarmoniaID QuestId, int32 HintIndex
 	}
 }
 
-void UHarmoniaQuestComponent::UpdateHintSystem(float DeltaTime)
+void UHarmoniaQuestComponent::OnHintDelayElapsed(FHarmoniaID QuestId, int32 HintIndex)
 {
-	// Check hints for all active quests
-	for (const FActiveQuestProgress& Progress : ActiveQuests)
+	if (!IsQuestActive(QuestId))
 	{
-		TArray<FQuestHint> Hints = GetAvailableHints(Progress.QuestId);
+		return;
+	}
 
-		// Auto-show hints if any are available
-		for (int32 i = 0; i < Hints.Num(); ++i)
-		{
-			if (!Hints[i].bShown)
-			{
-				// In a real implementation, you'd notify UI to show the hint
-				UE_LOG(LogHarmoniaQuest, Verbose, TEXT("Hint available for quest %s: %s"),
-					*Progress.QuestId.ToString(), *Hints[i].HintText.ToString());
-			}
-		}
+	const FHarmoniaQuestData* QuestData = FindQuestData(QuestId);
+	if (QuestData && QuestData->Hints.IsValidIndex(HintIndex) && !QuestData->Hints[HintIndex].bShown)
+	{
+		// In a real implementation, you'd notify UI to show the hint
+		UE_LOG(LogHarmoniaQuest, Verbose, TEXT("Hint available for quest %s: %s"),
+			*QuestId.ToString(), *QuestData->Hints[HintIndex].HintText.ToString());
 	}
 }
 
@@ -1762,7 +2062,7 @@ void UHarmoniaQuestComponent::ExecuteQuestEvent(const FQuestEvent& Event, FHarmo
 //~ Quest Fail Conditions
 //~==============================================
 
-void UHarmoniaQuestComponent::CheckFailConditions(float DeltaTime)
+void UHarmoniaQuestComponent::NotifyFailConditionEvent(EQuestFailConditionType ConditionType, FHarmoniaID TargetId)
 {
 	// Server only
 	if (GetOwnerRole() < ROLE_Authority)
@@ -1770,34 +2070,80 @@ void UHarmoniaQuestComponent::CheckFailConditions(float DeltaTime)
 		return;
 	}
 
-	TArray<FHarmoniaID> QuestsToFail;
+	const TArray<FHarmoniaID>* Candidates = FailConditionIndex.Find(ConditionType);
+	if (!Candidates)
+	{
+		return;
+	}
 
-	for (const FActiveQuestProgress& Progress : ActiveQuests)
+	TArray<FHarmoniaID, TInlineAllocator<4>> QuestsToFail;
+	for (const FHarmoniaID& QuestId : *Candidates)
 	{
-		FHarmoniaQuestData QuestData;
-		if (!GetQuestData(Progress.QuestId, QuestData))
+		const FHarmoniaQuestData* QuestData = FindQuestData(QuestId);
+		if (!QuestData)
 		{
 			continue;
 		}
 
-		// Check each fail condition
-		for (const FQuestFailCondition& Condition : QuestData.FailConditions)
+		for (const FQuestFailCondition& Condition : QuestData->FailConditions)
 		{
-			if (CheckFailCondition(Condition, Progress.QuestId))
+			if (Condition.ConditionType != ConditionType)
 			{
-				QuestsToFail.AddUnique(Progress.QuestId);
-				OnFailConditionTriggered(Progress.QuestId, Condition);
+				continue;
+			}
+
+			const FHarmoniaID& ConditionTarget = (ConditionType == EQuestFailConditionType::ItemLost) ? Condition.RequiredItemId : Condition.TargetId;
+			if (!ConditionTarget.IsValid() || ConditionTarget == TargetId)
+			{
+				QuestsToFail.AddUnique(QuestId);
+				OnFailConditionTriggered(QuestId, Condition);
+				break;
 			}
 		}
 	}
 
-	// Fail quests
+	// Fail quests (this edits FailConditionIndex, so it happens after the scan)
 	for (const FHarmoniaID& QuestId : QuestsToFail)
 	{
 		FailQuest(QuestId);
 	}
 }
 
+void UHarmoniaQuestComponent::CheckFailConditions(FHarmoniaID QuestId)
+{
+	// Server only
+	if (GetOwnerRole() < ROLE_Authority || !IsQuestActive(QuestId))
+	{
+		return;
+	}
+
+	const FHarmoniaQuestData* QuestData = FindQuestData(QuestId);
+	if (!QuestData)
+	{
+		return;
+	}
+
+	// Only conditions that depend on continuously changing state are polled, the rest are event driven
+	for (const FQuestFailCondition& Condition : QuestData->FailConditions)
+	{
+		if (Condition.ConditionType == EQuestFailConditionType::LocationLeft && CheckFailCondition(Condition, QuestId))
+		{
+			OnFailConditionTriggered(QuestId, Condition);
+			FailQuest(QuestId);
+			return;
+		}
+	}
+
+	// Still active, check again later
+	if (UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel())
+	{
+		TArray<FHarmoniaTimerWheelHandle>& Handles = QuestTimerHandles.FindOrAdd(QuestId);
+		Handles.RemoveAll([TimerWheel](const FHarmoniaTimerWheelHandle& Handle) { return !TimerWheel->IsScheduled(Handle); });
+		Handles.Add(TimerWheel->ScheduleAfter(FailConditionCheckInterval,
+			FSimpleDelegate::CreateUObject(this, &UHarmoniaQuestComponent::CheckFailConditions, QuestId)));
+	}
+}
+
 bool UHarmoniaQuestComponent::CheckFailCondition(const FQuestFailCondition& Condition, FHarmoniaID QuestId)
 {
 	switch (Condition.ConditionType)
@@ -1805,15 +2151,7 @@ bool UHarmoniaQuestComponent::CheckFailCondition(const FQuestFailCondition& Cond
 		case EQuestFailConditionType::TimeLimit:
 		{
 			const FActiveQuestProgress* Progress = FindActiveQuest(QuestId);
-			if (Progress)
-			{
-				FHarmoniaQuestData QuestData;
-				if (GetQuestData(QuestId, QuestData))
-				{
-					return Progress->IsTimeUp(QuestData);
-				}
-			}
-			return false;
+			return Progress && CheckQuestTimeLimit(QuestId, *Progress);
 		}
 
 		case EQuestFailConditionType::NPCDied:
@@ -1916,6 +2254,7 @@ void UHarmoniaQuestComponent::Debug_CompleteQuestObjectives(FHarmoniaID QuestId)
 			Objective.CurrentCount = Objective.RequiredCount;
 		}
 		Progress->State = EQuestState::ReadyToComplete;
+		ActiveQuests.MarkQuestDirty(*Progress);
 
 		UE_LOG(LogHarmoniaQuest, Warning, TEXT("[DEBUG] Quest %s objectives completed"), *QuestId.ToString());
 	}
@@ -1932,7 +2271,8 @@ void UHarmoniaQuestComponent::Debug_UnlockAllQuests()
 
 void UHarmoniaQuestComponent::Debug_ResetAllQuests()
 {
-	ActiveQuests.Empty();
+	ActiveQuests.Reset(TArray<FActiveQuestProgress>());
+	RebuildActiveQuestIndex();
 	CompletedQuests.Empty();
 	FailedQuests.Empty();
 	TrackedQuest = FHarmoniaID();
@@ -4,6 +4,7 @@
 #include "HarmoniaLogCategories.h"
 #include "Components/HarmoniaLockOnComponent.h"
 #include "Actors/HarmoniaProjectile.h"
+#include "System/HarmoniaProjectileSubsystem.h"
 #include "AbilitySystem/HarmoniaAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
@@ -11,6 +12,7 @@
 #include "Engine/DataTable.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Net/UnrealNetwork.h"
@@ -480,27 +482,62 @@ void UHarmoniaRangedCombatComponent::FireProjectile()
 
 	LastFireTime = GetWorld()->GetTimeSeconds();
 
-	// Spawn multiple projectiles if needed (shotgun)
-	for (int32 i = 0; i < ProjectilesPerShot; ++i)
+	if (GetOwnerRole() < ROLE_Authority)
+	{
+		// The server fires the whole shot and sends the volley back to every client
+		ServerFireProjectile(SpawnLocation, Direction, DamageMultiplier);
+	}
+	else if (bUseActorProjectiles && DefaultProjectileClass)
 	{
-		FVector SpreadDirection = Direction;
-		if (i > 0 && SpreadAngle > 0.0f)
+		// Spawn multiple projectiles if needed (shotgun)
+		for (int32 i = 0; i < ProjectilesPerShot; ++i)
 		{
-			float SpreadRadians = FMath::DegreesToRadians(SpreadAngle);
-			SpreadDirection = FMath::VRandCone(Direction, SpreadRadians).GetSafeNormal();
+			FVector SpreadDirection = Direction;
+			if (i > 0 && SpreadAngle > 0.0f)
+			{
+				float SpreadRadians = FMath::DegreesToRadians(SpreadAngle);
+				SpreadDirection = FMath::VRandCone(Direction, SpreadRadians).GetSafeNormal();
+			}
+
+			// For now, create simple projectile data
+			FHarmoniaProjectileData ProjectileData;
+			ProjectileData.ProjectileType = DefaultProjectileType;
+			ProjectileData.InitialSpeed = 3000.0f;
+			ProjectileData.DamageConfig.DamageMultiplier = DamageMultiplier * BaseDamageMultiplier;
+
+			AActor* Projectile = SpawnProjectile(ProjectileData, SpawnLocation, SpreadDirection, DamageMultiplier);
+
+			if (Projectile)
+			{
+				OnProjectileFired.Broadcast(Projectile, ProjectileData);
+			}
 		}
-
+	}
+	else
+	{
 		// For now, create simple projectile data
-		FHarmoniaProjectileData ProjectileData;
-		ProjectileData.ProjectileType = DefaultProjectileType;
-		ProjectileData.InitialSpeed = 3000.0f;
-		ProjectileData.DamageConfig.DamageMultiplier = DamageMultiplier * BaseDamageMultiplier;
-
-		AActor* Projectile = SpawnProjectile(ProjectileData, SpawnLocation, SpreadDirection, DamageMultiplier);
+		FHarmoniaProjectileVolley Volley;
+		Volley.ProjectileData.ProjectileType = DefaultProjectileType;
+		Volley.ProjectileData.InitialSpeed = 3000.0f;
+		Volley.ProjectileData.DamageConfig.DamageMultiplier = DamageMultiplier * BaseDamageMultiplier;
+		Volley.Instigator = GetOwner();
+		Volley.Origin = SpawnLocation;
+		Volley.Direction = Direction;
+		Volley.SpreadAngle = SpreadAngle;
+		Volley.Count = static_cast<uint8>(FMath::Clamp(ProjectilesPerShot, 1, 255));
+		Volley.Seed = FMath::Rand();
+		Volley.DamageMultiplier = DamageMultiplier;
+
+		if (UHarmoniaLockOnComponent* LockOn = GetLockOnComponent())
+		{
+			Volley.HomingTarget = LockOn->GetCurrentTarget();
+		}
 
-		if (Projectile)
+		// Managed projectiles have no actor
+		const int32 NumSpawned = SpawnProjectileVolley(Volley);
+		for (int32 i = 0; i < NumSpawned; ++i)
 		{
-			OnProjectileFired.Broadcast(Projectile, ProjectileData);
+			OnProjectileFired.Broadcast(nullptr, Volley.ProjectileData);
 		}
 	}
 
@@ -678,20 +715,12 @@ AActor* UHarmoniaRangedCombatComponent::SpawnProjectile(const FHarmoniaProjectil
 		return nullptr;
 	}
 
-	// For now, spawn a simple projectile actor
-	// TODO: Implement full projectile system
-
 	if (GetOwnerRole() < ROLE_Authority)
 	{
 		ServerFireProjectile(SpawnLocation, Direction, DamageMultiplier);
 		return nullptr;
 	}
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = GetOwner();
-	SpawnParams.Instigator = Cast<APawn>(GetOwner());
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
 	// Spawn projectile
 	FTransform SpawnTransform;
 	SpawnTransform.SetLocation(SpawnLocation);
@@ -700,13 +729,62 @@ AActor* UHarmoniaRangedCombatComponent::SpawnProjectile(const FHarmoniaProjectil
 	// Use default projectile class if available
 	if (DefaultProjectileClass)
 	{
-		AActor* Projectile = GetWorld()->SpawnActor<AActor>(DefaultProjectileClass, SpawnTransform, SpawnParams);
+		// Deferred so the projectile is configured before BeginPlay starts its lifetime timer
+		AActor* Projectile = GetWorld()->SpawnActorDeferred<AActor>(DefaultProjectileClass, SpawnTransform, GetOwner(), Cast<APawn>(GetOwner()), ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!Projectile)
+		{
+			return nullptr;
+		}
+
+		AHarmoniaProjectile* HarmoniaProjectile = Cast<AHarmoniaProjectile>(Projectile);
+		if (HarmoniaProjectile)
+		{
+			HarmoniaProjectile->InitializeProjectile(ProjectileData, GetOwner(), DamageMultiplier);
+		}
+
+		Projectile->FinishSpawning(SpawnTransform);
+
+		if (HarmoniaProjectile)
+		{
+			HarmoniaProjectile->LaunchProjectile(Direction);
+		}
 		return Projectile;
 	}
 
 	return nullptr;
 }
 
+int32 UHarmoniaRangedCombatComponent::SpawnProjectileVolley(const FHarmoniaProjectileVolley& Volley)
+{
+	UWorld* World = GetWorld();
+	if (!World || GetOwnerRole() < ROLE_Authority)
+	{
+		return 0;
+	}
+
+	UHarmoniaProjectileSubsystem* ProjectileSubsystem = World->GetSubsystem<UHarmoniaProjectileSubsystem>();
+	if (!ProjectileSubsystem)
+	{
+		return 0;
+	}
+
+	FHarmoniaProjectileVolley StampedVolley = Volley;
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		StampedVolley.ServerSpawnTime = GameState->GetServerWorldTimeSeconds();
+	}
+
+	const int32 NumSpawned = ProjectileSubsystem->SpawnVolley(StampedVolley, true);
+
+	// One RPC per volley instead of one replicated actor per projectile
+	if (NumSpawned > 0 && World->GetNetMode() != NM_Standalone)
+	{
+		MulticastProjectileVolley(StampedVolley);
+	}
+
+	return NumSpawned;
+}
+
 // ============================================================================
 // Helper Functions
 // ============================================================================
@@ -786,6 +864,24 @@ bool UHarmoniaRangedCombatComponent::ServerFireProjectile_Validate(const FVector
 	return true;
 }
 
+// ============================================================================
+// Multicast RPCs
+// ============================================================================
+
+void UHarmoniaRangedCombatComponent::MulticastProjectileVolley_Implementation(const FHarmoniaProjectileVolley& Volley)
+{
+	// The server already simulates the authoritative copy
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return;
+	}
+
+	if (UHarmoniaProjectileSubsystem* ProjectileSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UHarmoniaProjectileSubsystem>() : nullptr)
+	{
+		ProjectileSubsystem->SpawnVolley(Volley, false);
+	}
+}
+
 void UHarmoniaRangedCombatComponent::ServerStartAiming_Implementation()
 {
 	bIsAiming = true;
@@ -8,9 +8,8 @@
 
 UHarmoniaStatusEffectComponent::UHarmoniaStatusEffectComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
-	PrimaryComponentTick.TickInterval = 0.1f; // 10Hz update for duration display
+	// Remaining time is computed on read, warnings and expiry run on the timer wheel
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UHarmoniaStatusEffectComponent::BeginPlay()
@@ -32,29 +31,21 @@ void UHarmoniaStatusEffectComponent::BeginPlay()
 void UHarmoniaStatusEffectComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	// Unbind from ASC
-	if (TrackedASC.IsValid())
+	UnbindFromASC();
+
+	if (UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel())
 	{
-		if (OnEffectAppliedHandle.IsValid())
-		{
-			TrackedASC->OnGameplayEffectAppliedDelegateToSelf.Remove(OnEffectAppliedHandle);
-		}
-		if (OnEffectRemovedHandle.IsValid())
+		for (TPair<FGuid, FEffectTimers>& Pair : EffectTimers)
 		{
-			TrackedASC->OnAnyGameplayEffectRemovedDelegate().Remove(OnEffectRemovedHandle);
+			TimerWheel->Cancel(Pair.Value.ExpiringSoon);
+			TimerWheel->Cancel(Pair.Value.Expiry);
 		}
 	}
+	EffectTimers.Empty();
 
 	Super::EndPlay(EndPlayReason);
 }
 
-void UHarmoniaStatusEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	UpdateEffectTimers(DeltaTime);
-	CleanupExpiredEffects();
-}
-
 // ============================================================================
 // GAS Integration
 // ============================================================================
@@ -66,19 +57,14 @@ void UHarmoniaStatusEffectComponent::InitializeWithASC(UAbilitySystemComponent*
 		return;
 	}
 
-	// Unbind from previous ASC
-	if (TrackedASC.IsValid() && TrackedASC.Get() != ASC)
+	if (TrackedASC.Get() == ASC)
 	{
-		if (OnEffectAppliedHandle.IsValid())
-		{
-			TrackedASC->OnGameplayEffectAppliedDelegateToSelf.Remove(OnEffectAppliedHandle);
-		}
-		if (OnEffectRemovedHandle.IsValid())
-		{
-			TrackedASC->OnAnyGameplayEffectRemovedDelegate().Remove(OnEffectRemovedHandle);
-		}
+		return;
 	}
 
+	// Unbind from previous ASC
+	UnbindFromASC();
+
 	TrackedASC = ASC;
 
 	// Bind to new ASC
@@ -93,11 +79,9 @@ void UHarmoniaStatusEffectComponent::InitializeWithASC(UAbilitySystemComponent*
 	for (const FActiveGameplayEffectHandle& Handle : ActiveHandles)
 	{
 		const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(Handle);
-		if (ActiveEffect)
+		if (ActiveEffect && !EffectIDByHandle.Contains(Handle))
 		{
-			FHarmoniaStatusEffectUIData UIData = CreateUIDataFromEffect(ActiveEffect->Spec, Handle);
-			ActiveEffects.Add(UIData);
-			OnEffectAdded.Broadcast(UIData);
+			AddEffect(CreateUIDataFromEffect(ActiveEffect->Spec, Handle));
 		}
 	}
 }
@@ -106,28 +90,40 @@ void UHarmoniaStatusEffectComponent::InitializeWithASC(UAbilitySystemComponent*
 // Effect Queries
 // ============================================================================
 
+TArray<FHarmoniaStatusEffectUIData> UHarmoniaStatusEffectComponent::GetAllEffects() const
+{
+	TArray<FHarmoniaStatusEffectUIData> Result = ActiveEffects;
+	for (FHarmoniaStatusEffectUIData& Effect : Result)
+	{
+		RefreshEffectTiming(Effect);
+	}
+	return Result;
+}
+
 TArray<FHarmoniaStatusEffectUIData> UHarmoniaStatusEffectComponent::GetEffectsByType(EHarmoniaStatusEffectType Type) const
 {
+	const TArray<FGuid>& EffectIDs = GetEffectIDsByType(Type);
+
 	TArray<FHarmoniaStatusEffectUIData> Result;
-	for (const FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	Result.Reserve(EffectIDs.Num());
+	for (const FGuid& EffectID : EffectIDs)
 	{
-		if (Effect.EffectType == Type)
-		{
-			Result.Add(Effect);
-		}
+		FHarmoniaStatusEffectUIData& Effect = Result.Add_GetRef(ActiveEffects[EffectIndexByID.FindChecked(EffectID)]);
+		RefreshEffectTiming(Effect);
 	}
 	return Result;
 }
 
 TArray<FHarmoniaStatusEffectUIData> UHarmoniaStatusEffectComponent::GetEffectsByCategory(EHarmoniaStatusEffectCategory Category) const
 {
+	const TArray<FGuid>& EffectIDs = GetEffectIDsByCategory(Category);
+
 	TArray<FHarmoniaStatusEffectUIData> Result;
-	for (const FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	Result.Reserve(EffectIDs.Num());
+	for (const FGuid& EffectID : EffectIDs)
 	{
-		if (Effect.Category == Category)
-		{
-			Result.Add(Effect);
-		}
+		FHarmoniaStatusEffectUIData& Effect = Result.Add_GetRef(ActiveEffects[EffectIndexByID.FindChecked(EffectID)]);
+		RefreshEffectTiming(Effect);
 	}
 	return Result;
 }
@@ -144,15 +140,15 @@ TArray<FHarmoniaStatusEffectUIData> UHarmoniaStatusEffectComponent::GetDebuffs()
 
 bool UHarmoniaStatusEffectComponent::GetEffectByID(FGuid EffectID, FHarmoniaStatusEffectUIData& OutEffect) const
 {
-	for (const FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE)
 	{
-		if (Effect.EffectID == EffectID)
-		{
-			OutEffect = Effect;
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	OutEffect = ActiveEffects[Index];
+	RefreshEffectTiming(OutEffect);
+	return true;
 }
 
 bool UHarmoniaStatusEffectComponent::GetEffectByTag(FGameplayTag EffectTag, FHarmoniaStatusEffectUIData& OutEffect) const
@@ -162,6 +158,7 @@ bool UHarmoniaStatusEffectComponent::GetEffectByTag(FGameplayTag EffectTag, FHar
 		if (Effect.EffectTag.MatchesTagExact(EffectTag))
 		{
 			OutEffect = Effect;
+			RefreshEffectTiming(OutEffect);
 			return true;
 		}
 	}
@@ -192,6 +189,33 @@ int32 UHarmoniaStatusEffectComponent::GetEffectStackCount(FGameplayTag EffectTag
 	return 0;
 }
 
+float UHarmoniaStatusEffectComponent::GetEffectRemainingDuration(FGuid EffectID) const
+{
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	FHarmoniaStatusEffectUIData Effect = ActiveEffects[Index];
+	RefreshEffectTiming(Effect);
+	return Effect.bHasDuration ? Effect.RemainingDuration : 0.0f;
+}
+
+const TArray<FGuid>& UHarmoniaStatusEffectComponent::GetEffectIDsByType(EHarmoniaStatusEffectType Type) const
+{
+	static const TArray<FGuid> Empty;
+	const TArray<FGuid>* EffectIDs = EffectIDsByType.Find(Type);
+	return EffectIDs ? *EffectIDs : Empty;
+}
+
+const TArray<FGuid>& UHarmoniaStatusEffectComponent::GetEffectIDsByCategory(EHarmoniaStatusEffectCategory Category) const
+{
+	static const TArray<FGuid> Empty;
+	const TArray<FGuid>* EffectIDs = EffectIDsByCategory.Find(Category);
+	return EffectIDs ? *EffectIDs : Empty;
+}
+
 // ============================================================================
 // Manual Effect Management
 // ============================================================================
@@ -199,79 +223,80 @@ int32 UHarmoniaStatusEffectComponent::GetEffectStackCount(FGameplayTag EffectTag
 FGuid UHarmoniaStatusEffectComponent::AddCustomEffect(const FHarmoniaStatusEffectUIData& Effect)
 {
 	FHarmoniaStatusEffectUIData NewEffect = Effect;
-	if (!NewEffect.EffectID.IsValid())
+	if (!NewEffect.EffectID.IsValid() || EffectIndexByID.Contains(NewEffect.EffectID))
 	{
 		NewEffect.EffectID = FGuid::NewGuid();
 	}
 
-	// Set start time
-	NewEffect.StartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-
-	// Calculate progress
-	if (NewEffect.bHasDuration && NewEffect.TotalDuration > 0.0f)
-	{
-		NewEffect.DurationProgress = NewEffect.RemainingDuration / NewEffect.TotalDuration;
-	}
-	else
+	// Duration: a missing total or remaining duration defaults to the other one
+	if (NewEffect.bHasDuration)
 	{
-		NewEffect.DurationProgress = 1.0f;
+		if (NewEffect.TotalDuration <= 0.0f)
+		{
+			NewEffect.TotalDuration = NewEffect.RemainingDuration;
+		}
+		else if (NewEffect.RemainingDuration <= 0.0f)
+		{
+			NewEffect.RemainingDuration = NewEffect.TotalDuration;
+		}
 	}
 
+	// Set start time, so that StartTime + TotalDuration is when the remaining duration runs out
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	NewEffect.StartTime = NewEffect.bHasDuration ? CurrentTime - (NewEffect.TotalDuration - NewEffect.RemainingDuration) : CurrentTime;
+
 	// Set border color
 	NewEffect.BorderColor = GetBorderColorForType(NewEffect.EffectType);
 
-	ActiveEffects.Add(NewEffect);
-	OnEffectAdded.Broadcast(NewEffect);
+	AddEffect(NewEffect);
 
 	return NewEffect.EffectID;
 }
 
 bool UHarmoniaStatusEffectComponent::RemoveCustomEffect(FGuid EffectID)
 {
-	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE || ActiveEffects[Index].ActiveHandle.IsValid())
 	{
-		if (ActiveEffects[i].EffectID == EffectID && !ActiveEffects[i].ActiveHandle.IsValid())
-		{
-			ActiveEffects.RemoveAt(i);
-			WarnedExpiringEffects.Remove(EffectID);
-			OnEffectRemoved.Broadcast(EffectID);
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	RemoveEffectAt(Index);
+	return true;
 }
 
 bool UHarmoniaStatusEffectComponent::UpdateCustomEffectDuration(FGuid EffectID, float NewRemainingDuration)
 {
-	for (FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE || ActiveEffects[Index].ActiveHandle.IsValid())
 	{
-		if (Effect.EffectID == EffectID && !Effect.ActiveHandle.IsValid())
-		{
-			Effect.RemainingDuration = NewRemainingDuration;
-			if (Effect.TotalDuration > 0.0f)
-			{
-				Effect.DurationProgress = NewRemainingDuration / Effect.TotalDuration;
-			}
-			OnEffectUpdated.Broadcast(Effect);
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	// Rebase the start time, the remaining duration itself is never stored
+	FHarmoniaStatusEffectUIData& Effect = ActiveEffects[Index];
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	Effect.StartTime = CurrentTime - (Effect.TotalDuration - NewRemainingDuration);
+	ScheduleEffectTimers(Effect);
+
+	FHarmoniaStatusEffectUIData Updated = Effect;
+	RefreshEffectTiming(Updated);
+	OnEffectUpdated.Broadcast(Updated);
+	return true;
 }
 
 bool UHarmoniaStatusEffectComponent::UpdateCustomEffectStacks(FGuid EffectID, int32 NewStackCount)
 {
-	for (FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE || ActiveEffects[Index].ActiveHandle.IsValid())
 	{
-		if (Effect.EffectID == EffectID && !Effect.ActiveHandle.IsValid())
-		{
-			int32 OldStackCount = Effect.StackCount;
-			Effect.StackCount = FMath::Clamp(NewStackCount, 0, Effect.MaxStackCount);
-			OnStackChanged.Broadcast(EffectID, Effect.StackCount);
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	FHarmoniaStatusEffectUIData& Effect = ActiveEffects[Index];
+	Effect.StackCount = FMath::Clamp(NewStackCount, 0, Effect.MaxStackCount);
+	OnStackChanged.Broadcast(EffectID, Effect.StackCount);
+	return true;
 }
 
 // ============================================================================
@@ -301,97 +326,285 @@ bool UHarmoniaStatusEffectComponent::GetEffectConfig(FGameplayTag EffectTag, FHa
 // Internal Updates
 // ============================================================================
 
-void UHarmoniaStatusEffectComponent::UpdateEffectTimers(float DeltaTime)
+void UHarmoniaStatusEffectComponent::AddEffect(const FHarmoniaStatusEffectUIData& Effect)
 {
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	const int32 Index = ActiveEffects.Add(Effect);
+	const FGuid EffectID = Effect.EffectID;
 
-	for (FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	EffectIndexByID.Add(EffectID, Index);
+	EffectIDsByType.FindOrAdd(Effect.EffectType).Add(EffectID);
+	EffectIDsByCategory.FindOrAdd(Effect.Category).Add(EffectID);
+
+	if (Effect.ActiveHandle.IsValid())
 	{
-		if (!Effect.bHasDuration)
-		{
-			continue;
-		}
+		EffectIDByHandle.Add(Effect.ActiveHandle, EffectID);
 
-		// For GAS effects, query the ASC for remaining time
-		if (Effect.ActiveHandle.IsValid() && TrackedASC.IsValid())
+		if (UAbilitySystemComponent* ASC = TrackedASC.Get())
 		{
-			TArray<float> Durations = TrackedASC->GetActiveEffectsDuration(FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(Effect.EffectTag.GetSingleTagContainer()));
-			float RemainingTime = Durations.Num() > 0 ? Durations[0] : 0.0f;
-			Effect.RemainingDuration = RemainingTime;
-		}
-		else
-		{
-			// For custom effects, manually decrease
-			Effect.RemainingDuration -= DeltaTime;
+			if (FOnActiveGameplayEffectStackChange* StackDelegate = ASC->OnGameplayEffectStackChangeDelegate(Effect.ActiveHandle))
+			{
+				StackDelegate->AddUObject(this, &UHarmoniaStatusEffectComponent::OnGameplayEffectStackChanged);
+			}
+			if (FOnActiveGameplayEffectTimeChange* TimeDelegate = ASC->OnGameplayEffectTimeChangeDelegate(Effect.ActiveHandle))
+			{
+				TimeDelegate->AddUObject(this, &UHarmoniaStatusEffectComponent::OnGameplayEffectTimeChanged);
+			}
 		}
+	}
 
-		// Update progress
-		if (Effect.TotalDuration > 0.0f)
-		{
-			Effect.DurationProgress = FMath::Clamp(Effect.RemainingDuration / Effect.TotalDuration, 0.0f, 1.0f);
-		}
+	ScheduleEffectTimers(Effect);
+
+	FHarmoniaStatusEffectUIData Added = Effect;
+	RefreshEffectTiming(Added);
+	OnEffectAdded.Broadcast(Added);
+}
+
+void UHarmoniaStatusEffectComponent::RemoveEffectAt(int32 Index)
+{
+	const FHarmoniaStatusEffectUIData& Effect = ActiveEffects[Index];
+	const FGuid RemovedID = Effect.EffectID;
+
+	CancelEffectTimers(RemovedID);
+
+	if (Effect.ActiveHandle.IsValid())
+	{
+		EffectIDByHandle.Remove(Effect.ActiveHandle);
+	}
+	if (TArray<FGuid>* TypeIDs = EffectIDsByType.Find(Effect.EffectType))
+	{
+		TypeIDs->RemoveSingle(RemovedID);
+	}
+	if (TArray<FGuid>* CategoryIDs = EffectIDsByCategory.Find(Effect.Category))
+	{
+		CategoryIDs->RemoveSingle(RemovedID);
+	}
+
+	// Keep display order, effects after the removed one shift down
+	EffectIndexByID.Remove(RemovedID);
+	ActiveEffects.RemoveAt(Index);
+	for (int32 i = Index; i < ActiveEffects.Num(); ++i)
+	{
+		EffectIndexByID.FindChecked(ActiveEffects[i].EffectID) = i;
+	}
+
+	WarnedExpiringEffects.Remove(RemovedID);
+	OnEffectRemoved.Broadcast(RemovedID);
+}
+
+int32 UHarmoniaStatusEffectComponent::FindEffectIndex(FGuid EffectID) const
+{
+	const int32* Index = EffectIndexByID.Find(EffectID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UHarmoniaStatusEffectComponent::RefreshEffectTiming(FHarmoniaStatusEffectUIData& Effect) const
+{
+	if (!Effect.bHasDuration)
+	{
+		return;
+	}
+
+	const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	Effect.RemainingDuration = FMath::Max(0.0f, Effect.StartTime + Effect.TotalDuration - CurrentTime);
+
+	// Update progress
+	if (Effect.TotalDuration > 0.0f)
+	{
+		Effect.DurationProgress = FMath::Clamp(Effect.RemainingDuration / Effect.TotalDuration, 0.0f, 1.0f);
+	}
 
-		// Check for expiring soon
-		bool bWasExpiringSoon = Effect.bIsExpiringSoon;
-		Effect.bIsExpiringSoon = Effect.RemainingDuration <= ExpiringSoonThreshold && Effect.RemainingDuration > 0.0f;
+	Effect.bIsExpiringSoon = Effect.RemainingDuration <= ExpiringSoonThreshold && Effect.RemainingDuration > 0.0f;
+}
+
+void UHarmoniaStatusEffectComponent::ScheduleEffectTimers(const FHarmoniaStatusEffectUIData& Effect)
+{
+	CancelEffectTimers(Effect.EffectID);
+
+	UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel();
+	if (!Effect.bHasDuration || !TimerWheel)
+	{
+		return;
+	}
+
+	const double EndTime = (double)Effect.StartTime + Effect.TotalDuration;
+	FEffectTimers& Timers = EffectTimers.Add(Effect.EffectID);
+
+	// Fire expiring event (only once per effect)
+	if (ExpiringSoonThreshold > 0.0f && !WarnedExpiringEffects.Contains(Effect.EffectID))
+	{
+		Timers.ExpiringSoon = TimerWheel->ScheduleAt(EndTime - ExpiringSoonThreshold,
+			FSimpleDelegate::CreateUObject(this, &UHarmoniaStatusEffectComponent::OnEffectExpiringSoon, Effect.EffectID));
+	}
+
+	// GAS effects are removed by GAS (OnGameplayEffectRemoved)
+	if (!Effect.ActiveHandle.IsValid())
+	{
+		Timers.Expiry = TimerWheel->ScheduleAt(EndTime,
+			FSimpleDelegate::CreateUObject(this, &UHarmoniaStatusEffectComponent::OnCustomEffectExpired, Effect.EffectID));
+	}
+}
 
-		// Fire expiring event (only once per effect)
-		if (Effect.bIsExpiringSoon && !bWasExpiringSoon && !WarnedExpiringEffects.Contains(Effect.EffectID))
+void UHarmoniaStatusEffectComponent::CancelEffectTimers(FGuid EffectID)
+{
+	FEffectTimers Timers;
+	if (EffectTimers.RemoveAndCopyValue(EffectID, Timers))
+	{
+		if (UHarmoniaTimerWheelSubsystem* TimerWheel = GetTimerWheel())
 		{
-			WarnedExpiringEffects.Add(Effect.EffectID);
-			OnEffectExpiring.Broadcast(Effect);
+			TimerWheel->Cancel(Timers.ExpiringSoon);
+			TimerWheel->Cancel(Timers.Expiry);
 		}
 	}
 }
 
+void UHarmoniaStatusEffectComponent::OnEffectExpiringSoon(FGuid EffectID)
+{
+	if (FEffectTimers* Timers = EffectTimers.Find(EffectID))
+	{
+		Timers->ExpiringSoon.Invalidate();
+	}
+
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE || WarnedExpiringEffects.Contains(EffectID))
+	{
+		return;
+	}
+
+	FHarmoniaStatusEffectUIData Effect = ActiveEffects[Index];
+	RefreshEffectTiming(Effect);
+
+	if (Effect.bIsExpiringSoon)
+	{
+		WarnedExpiringEffects.Add(EffectID);
+		OnEffectExpiring.Broadcast(Effect);
+	}
+}
+
+void UHarmoniaStatusEffectComponent::OnCustomEffectExpired(FGuid EffectID)
+{
+	if (FEffectTimers* Timers = EffectTimers.Find(EffectID))
+	{
+		Timers->Expiry.Invalidate();
+	}
+
+	const int32 Index = FindEffectIndex(EffectID);
+	if (Index == INDEX_NONE || ActiveEffects[Index].ActiveHandle.IsValid())
+	{
+		return;
+	}
+
+	FHarmoniaStatusEffectUIData Effect = ActiveEffects[Index];
+	RefreshEffectTiming(Effect);
+
+	if (Effect.RemainingDuration > 0.0f)
+	{
+		// Float start time rounding, try again on the next slot
+		ScheduleEffectTimers(ActiveEffects[Index]);
+		return;
+	}
+
+	RemoveEffectAt(Index);
+}
+
 void UHarmoniaStatusEffectComponent::OnGameplayEffectApplied(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
 {
 	// Check if we already have this effect (for stacking)
-	for (FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	if (EffectIDByHandle.Contains(Handle))
 	{
-		if (Effect.ActiveHandle == Handle)
-		{
-			// Already tracked
-			return;
-		}
+		// Already tracked
+		return;
 	}
 
-	FHarmoniaStatusEffectUIData UIData = CreateUIDataFromEffect(Spec, Handle);
-	ActiveEffects.Add(UIData);
-	OnEffectAdded.Broadcast(UIData);
+	AddEffect(CreateUIDataFromEffect(Spec, Handle));
 }
 
 void UHarmoniaStatusEffectComponent::OnGameplayEffectRemoved(const FActiveGameplayEffect& RemovedEffect)
 {
-	FActiveGameplayEffectHandle Handle = RemovedEffect.Handle;
-
-	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+	if (const FGuid* EffectID = EffectIDByHandle.Find(RemovedEffect.Handle))
 	{
-		if (ActiveEffects[i].ActiveHandle == Handle)
+		const int32 Index = FindEffectIndex(*EffectID);
+		if (Index != INDEX_NONE)
 		{
-			FGuid RemovedID = ActiveEffects[i].EffectID;
-			ActiveEffects.RemoveAt(i);
-			WarnedExpiringEffects.Remove(RemovedID);
-			OnEffectRemoved.Broadcast(RemovedID);
-			return;
+			RemoveEffectAt(Index);
 		}
 	}
 }
 
 void UHarmoniaStatusEffectComponent::OnGameplayEffectStackChanged(FActiveGameplayEffectHandle Handle, int32 NewStackCount, int32 PreviousStackCount)
 {
-	for (FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+	const FGuid* EffectID = EffectIDByHandle.Find(Handle);
+	const int32 Index = EffectID ? FindEffectIndex(*EffectID) : INDEX_NONE;
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	ActiveEffects[Index].StackCount = NewStackCount;
+
+	FHarmoniaStatusEffectUIData Effect = ActiveEffects[Index];
+	RefreshEffectTiming(Effect);
+	OnStackChanged.Broadcast(Effect.EffectID, NewStackCount);
+	OnEffectUpdated.Broadcast(Effect);
+}
+
+void UHarmoniaStatusEffectComponent::OnGameplayEffectTimeChanged(FActiveGameplayEffectHandle Handle, float NewStartTime, float NewDuration)
+{
+	const FGuid* EffectID = EffectIDByHandle.Find(Handle);
+	const int32 Index = EffectID ? FindEffectIndex(*EffectID) : INDEX_NONE;
+	if (Index == INDEX_NONE)
 	{
-		if (Effect.ActiveHandle == Handle)
+		return;
+	}
+
+	FHarmoniaStatusEffectUIData& Effect = ActiveEffects[Index];
+	Effect.StartTime = NewStartTime;
+	Effect.TotalDuration = NewDuration;
+	Effect.bHasDuration = NewDuration > 0.0f;
+	ScheduleEffectTimers(Effect);
+
+	FHarmoniaStatusEffectUIData Updated = Effect;
+	RefreshEffectTiming(Updated);
+	OnEffectUpdated.Broadcast(Updated);
+}
+
+void UHarmoniaStatusEffectComponent::UnbindFromASC()
+{
+	UAbilitySystemComponent* ASC = TrackedASC.Get();
+	if (!ASC)
+	{
+		return;
+	}
+
+	if (OnEffectAppliedHandle.IsValid())
+	{
+		ASC->OnGameplayEffectAppliedDelegateToSelf.Remove(OnEffectAppliedHandle);
+		OnEffectAppliedHandle.Reset();
+	}
+	if (OnEffectRemovedHandle.IsValid())
+	{
+		ASC->OnAnyGameplayEffectRemovedDelegate().Remove(OnEffectRemovedHandle);
+		OnEffectRemovedHandle.Reset();
+	}
+
+	for (const TPair<FActiveGameplayEffectHandle, FGuid>& Pair : EffectIDByHandle)
+	{
+		if (FOnActiveGameplayEffectStackChange* StackDelegate = ASC->OnGameplayEffectStackChangeDelegate(Pair.Key))
 		{
-			Effect.StackCount = NewStackCount;
-			OnStackChanged.Broadcast(Effect.EffectID, NewStackCount);
-			OnEffectUpdated.Broadcast(Effect);
-			return;
+			StackDelegate->RemoveAll(this);
+		}
+		if (FOnActiveGameplayEffectTimeChange* TimeDelegate = ASC->OnGameplayEffectTimeChangeDelegate(Pair.Key))
+		{
+			TimeDelegate->RemoveAll(this);
 		}
 	}
 }
 
+UHarmoniaTimerWheelSubsystem* UHarmoniaStatusEffectComponent::GetTimerWheel() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UHarmoniaTimerWheelSubsystem>() : nullptr;
+}
+
 FHarmoniaStatusEffectUIData UHarmoniaStatusEffectComponent::CreateUIDataFromEffect(const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
 {
 	FHarmoniaStatusEffectUIData UIData;
@@ -431,11 +644,12 @@ FHarmoniaStatusEffectUIData UHarmoniaStatusEffectComponent::CreateUIDataFromEffe
 		}
 	}
 
-	// Duration
-	UIData.TotalDuration = Spec.GetDuration();
+	// Duration (GAS already knows when the effect started, remaining time is derived from it)
+	const FActiveGameplayEffect* ActiveEffect = TrackedASC.IsValid() ? TrackedASC->GetActiveGameplayEffect(Handle) : nullptr;
+	UIData.TotalDuration = ActiveEffect ? ActiveEffect->GetDuration() : Spec.GetDuration();
 	UIData.RemainingDuration = UIData.TotalDuration;
 	UIData.bHasDuration = UIData.TotalDuration > 0.0f;
-	UIData.StartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	UIData.StartTime = ActiveEffect ? ActiveEffect->StartWorldTime : (GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f);
 	UIData.DurationProgress = 1.0f;
 
 	// Stacking
@@ -485,7 +699,12 @@ void UHarmoniaStatusEffectComponent::SetUIConfigDataAsset(UHarmoniaUIConfigDataA
 	{
 		// Apply timing settings from data asset
 		ExpiringSoonThreshold = ConfigAsset->StatusEffectTiming.ExpiringSoonThreshold;
-		PrimaryComponentTick.TickInterval = ConfigAsset->StatusEffectTiming.UpdateInterval;
+
+		// Warnings are scheduled against the threshold
+		for (const FHarmoniaStatusEffectUIData& Effect : ActiveEffects)
+		{
+			ScheduleEffectTimers(Effect);
+		}
 
 		// Register predefined effect configs
 		for (const FHarmoniaStatusEffectConfig& Config : ConfigAsset->PredefinedEffectConfigs)
@@ -518,20 +737,3 @@ FText UHarmoniaStatusEffectComponent::FormatMagnitudeText(const FGameplayEffectS
 
 	return FText::GetEmpty();
 }
-
-void UHarmoniaStatusEffectComponent::CleanupExpiredEffects()
-{
-	for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
-	{
-		// Only cleanup custom effects (GAS effects are handled by OnGameplayEffectRemoved)
-		if (!ActiveEffects[i].ActiveHandle.IsValid() &&
-			ActiveEffects[i].bHasDuration &&
-			ActiveEffects[i].RemainingDuration <= 0.0f)
-		{
-			FGuid RemovedID = ActiveEffects[i].EffectID;
-			ActiveEffects.RemoveAt(i);
-			WarnedExpiringEffects.Remove(RemovedID);
-			OnEffectRemoved.Broadcast(RemovedID);
-		}
-	}
-}
@@ -1,26 +1,39 @@
 ﻿// Copyright 2025 Snow Game Studio.
 
 #include "Components/HarmoniaThreatComponent.h"
+#include "System/HarmoniaThreatSubsystem.h"
 #include "TimerManager.h"
 
 UHarmoniaThreatComponent::UHarmoniaThreatComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 0.5f; // Update twice per second
+	// Decay, cleanup and target selection run in UHarmoniaThreatSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
-void UHarmoniaThreatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UHarmoniaThreatComponent::BeginPlay()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::BeginPlay();
 
-	// Update threat decay
-	UpdateThreatDecay(DeltaTime);
+	EnsureThreatTable();
+}
+
+void UHarmoniaThreatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem())
+	{
+		ThreatSubsystem->UnregisterTable(ThreatTableIndex);
+	}
+	ThreatTableIndex = INDEX_NONE;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TauntTimerHandle);
+	}
 
-	// Cleanup invalid entries
-	CleanupThreatTable();
+	TauntActor = nullptr;
+	CurrentHighestThreatActor = nullptr;
 
-	// Update highest threat
-	UpdateHighestThreatActor();
+	Super::EndPlay(EndPlayReason);
 }
 
 // ============================================================================
@@ -34,23 +47,14 @@ void UHarmoniaThreatComponent::AddThreat(AActor* ThreatActor, float ThreatAmount
 		return;
 	}
 
-	FHarmoniaThreatEntry* Entry = FindOrAddThreatEntry(ThreatActor);
-	if (!Entry)
-	{
-		return;
-	}
-
-	float OldThreat = Entry->ThreatValue;
-
 	// Apply threat multiplier if needed
 	// This could be extended with actor-specific multipliers (tank, DPS, healer roles)
 	float FinalThreat = ThreatAmount;
 
-	Entry->ThreatValue = FMath::Clamp(Entry->ThreatValue + FinalThreat, 0.0f, MaximumThreat);
-	Entry->LastThreatTime = GetWorld()->GetTimeSeconds();
-
-	// Broadcast threat change
-	OnThreatChanged.Broadcast(ThreatActor, OldThreat, Entry->ThreatValue);
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = EnsureThreatTable())
+	{
+		ThreatSubsystem->AddThreat(ThreatTableIndex, ThreatActor, FinalThreat);
+	}
 }
 
 void UHarmoniaThreatComponent::RemoveThreat(AActor* ThreatActor, float ThreatAmount)
@@ -60,21 +64,9 @@ void UHarmoniaThreatComponent::RemoveThreat(AActor* ThreatActor, float ThreatAmo
 		return;
 	}
 
-	for (int32 i = 0; i < ThreatTable.Num(); i++)
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem())
 	{
-		if (ThreatTable[i].ThreatActor == ThreatActor)
-		{
-			float OldThreat = ThreatTable[i].ThreatValue;
-			ThreatTable[i].ThreatValue = FMath::Max(0.0f, ThreatTable[i].ThreatValue - ThreatAmount);
-
-			OnThreatChanged.Broadcast(ThreatActor, OldThreat, ThreatTable[i].ThreatValue);
-
-			if (ThreatTable[i].ThreatValue < MinimumThreat)
-			{
-				ThreatTable.RemoveAt(i);
-			}
-			break;
-		}
+		ThreatSubsystem->RemoveThreat(ThreatTableIndex, ThreatActor, ThreatAmount);
 	}
 }
 
@@ -85,17 +77,10 @@ void UHarmoniaThreatComponent::SetThreat(AActor* ThreatActor, float ThreatValue)
 		return;
 	}
 
-	FHarmoniaThreatEntry* Entry = FindOrAddThreatEntry(ThreatActor);
-	if (!Entry)
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = EnsureThreatTable())
 	{
-		return;
+		ThreatSubsystem->SetThreat(ThreatTableIndex, ThreatActor, ThreatValue);
 	}
-
-	float OldThreat = Entry->ThreatValue;
-	Entry->ThreatValue = FMath::Clamp(ThreatValue, 0.0f, MaximumThreat);
-	Entry->LastThreatTime = GetWorld()->GetTimeSeconds();
-
-	OnThreatChanged.Broadcast(ThreatActor, OldThreat, Entry->ThreatValue);
 }
 
 void UHarmoniaThreatComponent::ClearThreat(AActor* ThreatActor)
@@ -105,27 +90,18 @@ void UHarmoniaThreatComponent::ClearThreat(AActor* ThreatActor)
 		return;
 	}
 
-	for (int32 i = 0; i < ThreatTable.Num(); i++)
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem())
 	{
-		if (ThreatTable[i].ThreatActor == ThreatActor)
-		{
-			float OldThreat = ThreatTable[i].ThreatValue;
-			ThreatTable.RemoveAt(i);
-			OnThreatChanged.Broadcast(ThreatActor, OldThreat, 0.0f);
-			break;
-		}
+		ThreatSubsystem->ClearThreat(ThreatTableIndex, ThreatActor);
 	}
 }
 
 void UHarmoniaThreatComponent::ClearAllThreat()
 {
-	for (const FHarmoniaThreatEntry& Entry : ThreatTable)
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem())
 	{
-		OnThreatChanged.Broadcast(Entry.ThreatActor, Entry.ThreatValue, 0.0f);
+		ThreatSubsystem->ClearAllThreat(ThreatTableIndex);
 	}
-
-	ThreatTable.Empty();
-	CurrentHighestThreatActor = nullptr;
 }
 
 void UHarmoniaThreatComponent::Taunt(AActor* TauntingActor, float Duration)
@@ -138,17 +114,8 @@ void UHarmoniaThreatComponent::Taunt(AActor* TauntingActor, float Duration)
 	// Set as taunt actor
 	TauntActor = TauntingActor;
 
-	// Add high threat
-	FHarmoniaThreatEntry* Entry = FindOrAddThreatEntry(TauntingActor);
-	if (Entry)
-	{
-		// Set to maximum threat
-		float OldThreat = Entry->ThreatValue;
-		Entry->ThreatValue = MaximumThreat;
-		Entry->LastThreatTime = GetWorld()->GetTimeSeconds();
-
-		OnThreatChanged.Broadcast(TauntingActor, OldThreat, Entry->ThreatValue);
-	}
+	// Set to maximum threat
+	SetThreat(TauntingActor, MaximumThreat);
 
 	// Clear existing taunt timer
 	if (GetWorld()->GetTimerManager().IsTimerActive(TauntTimerHandle))
@@ -166,26 +133,22 @@ void UHarmoniaThreatComponent::Taunt(AActor* TauntingActor, float Duration)
 	);
 }
 
+void UHarmoniaThreatComponent::RefreshThreatConfig()
+{
+	if (UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem())
+	{
+		ThreatSubsystem->RefreshTableConfig(ThreatTableIndex);
+	}
+}
+
 // ============================================================================
 // Threat Queries
 // ============================================================================
 
 float UHarmoniaThreatComponent::GetThreat(AActor* ThreatActor) const
 {
-	if (!ThreatActor)
-	{
-		return 0.0f;
-	}
-
-	for (const FHarmoniaThreatEntry& Entry : ThreatTable)
-	{
-		if (Entry.ThreatActor == ThreatActor)
-		{
-			return Entry.ThreatValue;
-		}
-	}
-
-	return 0.0f;
+	const UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem();
+	return ThreatSubsystem ? ThreatSubsystem->GetThreat(ThreatTableIndex, ThreatActor) : 0.0f;
 }
 
 AActor* UHarmoniaThreatComponent::GetHighestThreatActor() const
@@ -196,12 +159,19 @@ AActor* UHarmoniaThreatComponent::GetHighestThreatActor() const
 		return TauntActor;
 	}
 
-	return CurrentHighestThreatActor;
+	// Exact as of now, not as of the last notification
+	UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem();
+	return ThreatSubsystem ? ThreatSubsystem->GetHighestThreatActor(ThreatTableIndex) : nullptr;
 }
 
 TArray<FHarmoniaThreatEntry> UHarmoniaThreatComponent::GetThreatTable(bool bSorted) const
 {
-	TArray<FHarmoniaThreatEntry> Result = ThreatTable;
+	TArray<FHarmoniaThreatEntry> Result;
+
+	if (const UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem())
+	{
+		ThreatSubsystem->GetThreatEntries(ThreatTableIndex, Result);
+	}
 
 	if (bSorted)
 	{
@@ -214,118 +184,30 @@ TArray<FHarmoniaThreatEntry> UHarmoniaThreatComponent::GetThreatTable(bool bSort
 	return Result;
 }
 
-// ============================================================================
-// Protected Functions
-// ============================================================================
-
-void UHarmoniaThreatComponent::UpdateThreatDecay(float DeltaTime)
+int32 UHarmoniaThreatComponent::GetThreatTableSize() const
 {
-	if (ThreatDecayRate <= 0.0f)
-	{
-		return;
-	}
-
-	AActor* Owner = GetOwner();
-	if (!Owner)
-	{
-		return;
-	}
-
-	FVector OwnerLocation = Owner->GetActorLocation();
-
-	for (FHarmoniaThreatEntry& Entry : ThreatTable)
-	{
-		if (!Entry.IsValid())
-		{
-			continue;
-		}
-
-		// Calculate decay rate
-		float DecayMultiplier = 1.0f;
-
-		// Increase decay if out of range
-		if (ThreatDecayDistance > 0.0f)
-		{
-			float Distance = FVector::Dist(OwnerLocation, Entry.ThreatActor->GetActorLocation());
-			if (Distance > ThreatDecayDistance)
-			{
-				DecayMultiplier = OutOfRangeDecayMultiplier;
-			}
-		}
-
-		// Apply decay
-		float DecayAmount = Entry.ThreatValue * ThreatDecayRate * DecayMultiplier * DeltaTime;
-		float OldThreat = Entry.ThreatValue;
-		Entry.ThreatValue = FMath::Max(0.0f, Entry.ThreatValue - DecayAmount);
-
-		if (!FMath::IsNearlyEqual(OldThreat, Entry.ThreatValue))
-		{
-			OnThreatChanged.Broadcast(Entry.ThreatActor, OldThreat, Entry.ThreatValue);
-		}
-	}
+	const UHarmoniaThreatSubsystem* ThreatSubsystem = GetThreatSubsystem();
+	return ThreatSubsystem ? ThreatSubsystem->GetNumEntries(ThreatTableIndex) : 0;
 }
 
-void UHarmoniaThreatComponent::CleanupThreatTable()
-{
-	for (int32 i = ThreatTable.Num() - 1; i >= 0; i--)
-	{
-		const FHarmoniaThreatEntry& Entry = ThreatTable[i];
-
-		// Remove if invalid or threat too low
-		if (!Entry.IsValid() || Entry.ThreatValue < MinimumThreat)
-		{
-			OnThreatChanged.Broadcast(Entry.ThreatActor, Entry.ThreatValue, 0.0f);
-			ThreatTable.RemoveAt(i);
-		}
-	}
-}
+// ============================================================================
+// Protected Functions
+// ============================================================================
 
-void UHarmoniaThreatComponent::UpdateHighestThreatActor()
+UHarmoniaThreatSubsystem* UHarmoniaThreatComponent::EnsureThreatTable()
 {
-	AActor* OldHighest = CurrentHighestThreatActor;
-	CurrentHighestThreatActor = nullptr;
-	float HighestThreat = 0.0f;
-
-	for (const FHarmoniaThreatEntry& Entry : ThreatTable)
+	UHarmoniaThreatSubsystem* ThreatSubsystem = UHarmoniaThreatSubsystem::Get(this);
+	if (ThreatSubsystem && ThreatTableIndex == INDEX_NONE)
 	{
-		if (Entry.IsValid() && Entry.ThreatValue > HighestThreat)
-		{
-			HighestThreat = Entry.ThreatValue;
-			CurrentHighestThreatActor = Entry.ThreatActor;
-		}
+		ThreatTableIndex = ThreatSubsystem->RegisterTable(this);
 	}
 
-	// Broadcast if changed
-	if (OldHighest != CurrentHighestThreatActor)
-	{
-		OnHighestThreatChanged.Broadcast(OldHighest, CurrentHighestThreatActor);
-	}
+	return ThreatSubsystem;
 }
 
-FHarmoniaThreatEntry* UHarmoniaThreatComponent::FindOrAddThreatEntry(AActor* ThreatActor)
+UHarmoniaThreatSubsystem* UHarmoniaThreatComponent::GetThreatSubsystem() const
 {
-	if (!ThreatActor)
-	{
-		return nullptr;
-	}
-
-	// Find existing entry
-	for (FHarmoniaThreatEntry& Entry : ThreatTable)
-	{
-		if (Entry.ThreatActor == ThreatActor)
-		{
-			return &Entry;
-		}
-	}
-
-	// Create new entry
-	FHarmoniaThreatEntry NewEntry;
-	NewEntry.ThreatActor = ThreatActor;
-	NewEntry.ThreatValue = 0.0f;
-	NewEntry.LastThreatTime = GetWorld()->GetTimeSeconds();
-
-	ThreatTable.Add(NewEntry);
-	return &ThreatTable.Last();
+	return ThreatTableIndex != INDEX_NONE ? UHarmoniaThreatSubsystem::Get(this) : nullptr;
 }
 
 void UHarmoniaThreatComponent::OnTauntExpired()
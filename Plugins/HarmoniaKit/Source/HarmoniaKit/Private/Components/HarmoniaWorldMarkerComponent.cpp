@@ -27,6 +27,23 @@ void UHarmoniaWorldMarkerComponent::BeginPlay()
 		GEngine->GameViewport->GetViewportSize(ViewportSize);
 		CachedViewportSize = ViewportSize;
 	}
+
+	RefreshHiddenCategoryMask();
+}
+
+void UHarmoniaWorldMarkerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->UnregisterAll(this);
+	}
+
+	MarkerSlots.Empty();
+	MarkerSlotById.Empty();
+	InRangeMarkerIndices.Empty();
+	VisibleMarkerIndices.Empty();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UHarmoniaWorldMarkerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -42,7 +59,7 @@ void UHarmoniaWorldMarkerComponent::TickComponent(float DeltaTime, ELevelTick Ti
 	// Clean up invalid markers (tracking destroyed actors)
 	CleanupInvalidMarkers();
 
-	// Update all marker positions
+	// Update markers near the camera
 	UpdateMarkers();
 }
 
@@ -58,7 +75,18 @@ FGuid UHarmoniaWorldMarkerComponent::AddMarker(const FHarmoniaWorldMarkerData& M
 		NewMarker.MarkerID = FGuid::NewGuid();
 	}
 
-	Markers.Add(NewMarker);
+	// Re-adding an existing ID replaces that marker
+	if (UpdateMarker(NewMarker.MarkerID, NewMarker))
+	{
+		return NewMarker.MarkerID;
+	}
+
+	FMarkerSlot NewSlot;
+	NewSlot.Data = NewMarker;
+	const int32 SlotIndex = MarkerSlots.Add(MoveTemp(NewSlot));
+	MarkerSlotById.Add(NewMarker.MarkerID, SlotIndex);
+	RegisterSlot(SlotIndex);
+
 	OnMarkerAdded.Broadcast(NewMarker);
 
 	return NewMarker.MarkerID;
@@ -137,120 +165,146 @@ FGuid UHarmoniaWorldMarkerComponent::AddQuestMarker(FVector WorldLocation, FText
 
 bool UHarmoniaWorldMarkerComponent::RemoveMarker(FGuid MarkerID)
 {
-	for (int32 i = Markers.Num() - 1; i >= 0; --i)
+	const int32 SlotIndex = FindSlot(MarkerID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Markers[i].MarkerID == MarkerID)
-		{
-			Markers.RemoveAt(i);
-			OnMarkerRemoved.Broadcast(MarkerID);
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	RemoveSlot(SlotIndex);
+	return true;
 }
 
 void UHarmoniaWorldMarkerComponent::RemoveMarkersByCategory(FGameplayTag Category)
 {
-	for (int32 i = Markers.Num() - 1; i >= 0; --i)
+	TArray<int32> SlotsToRemove;
+	for (auto It = MarkerSlots.CreateConstIterator(); It; ++It)
 	{
-		if (Markers[i].CategoryTag.MatchesTag(Category))
+		if (It->Data.CategoryTag.MatchesTag(Category))
 		{
-			FGuid RemovedID = Markers[i].MarkerID;
-			Markers.RemoveAt(i);
-			OnMarkerRemoved.Broadcast(RemovedID);
+			SlotsToRemove.Add(It.GetIndex());
 		}
 	}
+
+	for (int32 SlotIndex : SlotsToRemove)
+	{
+		RemoveSlot(SlotIndex);
+	}
 }
 
 void UHarmoniaWorldMarkerComponent::RemoveAllMarkers()
 {
-	for (const FHarmoniaWorldMarkerData& Marker : Markers)
+	TArray<FGuid> RemovedIDs;
+	MarkerSlotById.GenerateKeyArray(RemovedIDs);
+
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->UnregisterAll(this);
+	}
+
+	MarkerSlots.Empty();
+	MarkerSlotById.Empty();
+	InRangeMarkerIndices.Empty();
+	VisibleMarkerIndices.Empty();
+	MaxFiniteDisplayDistance = 0.0f;
+
+	for (const FGuid& RemovedID : RemovedIDs)
 	{
-		OnMarkerRemoved.Broadcast(Marker.MarkerID);
+		OnMarkerRemoved.Broadcast(RemovedID);
 	}
-	Markers.Empty();
 }
 
 bool UHarmoniaWorldMarkerComponent::UpdateMarker(FGuid MarkerID, const FHarmoniaWorldMarkerData& NewData)
 {
-	for (FHarmoniaWorldMarkerData& Marker : Markers)
+	const int32 SlotIndex = FindSlot(MarkerID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Marker.MarkerID == MarkerID)
-		{
-			// Preserve ID
-			FGuid OriginalID = Marker.MarkerID;
-			Marker = NewData;
-			Marker.MarkerID = OriginalID;
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	// Preserve ID
+	FHarmoniaWorldMarkerData& Marker = MarkerSlots[SlotIndex].Data;
+	Marker = NewData;
+	Marker.MarkerID = MarkerID;
+
+	RegisterSlot(SlotIndex);
+	return true;
 }
 
 bool UHarmoniaWorldMarkerComponent::UpdateMarkerLocation(FGuid MarkerID, FVector NewLocation)
 {
-	for (FHarmoniaWorldMarkerData& Marker : Markers)
+	const int32 SlotIndex = FindSlot(MarkerID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Marker.MarkerID == MarkerID)
-		{
-			Marker.WorldLocation = NewLocation;
-			return true;
-		}
+		return false;
+	}
+
+	FMarkerSlot& Slot = MarkerSlots[SlotIndex];
+	Slot.Data.WorldLocation = NewLocation;
+
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->SetLocation(Slot.Handle, NewLocation);
 	}
-	return false;
+	return true;
 }
 
 // ============================================================================
 // Marker Queries
 // ============================================================================
 
-TArray<FHarmoniaWorldMarkerData> UHarmoniaWorldMarkerComponent::GetVisibleMarkers() const
+TArray<FHarmoniaWorldMarkerData> UHarmoniaWorldMarkerComponent::GetAllMarkers() const
 {
-	TArray<FHarmoniaWorldMarkerData> VisibleMarkers;
-	for (const FHarmoniaWorldMarkerData& Marker : Markers)
+	TArray<FHarmoniaWorldMarkerData> Result;
+	Result.Reserve(MarkerSlots.Num());
+	for (const FMarkerSlot& Slot : MarkerSlots)
 	{
-		if (Marker.bIsCurrentlyVisible)
-		{
-			VisibleMarkers.Add(Marker);
-		}
+		Result.Add(Slot.Data);
 	}
+	return Result;
+}
 
-	// Sort by priority (higher first)
-	VisibleMarkers.Sort([](const FHarmoniaWorldMarkerData& A, const FHarmoniaWorldMarkerData& B)
+TArray<FHarmoniaWorldMarkerData> UHarmoniaWorldMarkerComponent::GetVisibleMarkers() const
+{
+	TArray<FHarmoniaWorldMarkerData> VisibleMarkers;
+	VisibleMarkers.Reserve(GetNumVisibleMarkers());
+	ForEachVisibleMarker([&VisibleMarkers](const FHarmoniaWorldMarkerData& Marker)
 	{
-		return A.Priority > B.Priority;
+		VisibleMarkers.Add(Marker);
 	});
+	return VisibleMarkers;
+}
 
-	// Limit to max visible
-	if (VisibleMarkers.Num() > MaxVisibleMarkers)
+void UHarmoniaWorldMarkerComponent::ForEachVisibleMarker(TFunctionRef<void(const FHarmoniaWorldMarkerData&)> Visitor) const
+{
+	// Already sorted by priority, limited to max visible
+	const int32 NumVisible = GetNumVisibleMarkers();
+	for (int32 i = 0; i < NumVisible; ++i)
 	{
-		VisibleMarkers.SetNum(MaxVisibleMarkers);
+		Visitor(MarkerSlots[VisibleMarkerIndices[i]].Data);
 	}
-
-	return VisibleMarkers;
 }
 
 bool UHarmoniaWorldMarkerComponent::GetMarkerByID(FGuid MarkerID, FHarmoniaWorldMarkerData& OutMarker) const
 {
-	for (const FHarmoniaWorldMarkerData& Marker : Markers)
+	const int32 SlotIndex = FindSlot(MarkerID);
+	if (SlotIndex == INDEX_NONE)
 	{
-		if (Marker.MarkerID == MarkerID)
-		{
-			OutMarker = Marker;
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	OutMarker = MarkerSlots[SlotIndex].Data;
+	return true;
 }
 
 TArray<FHarmoniaWorldMarkerData> UHarmoniaWorldMarkerComponent::GetMarkersByCategory(FGameplayTag Category) const
 {
 	TArray<FHarmoniaWorldMarkerData> Result;
-	for (const FHarmoniaWorldMarkerData& Marker : Markers)
+	for (const FMarkerSlot& Slot : MarkerSlots)
 	{
-		if (Marker.CategoryTag.MatchesTag(Category))
+		if (Slot.Data.CategoryTag.MatchesTag(Category))
 		{
-			Result.Add(Marker);
+			Result.Add(Slot.Data);
 		}
 	}
 	return Result;
@@ -262,9 +316,10 @@ bool UHarmoniaWorldMarkerComponent::GetClosestMarkerToCenter(FHarmoniaWorldMarke
 	float ClosestDistance = MAX_FLT;
 	bool bFound = false;
 
-	for (const FHarmoniaWorldMarkerData& Marker : Markers)
+	for (int32 SlotIndex : VisibleMarkerIndices)
 	{
-		if (Marker.bIsCurrentlyVisible && !Marker.bIsOffScreen)
+		const FHarmoniaWorldMarkerData& Marker = MarkerSlots[SlotIndex].Data;
+		if (!Marker.bIsOffScreen)
 		{
 			float DistanceToCenter = FVector2D::Distance(Marker.CurrentScreenPosition, ScreenCenter);
 			if (DistanceToCenter < ClosestDistance)
@@ -293,6 +348,8 @@ void UHarmoniaWorldMarkerComponent::SetCategoryVisible(FGameplayTag Category, bo
 	{
 		HiddenCategories.AddUnique(Category);
 	}
+
+	RefreshHiddenCategoryMask();
 }
 
 bool UHarmoniaWorldMarkerComponent::IsCategoryVisible(FGameplayTag Category) const
@@ -339,9 +396,14 @@ FVector2D UHarmoniaWorldMarkerComponent::GetClampedScreenPosition(FVector WorldP
 		return ScreenPos;
 	}
 
+	return ClampToScreenEdge(ScreenPos, EdgePadding);
+}
+
+FVector2D UHarmoniaWorldMarkerComponent::ClampToScreenEdge(const FVector2D& ScreenPosition, float EdgePadding) const
+{
 	// Calculate clamped position at screen edge
 	FVector2D ScreenCenter = CachedViewportSize * 0.5f;
-	FVector2D Direction = ScreenPos - ScreenCenter;
+	FVector2D Direction = ScreenPosition - ScreenCenter;
 
 	if (Direction.IsNearlyZero())
 	{
@@ -421,43 +483,92 @@ FText UHarmoniaWorldMarkerComponent::FormatDistance(float DistanceInCM) const
 
 void UHarmoniaWorldMarkerComponent::UpdateMarkers()
 {
-	FVector CameraLocation = GetCameraLocation();
-
-	for (FHarmoniaWorldMarkerData& Marker : Markers)
+	// Markers outside this update's query keep no stale visibility
+	for (int32 SlotIndex : InRangeMarkerIndices)
 	{
-		// Update location for tracked actors
-		if (Marker.TrackedActor.IsValid())
+		if (MarkerSlots.IsValidIndex(SlotIndex))
 		{
-			Marker.WorldLocation = Marker.TrackedActor->GetActorLocation();
+			MarkerSlots[SlotIndex].Data.bIsCurrentlyVisible = false;
 		}
+	}
+	InRangeMarkerIndices.Reset();
+	VisibleMarkerIndices.Reset();
+
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	if (!Registry || MarkerSlots.Num() == 0)
+	{
+		return;
+	}
+
+	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+	const FVector CameraLocation = GetCameraLocation();
+	const FVector CameraForward = GetCameraRotation().Vector();
+
+	// Cone around the view frustum, markers outside it cannot be on screen
+	float CosViewCone = 0.0f;
+	if (PC && PC->PlayerCameraManager && CachedViewportSize.X > 0.0f)
+	{
+		const float TanHalfHorizontal = FMath::Tan(FMath::DegreesToRadians(PC->PlayerCameraManager->GetFOVAngle() * 0.5f));
+		const float TanHalfVertical = TanHalfHorizontal * CachedViewportSize.Y / CachedViewportSize.X;
+		CosViewCone = FMath::Cos(FMath::Atan(FMath::Sqrt(FMath::Square(TanHalfHorizontal) + FMath::Square(TanHalfVertical))));
+	}
+
+	// Only markers within the largest finite display distance, plus the infinite range ones
+	Registry->QueryRadius(this, CameraLocation, MaxFiniteDisplayDistance, HiddenCategoryMask, QueryHits);
+
+	for (const FHarmoniaMarkerQueryHit& Hit : QueryHits)
+	{
+		FHarmoniaWorldMarkerData& Marker = MarkerSlots[Hit.PayloadIndex].Data;
+		Marker.WorldLocation = Hit.Location;
 
 		// Calculate distance
 		Marker.CurrentDistance = FVector::Dist(CameraLocation, Marker.WorldLocation);
 
-		// Check category visibility
-		if (Marker.CategoryTag.IsValid() && !IsCategoryVisible(Marker.CategoryTag))
+		// Check display mode visibility
+		Marker.bIsCurrentlyVisible = ShouldMarkerBeVisible(Marker, Marker.CurrentDistance);
+		if (!Marker.bIsCurrentlyVisible)
 		{
-			Marker.bIsCurrentlyVisible = false;
 			continue;
 		}
+		InRangeMarkerIndices.Add(Hit.PayloadIndex);
 
-		// Check display mode visibility
-		Marker.bIsCurrentlyVisible = ShouldMarkerBeVisible(Marker, Marker.CurrentDistance);
+		const FVector ToMarker = Marker.WorldLocation - CameraLocation;
+		const bool bInViewCone = FVector::DotProduct(ToMarker, CameraForward) >= CosViewCone * Marker.CurrentDistance;
 
-		if (Marker.bIsCurrentlyVisible)
+		// Nothing to draw for an off-screen marker that does not clamp
+		if (!bInViewCone && !Marker.bClampToScreenEdge)
 		{
-			// Update screen position
-			bool bOnScreen;
-			WorldToScreen(Marker.WorldLocation, Marker.CurrentScreenPosition, bOnScreen);
-			Marker.bIsOffScreen = !bOnScreen;
+			Marker.bIsOffScreen = true;
+			continue;
+		}
 
-			// Clamp to screen edge if needed
-			if (Marker.bIsOffScreen && Marker.bClampToScreenEdge)
+		bool bOnScreen = false;
+		if (PC)
+		{
+			bOnScreen = UGameplayStatics::ProjectWorldToScreen(PC, Marker.WorldLocation, Marker.CurrentScreenPosition, true)
+				&& FVector::DotProduct(ToMarker, CameraForward) >= 0.0f;
+		}
+		Marker.bIsOffScreen = !bOnScreen;
+
+		if (Marker.bIsOffScreen)
+		{
+			if (!Marker.bClampToScreenEdge)
 			{
-				Marker.CurrentScreenPosition = GetClampedScreenPosition(Marker.WorldLocation, Marker.ScreenEdgePadding);
+				continue;
 			}
+			Marker.CurrentScreenPosition = ClampToScreenEdge(Marker.CurrentScreenPosition, Marker.ScreenEdgePadding);
 		}
+
+		VisibleMarkerIndices.Add(Hit.PayloadIndex);
 	}
+
+	// Sort by priority (higher first), slot order keeps ties stable between frames
+	VisibleMarkerIndices.Sort([this](int32 A, int32 B)
+	{
+		const int32 PriorityA = MarkerSlots[A].Data.Priority;
+		const int32 PriorityB = MarkerSlots[B].Data.Priority;
+		return PriorityA != PriorityB ? PriorityA > PriorityB : A < B;
+	});
 }
 
 bool UHarmoniaWorldMarkerComponent::ShouldMarkerBeVisible(const FHarmoniaWorldMarkerData& Marker, float Distance) const
@@ -540,14 +651,19 @@ float UHarmoniaWorldMarkerComponent::CalculateMarkerOpacity(const FHarmoniaWorld
 
 void UHarmoniaWorldMarkerComponent::CleanupInvalidMarkers()
 {
-	for (int32 i = Markers.Num() - 1; i >= 0; --i)
+	// Remove markers tracking destroyed actors, the registry reports them
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	if (!Registry)
 	{
-		// Remove markers tracking destroyed actors
-		if (Markers[i].TrackedActor.IsValid() == false && Markers[i].TrackedActor.IsExplicitlyNull() == false)
+		return;
+	}
+
+	Registry->ConsumeLostMarkers(this, LostSlots);
+	for (int32 SlotIndex : LostSlots)
+	{
+		if (MarkerSlots.IsValidIndex(SlotIndex))
 		{
-			FGuid RemovedID = Markers[i].MarkerID;
-			Markers.RemoveAt(i);
-			OnMarkerRemoved.Broadcast(RemovedID);
+			RemoveSlot(SlotIndex);
 		}
 	}
 }
@@ -571,3 +687,74 @@ FRotator UHarmoniaWorldMarkerComponent::GetCameraRotation() const
 	}
 	return FRotator::ZeroRotator;
 }
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+void UHarmoniaWorldMarkerComponent::RegisterSlot(int32 SlotIndex)
+{
+	FMarkerSlot& Slot = MarkerSlots[SlotIndex];
+	const FHarmoniaWorldMarkerData& Marker = Slot.Data;
+
+	// Infinite range markers are checked every update, the others only when the camera is near
+	const bool bInfiniteRange = Marker.MaxDisplayDistance <= 0.0f;
+	if (!bInfiniteRange)
+	{
+		MaxFiniteDisplayDistance = FMath::Max(MaxFiniteDisplayDistance, Marker.MaxDisplayDistance);
+	}
+
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	if (!Registry)
+	{
+		return;
+	}
+
+	if (Registry->IsRegistered(Slot.Handle))
+	{
+		Registry->Update(Slot.Handle, Marker.WorldLocation, Marker.TrackedActor.Get(), Marker.CategoryTag, bInfiniteRange);
+	}
+	else
+	{
+		Slot.Handle = Registry->Register(this, SlotIndex, Marker.WorldLocation, Marker.TrackedActor.Get(), Marker.CategoryTag, bInfiniteRange);
+	}
+}
+
+void UHarmoniaWorldMarkerComponent::RemoveSlot(int32 SlotIndex)
+{
+	FMarkerSlot& Slot = MarkerSlots[SlotIndex];
+	const FGuid RemovedID = Slot.Data.MarkerID;
+
+	if (UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry())
+	{
+		Registry->Unregister(Slot.Handle);
+	}
+
+	MarkerSlotById.Remove(RemovedID);
+	MarkerSlots.RemoveAt(SlotIndex);
+	InRangeMarkerIndices.RemoveSingleSwap(SlotIndex);
+	VisibleMarkerIndices.RemoveSingle(SlotIndex);
+
+	OnMarkerRemoved.Broadcast(RemovedID);
+}
+
+int32 UHarmoniaWorldMarkerComponent::FindSlot(const FGuid& MarkerID) const
+{
+	const int32* SlotIndex = MarkerSlotById.Find(MarkerID);
+	return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+void UHarmoniaWorldMarkerComponent::RefreshHiddenCategoryMask()
+{
+	UHarmoniaMarkerRegistrySubsystem* Registry = GetRegistry();
+	HiddenCategoryMask = Registry ? Registry->GetCategoryMask(HiddenCategories) : 0;
+}
+
+UHarmoniaMarkerRegistrySubsystem* UHarmoniaWorldMarkerComponent::GetRegistry() const
+{
+	if (!CachedRegistry.IsValid())
+	{
+		const_cast<UHarmoniaWorldMarkerComponent*>(this)->CachedRegistry = UHarmoniaMarkerRegistrySubsystem::Get(this);
+	}
+	return CachedRegistry.Get();
+}
@@ -0,0 +1,91 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Definitions/HarmoniaInventorySystemDefinitions.h"
+#include "Components/HarmoniaInventoryComponent.h"
+
+// ============================================================================
+// FInventoryData
+// ============================================================================
+
+void FInventoryData::Initialize(UHarmoniaInventoryComponent* InOwnerComponent)
+{
+	OwnerComponent = InOwnerComponent;
+
+	Slots.SetNum(MaxSlotCount);
+	for (int32 i = 0; i < Slots.Num(); ++i)
+	{
+		Slots[i].Index = i;
+	}
+
+	MarkArrayDirty();
+}
+
+void FInventoryData::MarkSlotDirty(int32 SlotIndex)
+{
+	if (Slots.IsValidIndex(SlotIndex))
+	{
+		MarkItemDirty(Slots[SlotIndex]);
+	}
+}
+
+const FInventorySlot* FInventoryData::FindSlot(int32 SlotIndex) const
+{
+	// Fast path: on the server (and normally on clients) the array position matches the slot index
+	if (Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].Index == SlotIndex)
+	{
+		return &Slots[SlotIndex];
+	}
+
+	return Slots.FindByPredicate([SlotIndex](const FInventorySlot& Slot) { return Slot.Index == SlotIndex; });
+}
+
+void FInventoryData::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (int32 Index : RemovedIndices)
+	{
+		// Report the slot as emptied so bound UI can clear it
+		FInventorySlot EmptySlot;
+		EmptySlot.Index = Slots[Index].Index;
+		OwnerComponent->HandleSlotReplicated(EmptySlot);
+	}
+}
+
+void FInventoryData::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (int32 Index : AddedIndices)
+	{
+		OwnerComponent->HandleSlotReplicated(Slots[Index]);
+	}
+}
+
+void FInventoryData::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (int32 Index : ChangedIndices)
+	{
+		OwnerComponent->HandleSlotReplicated(Slots[Index]);
+	}
+}
+
+void FInventoryData::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (OwnerComponent)
+	{
+		// One coarse notification per received batch, per-slot listeners have already been told what changed
+		OwnerComponent->OnInventoryChanged.Broadcast();
+	}
+}
@@ -0,0 +1,452 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Definitions/HarmoniaMapSystemDefinitions.h"
+#include "Components/HarmoniaMapComponent.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace HarmoniaExplorationGrid
+{
+	// Bump when the RLE layout changes, older saves are then ignored
+	constexpr uint8 SaveVersion = 1;
+
+	// Sanity limit for the saved resolution so corrupt data can't trigger a huge allocation
+	constexpr int32 MaxSavedCellsPerSide = 16384;
+
+	FORCEINLINE int32 GetNibbleIndex(int32 LocalX, int32 LocalY)
+	{
+		return LocalY * FHarmoniaExplorationGrid::TileSize + LocalX;
+	}
+
+	FORCEINLINE uint8 ReadNibble(const uint8* Cells, int32 NibbleIndex)
+	{
+		return (Cells[NibbleIndex >> 1] >> ((NibbleIndex & 1) * 4)) & 0x0F;
+	}
+
+	FORCEINLINE void WriteNibble(uint8* Cells, int32 NibbleIndex, uint8 Value)
+	{
+		const int32 Shift = (NibbleIndex & 1) * 4;
+		uint8& Byte = Cells[NibbleIndex >> 1];
+		Byte = (Byte & ~(0x0F << Shift)) | ((Value & 0x0F) << Shift);
+	}
+}
+
+// ============================================================================
+// FHarmoniaExplorationGrid
+// ============================================================================
+
+void FHarmoniaExplorationGrid::Initialize(const FBox& WorldBounds, int32 Resolution, UHarmoniaMapComponent* InOwnerComponent)
+{
+	OwnerComponent = InOwnerComponent;
+
+	TilesPerSide = FMath::DivideAndRoundUp(FMath::Max(Resolution, TileSize), TileSize);
+	CellsPerSide = TilesPerSide * TileSize;
+
+	const FVector BoundsSize = WorldBounds.IsValid ? WorldBounds.GetSize() : FVector(1.0);
+	Origin = WorldBounds.IsValid ? FVector2D(WorldBounds.Min) : FVector2D::ZeroVector;
+	CellSize = FVector2D(
+		FMath::Max(BoundsSize.X, 1.0) / CellsPerSide,
+		FMath::Max(BoundsSize.Y, 1.0) / CellsPerSide);
+
+	// Tiles may have been replicated before the map data was known
+	RebuildTileLookup();
+
+	DirtyTileBits.Init(false, TilesPerSide * TilesPerSide);
+	DirtyTiles.Reset();
+	for (const FHarmoniaExplorationTile& Tile : Tiles)
+	{
+		MarkTileDirty(Tile.TileIndex);
+	}
+}
+
+bool FHarmoniaExplorationGrid::RevealCircle(const FVector& Center, float Radius)
+{
+	using namespace HarmoniaExplorationGrid;
+
+	if (!IsInitialized() || Radius <= 0.0f)
+	{
+		return false;
+	}
+
+	// Cells between Radius and FadeRadius get a partial alpha, like the old circle fade
+	const double FadeRadius = Radius * 1.5;
+	const FVector2D LocalCenter = (FVector2D(Center) - Origin) / CellSize;
+	const FVector2D LocalExtent = FVector2D(FadeRadius) / CellSize;
+
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt32(LocalCenter.X - LocalExtent.X), 0, CellsPerSide - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt32(LocalCenter.Y - LocalExtent.Y), 0, CellsPerSide - 1);
+	const int32 MaxX = FMath::Clamp(FMath::FloorToInt32(LocalCenter.X + LocalExtent.X), 0, CellsPerSide - 1);
+	const int32 MaxY = FMath::Clamp(FMath::FloorToInt32(LocalCenter.Y + LocalExtent.Y), 0, CellsPerSide - 1);
+
+	if (LocalCenter.X + LocalExtent.X < 0.0 || LocalCenter.Y + LocalExtent.Y < 0.0
+		|| LocalCenter.X - LocalExtent.X >= CellsPerSide || LocalCenter.Y - LocalExtent.Y >= CellsPerSide)
+	{
+		return false;
+	}
+
+	const double InvRadius = 1.0 / Radius;
+	bool bAnyChanged = false;
+
+	// Walk tile by tile so each tile is looked up (and marked dirty) once
+	for (int32 TileY = MinY / TileSize; TileY <= MaxY / TileSize; ++TileY)
+	{
+		for (int32 TileX = MinX / TileSize; TileX <= MaxX / TileSize; ++TileX)
+		{
+			const int32 TileIndex = TileY * TilesPerSide + TileX;
+			FHarmoniaExplorationTile* Tile = TileLookup[TileIndex] != INDEX_NONE ? &Tiles[TileLookup[TileIndex]] : nullptr;
+			bool bTileChanged = false;
+
+			const int32 StartX = FMath::Max(MinX, TileX * TileSize);
+			const int32 EndX = FMath::Min(MaxX, TileX * TileSize + TileSize - 1);
+			const int32 StartY = FMath::Max(MinY, TileY * TileSize);
+			const int32 EndY = FMath::Min(MaxY, TileY * TileSize + TileSize - 1);
+
+			for (int32 CellY = StartY; CellY <= EndY; ++CellY)
+			{
+				const double DeltaY = (CellY + 0.5 - LocalCenter.Y) * CellSize.Y;
+
+				for (int32 CellX = StartX; CellX <= EndX; ++CellX)
+				{
+					const double DeltaX = (CellX + 0.5 - LocalCenter.X) * CellSize.X;
+					const double DistanceRatio = FMath::Sqrt(DeltaX * DeltaX + DeltaY * DeltaY) * InvRadius;
+
+					uint8 Alpha = MaxAlpha;
+					if (DistanceRatio > 1.5)
+					{
+						continue;
+					}
+					else if (DistanceRatio > 1.0)
+					{
+						Alpha = static_cast<uint8>(FMath::RoundToInt32(MaxAlpha * (1.0 - (DistanceRatio - 1.0) / 0.5)));
+						if (Alpha == 0)
+						{
+							continue;
+						}
+					}
+
+					const int32 NibbleIndex = GetNibbleIndex(CellX - TileX * TileSize, CellY - TileY * TileSize);
+					if (Tile && ReadNibble(Tile->Cells.GetData(), NibbleIndex) >= Alpha)
+					{
+						continue;
+					}
+
+					if (!Tile)
+					{
+						Tile = &FindOrAddTile(TileIndex);
+					}
+
+					WriteNibble(Tile->Cells.GetData(), NibbleIndex, Alpha);
+					bTileChanged = true;
+				}
+			}
+
+			if (bTileChanged)
+			{
+				MarkItemDirty(*Tile);
+				MarkTileDirty(TileIndex);
+				bAnyChanged = true;
+			}
+		}
+	}
+
+	return bAnyChanged;
+}
+
+uint8 FHarmoniaExplorationGrid::GetAlpha(const FVector& WorldLocation) const
+{
+	if (!IsInitialized())
+	{
+		return 0;
+	}
+
+	const int32 CellX = FMath::FloorToInt32((WorldLocation.X - Origin.X) / CellSize.X);
+	const int32 CellY = FMath::FloorToInt32((WorldLocation.Y - Origin.Y) / CellSize.Y);
+	if (CellX < 0 || CellY < 0 || CellX >= CellsPerSide || CellY >= CellsPerSide)
+	{
+		return 0;
+	}
+
+	const int32 TileLookupIndex = TileLookup[(CellY / TileSize) * TilesPerSide + CellX / TileSize];
+	if (TileLookupIndex == INDEX_NONE)
+	{
+		return 0;
+	}
+
+	return GetTileCellAlpha(&Tiles[TileLookupIndex], CellX % TileSize, CellY % TileSize);
+}
+
+uint8 FHarmoniaExplorationGrid::GetTileCellAlpha(const FHarmoniaExplorationTile* Tile, int32 LocalX, int32 LocalY)
+{
+	if (!Tile || Tile->Cells.Num() != BytesPerTile)
+	{
+		return 0;
+	}
+
+	return HarmoniaExplorationGrid::ReadNibble(Tile->Cells.GetData(), HarmoniaExplorationGrid::GetNibbleIndex(LocalX, LocalY));
+}
+
+const FHarmoniaExplorationTile* FHarmoniaExplorationGrid::FindTile(int32 TileIndex) const
+{
+	if (!TileLookup.IsValidIndex(TileIndex) || TileLookup[TileIndex] == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return &Tiles[TileLookup[TileIndex]];
+}
+
+void FHarmoniaExplorationGrid::ConsumeDirtyTiles(TArray<int32>& OutTileIndices)
+{
+	OutTileIndices = MoveTemp(DirtyTiles);
+	DirtyTiles.Reset();
+	DirtyTileBits.SetRange(0, DirtyTileBits.Num(), false);
+}
+
+void FHarmoniaExplorationGrid::Reset()
+{
+	for (const FHarmoniaExplorationTile& Tile : Tiles)
+	{
+		MarkTileDirty(Tile.TileIndex);
+	}
+
+	Tiles.Reset();
+	RebuildTileLookup();
+	MarkArrayDirty();
+}
+
+FHarmoniaExplorationTile& FHarmoniaExplorationGrid::FindOrAddTile(int32 TileIndex)
+{
+	if (TileLookup[TileIndex] != INDEX_NONE)
+	{
+		return Tiles[TileLookup[TileIndex]];
+	}
+
+	TileLookup[TileIndex] = Tiles.Num();
+
+	FHarmoniaExplorationTile& Tile = Tiles.AddDefaulted_GetRef();
+	Tile.TileIndex = TileIndex;
+	Tile.Cells.SetNumZeroed(BytesPerTile);
+	MarkItemDirty(Tile);
+	return Tile;
+}
+
+void FHarmoniaExplorationGrid::RebuildTileLookup()
+{
+	TileLookup.Init(INDEX_NONE, TilesPerSide * TilesPerSide);
+
+	for (int32 Index = 0; Index < Tiles.Num(); ++Index)
+	{
+		if (TileLookup.IsValidIndex(Tiles[Index].TileIndex))
+		{
+			TileLookup[Tiles[Index].TileIndex] = Index;
+		}
+	}
+}
+
+void FHarmoniaExplorationGrid::MarkTileDirty(int32 TileIndex)
+{
+	if (DirtyTileBits.IsValidIndex(TileIndex) && !DirtyTileBits[TileIndex])
+	{
+		DirtyTileBits[TileIndex] = true;
+		DirtyTiles.Add(TileIndex);
+	}
+}
+
+// ============================================================================
+// Save
+// ============================================================================
+
+void FHarmoniaExplorationGrid::SaveRLE(TArray<uint8>& OutData) const
+{
+	OutData.Reset();
+	if (!IsInitialized())
+	{
+		return;
+	}
+
+	FMemoryWriter Writer(OutData);
+
+	uint8 Version = HarmoniaExplorationGrid::SaveVersion;
+	int32 SavedCellsPerSide = CellsPerSide;
+	Writer << Version;
+	Writer << SavedCellsPerSide;
+
+	// (run length, byte) pairs over every tile in grid order, unexplored tiles read as zeros
+	uint8 RunValue = 0;
+	int32 RunLength = 0;
+	auto FlushRun = [&Writer, &RunValue, &RunLength]()
+	{
+		uint8 Length = static_cast<uint8>(RunLength);
+		Writer << Length;
+		Writer << RunValue;
+		RunLength = 0;
+	};
+
+	for (int32 TileIndex = 0; TileIndex < TileLookup.Num(); ++TileIndex)
+	{
+		const FHarmoniaExplorationTile* Tile = FindTile(TileIndex);
+		const bool bHasCells = Tile && Tile->Cells.Num() == BytesPerTile;
+
+		for (int32 ByteIndex = 0; ByteIndex < BytesPerTile; ++ByteIndex)
+		{
+			const uint8 Value = bHasCells ? Tile->Cells[ByteIndex] : 0;
+			if (RunLength > 0 && (Value != RunValue || RunLength == MAX_uint8))
+			{
+				FlushRun();
+			}
+
+			RunValue = Value;
+			RunLength++;
+		}
+	}
+
+	if (RunLength > 0)
+	{
+		FlushRun();
+	}
+}
+
+bool FHarmoniaExplorationGrid::LoadRLE(const TArray<uint8>& Data)
+{
+	if (!IsInitialized() || Data.Num() == 0)
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+
+	uint8 Version = 0;
+	int32 SavedCellsPerSide = 0;
+	Reader << Version;
+	Reader << SavedCellsPerSide;
+
+	if (Reader.IsError() || Version != HarmoniaExplorationGrid::SaveVersion
+		|| SavedCellsPerSide <= 0 || SavedCellsPerSide % TileSize != 0 || SavedCellsPerSide > HarmoniaExplorationGrid::MaxSavedCellsPerSide)
+	{
+		return false;
+	}
+
+	// Decode every saved tile in grid order
+	const int32 SavedTilesPerSide = SavedCellsPerSide / TileSize;
+	const int32 SavedNumBytes = SavedTilesPerSide * SavedTilesPerSide * BytesPerTile;
+
+	TArray<uint8> SavedBytes;
+	SavedBytes.SetNumZeroed(SavedNumBytes);
+
+	int32 DecodedBytes = 0;
+	while (!Reader.AtEnd() && DecodedBytes < SavedNumBytes)
+	{
+		uint8 Length = 0;
+		uint8 Value = 0;
+		Reader << Length;
+		Reader << Value;
+
+		if (Reader.IsError())
+		{
+			break;
+		}
+
+		const int32 RunEnd = FMath::Min(DecodedBytes + Length, SavedNumBytes);
+		if (Value != 0)
+		{
+			FMemory::Memset(SavedBytes.GetData() + DecodedBytes, Value, RunEnd - DecodedBytes);
+		}
+		DecodedBytes = RunEnd;
+	}
+
+	if (DecodedBytes != SavedNumBytes)
+	{
+		return false;
+	}
+
+	Reset();
+
+	if (SavedCellsPerSide == CellsPerSide)
+	{
+		for (int32 TileIndex = 0; TileIndex < TilesPerSide * TilesPerSide; ++TileIndex)
+		{
+			const uint8* SavedTile = SavedBytes.GetData() + TileIndex * BytesPerTile;
+			for (int32 ByteIndex = 0; ByteIndex < BytesPerTile; ++ByteIndex)
+			{
+				if (SavedTile[ByteIndex] != 0)
+				{
+					FHarmoniaExplorationTile& Tile = FindOrAddTile(TileIndex);
+					FMemory::Memcpy(Tile.Cells.GetData(), SavedTile, BytesPerTile);
+					MarkTileDirty(TileIndex);
+					break;
+				}
+			}
+		}
+	}
+	else
+	{
+		// The grid resolution changed since the save: both grids span the map bounds, so sample the saved cell under each cell center
+		using namespace HarmoniaExplorationGrid;
+
+		const double SavedCellsPerCell = static_cast<double>(SavedCellsPerSide) / CellsPerSide;
+
+		for (int32 CellY = 0; CellY < CellsPerSide; ++CellY)
+		{
+			const int32 SavedY = FMath::Min(FMath::FloorToInt32((CellY + 0.5) * SavedCellsPerCell), SavedCellsPerSide - 1);
+
+			for (int32 CellX = 0; CellX < CellsPerSide; ++CellX)
+			{
+				const int32 SavedX = FMath::Min(FMath::FloorToInt32((CellX + 0.5) * SavedCellsPerCell), SavedCellsPerSide - 1);
+
+				const int32 SavedTileIndex = (SavedY / TileSize) * SavedTilesPerSide + SavedX / TileSize;
+				const uint8 Alpha = ReadNibble(SavedBytes.GetData() + SavedTileIndex * BytesPerTile, GetNibbleIndex(SavedX % TileSize, SavedY % TileSize));
+				if (Alpha == 0)
+				{
+					continue;
+				}
+
+				const int32 TileIndex = (CellY / TileSize) * TilesPerSide + CellX / TileSize;
+				FHarmoniaExplorationTile& Tile = FindOrAddTile(TileIndex);
+				WriteNibble(Tile.Cells.GetData(), GetNibbleIndex(CellX % TileSize, CellY % TileSize), Alpha);
+				MarkTileDirty(TileIndex);
+			}
+		}
+	}
+
+	MarkArrayDirty();
+	return true;
+}
+
+// ============================================================================
+// Replication
+// ============================================================================
+
+void FHarmoniaExplorationGrid::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	for (int32 Index : RemovedIndices)
+	{
+		MarkTileDirty(Tiles[Index].TileIndex);
+	}
+}
+
+void FHarmoniaExplorationGrid::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	for (int32 Index : AddedIndices)
+	{
+		MarkTileDirty(Tiles[Index].TileIndex);
+	}
+}
+
+void FHarmoniaExplorationGrid::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	for (int32 Index : ChangedIndices)
+	{
+		MarkTileDirty(Tiles[Index].TileIndex);
+	}
+}
+
+void FHarmoniaExplorationGrid::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// Adds and removes shift positions in Tiles
+	RebuildTileLookup();
+
+	if (OwnerComponent)
+	{
+		OwnerComponent->HandleExplorationReplicated();
+	}
+}
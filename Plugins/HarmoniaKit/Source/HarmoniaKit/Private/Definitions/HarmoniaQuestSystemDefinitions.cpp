@@ -0,0 +1,153 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Definitions/HarmoniaQuestSystemDefinitions.h"
+#include "Components/HarmoniaQuestComponent.h"
+
+// ============================================================================
+// FActiveQuestList
+// ============================================================================
+
+FActiveQuestProgress* FActiveQuestList::Find(const FHarmoniaID& QuestId)
+{
+	return Items.FindByPredicate([&QuestId](const FActiveQuestProgress& Item) { return Item.QuestId == QuestId; });
+}
+
+const FActiveQuestProgress* FActiveQuestList::Find(const FHarmoniaID& QuestId) const
+{
+	return Items.FindByPredicate([&QuestId](const FActiveQuestProgress& Item) { return Item.QuestId == QuestId; });
+}
+
+FActiveQuestProgress& FActiveQuestList::Add(const FActiveQuestProgress& Progress)
+{
+	FActiveQuestProgress& NewItem = Items.Add_GetRef(Progress);
+	MarkItemDirty(NewItem);
+	return NewItem;
+}
+
+bool FActiveQuestList::Remove(const FHarmoniaID& QuestId)
+{
+	const int32 NumRemoved = Items.RemoveAll([&QuestId](const FActiveQuestProgress& Item) { return Item.QuestId == QuestId; });
+	if (NumRemoved > 0)
+	{
+		MarkArrayDirty();
+		return true;
+	}
+	return false;
+}
+
+void FActiveQuestList::Reset(const TArray<FActiveQuestProgress>& NewItems)
+{
+	Items = NewItems;
+	for (FActiveQuestProgress& Item : Items)
+	{
+		// Save data may carry stale replication IDs, assign fresh ones
+		Item.ReplicationID = INDEX_NONE;
+		Item.ReplicationKey = INDEX_NONE;
+		MarkItemDirty(Item);
+	}
+	MarkArrayDirty();
+}
+
+void FActiveQuestList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (int32 Index : RemovedIndices)
+	{
+		OwnerComponent->HandleActiveQuestRemovedReplicated(Items[Index]);
+	}
+}
+
+void FActiveQuestList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (int32 Index : AddedIndices)
+	{
+		OwnerComponent->HandleActiveQuestReplicated(Items[Index], true);
+	}
+}
+
+void FActiveQuestList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (int32 Index : ChangedIndices)
+	{
+		OwnerComponent->HandleActiveQuestReplicated(Items[Index], false);
+	}
+}
+
+// ============================================================================
+// FQuestIdSet
+// ============================================================================
+
+bool FQuestIdSet::Add(const FHarmoniaID& QuestId)
+{
+	bool bAlreadyInSet = false;
+	Lookup.Add(QuestId, &bAlreadyInSet);
+	if (bAlreadyInSet)
+	{
+		return false;
+	}
+
+	MarkItemDirty(Entries.Emplace_GetRef(QuestId));
+	Ids.Add(QuestId);
+	return true;
+}
+
+bool FQuestIdSet::Remove(const FHarmoniaID& QuestId)
+{
+	if (Lookup.Remove(QuestId) == 0)
+	{
+		return false;
+	}
+
+	Entries.RemoveAll([&QuestId](const FQuestIdSetEntry& Entry) { return Entry.QuestId == QuestId; });
+	Ids.Remove(QuestId);
+	MarkArrayDirty();
+	return true;
+}
+
+void FQuestIdSet::Empty()
+{
+	Entries.Empty();
+	Lookup.Empty();
+	Ids.Empty();
+	MarkArrayDirty();
+}
+
+void FQuestIdSet::Reset(const TArray<FHarmoniaID>& QuestIds)
+{
+	Empty();
+	for (const FHarmoniaID& QuestId : QuestIds)
+	{
+		Add(QuestId);
+	}
+}
+
+void FQuestIdSet::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// Sets only change on quest completion/failure, a full rebuild per received batch is cheap
+	RebuildIds();
+}
+
+void FQuestIdSet::RebuildIds()
+{
+	Lookup.Reset();
+	Ids.Reset(Entries.Num());
+	for (const FQuestIdSetEntry& Entry : Entries)
+	{
+		Lookup.Add(Entry.QuestId);
+		Ids.Add(Entry.QuestId);
+	}
+}
@@ -5,6 +5,7 @@
 #include "Definitions/HarmoniaItemSystemDefinitions.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Controller.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 AActor* UHarmoniaInstancedItemManager::SpawnWorldActor(const FHarmoniaInstancedObjectData& Data, AController* Requestor)
 {
@@ -24,6 +25,19 @@ AActor* UHarmoniaInstancedItemManager::SpawnWorldActor(const FHarmoniaInstancedO
             return nullptr;
         }
 
+        // Not resident yet: spawn once the class has streamed in, if the instance is still there and not spawned meanwhile
+        UHarmoniaAssetResolverSubsystem* AssetResolver = UHarmoniaAssetResolverSubsystem::Get(this);
+        if (AssetResolver && !UHarmoniaAssetResolverSubsystem::IsResident(Item->WorldActorClass.ToSoftObjectPath()))
+        {
+            const FGuid InstanceGuid = Data.InstanceGuid;
+            TWeakObjectPtr<AController> WeakRequestor = Requestor;
+            AssetResolver->RequestAsset(Item->WorldActorClass.ToSoftObjectPath(), FSimpleDelegate::CreateWeakLambda(this, [this, InstanceGuid, WeakRequestor]()
+            {
+                SwapInstanceToActor(InstanceGuid, WeakRequestor.Get());
+            }));
+            return nullptr;
+        }
+
         ItemActorClass = Item->WorldActorClass.LoadSynchronous();
 
         if (!ItemActorClass)
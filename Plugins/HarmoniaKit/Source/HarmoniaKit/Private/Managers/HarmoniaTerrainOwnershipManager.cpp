@@ -14,6 +14,13 @@ void UHarmoniaTerrainOwnershipManager::Initialize(FSubsystemCollectionBase& Coll
 void UHarmoniaTerrainOwnershipManager::Deinitialize()
 {
 	OwnershipZones.Empty();
+	ZoneRecords.Empty();
+	FreeZoneIndices.Empty();
+	ZoneGrid.Empty();
+	OversizedZones.Empty();
+	PlayerKeys.Empty();
+	ZonesByPlayerKey.Empty();
+	ZonesByTeam.Empty();
 
 	Super::Deinitialize();
 }
@@ -24,7 +31,19 @@ void UHarmoniaTerrainOwnershipManager::Deinitialize()
 
 int32 UHarmoniaTerrainOwnershipManager::RegisterOwnershipZone(const FTerrainOwnershipZone& Zone)
 {
-	int32 ZoneIndex = OwnershipZones.Add(Zone);
+	int32 ZoneIndex = INDEX_NONE;
+	if (FreeZoneIndices.Num() > 0)
+	{
+		ZoneIndex = FreeZoneIndices.Pop(EAllowShrinking::No);
+		OwnershipZones[ZoneIndex] = Zone;
+	}
+	else
+	{
+		ZoneIndex = OwnershipZones.Add(Zone);
+		ZoneRecords.AddDefaulted();
+	}
+
+	IndexZone(ZoneIndex);
 
 	UE_LOG(LogTemp, Log, TEXT("Registered ownership zone '%s' at index %d (Center: %s, Radius: %.1f)"),
 		*Zone.ZoneName, ZoneIndex, *Zone.Center.ToString(), Zone.Radius);
@@ -34,50 +53,76 @@ int32 UHarmoniaTerrainOwnershipManager::RegisterOwnershipZone(const FTerrainOwne
 
 void UHarmoniaTerrainOwnershipManager::UnregisterOwnershipZone(int32 ZoneIndex)
 {
-	if (OwnershipZones.IsValidIndex(ZoneIndex))
+	if (ZoneRecords.IsValidIndex(ZoneIndex) && ZoneRecords[ZoneIndex].bRegistered)
 	{
 		FTerrainOwnershipZone& Zone = OwnershipZones[ZoneIndex];
 		UE_LOG(LogTemp, Log, TEXT("Unregistered ownership zone '%s' at index %d"), *Zone.ZoneName, ZoneIndex);
 
-		OwnershipZones.RemoveAt(ZoneIndex);
+		UnindexZone(ZoneIndex);
+
+		// Keep the slot so the indices of other zones stay valid
+		Zone = FTerrainOwnershipZone();
+		FreeZoneIndices.Add(ZoneIndex);
 	}
 }
 
 bool UHarmoniaTerrainOwnershipManager::GetZoneAtLocation(const FVector& Location, FTerrainOwnershipZone& OutZone) const
+{
+	const int32 ZoneIndex = FindZoneIndexAtLocation(Location);
+	if (ZoneIndex != INDEX_NONE)
+	{
+		OutZone = OwnershipZones[ZoneIndex];
+		return true;
+	}
+
+	return false;
+}
+
+int32 UHarmoniaTerrainOwnershipManager::FindZoneIndexAtLocation(const FVector& Location) const
 {
 	// Return the smallest zone that contains the location (most specific)
-	const FTerrainOwnershipZone* BestZone = nullptr;
-	float SmallestRadius = FLT_MAX;
+	// Cell lists are ordered smallest first, so the first containing zone is the answer for the cell
+	int32 BestZone = INDEX_NONE;
 
-	for (const FTerrainOwnershipZone& Zone : OwnershipZones)
+	if (const FZoneCell* Cell = ZoneGrid.Find(GetCell(Location)))
 	{
-		float Distance = FVector::Dist(Zone.Center, Location);
-		if (Distance <= Zone.Radius && Zone.Radius < SmallestRadius)
+		for (const int32 ZoneIndex : Cell->Zones)
 		{
-			BestZone = &Zone;
-			SmallestRadius = Zone.Radius;
+			if (ZoneContains(ZoneIndex, Location))
+			{
+				BestZone = ZoneIndex;
+				break;
+			}
 		}
 	}
 
-	if (BestZone)
+	// Oversized zones are ordered the same way and only matter while they would beat the cell's answer
+	for (const int32 ZoneIndex : OversizedZones)
 	{
-		OutZone = *BestZone;
-		return true;
+		if (BestZone != INDEX_NONE && !ZonePrecedes(ZoneIndex, BestZone))
+		{
+			break;
+		}
+
+		if (ZoneContains(ZoneIndex, Location))
+		{
+			BestZone = ZoneIndex;
+			break;
+		}
 	}
 
-	return false;
+	return BestZone;
 }
 
 TArray<int32> UHarmoniaTerrainOwnershipManager::GetZonesOwnedByPlayer(const FString& PlayerID) const
 {
 	TArray<int32> Result;
 
-	for (int32 i = 0; i < OwnershipZones.Num(); ++i)
+	const int32 PlayerKey = FindPlayerKey(PlayerID);
+	if (PlayerKey != INDEX_NONE)
 	{
-		if (OwnershipZones[i].OwnerPlayerID == PlayerID)
-		{
-			Result.Add(i);
-		}
+		Result = ZonesByPlayerKey[PlayerKey];
+		Result.Sort();
 	}
 
 	return Result;
@@ -92,12 +137,10 @@ TArray<int32> UHarmoniaTerrainOwnershipManager::GetZonesOwnedByTeam(int32 TeamID
 		return Result;
 	}
 
-	for (int32 i = 0; i < OwnershipZones.Num(); ++i)
+	if (const TArray<int32>* TeamZones = ZonesByTeam.Find(TeamID))
 	{
-		if (OwnershipZones[i].OwnerTeamID == TeamID)
-		{
-			Result.Add(i);
-		}
+		Result = *TeamZones;
+		Result.Sort();
 	}
 
 	return Result;
@@ -122,15 +165,16 @@ bool UHarmoniaTerrainOwnershipManager::HasBuildingPermission(AActor* Actor, cons
 
 bool UHarmoniaTerrainOwnershipManager::HasBuildingPermissionByID(const FString& PlayerID, int32 TeamID, const FVector& Location) const
 {
-	FTerrainOwnershipZone Zone;
-	bool bFoundZone = GetZoneAtLocation(Location, Zone);
+	const int32 ZoneIndex = FindZoneIndexAtLocation(Location);
 
 	// No zone found - check if building is allowed in unclaimed areas
-	if (!bFoundZone)
+	if (ZoneIndex == INDEX_NONE)
 	{
 		return bAllowBuildingInUnclaimedAreas;
 	}
 
+	const FTerrainOwnershipZone& Zone = OwnershipZones[ZoneIndex];
+
 	// Protected zone - no building allowed
 	if (Zone.bProtectedZone)
 	{
@@ -144,7 +188,8 @@ bool UHarmoniaTerrainOwnershipManager::HasBuildingPermissionByID(const FString&
 	}
 
 	// Check player ownership
-	if (!Zone.OwnerPlayerID.IsEmpty() && Zone.OwnerPlayerID == PlayerID)
+	const int32 OwnerPlayerKey = ZoneRecords[ZoneIndex].OwnerPlayerKey;
+	if (OwnerPlayerKey != INDEX_NONE && OwnerPlayerKey == FindPlayerKey(PlayerID))
 	{
 		return true;
 	}
@@ -161,14 +206,14 @@ bool UHarmoniaTerrainOwnershipManager::HasBuildingPermissionByID(const FString&
 
 bool UHarmoniaTerrainOwnershipManager::IsProtectedZone(const FVector& Location) const
 {
-	FTerrainOwnershipZone Zone;
-	return GetZoneAtLocation(Location, Zone) && Zone.bProtectedZone;
+	const int32 ZoneIndex = FindZoneIndexAtLocation(Location);
+	return ZoneIndex != INDEX_NONE && OwnershipZones[ZoneIndex].bProtectedZone;
 }
 
 bool UHarmoniaTerrainOwnershipManager::IsPublicBuildingArea(const FVector& Location) const
 {
-	FTerrainOwnershipZone Zone;
-	return GetZoneAtLocation(Location, Zone) && Zone.bAllowPublicBuilding;
+	const int32 ZoneIndex = FindZoneIndexAtLocation(Location);
+	return ZoneIndex != INDEX_NONE && OwnershipZones[ZoneIndex].bAllowPublicBuilding;
 }
 
 // ============================================================================
@@ -301,3 +346,158 @@ int32 UHarmoniaTerrainOwnershipManager::GetTeamIDFromActor(AActor* Actor) const
 
 	return INDEX_NONE;
 }
+
+// ============================================================================
+// Spatial Index
+// ============================================================================
+
+FIntPoint UHarmoniaTerrainOwnershipManager::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / GridCellSize), FMath::FloorToInt32(Location.Y / GridCellSize));
+}
+
+bool UHarmoniaTerrainOwnershipManager::ZonePrecedes(int32 ZoneA, int32 ZoneB) const
+{
+	const float RadiusA = OwnershipZones[ZoneA].Radius;
+	const float RadiusB = OwnershipZones[ZoneB].Radius;
+	return RadiusA != RadiusB ? RadiusA < RadiusB : ZoneRecords[ZoneA].Serial < ZoneRecords[ZoneB].Serial;
+}
+
+bool UHarmoniaTerrainOwnershipManager::ZoneContains(int32 ZoneIndex, const FVector& Location) const
+{
+	const FTerrainOwnershipZone& Zone = OwnershipZones[ZoneIndex];
+	return Zone.Radius >= 0.0f && FVector::DistSquared(Zone.Center, Location) <= FMath::Square(Zone.Radius);
+}
+
+void UHarmoniaTerrainOwnershipManager::InsertOrdered(TArray<int32>& Zones, int32 ZoneIndex) const
+{
+	int32 InsertAt = 0;
+	while (InsertAt < Zones.Num() && ZonePrecedes(Zones[InsertAt], ZoneIndex))
+	{
+		++InsertAt;
+	}
+	Zones.Insert(ZoneIndex, InsertAt);
+}
+
+void UHarmoniaTerrainOwnershipManager::IndexZone(int32 ZoneIndex)
+{
+	const FTerrainOwnershipZone& Zone = OwnershipZones[ZoneIndex];
+	FZoneRecord& Record = ZoneRecords[ZoneIndex];
+
+	Record = FZoneRecord();
+	Record.bRegistered = true;
+	Record.Serial = NextZoneSerial++;
+
+	// Owners
+	Record.OwnerPlayerKey = InternPlayerID(Zone.OwnerPlayerID);
+	if (Record.OwnerPlayerKey != INDEX_NONE)
+	{
+		ZonesByPlayerKey[Record.OwnerPlayerKey].Add(ZoneIndex);
+	}
+	if (Zone.OwnerTeamID != INDEX_NONE)
+	{
+		ZonesByTeam.FindOrAdd(Zone.OwnerTeamID).Add(ZoneIndex);
+	}
+
+	// Grid, over the XY footprint of the zone
+	const float Radius = FMath::Max(0.0f, Zone.Radius);
+	Record.MinCell = GetCell(Zone.Center - FVector(Radius, Radius, 0.0f));
+	Record.MaxCell = GetCell(Zone.Center + FVector(Radius, Radius, 0.0f));
+
+	const int64 NumCells = (int64)(Record.MaxCell.X - Record.MinCell.X + 1) * (Record.MaxCell.Y - Record.MinCell.Y + 1);
+	if (NumCells > MaxCellsPerZone)
+	{
+		Record.bOversized = true;
+		InsertOrdered(OversizedZones, ZoneIndex);
+		return;
+	}
+
+	const FVector2D Center2D(Zone.Center);
+	for (int32 X = Record.MinCell.X; X <= Record.MaxCell.X; ++X)
+	{
+		for (int32 Y = Record.MinCell.Y; Y <= Record.MaxCell.Y; ++Y)
+		{
+			// Skip the corner cells the circle does not reach
+			const FBox2D CellBounds(FVector2D(X, Y) * GridCellSize, FVector2D(X + 1, Y + 1) * GridCellSize);
+			if (CellBounds.ComputeSquaredDistanceToPoint(Center2D) <= FMath::Square(Radius))
+			{
+				InsertOrdered(ZoneGrid.FindOrAdd(FIntPoint(X, Y)).Zones, ZoneIndex);
+			}
+		}
+	}
+}
+
+void UHarmoniaTerrainOwnershipManager::UnindexZone(int32 ZoneIndex)
+{
+	const FTerrainOwnershipZone& Zone = OwnershipZones[ZoneIndex];
+	FZoneRecord& Record = ZoneRecords[ZoneIndex];
+
+	if (Record.OwnerPlayerKey != INDEX_NONE)
+	{
+		ZonesByPlayerKey[Record.OwnerPlayerKey].RemoveSingleSwap(ZoneIndex);
+	}
+	if (Zone.OwnerTeamID != INDEX_NONE)
+	{
+		if (TArray<int32>* TeamZones = ZonesByTeam.Find(Zone.OwnerTeamID))
+		{
+			TeamZones->RemoveSingleSwap(ZoneIndex);
+			if (TeamZones->Num() == 0)
+			{
+				ZonesByTeam.Remove(Zone.OwnerTeamID);
+			}
+		}
+	}
+
+	if (Record.bOversized)
+	{
+		OversizedZones.RemoveSingle(ZoneIndex);
+	}
+	else
+	{
+		for (int32 X = Record.MinCell.X; X <= Record.MaxCell.X; ++X)
+		{
+			for (int32 Y = Record.MinCell.Y; Y <= Record.MaxCell.Y; ++Y)
+			{
+				const FIntPoint CellKey(X, Y);
+				if (FZoneCell* Cell = ZoneGrid.Find(CellKey))
+				{
+					Cell->Zones.RemoveSingle(ZoneIndex);
+					if (Cell->Zones.Num() == 0)
+					{
+						ZoneGrid.Remove(CellKey);
+					}
+				}
+			}
+		}
+	}
+
+	Record = FZoneRecord();
+}
+
+int32 UHarmoniaTerrainOwnershipManager::FindPlayerKey(const FString& PlayerID) const
+{
+	if (PlayerID.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32* PlayerKey = PlayerKeys.Find(PlayerID);
+	return PlayerKey ? *PlayerKey : INDEX_NONE;
+}
+
+int32 UHarmoniaTerrainOwnershipManager::InternPlayerID(const FString& PlayerID)
+{
+	if (PlayerID.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* PlayerKey = PlayerKeys.Find(PlayerID))
+	{
+		return *PlayerKey;
+	}
+
+	const int32 PlayerKey = ZonesByPlayerKey.AddDefaulted();
+	PlayerKeys.Add(PlayerID, PlayerKey);
+	return PlayerKey;
+}
@@ -17,6 +17,7 @@
 #include "MotionWarpingComponent.h"
 #include "Core/HarmoniaHealthComponent.h"
 #include "Character/LyraCharacter.h"
+#include "System/LyraSignificanceManager.h"
 
 AHarmoniaMonsterBase::AHarmoniaMonsterBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer
@@ -43,6 +44,8 @@ AHarmoniaMonsterBase::AHarmoniaMonsterBase(const FObjectInitializer& ObjectIniti
 	// Create AI LOD Component for performance optimization
 	AILODComponent = CreateDefaultSubobject<UHarmoniaAILODComponent>(TEXT("AILODComponent"));
 
+	SignificanceTag = LyraSignificanceTags::Monster;
+
 	// Enable ticking
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.bStartWithTickEnabled = true;
@@ -159,6 +162,7 @@ void AHarmoniaMonsterBase::SetMonsterState_Implementation(EHarmoniaMonsterState
 
 	// Broadcast state change
 	OnMonsterStateChanged.Broadcast(OldState, NewState);
+	UpdateSignificanceCombatState();
 
 	// Handle state-specific logic
 	if (NewState == EHarmoniaMonsterState::Dead && !bDeathStarted)
@@ -516,6 +520,16 @@ void AHarmoniaMonsterBase::PlayDeathAnimation()
 void AHarmoniaMonsterBase::OnRep_MonsterState(EHarmoniaMonsterState OldState)
 {
 	OnMonsterStateChanged.Broadcast(OldState, CurrentState);
+	UpdateSignificanceCombatState();
+}
+
+void AHarmoniaMonsterBase::UpdateSignificanceCombatState()
+{
+	// Monsters fighting stay one significance bucket up, so AI, animation and net budgets do not degrade them mid fight
+	if (ULyraSignificanceManager* SignificanceManager = ULyraSignificanceManager::Get(this))
+	{
+		SignificanceManager->SetObjectInCombat(this, CurrentState == EHarmoniaMonsterState::Combat);
+	}
 }
 
 void AHarmoniaMonsterBase::OnHealthChanged(AActor* EffectInstigator, AActor* EffectCauser, const FGameplayEffectSpec* EffectSpec, float EffectMagnitude, float OldValue, float NewValue)
@@ -729,3 +743,9 @@ bool AHarmoniaMonsterBase::IsEnemyWith_Implementation(AActor* OtherActor) const
 	EHarmoniaTeamRelationship Relationship = Execute_GetRelationshipWith(this, OtherActor);
 	return Relationship == EHarmoniaTeamRelationship::Enemy;
 }
+
+int32 AHarmoniaMonsterBase::GetReplicationLOD() const
+{
+	// One replication LOD step per AI LOD level: the replication graph doubles the period for each level
+	return AILODComponent ? static_cast<int32>(AILODComponent->GetCurrentLODLevel()) : 0;
+}
@@ -4,11 +4,13 @@
 #include "Engine/DataTable.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "HarmoniaLoadManager.h"
 #include "Animation/AnimSequence.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/BlendSpace.h"
 #include "GameFramework/Character.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHarmoniaAnimationCache, Log, All);
 
@@ -20,15 +22,19 @@ void UHarmoniaAnimationCacheSubsystem::Initialize(FSubsystemCollectionBase& Coll
 
 	if (bPreloadAllAnimations)
 	{
-		LoadAndCacheAnimations();
+		LoadAndCacheAnimations(bLoadTablesAsync);
 
 		if (bPreloadAssets)
 		{
-			PreloadAnimationAssets(false);
+			CallOrRegister_OnCacheReady(FSimpleDelegate::CreateUObject(this, &ThisClass::PreloadAnimationAssets, bLoadTablesAsync));
 		}
 	}
+	else
+	{
+		bCacheReady = true;
+	}
 
-	UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Animation Cache initialized with %d animations"), AnimationCache.Num());
+	UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Animation Cache initialized (%s)"), bCacheReady ? TEXT("ready") : TEXT("loading"));
 }
 
 void UHarmoniaAnimationCacheSubsystem::Deinitialize()
@@ -82,7 +88,11 @@ const FHarmoniaAnimationData* UHarmoniaAnimationCacheSubsystem::GetAnimationData
 			return AnimationCache.Find(AnimationTag);
 		}
 
-		FailedLoadTags.Add(AnimationTag);
+		// Tables may still be streaming in, only remember misses once the cache is complete
+		if (bCacheReady)
+		{
+			FailedLoadTags.Add(AnimationTag);
+		}
 	}
 
 	return nullptr;
@@ -203,6 +213,23 @@ float UHarmoniaAnimationCacheSubsystem::PlayAnimationByTag(
 		return 0.0f;
 	}
 
+	// Queue the play until the montage has streamed in instead of blocking on it
+	UHarmoniaAssetResolverSubsystem* AssetResolver = GetGameInstance()->GetSubsystem<UHarmoniaAssetResolverSubsystem>();
+	if (AssetResolver && !UHarmoniaAssetResolverSubsystem::IsResident(AnimData->AnimMontage.ToSoftObjectPath()))
+	{
+		TWeakObjectPtr<ACharacter> WeakCharacter = Character;
+		AssetResolver->RequestAsset(AnimData->AnimMontage.ToSoftObjectPath(), FSimpleDelegate::CreateWeakLambda(this, [this, WeakCharacter, AnimationTag, Context]()
+		{
+			if (ACharacter* LoadedCharacter = WeakCharacter.Get())
+			{
+				PlayAnimationByTag(LoadedCharacter, AnimationTag, Context);
+			}
+		}));
+
+		UE_LOG(LogHarmoniaAnimationCache, Verbose, TEXT("Animation montage not loaded yet, queued: %s"), *AnimationTag.ToString());
+		return 0.0f;
+	}
+
 	// Calculate final play rate
 	float FinalPlayRate = Context.bOverridePlayRate ? Context.PlayRateOverride : AnimData->PlayRate;
 	float FinalBlendInTime = Context.bOverrideBlendInTime ? Context.BlendInTimeOverride : AnimData->BlendInTime;
@@ -239,7 +266,9 @@ float UHarmoniaAnimationCacheSubsystem::PlayAnimationByTag(
 	// Fallback to sequence (note: less control)
 	if (!AnimData->AnimSequence.IsNull())
 	{
-		UAnimSequence* Sequence = AnimData->AnimSequence.LoadSynchronous();
+		UAnimSequence* Sequence = AssetResolver
+			? AssetResolver->ResolveSync(AnimData->AnimSequence, TEXT("PlayAnimationByTag"))
+			: AnimData->AnimSequence.LoadSynchronous();
 		if (Sequence)
 		{
 			// For sequences, we'd need to use slot node in AnimBP
@@ -289,7 +318,8 @@ void UHarmoniaAnimationCacheSubsystem::StopAnimationByTag(
 	// Stop montage if it's playing
 	if (!AnimData->AnimMontage.IsNull())
 	{
-		UAnimMontage* Montage = AnimData->AnimMontage.LoadSynchronous();
+		// A montage that is not loaded cannot be playing
+		UAnimMontage* Montage = AnimData->AnimMontage.Get();
 		if (Montage && AnimInstance->Montage_IsPlaying(Montage))
 		{
 			AnimInstance->Montage_Stop(FinalBlendOutTime, Montage);
@@ -315,21 +345,72 @@ void UHarmoniaAnimationCacheSubsystem::StopAnimationsByParentTag(
 	}
 }
 
+void UHarmoniaAnimationCacheSubsystem::PreloadAnimationsByTag(FGameplayTag ParentTag)
+{
+	UHarmoniaAssetResolverSubsystem* AssetResolver = GetGameInstance()->GetSubsystem<UHarmoniaAssetResolverSubsystem>();
+	if (!AssetResolver || !ParentTag.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const FHarmoniaAnimationData& AnimData : GetAnimationsByTag(ParentTag, false))
+	{
+		AssetsToLoad.Add(AnimData.AnimMontage.ToSoftObjectPath());
+		AssetsToLoad.Add(AnimData.AnimSequence.ToSoftObjectPath());
+		AssetsToLoad.Add(AnimData.BlendSpace.ToSoftObjectPath());
+	}
+
+	AssetResolver->PreloadByTag(this, ParentTag, AssetsToLoad);
+}
+
+void UHarmoniaAnimationCacheSubsystem::ReleaseAnimationsByTag(FGameplayTag ParentTag)
+{
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = GetGameInstance()->GetSubsystem<UHarmoniaAssetResolverSubsystem>())
+	{
+		AssetResolver->ReleasePreloadByTag(this, ParentTag);
+	}
+}
+
 void UHarmoniaAnimationCacheSubsystem::ReloadAnimationCache()
 {
 	UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Reloading animation cache..."));
 
 	ClearCache();
-	LoadAndCacheAnimations();
+	LoadAndCacheAnimations(false);
 
 	UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Animation cache reloaded with %d animations"), AnimationCache.Num());
 }
 
 void UHarmoniaAnimationCacheSubsystem::ClearCache()
 {
+	// Drop any startup load or worker build still in flight, an empty cache counts as ready
+	if (TablesHandle.IsValid())
+	{
+		TablesHandle->CancelHandle();
+		TablesHandle.Reset();
+	}
+	++CacheBuildSerial;
+
 	AnimationCache.Empty();
 	LoadedDataTables.Empty();
 	FailedLoadTags.Empty();
+
+	bCacheReady = true;
+	OnCacheReady.Broadcast();
+	OnCacheReady.Clear();
+}
+
+void UHarmoniaAnimationCacheSubsystem::CallOrRegister_OnCacheReady(FSimpleDelegate&& Delegate)
+{
+	if (bCacheReady)
+	{
+		Delegate.ExecuteIfBound();
+	}
+	else
+	{
+		OnCacheReady.Add(MoveTemp(Delegate));
+	}
 }
 
 void UHarmoniaAnimationCacheSubsystem::PreloadAnimationAssets(bool bAsync)
@@ -389,23 +470,60 @@ void UHarmoniaAnimationCacheSubsystem::PreloadAnimationAssets(bool bAsync)
 	}
 }
 
-void UHarmoniaAnimationCacheSubsystem::LoadAndCacheAnimations()
+void UHarmoniaAnimationCacheSubsystem::LoadAndCacheAnimations(bool bAsync)
 {
+	bCacheReady = false;
+	++CacheBuildSerial;
+
 	if (AnimationDataTablePaths.Num() == 0)
 	{
 		UE_LOG(LogHarmoniaAnimationCache, Warning, TEXT("No animation DataTable paths configured"));
-		return;
 	}
 
-	int32 TotalAnimationsLoaded = 0;
-
+	TArray<FSoftObjectPath> TablePaths;
 	for (const FSoftObjectPath& TablePath : AnimationDataTablePaths)
 	{
-		if (TablePath.IsNull())
+		if (!TablePath.IsNull())
 		{
-			continue;
+			TablePaths.AddUnique(TablePath);
+		}
+	}
+
+	if (TablePaths.Num() > 0 && UAssetManager::IsInitialized())
+	{
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		if (bAsync)
+		{
+			// All tables in one request, so their packages load in parallel
+			TablesHandle = StreamableManager.RequestAsyncLoad(TablePaths,
+				FStreamableDelegate::CreateUObject(this, &ThisClass::HandleAnimationTablesLoaded, TablePaths, true));
+			if (TablesHandle.IsValid() && TablesHandle->IsLoadingInProgress())
+			{
+				return;
+			}
+		}
+		else
+		{
+			StreamableManager.RequestSyncLoad(TablePaths);
 		}
+	}
+
+	HandleAnimationTablesLoaded(MoveTemp(TablePaths), bAsync);
+}
 
+void UHarmoniaAnimationCacheSubsystem::HandleAnimationTablesLoaded(TArray<FSoftObjectPath> TablePaths, bool bAsync)
+{
+	if (bCacheReady)
+	{
+		return;
+	}
+
+	// LoadedDataTables keeps the tables alive from here on
+	TablesHandle.Reset();
+
+	TArray<UDataTable*> Tables;
+	for (const FSoftObjectPath& TablePath : TablePaths)
+	{
 		UDataTable* DataTable = Cast<UDataTable>(TablePath.TryLoad());
 		if (!DataTable)
 		{
@@ -420,19 +538,64 @@ void UHarmoniaAnimationCacheSubsystem::LoadAndCacheAnimations()
 			continue;
 		}
 
-		int32 AnimationsLoaded = LoadAnimationsFromDataTable(DataTable);
-		TotalAnimationsLoaded += AnimationsLoaded;
+		if (!LoadedDataTables.Contains(DataTable))
+		{
+			LoadedDataTables.Add(DataTable);
+			Tables.Add(DataTable);
+		}
+	}
 
-		LoadedDataTables.Add(DataTable);
+	auto BuildCache = [](const TArray<const UDataTable*>& BuildTables, TMap<FGameplayTag, FHarmoniaAnimationData>& OutCache)
+	{
+		for (const UDataTable* DataTable : BuildTables)
+		{
+			const int32 AnimationsLoaded = LoadAnimationsFromDataTable(DataTable, OutCache);
+			UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Loaded %d animations from DataTable: %s"), AnimationsLoaded, *DataTable->GetName());
+		}
+	};
 
-		UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Loaded %d animations from DataTable: %s"),
-			AnimationsLoaded, *DataTable->GetName());
+	if (bAsync)
+	{
+		const int32 BuildSerial = CacheBuildSerial;
+		UHarmoniaLoadManager::BuildTableCacheAsync<TMap<FGameplayTag, FHarmoniaAnimationData>>(Tables, MoveTemp(BuildCache),
+			[WeakThis = TWeakObjectPtr<ThisClass>(this), BuildSerial](TMap<FGameplayTag, FHarmoniaAnimationData>&& BuiltCache)
+			{
+				ThisClass* This = WeakThis.Get();
+				if (This && This->CacheBuildSerial == BuildSerial)
+				{
+					This->HandleAnimationCacheBuilt(MoveTemp(BuiltCache));
+				}
+			});
+	}
+	else
+	{
+		TMap<FGameplayTag, FHarmoniaAnimationData> BuiltCache;
+		BuildCache(TArray<const UDataTable*>(Tables), BuiltCache);
+		HandleAnimationCacheBuilt(MoveTemp(BuiltCache));
 	}
+}
+
+void UHarmoniaAnimationCacheSubsystem::HandleAnimationCacheBuilt(TMap<FGameplayTag, FHarmoniaAnimationData>&& BuiltCache)
+{
+	// Rows lazily added while the cache was building come from the same tables
+	AnimationCache.Append(MoveTemp(BuiltCache));
+	bCacheReady = true;
+
+	UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Total animations loaded: %d"), AnimationCache.Num());
+
+	OnCacheReady.Broadcast();
+	OnCacheReady.Clear();
+}
 
-	UE_LOG(LogHarmoniaAnimationCache, Log, TEXT("Total animations loaded: %d"), TotalAnimationsLoaded);
+void UHarmoniaAnimationCacheSubsystem::FlushPendingTableLoad()
+{
+	if (TablesHandle.IsValid() && TablesHandle->IsLoadingInProgress())
+	{
+		TablesHandle->WaitUntilComplete();
+	}
 }
 
-int32 UHarmoniaAnimationCacheSubsystem::LoadAnimationsFromDataTable(UDataTable* DataTable)
+int32 UHarmoniaAnimationCacheSubsystem::LoadAnimationsFromDataTable(const UDataTable* DataTable, TMap<FGameplayTag, FHarmoniaAnimationData>& OutCache)
 {
 	if (!DataTable)
 	{
@@ -458,13 +621,13 @@ int32 UHarmoniaAnimationCacheSubsystem::LoadAnimationsFromDataTable(UDataTable*
 			continue;
 		}
 
-		if (AnimationCache.Contains(RowData->AnimationTag))
+		if (OutCache.Contains(RowData->AnimationTag))
 		{
 			UE_LOG(LogHarmoniaAnimationCache, Warning, TEXT("Duplicate animation tag found: %s (overwriting)"),
 				*RowData->AnimationTag.ToString());
 		}
 
-		AnimationCache.Add(RowData->AnimationTag, *RowData);
+		OutCache.Add(RowData->AnimationTag, *RowData);
 		AnimationsLoaded++;
 	}
 
@@ -478,6 +641,8 @@ bool UHarmoniaAnimationCacheSubsystem::LoadAnimationFromDataTables(FGameplayTag
 		return false;
 	}
 
+	FlushPendingTableLoad();
+
 	for (UDataTable* DataTable : LoadedDataTables)
 	{
 		if (!DataTable)
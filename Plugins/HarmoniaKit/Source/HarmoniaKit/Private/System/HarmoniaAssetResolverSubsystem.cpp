@@ -0,0 +1,235 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaAssetResolverSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHarmoniaAssetResolver, Log, All);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AssetResolver Sync Loads"), STAT_AssetResolverSyncLoads, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AssetResolver Pending Requests"), STAT_AssetResolverPendingRequests, STATGROUP_Game);
+
+UHarmoniaAssetResolverSubsystem* UHarmoniaAssetResolverSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UHarmoniaAssetResolverSubsystem>() : nullptr;
+}
+
+void UHarmoniaAssetResolverSubsystem::Deinitialize()
+{
+	for (TPair<uint64, FPendingRequest>& Pair : PendingRequests)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->CancelHandle();
+		}
+	}
+	PendingRequests.Empty();
+	SET_DWORD_STAT(STAT_AssetResolverPendingRequests, 0);
+
+	for (TPair<FPreloadKey, TSharedPtr<FStreamableHandle>>& Pair : Preloads)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+	Preloads.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Preloading
+// ============================================================================
+
+void UHarmoniaAssetResolverSubsystem::Preload(const UObject* Owner, FName Key, const TArray<FSoftObjectPath>& Paths)
+{
+	TArray<FSoftObjectPath> ValidPaths;
+	ValidPaths.Reserve(Paths.Num());
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (!Path.IsNull())
+		{
+			ValidPaths.AddUnique(Path);
+		}
+	}
+
+	ReleasePreload(Owner, Key);
+
+	if (ValidPaths.Num() == 0)
+	{
+		return;
+	}
+
+	// The handle keeps the assets referenced, even when they are resident already
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ValidPaths, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority, false, false, TEXT("HarmoniaAssetResolver"));
+
+	if (Handle.IsValid())
+	{
+		Preloads.Add(FPreloadKey(Owner, Key), Handle);
+	}
+}
+
+void UHarmoniaAssetResolverSubsystem::PreloadBundles(const UObject* Owner, FName Key, const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& Bundles)
+{
+	ReleasePreload(Owner, Key);
+
+	if (AssetIds.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::Get().LoadPrimaryAssets(AssetIds, Bundles);
+	if (Handle.IsValid())
+	{
+		Preloads.Add(FPreloadKey(Owner, Key), Handle);
+	}
+}
+
+void UHarmoniaAssetResolverSubsystem::ReleasePreload(const UObject* Owner, FName Key)
+{
+	TSharedPtr<FStreamableHandle> Handle;
+	if (Preloads.RemoveAndCopyValue(FPreloadKey(Owner, Key), Handle) && Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+	}
+}
+
+void UHarmoniaAssetResolverSubsystem::ReleaseAllPreloads(const UObject* Owner)
+{
+	const FObjectKey OwnerKey(Owner);
+	for (auto It = Preloads.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Owner == OwnerKey)
+		{
+			if (It.Value().IsValid())
+			{
+				It.Value()->ReleaseHandle();
+			}
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UHarmoniaAssetResolverSubsystem::PreloadByTag(const UObject* Owner, FGameplayTag Tag, const TArray<FSoftObjectPath>& Paths)
+{
+	if (Tag.IsValid())
+	{
+		Preload(Owner, Tag.GetTagName(), Paths);
+	}
+}
+
+void UHarmoniaAssetResolverSubsystem::ReleasePreloadByTag(const UObject* Owner, FGameplayTag Tag)
+{
+	if (Tag.IsValid())
+	{
+		ReleasePreload(Owner, Tag.GetTagName());
+	}
+}
+
+// ============================================================================
+// Resolution
+// ============================================================================
+
+bool UHarmoniaAssetResolverSubsystem::IsResident(const FSoftObjectPath& Path)
+{
+	return Path.IsNull() || Path.ResolveObject() != nullptr;
+}
+
+bool UHarmoniaAssetResolverSubsystem::RequestAssets(const TArray<FSoftObjectPath>& Paths, FSimpleDelegate OnReady)
+{
+	TArray<FSoftObjectPath> MissingPaths;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (!IsResident(Path))
+		{
+			MissingPaths.AddUnique(Path);
+		}
+	}
+
+	if (MissingPaths.Num() == 0)
+	{
+		NumImmediateRequests++;
+		OnReady.ExecuteIfBound();
+		return true;
+	}
+
+	const uint64 RequestId = NextRequestId++;
+	NumQueuedRequests++;
+
+	// Add before requesting: the streamable manager may complete the request before returning
+	FPendingRequest& Request = PendingRequests.Add(RequestId);
+	Request.OnReady = MoveTemp(OnReady);
+	SET_DWORD_STAT(STAT_AssetResolverPendingRequests, PendingRequests.Num());
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MissingPaths,
+		FStreamableDelegate::CreateUObject(this, &UHarmoniaAssetResolverSubsystem::OnRequestCompleted, RequestId),
+		FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("HarmoniaAssetResolver"));
+
+	if (FPendingRequest* StillPending = PendingRequests.Find(RequestId))
+	{
+		StillPending->Handle = Handle;
+	}
+
+	return false;
+}
+
+void UHarmoniaAssetResolverSubsystem::OnRequestCompleted(uint64 RequestId)
+{
+	FPendingRequest Request;
+	if (!PendingRequests.RemoveAndCopyValue(RequestId, Request))
+	{
+		return;
+	}
+
+	SET_DWORD_STAT(STAT_AssetResolverPendingRequests, PendingRequests.Num());
+
+	// The callback takes its own references, the handle is only needed while streaming
+	Request.OnReady.ExecuteIfBound();
+
+	if (Request.Handle.IsValid())
+	{
+		Request.Handle->ReleaseHandle();
+	}
+}
+
+UObject* UHarmoniaAssetResolverSubsystem::ResolveSync(const FSoftObjectPath& Path, const TCHAR* Context)
+{
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UObject* Loaded = Path.ResolveObject())
+	{
+		return Loaded;
+	}
+
+	if (IsInGameThread())
+	{
+		NumSyncLoads++;
+		INC_DWORD_STAT(STAT_AssetResolverSyncLoads);
+
+		if (bLogSyncLoads && !LoggedSyncLoads.Contains(Path))
+		{
+			LoggedSyncLoads.Add(Path);
+			UE_LOG(LogHarmoniaAssetResolver, Warning, TEXT("Synchronous load on the game thread: %s (%s). Preload it or use RequestAssets"),
+				*Path.ToString(), Context ? Context : TEXT("unknown"));
+		}
+	}
+
+	return UAssetManager::GetStreamableManager().LoadSynchronous(Path);
+}
+
+void UHarmoniaAssetResolverSubsystem::ResetStats()
+{
+	NumSyncLoads = 0;
+	NumQueuedRequests = 0;
+	NumImmediateRequests = 0;
+	LoggedSyncLoads.Empty();
+}
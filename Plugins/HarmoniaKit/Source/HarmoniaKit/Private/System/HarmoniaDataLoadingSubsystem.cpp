@@ -0,0 +1,142 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaDataLoadingSubsystem.h"
+#include "System/HarmoniaSoundCacheSubsystem.h"
+#include "System/HarmoniaEffectCacheSubsystem.h"
+#include "System/HarmoniaAnimationCacheSubsystem.h"
+#include "HarmoniaLoadManager.h"
+#include "LoadingScreenManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/CoreDelegates.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHarmoniaDataLoading, Log, All);
+
+UHarmoniaDataLoadingSubsystem* UHarmoniaDataLoadingSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UHarmoniaDataLoadingSubsystem>() : nullptr;
+}
+
+void UHarmoniaDataLoadingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadStartTime = FPlatformTime::Seconds();
+	DataReadyFuture = DataReadyPromise.GetFuture().Share();
+
+	// Caches start their own table requests when they initialize
+	UHarmoniaSoundCacheSubsystem* SoundCache = Collection.InitializeDependency<UHarmoniaSoundCacheSubsystem>();
+	UHarmoniaEffectCacheSubsystem* EffectCache = Collection.InitializeDependency<UHarmoniaEffectCacheSubsystem>();
+	UHarmoniaAnimationCacheSubsystem* AnimationCache = Collection.InitializeDependency<UHarmoniaAnimationCacheSubsystem>();
+	ULoadingScreenManager* LoadingScreenManager = Collection.InitializeDependency<ULoadingScreenManager>();
+
+	UHarmoniaLoadManager* LoadManager = UHarmoniaLoadManager::Get();
+	if (LoadManager)
+	{
+		LoadManager->LoadAllTables();
+	}
+
+	// Count every source first, some of them may already be ready and call back right away
+	PendingSources = 1 + (SoundCache ? 1 : 0) + (EffectCache ? 1 : 0) + (AnimationCache ? 1 : 0);
+
+	if (LoadManager)
+	{
+		LoadManager->CallOrRegister_OnTablesReady(FSimpleDelegate::CreateUObject(this, &ThisClass::HandleSourceReady));
+	}
+	else
+	{
+		HandleSourceReady();
+	}
+	if (SoundCache)
+	{
+		SoundCache->CallOrRegister_OnCacheReady(FSimpleDelegate::CreateUObject(this, &ThisClass::HandleSourceReady));
+	}
+	if (EffectCache)
+	{
+		EffectCache->CallOrRegister_OnCacheReady(FSimpleDelegate::CreateUObject(this, &ThisClass::HandleSourceReady));
+	}
+	if (AnimationCache)
+	{
+		AnimationCache->CallOrRegister_OnCacheReady(FSimpleDelegate::CreateUObject(this, &ThisClass::HandleSourceReady));
+	}
+
+	if (LoadingScreenManager && bHoldLoadingScreenUntilReady && !bDataReady)
+	{
+		LoadingScreenManager->RegisterLoadingProcessor(this);
+	}
+}
+
+void UHarmoniaDataLoadingSubsystem::Deinitialize()
+{
+	if (ULoadingScreenManager* LoadingScreenManager = GetGameInstance()->GetSubsystem<ULoadingScreenManager>())
+	{
+		LoadingScreenManager->UnregisterLoadingProcessor(this);
+	}
+
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	// Never leave a waiter hanging
+	if (!bDataReady)
+	{
+		bDataReady = true;
+		DataReadyPromise.SetValue();
+	}
+	OnDataReady.Clear();
+
+	Super::Deinitialize();
+}
+
+bool UHarmoniaDataLoadingSubsystem::ShouldShowLoadingScreen(FString& OutReason) const
+{
+	if (bHoldLoadingScreenUntilReady && !bDataReady)
+	{
+		OutReason = FString::Printf(TEXT("Loading Harmonia data (%d sources pending)"), PendingSources);
+		return true;
+	}
+
+	return false;
+}
+
+void UHarmoniaDataLoadingSubsystem::CallOrRegister_OnDataReady(FSimpleDelegate&& Delegate)
+{
+	if (bDataReady)
+	{
+		Delegate.ExecuteIfBound();
+	}
+	else
+	{
+		OnDataReady.Add(MoveTemp(Delegate));
+	}
+}
+
+void UHarmoniaDataLoadingSubsystem::HandleSourceReady()
+{
+	if (bDataReady || --PendingSources > 0)
+	{
+		return;
+	}
+
+	bDataReady = true;
+	DataReadyTime = FPlatformTime::Seconds();
+	UE_LOG(LogHarmoniaDataLoading, Log, TEXT("Startup data ready in %.1f ms"), (DataReadyTime - LoadStartTime) * 1000.0);
+
+	// The frame that ends next is the first one that can drop the loading screen
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &ThisClass::HandleEndFrame);
+
+	DataReadyPromise.SetValue();
+	OnDataReady.Broadcast();
+	OnDataReady.Clear();
+}
+
+void UHarmoniaDataLoadingSubsystem::HandleEndFrame()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	FirstFrameTime = FPlatformTime::Seconds();
+	UE_LOG(LogHarmoniaDataLoading, Log, TEXT("Time to first frame: %.1f ms after load start (data %.1f ms), %.2f s since launch"),
+		(FirstFrameTime - LoadStartTime) * 1000.0, (DataReadyTime - LoadStartTime) * 1000.0, FirstFrameTime - GStartTime);
+}
@@ -4,6 +4,7 @@
 #include "Engine/DataTable.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "HarmoniaLoadManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHarmoniaEffectCache, Log, All);
 
@@ -15,15 +16,19 @@ void UHarmoniaEffectCacheSubsystem::Initialize(FSubsystemCollectionBase& Collect
 
 	if (bPreloadAllEffects)
 	{
-		LoadAndCacheEffects();
+		LoadAndCacheEffects(bLoadTablesAsync);
 
 		if (bPreloadAssets)
 		{
-			PreloadEffectAssets(false);
+			CallOrRegister_OnCacheReady(FSimpleDelegate::CreateUObject(this, &ThisClass::PreloadEffectAssets, bLoadTablesAsync));
 		}
 	}
+	else
+	{
+		bCacheReady = true;
+	}
 
-	UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Effect Cache initialized with %d effects"), EffectCache.Num());
+	UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Effect Cache initialized (%s)"), bCacheReady ? TEXT("ready") : TEXT("loading"));
 }
 
 void UHarmoniaEffectCacheSubsystem::Deinitialize()
@@ -78,8 +83,11 @@ const FHarmoniaAnimationEffectData* UHarmoniaEffectCacheSubsystem::GetEffectData
 			return EffectCache.Find(EffectTag);
 		}
 
-		// Mark as failed to avoid repeated attempts
-		FailedLoadTags.Add(EffectTag);
+		// Tables may still be streaming in, only remember misses once the cache is complete
+		if (bCacheReady)
+		{
+			FailedLoadTags.Add(EffectTag);
+		}
 	}
 
 	return nullptr;
@@ -135,16 +143,40 @@ void UHarmoniaEffectCacheSubsystem::ReloadEffectCache()
 	UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Reloading effect cache..."));
 
 	ClearCache();
-	LoadAndCacheEffects();
+	LoadAndCacheEffects(false);
 
 	UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Effect cache reloaded with %d effects"), EffectCache.Num());
 }
 
 void UHarmoniaEffectCacheSubsystem::ClearCache()
 {
+	// Drop any startup load or worker build still in flight, an empty cache counts as ready
+	if (TablesHandle.IsValid())
+	{
+		TablesHandle->CancelHandle();
+		TablesHandle.Reset();
+	}
+	++CacheBuildSerial;
+
 	EffectCache.Empty();
 	LoadedDataTables.Empty();
 	FailedLoadTags.Empty();
+
+	bCacheReady = true;
+	OnCacheReady.Broadcast();
+	OnCacheReady.Clear();
+}
+
+void UHarmoniaEffectCacheSubsystem::CallOrRegister_OnCacheReady(FSimpleDelegate&& Delegate)
+{
+	if (bCacheReady)
+	{
+		Delegate.ExecuteIfBound();
+	}
+	else
+	{
+		OnCacheReady.Add(MoveTemp(Delegate));
+	}
 }
 
 void UHarmoniaEffectCacheSubsystem::PreloadEffectAssets(bool bAsync)
@@ -208,24 +240,60 @@ void UHarmoniaEffectCacheSubsystem::PreloadEffectAssets(bool bAsync)
 	}
 }
 
-void UHarmoniaEffectCacheSubsystem::LoadAndCacheEffects()
+void UHarmoniaEffectCacheSubsystem::LoadAndCacheEffects(bool bAsync)
 {
+	bCacheReady = false;
+	++CacheBuildSerial;
+
 	if (EffectDataTablePaths.Num() == 0)
 	{
 		UE_LOG(LogHarmoniaEffectCache, Warning, TEXT("No effect DataTable paths configured. Set EffectDataTablePaths in Project Settings or DefaultGame.ini"));
-		return;
 	}
 
-	int32 TotalEffectsLoaded = 0;
-
+	TArray<FSoftObjectPath> TablePaths;
 	for (const FSoftObjectPath& TablePath : EffectDataTablePaths)
 	{
-		if (TablePath.IsNull())
+		if (!TablePath.IsNull())
 		{
-			continue;
+			TablePaths.AddUnique(TablePath);
+		}
+	}
+
+	if (TablePaths.Num() > 0 && UAssetManager::IsInitialized())
+	{
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		if (bAsync)
+		{
+			// All tables in one request, so their packages load in parallel
+			TablesHandle = StreamableManager.RequestAsyncLoad(TablePaths,
+				FStreamableDelegate::CreateUObject(this, &ThisClass::HandleEffectTablesLoaded, TablePaths, true));
+			if (TablesHandle.IsValid() && TablesHandle->IsLoadingInProgress())
+			{
+				return;
+			}
+		}
+		else
+		{
+			StreamableManager.RequestSyncLoad(TablePaths);
 		}
+	}
+
+	HandleEffectTablesLoaded(MoveTemp(TablePaths), bAsync);
+}
+
+void UHarmoniaEffectCacheSubsystem::HandleEffectTablesLoaded(TArray<FSoftObjectPath> TablePaths, bool bAsync)
+{
+	if (bCacheReady)
+	{
+		return;
+	}
 
-		// Load DataTable
+	// LoadedDataTables keeps the tables alive from here on
+	TablesHandle.Reset();
+
+	TArray<UDataTable*> Tables;
+	for (const FSoftObjectPath& TablePath : TablePaths)
+	{
 		UDataTable* DataTable = Cast<UDataTable>(TablePath.TryLoad());
 		if (!DataTable)
 		{
@@ -233,7 +301,6 @@ void UHarmoniaEffectCacheSubsystem::LoadAndCacheEffects()
 			continue;
 		}
 
-		// Check row structure
 		if (DataTable->GetRowStruct() != FHarmoniaAnimationEffectData::StaticStruct())
 		{
 			UE_LOG(LogHarmoniaEffectCache, Error, TEXT("DataTable has wrong row structure: %s (expected FHarmoniaAnimationEffectData)"),
@@ -241,21 +308,64 @@ void UHarmoniaEffectCacheSubsystem::LoadAndCacheEffects()
 			continue;
 		}
 
-		// Load effects from table
-		int32 EffectsLoaded = LoadEffectsFromDataTable(DataTable);
-		TotalEffectsLoaded += EffectsLoaded;
+		if (!LoadedDataTables.Contains(DataTable))
+		{
+			LoadedDataTables.Add(DataTable);
+			Tables.Add(DataTable);
+		}
+	}
 
-		// Keep DataTable alive
-		LoadedDataTables.Add(DataTable);
+	auto BuildCache = [](const TArray<const UDataTable*>& BuildTables, TMap<FGameplayTag, FHarmoniaAnimationEffectData>& OutCache)
+	{
+		for (const UDataTable* DataTable : BuildTables)
+		{
+			const int32 EffectsLoaded = LoadEffectsFromDataTable(DataTable, OutCache);
+			UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Loaded %d effects from DataTable: %s"), EffectsLoaded, *DataTable->GetName());
+		}
+	};
 
-		UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Loaded %d effects from DataTable: %s"),
-			EffectsLoaded, *DataTable->GetName());
+	if (bAsync)
+	{
+		const int32 BuildSerial = CacheBuildSerial;
+		UHarmoniaLoadManager::BuildTableCacheAsync<TMap<FGameplayTag, FHarmoniaAnimationEffectData>>(Tables, MoveTemp(BuildCache),
+			[WeakThis = TWeakObjectPtr<ThisClass>(this), BuildSerial](TMap<FGameplayTag, FHarmoniaAnimationEffectData>&& BuiltCache)
+			{
+				ThisClass* This = WeakThis.Get();
+				if (This && This->CacheBuildSerial == BuildSerial)
+				{
+					This->HandleEffectCacheBuilt(MoveTemp(BuiltCache));
+				}
+			});
+	}
+	else
+	{
+		TMap<FGameplayTag, FHarmoniaAnimationEffectData> BuiltCache;
+		BuildCache(TArray<const UDataTable*>(Tables), BuiltCache);
+		HandleEffectCacheBuilt(MoveTemp(BuiltCache));
 	}
+}
+
+void UHarmoniaEffectCacheSubsystem::HandleEffectCacheBuilt(TMap<FGameplayTag, FHarmoniaAnimationEffectData>&& BuiltCache)
+{
+	// Rows lazily added while the cache was building come from the same tables
+	EffectCache.Append(MoveTemp(BuiltCache));
+	bCacheReady = true;
+
+	UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Total effects loaded: %d"), EffectCache.Num());
+
+	OnCacheReady.Broadcast();
+	OnCacheReady.Clear();
+}
 
-	UE_LOG(LogHarmoniaEffectCache, Log, TEXT("Total effects loaded: %d"), TotalEffectsLoaded);
+void UHarmoniaEffectCacheSubsystem::FlushPendingTableLoad()
+{
+	if (TablesHandle.IsValid() && TablesHandle->IsLoadingInProgress())
+	{
+		TablesHandle->WaitUntilComplete();
+	}
 }
 
-int32 UHarmoniaEffectCacheSubsystem::LoadEffectsFromDataTable(UDataTable* DataTable)
+int32 UHarmoniaEffectCacheSubsystem::LoadEffectsFromDataTable(const UDataTable* DataTable, TMap<FGameplayTag, FHarmoniaAnimationEffectData>& OutCache)
 {
 	if (!DataTable)
 	{
@@ -283,14 +393,14 @@ int32 UHarmoniaEffectCacheSubsystem::LoadEffectsFromDataTable(UDataTable* DataTa
 		}
 
 		// Check for duplicates
-		if (EffectCache.Contains(RowData->EffectTag))
+		if (OutCache.Contains(RowData->EffectTag))
 		{
 			UE_LOG(LogHarmoniaEffectCache, Warning, TEXT("Duplicate effect tag found: %s (overwriting)"),
 				*RowData->EffectTag.ToString());
 		}
 
 		// Add to cache
-		EffectCache.Add(RowData->EffectTag, *RowData);
+		OutCache.Add(RowData->EffectTag, *RowData);
 		EffectsLoaded++;
 	}
 
@@ -304,6 +414,8 @@ bool UHarmoniaEffectCacheSubsystem::LoadEffectFromDataTables(FGameplayTag Effect
 		return false;
 	}
 
+	FlushPendingTableLoad();
+
 	// Search through all loaded DataTables
 	for (UDataTable* DataTable : LoadedDataTables)
 	{
@@ -2,20 +2,15 @@
 
 #include "System/HarmoniaFogOfWarRenderer.h"
 #include "Definitions/HarmoniaMapSystemDefinitions.h"
-#include "Engine/Canvas.h"
-#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/Texture2D.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "Kismet/KismetRenderingLibrary.h"
-#include "CanvasItem.h"
-#include "CanvasTypes.h"
-#include "Engine/Texture.h"
+#include "TextureResource.h"
 
 UHarmoniaFogOfWarRenderer::UHarmoniaFogOfWarRenderer()
 {
-    FogBlendRadius = 200.0f;
     FogColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.8f);
     ExploredColor = FLinearColor(1.0f, 1.0f, 1.0f, 0.0f);
-    TextureResolution = FIntPoint(1024, 1024);
+    TextureResolution = FIntPoint(512, 512);
 }
 
 void UHarmoniaFogOfWarRenderer::Initialize(const FBox& InMapBounds, FIntPoint Resolution)
@@ -23,14 +18,27 @@ void UHarmoniaFogOfWarRenderer::Initialize(const FBox& InMapBounds, FIntPoint Re
     MapBounds = InMapBounds;
     TextureResolution = Resolution;
 
-    CreateRenderTarget();
+    // Resolution changes need a new texture
+    FogOfWarTexture = nullptr;
+    CreateTexture();
 }
 
-void UHarmoniaFogOfWarRenderer::UpdateFogOfWar(const TArray<FExploredRegion>& ExploredRegions)
+void UHarmoniaFogOfWarRenderer::UpdateTiles(const FHarmoniaExplorationGrid& Grid, TConstArrayView<int32> TileIndices)
 {
+    const int32 TileSize = FHarmoniaExplorationGrid::TileSize;
+    const int32 TilesPerSide = Grid.GetTilesPerSide();
+
+    if (Grid.GetCellsPerSide() != TextureResolution.X || Grid.GetCellsPerSide() != TextureResolution.Y)
+    {
+        // The grid was resized after the texture was made
+        Initialize(MapBounds, FIntPoint(Grid.GetCellsPerSide(), Grid.GetCellsPerSide()));
+        UpdateAllTiles(Grid);
+        return;
+    }
+
     if (!FogOfWarTexture)
     {
-        CreateRenderTarget();
+        CreateTexture();
     }
 
     if (!FogOfWarTexture)
@@ -39,22 +47,98 @@ void UHarmoniaFogOfWarRenderer::UpdateFogOfWar(const TArray<FExploredRegion>& Ex
         return;
     }
 
-    RenderExploredRegions(ExploredRegions);
+    SourceGrid = &Grid;
+
+    if (TileIndices.Num() == 0)
+    {
+        return;
+    }
+
+    FColor Colors[16];
+    BuildColorTable(Colors);
+
+    // Dirty tiles are stacked vertically in one staging buffer, one region per tile
+    const int32 PixelsPerTile = TileSize * TileSize;
+    FColor* Pixels = new FColor[PixelsPerTile * TileIndices.Num()];
+    FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[TileIndices.Num()];
+
+    for (int32 RegionIndex = 0; RegionIndex < TileIndices.Num(); ++RegionIndex)
+    {
+        const int32 TileIndex = TileIndices[RegionIndex];
+        const FHarmoniaExplorationTile* Tile = Grid.FindTile(TileIndex);
+
+        Regions[RegionIndex] = FUpdateTextureRegion2D(
+            (TileIndex % TilesPerSide) * TileSize, (TileIndex / TilesPerSide) * TileSize,
+            0, RegionIndex * TileSize,
+            TileSize, TileSize);
+
+        FColor* TilePixels = Pixels + RegionIndex * PixelsPerTile;
+        for (int32 LocalY = 0; LocalY < TileSize; ++LocalY)
+        {
+            for (int32 LocalX = 0; LocalX < TileSize; ++LocalX)
+            {
+                TilePixels[LocalY * TileSize + LocalX] = Colors[FHarmoniaExplorationGrid::GetTileCellAlpha(Tile, LocalX, LocalY)];
+            }
+        }
+    }
+
+    FogOfWarTexture->UpdateTextureRegions(0, TileIndices.Num(), Regions, TileSize * sizeof(FColor), sizeof(FColor),
+        reinterpret_cast<uint8*>(Pixels),
+        [](uint8* SrcData, const FUpdateTextureRegion2D* InRegions)
+        {
+            delete[] reinterpret_cast<FColor*>(SrcData);
+            delete[] InRegions;
+        });
+}
+
+void UHarmoniaFogOfWarRenderer::UpdateAllTiles(const FHarmoniaExplorationGrid& Grid)
+{
+    if (Grid.GetCellsPerSide() != TextureResolution.X || Grid.GetCellsPerSide() != TextureResolution.Y)
+    {
+        Initialize(MapBounds, FIntPoint(Grid.GetCellsPerSide(), Grid.GetCellsPerSide()));
+    }
+    else
+    {
+        ClearFogOfWar();
+    }
+
+    TArray<int32> TileIndices;
+    TileIndices.Reserve(Grid.Tiles.Num());
+    for (const FHarmoniaExplorationTile& Tile : Grid.Tiles)
+    {
+        TileIndices.Add(Tile.TileIndex);
+    }
+
+    UpdateTiles(Grid, TileIndices);
 }
 
 void UHarmoniaFogOfWarRenderer::ClearFogOfWar()
 {
-    if (!FogOfWarTexture)
+    if (!FogOfWarTexture || TextureResolution.X <= 0 || TextureResolution.Y <= 0)
     {
         return;
     }
 
-    // Clear to black (fully fogged)
-    UKismetRenderingLibrary::ClearRenderTarget2D(
-        this,
-        FogOfWarTexture,
-        FogColor
-    );
+    // Clear to fog color (fully fogged)
+    FColor Colors[16];
+    BuildColorTable(Colors);
+
+    const int32 NumPixels = TextureResolution.X * TextureResolution.Y;
+    FColor* Pixels = new FColor[NumPixels];
+    for (int32 Index = 0; Index < NumPixels; ++Index)
+    {
+        Pixels[Index] = Colors[0];
+    }
+
+    FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, TextureResolution.X, TextureResolution.Y);
+
+    FogOfWarTexture->UpdateTextureRegions(0, 1, Region, TextureResolution.X * sizeof(FColor), sizeof(FColor),
+        reinterpret_cast<uint8*>(Pixels),
+        [](uint8* SrcData, const FUpdateTextureRegion2D* InRegions)
+        {
+            delete[] reinterpret_cast<FColor*>(SrcData);
+            delete InRegions;
+        });
 }
 
 FVector2D UHarmoniaFogOfWarRenderer::WorldToTextureUV(const FVector& WorldPosition) const
@@ -75,137 +159,44 @@ FVector2D UHarmoniaFogOfWarRenderer::WorldToTextureUV(const FVector& WorldPositi
 
 float UHarmoniaFogOfWarRenderer::GetExplorationAlphaAtPosition(const FVector& WorldPosition) const
 {
-    // This would require reading back from the render target
-    // For now, return a simple calculation
-    // In production, you might want to cache this or use a more efficient method
-    return 0.0f;
-}
-
-void UHarmoniaFogOfWarRenderer::CreateRenderTarget()
-{
-    if (!FogOfWarTexture)
+    // Read from the grid rather than the GPU texture
+    if (!SourceGrid)
     {
-        FogOfWarTexture = NewObject<UTextureRenderTarget2D>(this);
-        FogOfWarTexture->RenderTargetFormat = RTF_RGBA8;
-        FogOfWarTexture->InitAutoFormat(TextureResolution.X, TextureResolution.Y);
-        FogOfWarTexture->UpdateResourceImmediate(true);
-        FogOfWarTexture->bAutoGenerateMips = false;
-
-        // Clear to fogged initially
-        ClearFogOfWar();
+        return 0.0f;
     }
+
+    return static_cast<float>(SourceGrid->GetAlpha(WorldPosition)) / FHarmoniaExplorationGrid::MaxAlpha;
 }
 
-void UHarmoniaFogOfWarRenderer::RenderExploredRegions(const TArray<FExploredRegion>& Regions)
+void UHarmoniaFogOfWarRenderer::CreateTexture()
 {
-    if (!FogOfWarTexture)
+    if (FogOfWarTexture || TextureResolution.X <= 0 || TextureResolution.Y <= 0)
     {
         return;
     }
 
-    // Get canvas for drawing
-    UCanvas* Canvas = nullptr;
-    FVector2D CanvasSize;
-    FDrawToRenderTargetContext Context;
-
-    UKismetRenderingLibrary::BeginDrawCanvasToRenderTarget(
-        this,
-        FogOfWarTexture,
-        Canvas,
-        CanvasSize,
-        Context
-    );
-
-    if (Canvas)
-    {
-        // Draw each explored region
-        for (const FExploredRegion& Region : Regions)
-        {
-            DrawExploredRegion(Canvas, Region);
-        }
-
-        // End drawing
-        UKismetRenderingLibrary::EndDrawCanvasToRenderTarget(this, Context);
-    }
-}
-
-void UHarmoniaFogOfWarRenderer::DrawExploredRegion(UCanvas* Canvas, const FExploredRegion& Region)
-{
-    if (!Canvas || !MapBounds.IsValid)
+    FogOfWarTexture = UTexture2D::CreateTransient(TextureResolution.X, TextureResolution.Y, PF_B8G8R8A8, TEXT("HarmoniaFogOfWar"));
+    if (!FogOfWarTexture)
     {
         return;
     }
 
-    // Convert world position to texture coordinates
-    FVector2D CenterUV = WorldToTextureUV(Region.Center);
+    FogOfWarTexture->SRGB = false;
+    FogOfWarTexture->Filter = TF_Bilinear;
+    FogOfWarTexture->AddressX = TA_Clamp;
+    FogOfWarTexture->AddressY = TA_Clamp;
+    FogOfWarTexture->CompressionSettings = TC_VectorDisplacementmap;
+    FogOfWarTexture->UpdateResource();
 
-    // Convert radius to texture space
-    FVector BoundsSize = MapBounds.GetSize();
-    float RadiusX = (Region.Radius / BoundsSize.X) * TextureResolution.X;
-    float RadiusY = (Region.Radius / BoundsSize.Y) * TextureResolution.Y;
-    float AvgRadius = (RadiusX + RadiusY) * 0.5f;
-
-    // Calculate screen position
-    FVector2D ScreenPos(
-        CenterUV.X * TextureResolution.X,
-        CenterUV.Y * TextureResolution.Y
-    );
-
-    // Draw circle with gradient
-    int32 NumSegments = FMath::Max(16, FMath::CeilToInt(AvgRadius / 4.0f));
-
-    // Draw filled circle with gradient
-    FCanvasTileItem TileItem(
-        ScreenPos - FVector2D(AvgRadius, AvgRadius),
-        FVector2D(AvgRadius * 2.0f, AvgRadius * 2.0f),
-        ExploredColor
-    );
-    TileItem.BlendMode = ESimpleElementBlendMode::SE_BLEND_Translucent;
-    Canvas->DrawItem(TileItem);
+    // Clear to fogged initially
+    ClearFogOfWar();
+}
 
-    // Optional: Draw soft edge
-    if (FogBlendRadius > 0.0f)
+void UHarmoniaFogOfWarRenderer::BuildColorTable(FColor (&OutColors)[16]) const
+{
+    for (int32 Alpha = 0; Alpha <= FHarmoniaExplorationGrid::MaxAlpha; ++Alpha)
     {
-        float BlendRadius = FMath::Min(FogBlendRadius, AvgRadius * 0.3f);
-
-        for (int32 i = 0; i < NumSegments; ++i)
-        {
-            float Angle1 = (i / (float)NumSegments) * 2.0f * PI;
-            float Angle2 = ((i + 1) / (float)NumSegments) * 2.0f * PI;
-
-            FVector2D P1 = ScreenPos + FVector2D(
-                FMath::Cos(Angle1) * (AvgRadius - BlendRadius),
-                FMath::Sin(Angle1) * (AvgRadius - BlendRadius)
-            );
-
-            FVector2D P2 = ScreenPos + FVector2D(
-                FMath::Cos(Angle2) * (AvgRadius - BlendRadius),
-                FMath::Sin(Angle2) * (AvgRadius - BlendRadius)
-            );
-
-            FVector2D P3 = ScreenPos + FVector2D(
-                FMath::Cos(Angle2) * AvgRadius,
-                FMath::Sin(Angle2) * AvgRadius
-            );
-
-            FVector2D P4 = ScreenPos + FVector2D(
-                FMath::Cos(Angle1) * AvgRadius,
-                FMath::Sin(Angle1) * AvgRadius
-            );
-
-            // Draw gradient quad
-            FLinearColor InnerColor = ExploredColor;
-            FLinearColor OuterColor = FLinearColor(ExploredColor.R, ExploredColor.G, ExploredColor.B, 0.0f);
-
-            FCanvasTriangleItem TriItem1(P1, P2, P3, GWhiteTexture);
-            TriItem1.SetColor(InnerColor);
-            TriItem1.BlendMode = ESimpleElementBlendMode::SE_BLEND_Translucent;
-            Canvas->DrawItem(TriItem1);
-
-            FCanvasTriangleItem TriItem2(P1, P3, P4, GWhiteTexture);
-            TriItem2.SetColor(InnerColor);
-            TriItem2.BlendMode = ESimpleElementBlendMode::SE_BLEND_Translucent;
-            Canvas->DrawItem(TriItem2);
-        }
+        const float Blend = static_cast<float>(Alpha) / FHarmoniaExplorationGrid::MaxAlpha;
+        OutColors[Alpha] = FMath::Lerp(FogColor, ExploredColor, Blend).ToFColor(false);
     }
 }
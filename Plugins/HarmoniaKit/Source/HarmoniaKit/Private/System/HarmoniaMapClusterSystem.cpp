@@ -21,27 +21,15 @@ TArray<FMarkerCluster> UHarmoniaMapClusterSystem::ClusterMarkers(
     const FBox& MapBounds,
     float CurrentZoom)
 {
-    TArray<FMarkerCluster> Clusters;
+    ResetIndex(MapBounds);
 
-    if (!bEnableClustering || Markers.Num() < MinMarkersForCluster)
+    for (const FMapLocationData& Marker : Markers)
     {
-        // No clustering, create individual clusters
-        for (const FMapLocationData& Marker : Markers)
-        {
-            FMarkerCluster Cluster;
-            FVector2D MarkerUV = WorldToNormalizedUV(Marker.WorldPosition, MapBounds);
-            Cluster.AddMarker(Marker, MarkerUV);
-            Clusters.Add(Cluster);
-        }
-        return Clusters;
+        AddMarker(Marker);
     }
 
-    // Adjust distance threshold based on zoom
-    float AdjustedThreshold = ClusterDistanceThreshold / FMath::Max(0.1f, CurrentZoom);
-
-    // Use simple distance-based clustering
-    BuildClustersSimple(Markers, MapBounds, Clusters, AdjustedThreshold);
-
+    TArray<FMarkerCluster> Clusters;
+    QueryClusters(FBox2D(FVector2D::ZeroVector, FVector2D::UnitVector), CurrentZoom, Clusters);
     return Clusters;
 }
 
@@ -91,239 +79,319 @@ float UHarmoniaMapClusterSystem::GetMarkerOpacity(float ZoomLevel, float FadeSta
     return (ZoomLevel - FadeStart) / (FadeEnd - FadeStart);
 }
 
-void UHarmoniaMapClusterSystem::BuildClustersKMeans(
-    const TArray<FMapLocationData>& Markers,
-    TArray<FMarkerCluster>& OutClusters,
-    float DistanceThreshold)
+// ============================================================================
+// Incremental Index
+// ============================================================================
+
+void UHarmoniaMapClusterSystem::ResetIndex(const FBox& MapBounds)
 {
-    if (Markers.Num() < MinMarkersForCluster)
+    IndexBounds = MapBounds;
+    IndexDepth = FMath::Clamp(MaxClusterDepth, 1, 15);
+
+    IndexedMarkers.Empty();
+    Levels.Reset();
+    Levels.SetNum(IndexDepth + 1);
+}
+
+int32 UHarmoniaMapClusterSystem::AddMarker(const FMapLocationData& Marker)
+{
+    if (Levels.Num() == 0)
     {
-        // Too few markers for clustering
-        return;
+        ResetIndex(IndexBounds);
+    }
+
+    FIndexedMarker NewMarker;
+    NewMarker.Data = Marker;
+    NewMarker.UV = WorldToNormalizedUV(Marker.WorldPosition, IndexBounds).ClampAxes(0.0, 1.0);
+    NewMarker.LeafCell = GetLeafCell(NewMarker.UV);
+
+    const int32 MarkerId = IndexedMarkers.Add(MoveTemp(NewMarker));
+    InsertIntoLevels(MarkerId);
+    return MarkerId;
+}
+
+bool UHarmoniaMapClusterSystem::UpdateMarker(int32 MarkerId, const FMapLocationData& Marker)
+{
+    if (!IndexedMarkers.IsValidIndex(MarkerId))
+    {
+        return false;
+    }
+
+    const FVector2D NewUV = WorldToNormalizedUV(Marker.WorldPosition, IndexBounds).ClampAxes(0.0, 1.0);
+    FIndexedMarker& Indexed = IndexedMarkers[MarkerId];
+
+    if (NewUV == Indexed.UV)
+    {
+        // Same place, the cells are unaffected
+        Indexed.Data = Marker;
+        return true;
+    }
+
+    RemoveFromLevels(MarkerId);
+
+    Indexed.Data = Marker;
+    Indexed.UV = NewUV;
+    Indexed.LeafCell = GetLeafCell(NewUV);
+
+    InsertIntoLevels(MarkerId);
+    return true;
+}
+
+bool UHarmoniaMapClusterSystem::RemoveMarker(int32 MarkerId)
+{
+    if (!IndexedMarkers.IsValidIndex(MarkerId))
+    {
+        return false;
     }
 
-    // Estimate number of clusters based on distance threshold
-    // For simplicity, use markers.Num() / MinMarkersForCluster as max K
-    int32 MaxK = FMath::Max(1, Markers.Num() / MinMarkersForCluster);
-    int32 K = FMath::Min(MaxK, 10); // Limit to 10 clusters max
+    RemoveFromLevels(MarkerId);
+    IndexedMarkers.RemoveAt(MarkerId);
+    return true;
+}
 
-    // Initialize K random centroids
-    TArray<FVector2D> Centroids;
-    TArray<int32> SelectedIndices;
+int32 UHarmoniaMapClusterSystem::GetDepthForZoom(float ZoomLevel) const
+{
+    // Deepest level whose cells are still at least ClusterDistanceThreshold pixels wide
+    const float MapPixels = MapPixelSize * FMath::Max(0.1f, ZoomLevel);
+    const float CellPixels = FMath::Max(1.0f, ClusterDistanceThreshold);
+    const int32 MaxDepth = Levels.Num() > 0 ? IndexDepth : FMath::Clamp(MaxClusterDepth, 1, 15);
 
-    // K-means++ initialization for better initial centroids
-    FRandomStream Random(FMath::Rand());
+    return FMath::Clamp(FMath::FloorToInt32(FMath::Log2(MapPixels / CellPixels)), 0, MaxDepth);
+}
 
-    // First centroid: random marker
-    int32 FirstIndex = Random.RandRange(0, Markers.Num() - 1);
-    Centroids.Add(FVector2D(Markers[FirstIndex].WorldPosition.X, Markers[FirstIndex].WorldPosition.Y));
-    SelectedIndices.Add(FirstIndex);
+void UHarmoniaMapClusterSystem::QueryClusters(const FBox2D& ViewUV, float CurrentZoom, TArray<FMarkerCluster>& OutClusters) const
+{
+    OutClusters.Reset();
 
-    // Select remaining centroids using K-means++ method
-    for (int32 i = 1; i < K; ++i)
+    if (IndexedMarkers.Num() == 0 || Levels.Num() == 0)
     {
-        // Calculate distance to nearest centroid for each marker
-        TArray<float> MinDistances;
-        MinDistances.SetNum(Markers.Num());
+        return;
+    }
 
-        for (int32 j = 0; j < Markers.Num(); ++j)
+    const FVector2D ViewMin = ViewUV.Min.ClampAxes(0.0, 1.0);
+    const FVector2D ViewMax = ViewUV.Max.ClampAxes(0.0, 1.0);
+
+    if (!bEnableClustering)
+    {
+        // Every marker on its own
+        for (const FIndexedMarker& Indexed : IndexedMarkers)
         {
-            if (SelectedIndices.Contains(j))
+            if (Indexed.UV.X >= ViewMin.X && Indexed.UV.Y >= ViewMin.Y && Indexed.UV.X <= ViewMax.X && Indexed.UV.Y <= ViewMax.Y)
             {
-                MinDistances[j] = 0.0f;
-                continue;
+                OutClusters.AddDefaulted_GetRef().AddMarker(Indexed.Data, Indexed.UV);
             }
+        }
+        return;
+    }
+
+    const int32 Depth = GetDepthForZoom(CurrentZoom);
+    const int32 CellsPerSide = 1 << Depth;
+    const TMap<uint32, FClusterCell>& Level = Levels[Depth];
+    const float PixelScale = MapPixelSize * FMath::Max(0.1f, CurrentZoom);
 
-            FVector2D MarkerPos(Markers[j].WorldPosition.X, Markers[j].WorldPosition.Y);
-            float MinDist = TNumericLimits<float>::Max();
+    const int32 MinX = FMath::Clamp(FMath::FloorToInt32(ViewMin.X * CellsPerSide), 0, CellsPerSide - 1);
+    const int32 MinY = FMath::Clamp(FMath::FloorToInt32(ViewMin.Y * CellsPerSide), 0, CellsPerSide - 1);
+    const int32 MaxX = FMath::Clamp(FMath::FloorToInt32(ViewMax.X * CellsPerSide), 0, CellsPerSide - 1);
+    const int32 MaxY = FMath::Clamp(FMath::FloorToInt32(ViewMax.Y * CellsPerSide), 0, CellsPerSide - 1);
 
-            for (const FVector2D& Centroid : Centroids)
+    const int64 NumViewCells = int64(MaxX - MinX + 1) * int64(MaxY - MinY + 1);
+    if (NumViewCells <= Level.Num())
+    {
+        // Look up the cells under the view
+        for (int32 Y = MinY; Y <= MaxY; ++Y)
+        {
+            for (int32 X = MinX; X <= MaxX; ++X)
             {
-                float Dist = FVector2D::DistSquared(MarkerPos, Centroid);
-                MinDist = FMath::Min(MinDist, Dist);
+                if (const FClusterCell* ClusterCell = Level.Find(MakeCellKey(X, Y)))
+                {
+                    EmitCell(Depth, FIntPoint(X, Y), *ClusterCell, PixelScale, OutClusters);
+                }
             }
-
-            MinDistances[j] = MinDist;
         }
-
-        // Select next centroid with probability proportional to distance^2
-        float TotalWeight = 0.0f;
-        for (float Dist : MinDistances)
+    }
+    else
+    {
+        // Fewer occupied cells than cells under the view, walk the occupied ones in row order
+        TArray<uint32> VisibleKeys;
+        for (const TPair<uint32, FClusterCell>& Pair : Level)
         {
-            TotalWeight += Dist;
+            const int32 X = Pair.Key >> 16;
+            const int32 Y = Pair.Key & 0xFFFF;
+            if (X >= MinX && X <= MaxX && Y >= MinY && Y <= MaxY)
+            {
+                VisibleKeys.Add(Pair.Key);
+            }
         }
 
-        if (TotalWeight > 0.0f)
+        VisibleKeys.Sort([](uint32 A, uint32 B)
         {
-            float RandomValue = Random.FRandRange(0.0f, TotalWeight);
-            float AccumulatedWeight = 0.0f;
+            return (A & 0xFFFF) != (B & 0xFFFF) ? (A & 0xFFFF) < (B & 0xFFFF) : A < B;
+        });
 
-            for (int32 j = 0; j < Markers.Num(); ++j)
-            {
-                AccumulatedWeight += MinDistances[j];
-                if (AccumulatedWeight >= RandomValue)
-                {
-                    Centroids.Add(FVector2D(Markers[j].WorldPosition.X, Markers[j].WorldPosition.Y));
-                    SelectedIndices.Add(j);
-                    break;
-                }
-            }
+        for (const uint32 Key : VisibleKeys)
+        {
+            EmitCell(Depth, FIntPoint(Key >> 16, Key & 0xFFFF), Level[Key], PixelScale, OutClusters);
         }
     }
+}
 
-    // K-means iterations
-    const int32 MaxIterations = 20;
-    TArray<int32> Assignments;
-    Assignments.SetNum(Markers.Num());
+FIntPoint UHarmoniaMapClusterSystem::GetLeafCell(const FVector2D& UV) const
+{
+    const int32 CellsPerSide = 1 << IndexDepth;
+    return FIntPoint(
+        FMath::Clamp(FMath::FloorToInt32(UV.X * CellsPerSide), 0, CellsPerSide - 1),
+        FMath::Clamp(FMath::FloorToInt32(UV.Y * CellsPerSide), 0, CellsPerSide - 1));
+}
+
+void UHarmoniaMapClusterSystem::InsertIntoLevels(int32 MarkerId)
+{
+    const FIndexedMarker& Indexed = IndexedMarkers[MarkerId];
 
-    for (int32 Iteration = 0; Iteration < MaxIterations; ++Iteration)
+    for (int32 Depth = IndexDepth; Depth >= 0; --Depth)
     {
-        bool bChanged = false;
+        const int32 Shift = IndexDepth - Depth;
+        FClusterCell& ClusterCell = Levels[Depth].FindOrAdd(MakeCellKey(Indexed.LeafCell.X >> Shift, Indexed.LeafCell.Y >> Shift));
 
-        // Assignment step: assign each marker to nearest centroid
-        for (int32 i = 0; i < Markers.Num(); ++i)
+        ClusterCell.Count++;
+        ClusterCell.SumUV += Indexed.UV;
+        ClusterCell.Bounds += Indexed.UV;
+
+        if (Depth == IndexDepth)
         {
-            FVector2D MarkerPos(Markers[i].WorldPosition.X, Markers[i].WorldPosition.Y);
+            ClusterCell.MarkerIds.Add(MarkerId);
+        }
+    }
+}
 
-            int32 NearestCentroid = 0;
-            float MinDist = FVector2D::DistSquared(MarkerPos, Centroids[0]);
+void UHarmoniaMapClusterSystem::RemoveFromLevels(int32 MarkerId)
+{
+    const FIndexedMarker& Indexed = IndexedMarkers[MarkerId];
 
-            for (int32 k = 1; k < K; ++k)
-            {
-                float Dist = FVector2D::DistSquared(MarkerPos, Centroids[k]);
-                if (Dist < MinDist)
-                {
-                    MinDist = Dist;
-                    NearestCentroid = k;
-                }
-            }
+    for (int32 Depth = IndexDepth; Depth >= 0; --Depth)
+    {
+        const int32 Shift = IndexDepth - Depth;
+        const uint32 Key = MakeCellKey(Indexed.LeafCell.X >> Shift, Indexed.LeafCell.Y >> Shift);
 
-            if (Assignments[i] != NearestCentroid)
-            {
-                Assignments[i] = NearestCentroid;
-                bChanged = true;
-            }
+        FClusterCell* ClusterCell = Levels[Depth].Find(Key);
+        if (!ClusterCell)
+        {
+            continue;
         }
 
-        // If no changes, we've converged
-        if (!bChanged)
+        if (--ClusterCell->Count <= 0)
         {
-            break;
+            Levels[Depth].Remove(Key);
+            continue;
         }
 
-        // Update step: recalculate centroids
-        TArray<FVector2D> NewCentroids;
-        TArray<int32> ClusterCounts;
-        NewCentroids.SetNum(K);
-        ClusterCounts.SetNumZeroed(K);
+        ClusterCell->SumUV -= Indexed.UV;
+        if (Depth == IndexDepth)
+        {
+            ClusterCell->MarkerIds.RemoveSwap(MarkerId);
+        }
+    }
 
-        for (int32 i = 0; i < Markers.Num(); ++i)
+    RefreshBounds(Indexed.LeafCell);
+}
+
+void UHarmoniaMapClusterSystem::RefreshBounds(const FIntPoint& LeafCell)
+{
+    // Bounds cannot shrink incrementally: rebuild the leaf from its markers, then each parent from its four children
+    if (FClusterCell* Leaf = Levels[IndexDepth].Find(MakeCellKey(LeafCell.X, LeafCell.Y)))
+    {
+        Leaf->Bounds = FBox2D(ForceInit);
+        for (const int32 MarkerId : Leaf->MarkerIds)
         {
-            int32 ClusterIndex = Assignments[i];
-            FVector2D MarkerPos(Markers[i].WorldPosition.X, Markers[i].WorldPosition.Y);
+            Leaf->Bounds += IndexedMarkers[MarkerId].UV;
+        }
+    }
+
+    for (int32 Depth = IndexDepth - 1; Depth >= 0; --Depth)
+    {
+        const int32 Shift = IndexDepth - Depth;
+        const FIntPoint Cell(LeafCell.X >> Shift, LeafCell.Y >> Shift);
 
-            NewCentroids[ClusterIndex] += MarkerPos;
-            ClusterCounts[ClusterIndex]++;
+        FClusterCell* ClusterCell = Levels[Depth].Find(MakeCellKey(Cell.X, Cell.Y));
+        if (!ClusterCell)
+        {
+            continue;
         }
 
-        for (int32 k = 0; k < K; ++k)
+        ClusterCell->Bounds = FBox2D(ForceInit);
+        for (int32 Child = 0; Child < 4; ++Child)
         {
-            if (ClusterCounts[k] > 0)
+            if (const FClusterCell* ChildCell = Levels[Depth + 1].Find(MakeCellKey(Cell.X * 2 + (Child & 1), Cell.Y * 2 + (Child >> 1))))
             {
-                Centroids[k] = NewCentroids[k] / static_cast<float>(ClusterCounts[k]);
+                ClusterCell->Bounds += ChildCell->Bounds;
             }
         }
     }
+}
 
-    // Build final clusters from assignments
-    OutClusters.SetNum(K);
-    for (int32 k = 0; k < K; ++k)
-    {
-        OutClusters[k] = FMarkerCluster();
-        OutClusters[k].ClusterCenter = Centroids[k];
-    }
-
-    for (int32 i = 0; i < Markers.Num(); ++i)
+void UHarmoniaMapClusterSystem::CollectMarkerIds(int32 Depth, const FIntPoint& Cell, int32 MaxMarkers, TArray<int32>& OutMarkerIds) const
+{
+    if (MaxMarkers > 0 && OutMarkerIds.Num() >= MaxMarkers)
     {
-        int32 ClusterIndex = Assignments[i];
-        FVector2D MarkerPos(Markers[i].WorldPosition.X, Markers[i].WorldPosition.Y);
-        OutClusters[ClusterIndex].AddMarker(Markers[i], MarkerPos);
+        return;
     }
 
-    // Calculate cluster radii
-    for (int32 k = 0; k < K; ++k)
+    if (Depth == IndexDepth)
     {
-        for (const FMapLocationData& Marker : OutClusters[k].Markers)
+        if (const FClusterCell* Leaf = Levels[Depth].Find(MakeCellKey(Cell.X, Cell.Y)))
         {
-            FVector2D MarkerPos(Marker.WorldPosition.X, Marker.WorldPosition.Y);
-            float Distance = FVector2D::Distance(OutClusters[k].ClusterCenter, MarkerPos);
-            OutClusters[k].ClusterRadius = FMath::Max(OutClusters[k].ClusterRadius, Distance);
+            const int32 NumToAdd = MaxMarkers > 0 ? FMath::Min(Leaf->MarkerIds.Num(), MaxMarkers - OutMarkerIds.Num()) : Leaf->MarkerIds.Num();
+            OutMarkerIds.Append(Leaf->MarkerIds.GetData(), NumToAdd);
         }
+        return;
     }
 
-    // Remove empty clusters
-    for (int32 k = OutClusters.Num() - 1; k >= 0; --k)
+    for (int32 Child = 0; Child < 4; ++Child)
     {
-        if (OutClusters[k].MarkerCount == 0)
+        const FIntPoint ChildCell(Cell.X * 2 + (Child & 1), Cell.Y * 2 + (Child >> 1));
+        if (Levels[Depth + 1].Contains(MakeCellKey(ChildCell.X, ChildCell.Y)))
         {
-            OutClusters.RemoveAt(k);
+            CollectMarkerIds(Depth + 1, ChildCell, MaxMarkers, OutMarkerIds);
         }
     }
 }
 
-void UHarmoniaMapClusterSystem::BuildClustersSimple(
-    const TArray<FMapLocationData>& Markers,
-    const FBox& MapBounds,
-    TArray<FMarkerCluster>& OutClusters,
-    float DistanceThreshold)
+void UHarmoniaMapClusterSystem::EmitCell(int32 Depth, const FIntPoint& Cell, const FClusterCell& ClusterCell, float PixelScale, TArray<FMarkerCluster>& OutClusters) const
 {
-    TArray<bool> Clustered;
-    Clustered.SetNumZeroed(Markers.Num());
 
-    for (int32 i = 0; i < Markers.Num(); ++i)
+    if (ClusterCell.Count < MinMarkersForCluster)
     {
-        if (Clustered[i])
-        {
-            continue;
-        }
-
-        FMarkerCluster NewCluster;
-        FVector2D MarkerUV_i = WorldToNormalizedUV(Markers[i].WorldPosition, MapBounds);
+        // Too few to cluster, show them individually
+        TArray<int32> CellMarkerIds;
+        CollectMarkerIds(Depth, Cell, 0, CellMarkerIds);
 
-        // Add first marker
-        NewCluster.AddMarker(Markers[i], MarkerUV_i);
-        Clustered[i] = true;
-
-        // Find nearby markers
-        for (int32 j = i + 1; j < Markers.Num(); ++j)
+        for (const int32 MarkerId : CellMarkerIds)
         {
-            if (Clustered[j])
-            {
-                continue;
-            }
-
-            FVector2D MarkerUV_j = WorldToNormalizedUV(Markers[j].WorldPosition, MapBounds);
-            float Distance = FVector2D::Distance(MarkerUV_i, MarkerUV_j);
+            const FIndexedMarker& Indexed = IndexedMarkers[MarkerId];
+            OutClusters.AddDefaulted_GetRef().AddMarker(Indexed.Data, Indexed.UV);
+        }
+        return;
+    }
 
-            // Normalize distance to screen space (assuming 1024x1024 texture)
-            float ScreenDistance = Distance * 1024.0f;
+    FMarkerCluster& Cluster = OutClusters.AddDefaulted_GetRef();
+    Cluster.MarkerCount = ClusterCell.Count;
+    Cluster.ClusterCenter = ClusterCell.SumUV / ClusterCell.Count;
 
-            if (ScreenDistance < DistanceThreshold)
-            {
-                NewCluster.AddMarker(Markers[j], MarkerUV_j);
-                Clustered[j] = true;
-            }
-        }
+    // Farthest bounds corner from the centroid, in screen pixels
+    if (ClusterCell.Bounds.bIsValid)
+    {
+        const FVector2D FarCorner(
+            FMath::Max(FMath::Abs(ClusterCell.Bounds.Min.X - Cluster.ClusterCenter.X), FMath::Abs(ClusterCell.Bounds.Max.X - Cluster.ClusterCenter.X)),
+            FMath::Max(FMath::Abs(ClusterCell.Bounds.Min.Y - Cluster.ClusterCenter.Y), FMath::Abs(ClusterCell.Bounds.Max.Y - Cluster.ClusterCenter.Y)));
+        Cluster.ClusterRadius = FarCorner.Size() * PixelScale;
+    }
 
-        // Calculate cluster radius
-        for (const FMapLocationData& Marker : NewCluster.Markers)
-        {
-            FVector2D MarkerUV = WorldToNormalizedUV(Marker.WorldPosition, MapBounds);
-            float Distance = FVector2D::Distance(NewCluster.ClusterCenter, MarkerUV) * 1024.0f;
-            NewCluster.ClusterRadius = FMath::Max(NewCluster.ClusterRadius, Distance);
-        }
+    TArray<int32> ListedMarkerIds;
+    CollectMarkerIds(Depth, Cell, MaxListedMarkersPerCluster, ListedMarkerIds);
 
-        OutClusters.Add(NewCluster);
+    Cluster.Markers.Reserve(ListedMarkerIds.Num());
+    for (const int32 MarkerId : ListedMarkerIds)
+    {
+        Cluster.Markers.Add(IndexedMarkers[MarkerId].Data);
     }
 }
 
@@ -0,0 +1,388 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaMarkerRegistrySubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogHarmoniaMarkerRegistry, Log, All);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("MarkerRegistry Markers"), STAT_MarkerRegistryMarkers, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("MarkerRegistry Query Hits"), STAT_MarkerRegistryQueryHits, STATGROUP_Game);
+
+namespace HarmoniaMarkerRegistry
+{
+	constexpr int32 MaxCategoryBits = 64;
+}
+
+UHarmoniaMarkerRegistrySubsystem* UHarmoniaMarkerRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UHarmoniaMarkerRegistrySubsystem>() : nullptr;
+}
+
+void UHarmoniaMarkerRegistrySubsystem::Deinitialize()
+{
+	Entries.Empty();
+	Cells.Empty();
+	AlwaysRelevantEntries.Empty();
+	TrackedEntries.Empty();
+	LostPayloads.Empty();
+	SET_DWORD_STAT(STAT_MarkerRegistryMarkers, 0);
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+FHarmoniaMarkerHandle UHarmoniaMarkerRegistrySubsystem::Register(const UObject* Owner, int32 PayloadIndex, const FVector& Location, AActor* TrackedActor, FGameplayTag Category, bool bAlwaysRelevant)
+{
+	FEntry Entry;
+	Entry.Owner = Owner;
+	Entry.PayloadIndex = PayloadIndex;
+	Entry.TrackedActor = TrackedActor;
+	Entry.bTracked = TrackedActor != nullptr;
+	Entry.Location = TrackedActor ? TrackedActor->GetActorLocation() : Location;
+	Entry.CategoryBit = GetCategoryBit(Category);
+	Entry.bAlwaysRelevant = bAlwaysRelevant;
+	Entry.Serial = NextSerial++;
+
+	FHarmoniaMarkerHandle Handle;
+	Handle.Serial = Entry.Serial;
+	Handle.Index = Entries.Add(MoveTemp(Entry));
+	LinkEntry(Handle.Index);
+
+	SET_DWORD_STAT(STAT_MarkerRegistryMarkers, Entries.Num());
+	return Handle;
+}
+
+void UHarmoniaMarkerRegistrySubsystem::Unregister(FHarmoniaMarkerHandle& Handle)
+{
+	if (FEntry* Entry = FindEntry(Handle))
+	{
+		if (Entry->bLost)
+		{
+			if (TArray<int32>* Lost = LostPayloads.Find(Entry->Owner))
+			{
+				Lost->RemoveSingleSwap(Entry->PayloadIndex);
+			}
+		}
+
+		UnlinkEntry(Handle.Index);
+		Entries.RemoveAt(Handle.Index);
+		SET_DWORD_STAT(STAT_MarkerRegistryMarkers, Entries.Num());
+	}
+
+	Handle.Reset();
+}
+
+void UHarmoniaMarkerRegistrySubsystem::UnregisterAll(const UObject* Owner)
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It->Owner == Owner)
+		{
+			UnlinkEntry(It.GetIndex());
+			It.RemoveCurrent();
+		}
+	}
+
+	LostPayloads.Remove(Owner);
+	SET_DWORD_STAT(STAT_MarkerRegistryMarkers, Entries.Num());
+}
+
+void UHarmoniaMarkerRegistrySubsystem::Update(const FHarmoniaMarkerHandle& Handle, const FVector& Location, AActor* TrackedActor, FGameplayTag Category, bool bAlwaysRelevant)
+{
+	FEntry* Entry = FindEntry(Handle);
+	if (!Entry)
+	{
+		return;
+	}
+
+	if (Entry->bLost)
+	{
+		if (TArray<int32>* Lost = LostPayloads.Find(Entry->Owner))
+		{
+			Lost->RemoveSingleSwap(Entry->PayloadIndex);
+		}
+	}
+
+	UnlinkEntry(Handle.Index);
+
+	Entry->TrackedActor = TrackedActor;
+	Entry->bTracked = TrackedActor != nullptr;
+	Entry->bLost = false;
+	Entry->Location = TrackedActor ? TrackedActor->GetActorLocation() : Location;
+	Entry->CategoryBit = GetCategoryBit(Category);
+	Entry->bAlwaysRelevant = bAlwaysRelevant;
+
+	LinkEntry(Handle.Index);
+}
+
+void UHarmoniaMarkerRegistrySubsystem::SetLocation(const FHarmoniaMarkerHandle& Handle, const FVector& Location)
+{
+	if (FEntry* Entry = FindEntry(Handle))
+	{
+		Entry->Location = Location;
+		RelinkCell(Handle.Index);
+	}
+}
+
+UHarmoniaMarkerRegistrySubsystem::FEntry* UHarmoniaMarkerRegistrySubsystem::FindEntry(const FHarmoniaMarkerHandle& Handle)
+{
+	if (Handle.IsValid() && Entries.IsValidIndex(Handle.Index) && Entries[Handle.Index].Serial == Handle.Serial)
+	{
+		return &Entries[Handle.Index];
+	}
+	return nullptr;
+}
+
+const UHarmoniaMarkerRegistrySubsystem::FEntry* UHarmoniaMarkerRegistrySubsystem::FindEntry(const FHarmoniaMarkerHandle& Handle) const
+{
+	return const_cast<UHarmoniaMarkerRegistrySubsystem*>(this)->FindEntry(Handle);
+}
+
+// ============================================================================
+// Categories
+// ============================================================================
+
+uint64 UHarmoniaMarkerRegistrySubsystem::GetCategoryBit(FGameplayTag Category)
+{
+	if (!Category.IsValid())
+	{
+		return 0;
+	}
+
+	int32 BitIndex = CategoryTags.IndexOfByKey(Category);
+	if (BitIndex == INDEX_NONE)
+	{
+		if (CategoryTags.Num() < HarmoniaMarkerRegistry::MaxCategoryBits)
+		{
+			BitIndex = CategoryTags.Add(Category);
+		}
+		else
+		{
+			// Extra categories share the last bit, hiding one of them hides all of them
+			if (!bWarnedCategoryOverflow)
+			{
+				bWarnedCategoryOverflow = true;
+				UE_LOG(LogHarmoniaMarkerRegistry, Warning, TEXT("More than %d marker categories, %s shares a filter bit with other categories"),
+					HarmoniaMarkerRegistry::MaxCategoryBits, *Category.ToString());
+			}
+			BitIndex = HarmoniaMarkerRegistry::MaxCategoryBits - 1;
+		}
+	}
+
+	return uint64(1) << BitIndex;
+}
+
+uint64 UHarmoniaMarkerRegistrySubsystem::GetCategoryMask(const TArray<FGameplayTag>& Categories)
+{
+	uint64 Mask = 0;
+	for (const FGameplayTag& Category : Categories)
+	{
+		Mask |= GetCategoryBit(Category);
+	}
+	return Mask;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+void UHarmoniaMarkerRegistrySubsystem::QueryRadius(const UObject* Owner, const FVector& Center, float Radius, uint64 HiddenCategoryMask, TArray<FHarmoniaMarkerQueryHit>& OutHits)
+{
+	RefreshTrackedEntries();
+
+	OutHits.Reset();
+	LastQueryCellCount = 0;
+
+	auto AddHit = [this, Owner, HiddenCategoryMask, &OutHits](int32 Index)
+	{
+		const FEntry& Entry = Entries[Index];
+		if (Entry.Owner == Owner && !Entry.bLost && (Entry.CategoryBit & HiddenCategoryMask) == 0)
+		{
+			OutHits.Add({ Entry.PayloadIndex, Entry.Location });
+		}
+	};
+
+	for (int32 Index : AlwaysRelevantEntries)
+	{
+		AddHit(Index);
+	}
+
+	if (Radius > 0.0f && Cells.Num() > 0)
+	{
+		const FIntPoint MinCell = ToCell(Center - FVector(Radius, Radius, 0.0f));
+		const FIntPoint MaxCell = ToCell(Center + FVector(Radius, Radius, 0.0f));
+		const int64 NumCellsInView = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+		auto VisitCell = [&](const FIntPoint& Cell, const TArray<int32>& Indices)
+		{
+			// Skip cells entirely outside the circle
+			const FVector2D CellMin(Cell.X * CellSize, Cell.Y * CellSize);
+			const FVector2D Closest(
+				FMath::Clamp(double(Center.X), CellMin.X, CellMin.X + CellSize),
+				FMath::Clamp(double(Center.Y), CellMin.Y, CellMin.Y + CellSize));
+			if (FVector2D::DistSquared(Closest, FVector2D(Center)) > FMath::Square(Radius))
+			{
+				return;
+			}
+
+			LastQueryCellCount++;
+			for (int32 Index : Indices)
+			{
+				AddHit(Index);
+			}
+		};
+
+		if (NumCellsInView > Cells.Num())
+		{
+			// Sparse grid: cheaper to walk the occupied cells than the view rectangle
+			for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+			{
+				if (Pair.Key.X >= MinCell.X && Pair.Key.X <= MaxCell.X && Pair.Key.Y >= MinCell.Y && Pair.Key.Y <= MaxCell.Y)
+				{
+					VisitCell(Pair.Key, Pair.Value);
+				}
+			}
+		}
+		else
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+				{
+					const FIntPoint Cell(X, Y);
+					if (const TArray<int32>* Indices = Cells.Find(Cell))
+					{
+						VisitCell(Cell, *Indices);
+					}
+				}
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_MarkerRegistryQueryHits, OutHits.Num());
+}
+
+void UHarmoniaMarkerRegistrySubsystem::ConsumeLostMarkers(const UObject* Owner, TArray<int32>& OutPayloadIndices)
+{
+	RefreshTrackedEntries();
+
+	OutPayloadIndices.Reset();
+	if (TArray<int32>* Lost = LostPayloads.Find(Owner))
+	{
+		OutPayloadIndices = MoveTemp(*Lost);
+		LostPayloads.Remove(Owner);
+	}
+}
+
+// ============================================================================
+// Internal
+// ============================================================================
+
+FIntPoint UHarmoniaMarkerRegistrySubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UHarmoniaMarkerRegistrySubsystem::LinkEntry(int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+
+	if (Entry.bAlwaysRelevant)
+	{
+		AlwaysRelevantEntries.Add(Index);
+	}
+	else
+	{
+		Entry.Cell = ToCell(Entry.Location);
+		Cells.FindOrAdd(Entry.Cell).Add(Index);
+	}
+
+	if (Entry.bTracked)
+	{
+		TrackedEntries.Add(Index);
+	}
+}
+
+void UHarmoniaMarkerRegistrySubsystem::UnlinkEntry(int32 Index)
+{
+	const FEntry& Entry = Entries[Index];
+
+	if (Entry.bAlwaysRelevant)
+	{
+		AlwaysRelevantEntries.RemoveSingleSwap(Index);
+	}
+	else if (TArray<int32>* CellEntries = Cells.Find(Entry.Cell))
+	{
+		CellEntries->RemoveSingleSwap(Index);
+		if (CellEntries->Num() == 0)
+		{
+			Cells.Remove(Entry.Cell);
+		}
+	}
+
+	if (Entry.bTracked)
+	{
+		TrackedEntries.RemoveSingleSwap(Index);
+	}
+}
+
+void UHarmoniaMarkerRegistrySubsystem::RelinkCell(int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+	if (Entry.bAlwaysRelevant)
+	{
+		return;
+	}
+
+	const FIntPoint NewCell = ToCell(Entry.Location);
+	if (NewCell == Entry.Cell)
+	{
+		return;
+	}
+
+	if (TArray<int32>* CellEntries = Cells.Find(Entry.Cell))
+	{
+		CellEntries->RemoveSingleSwap(Index);
+		if (CellEntries->Num() == 0)
+		{
+			Cells.Remove(Entry.Cell);
+		}
+	}
+
+	Entry.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Index);
+}
+
+void UHarmoniaMarkerRegistrySubsystem::RefreshTrackedEntries()
+{
+	if (LastRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastRefreshFrame = GFrameCounter;
+
+	for (int32 i = TrackedEntries.Num() - 1; i >= 0; --i)
+	{
+		const int32 Index = TrackedEntries[i];
+		FEntry& Entry = Entries[Index];
+
+		if (const AActor* Actor = Entry.TrackedActor.Get())
+		{
+			Entry.Location = Actor->GetActorLocation();
+			RelinkCell(Index);
+		}
+		else
+		{
+			// Stop following and hand the marker back to its owner for removal
+			Entry.bTracked = false;
+			Entry.bLost = true;
+			TrackedEntries.RemoveAtSwap(i);
+			LostPayloads.FindOrAdd(Entry.Owner).Add(Entry.PayloadIndex);
+		}
+	}
+}
@@ -0,0 +1,231 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaNetRelevancySubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("Net Relevancy Tier Pass"), STAT_NetRelevancyTierPass, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Net Relevancy Actors"), STAT_NetRelevancyActors, STATGROUP_Game);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Net Tier Transitions/s"), STAT_NetTierTransitionsPerSecond, STATGROUP_Game);
+
+UHarmoniaNetRelevancySubsystem* UHarmoniaNetRelevancySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UHarmoniaNetRelevancySubsystem>() : nullptr;
+}
+
+void UHarmoniaNetRelevancySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHarmoniaNetRelevancySubsystem::Tick),
+		0.0f // Tick every frame, passes are spaced by TierUpdateInterval
+	);
+}
+
+void UHarmoniaNetRelevancySubsystem::Deinitialize()
+{
+	if (TickDelegateHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+		TickDelegateHandle.Reset();
+	}
+
+	Components.Empty();
+	ComponentKeys.Empty();
+	ComponentIndices.Empty();
+	TieringInputs.Empty();
+	TieringOutputs.Empty();
+	PlayerLocations.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHarmoniaNetRelevancySubsystem::Tick(float DeltaTime)
+{
+	// Counter stats reset every frame, so report on every tick rather than only on pass frames
+	SET_DWORD_STAT(STAT_NetRelevancyActors, ComponentIndices.Num());
+
+	UWorld* World = GetWorld();
+	if (!World || World->IsPaused() || Components.Num() == 0)
+	{
+		return true;
+	}
+
+	// Follow world time (pause, time dilation) rather than the core ticker delta
+	const float WorldDeltaTime = World->GetDeltaSeconds();
+
+	TimeSinceTierPass += WorldDeltaTime;
+	if (TimeSinceTierPass < TierUpdateInterval)
+	{
+		UpdateTransitionRate(WorldDeltaTime, 0);
+		return true;
+	}
+
+	const float PassDeltaTime = TimeSinceTierPass;
+	TimeSinceTierPass = 0.0f;
+
+	GatherPlayerLocations(*World);
+	RunTierPass(PassDeltaTime);
+	UpdateTransitionRate(WorldDeltaTime, TierTransitionsLastPass);
+
+	return true;
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+void UHarmoniaNetRelevancySubsystem::Register(UHarmoniaNetworkOptimizationComponent* Component)
+{
+	if (!Component || ComponentIndices.Contains(Component))
+	{
+		return;
+	}
+
+	ComponentIndices.Add(Component, Components.Num());
+	Components.Add(Component);
+	ComponentKeys.Add(Component);
+}
+
+void UHarmoniaNetRelevancySubsystem::Unregister(UHarmoniaNetworkOptimizationComponent* Component)
+{
+	int32 Index = INDEX_NONE;
+	if (!ComponentIndices.RemoveAndCopyValue(Component, Index))
+	{
+		return;
+	}
+
+	// Level change callbacks may unregister in the middle of a pass, so only clear the slot here
+	Components[Index].Reset();
+	ComponentKeys[Index] = nullptr;
+}
+
+void UHarmoniaNetRelevancySubsystem::RemoveStaleComponents()
+{
+	for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+	{
+		if (Components[Index].IsValid())
+		{
+			continue;
+		}
+
+		// Destroyed without EndPlay
+		if (ComponentKeys[Index])
+		{
+			ComponentIndices.Remove(ComponentKeys[Index]);
+		}
+
+		Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		ComponentKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+		if (Index < ComponentKeys.Num() && ComponentKeys[Index])
+		{
+			ComponentIndices[ComponentKeys[Index]] = Index;
+		}
+	}
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+float UHarmoniaNetRelevancySubsystem::GetDistanceToNearestPlayer(const FVector& Location) const
+{
+	double NearestDistSq = TNumericLimits<double>::Max();
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		NearestDistSq = FMath::Min(NearestDistSq, FVector::DistSquared(Location, PlayerLocation));
+	}
+
+	return PlayerLocations.Num() > 0 ? (float)FMath::Sqrt(NearestDistSq) : MAX_flt;
+}
+
+// ============================================================================
+// Tier Pass
+// ============================================================================
+
+void UHarmoniaNetRelevancySubsystem::GatherPlayerLocations(UWorld& World)
+{
+	PlayerLocations.Reset();
+
+	for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->GetPawn())
+		{
+			PlayerLocations.Add(PC->GetPawn()->GetActorLocation());
+		}
+	}
+}
+
+void UHarmoniaNetRelevancySubsystem::RunTierPass(float PassDeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NetRelevancyTierPass);
+
+	RemoveStaleComponents();
+
+	const int32 NumComponents = Components.Num();
+	TieringInputs.SetNumUninitialized(NumComponents, EAllowShrinking::No);
+	TieringOutputs.SetNumUninitialized(NumComponents, EAllowShrinking::No);
+
+	// Gather on the game thread, the pass itself only touches the input and output arrays
+	for (int32 Index = 0; Index < NumComponents; ++Index)
+	{
+		const UHarmoniaNetworkOptimizationComponent* Component = Components[Index].Get();
+		const AActor* Owner = Component->GetOwner();
+
+		FTieringInput& Input = TieringInputs[Index];
+		Input.Location = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
+		Input.Config = &Component->Config;
+		Input.CurrentLevel = Component->CurrentLevel;
+		Input.bInCombat = Component->bIsInCombat;
+		Input.bSkip = !Owner || Component->bLevelForced;
+	}
+
+	ParallelFor(NumComponents, [this](int32 Index)
+	{
+		const FTieringInput& Input = TieringInputs[Index];
+		FTieringOutput& Output = TieringOutputs[Index];
+
+		Output.Distance = GetDistanceToNearestPlayer(Input.Location);
+		Output.Level = Input.bSkip ? Input.CurrentLevel : UHarmoniaNetworkOptimizationComponent::CalculateLevel(*Input.Config, Output.Distance, Input.CurrentLevel, Input.bInCombat);
+	}, NumComponents < MinComponentsForParallelTiering);
+
+	// Apply on the game thread, frequency and dormancy are only rewritten on a level change
+	TierTransitionsLastPass = 0;
+	for (int32 Index = 0; Index < NumComponents; ++Index)
+	{
+		UHarmoniaNetworkOptimizationComponent* Component = Components[Index].Get();
+		if (!Component || !Component->GetOwner())
+		{
+			continue;
+		}
+
+		// A forced level keeps its level, but a forced Dormant level still has to count down into dormancy
+		if (!TieringInputs[Index].bSkip && Component->SetLevel(TieringOutputs[Index].Level, TieringOutputs[Index].Distance))
+		{
+			++TierTransitionsLastPass;
+		}
+
+		Component->UpdateDormancyDelay(PassDeltaTime);
+	}
+}
+
+void UHarmoniaNetRelevancySubsystem::UpdateTransitionRate(float DeltaTime, int32 NumTransitions)
+{
+	TransitionWindowTime += DeltaTime;
+	TransitionsInWindow += NumTransitions;
+
+	if (TransitionWindowTime >= 1.0f)
+	{
+		TierTransitionsPerSecond = TransitionsInWindow / TransitionWindowTime;
+		TransitionWindowTime = 0.0f;
+		TransitionsInWindow = 0;
+	}
+
+	SET_FLOAT_STAT(STAT_NetTierTransitionsPerSecond, TierTransitionsPerSecond);
+}
@@ -0,0 +1,907 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaProjectileSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystem/HarmoniaAttributeSet.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "Kismet/GameplayStatics.h"
+#include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+
+DECLARE_CYCLE_STAT(TEXT("Projectile Subsystem Tick"), STAT_ProjectileSubsystemTick, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Projectiles"), STAT_ManagedProjectiles, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Projectile Sweeps"), STAT_ManagedProjectileSweeps, STATGROUP_Game);
+
+namespace HarmoniaProjectile
+{
+	// How long a stuck projectile stays before it is removed (matches AHarmoniaProjectile::StickToSurface)
+	static constexpr float StuckLifetime = 10.0f;
+
+	// Distance at which a returning boomerang is caught by its owner
+	static constexpr float BoomerangCatchDistance = 100.0f;
+
+	// Clients never fast forward a volley by more than this, older volleys start where they were fired
+	static constexpr float MaxClientCatchUpTime = 0.25f;
+
+	// Niagara array parameter receiving the projectile positions of a batched trail system
+	static const FName TrailPositionsParameterName(TEXT("ProjectilePositions"));
+
+	static const FTransform HiddenInstanceTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+}
+
+void UHarmoniaProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SweepObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	SweepObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	SweepObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	SweepDelegate.BindUObject(this, &UHarmoniaProjectileSubsystem::OnSweepCompleted);
+
+	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHarmoniaProjectileSubsystem::Tick),
+		0.0f // Tick every frame
+	);
+}
+
+void UHarmoniaProjectileSubsystem::Deinitialize()
+{
+	if (TickDelegateHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+		TickDelegateHandle.Reset();
+	}
+
+	SweepDelegate.Unbind();
+
+	Ids.Empty();
+	Positions.Empty();
+	PreviousPositions.Empty();
+	Velocities.Empty();
+	Ages.Empty();
+	ArchetypeIndices.Empty();
+	Flags.Empty();
+	RemainingPenetrations.Empty();
+	RemainingBounces.Empty();
+	MeshInstances.Empty();
+	HitActors.Empty();
+	StuckComponents.Empty();
+	StuckOffsets.Empty();
+	IdToIndex.Empty();
+
+	ArchetypeData.Empty();
+	Archetypes.Empty();
+	FreeArchetypes.Empty();
+	CompletedSweeps.Empty();
+
+	MeshBatchComponents.Empty();
+	MeshBatches.Empty();
+	MeshBatchIndices.Empty();
+	TrailBatchComponents.Empty();
+	TrailBatchPositions.Empty();
+	TrailBatchIndices.Empty();
+	VisualHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UHarmoniaProjectileSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ProjectileSubsystemTick);
+
+	UWorld* World = GetWorld();
+	if (!World || World->IsPaused() || (Ids.Num() == 0 && CompletedSweeps.Num() == 0))
+	{
+		return true;
+	}
+
+	// Follow world time (pause, time dilation) rather than the core ticker delta
+	const float WorldDeltaTime = World->GetDeltaSeconds();
+
+	ApplySweepResults();
+	Integrate(WorldDeltaTime);
+	RemovePendingKill();
+	SubmitSweeps();
+	UpdateVisuals();
+
+	SET_DWORD_STAT(STAT_ManagedProjectiles, Ids.Num());
+
+	return true;
+}
+
+// ============================================================================
+// Spawning
+// ============================================================================
+
+int32 UHarmoniaProjectileSubsystem::SpawnVolley(const FHarmoniaProjectileVolley& Volley, bool bAuthoritative)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0;
+	}
+
+	TArray<FVector, TInlineAllocator<16>> Directions;
+	BuildVolleyDirections(Volley, Directions);
+
+	// Clients receive the volley late, move it forward to where the server simulation is
+	float CatchUpTime = 0.0f;
+	if (!bAuthoritative)
+	{
+		if (const AGameStateBase* GameState = World->GetGameState())
+		{
+			CatchUpTime = FMath::Clamp(static_cast<float>(GameState->GetServerWorldTimeSeconds() - Volley.ServerSpawnTime), 0.0f, HarmoniaProjectile::MaxClientCatchUpTime);
+		}
+	}
+
+	const int32 ArchetypeIndex = AddArchetype(Volley.ProjectileData, Volley.Instigator, Volley.HomingTarget, Volley.DamageMultiplier, bAuthoritative);
+	const float InitialSpeed = ArchetypeData[ArchetypeIndex].InitialSpeed;
+	const FVector Gravity(0.0f, 0.0f, Archetypes[ArchetypeIndex].GravityZ);
+
+	for (const FVector& Direction : Directions)
+	{
+		const FVector LaunchVelocity = Direction * InitialSpeed;
+		const FVector Location = Volley.Origin + LaunchVelocity * CatchUpTime + 0.5f * Gravity * FMath::Square(CatchUpTime);
+		const int32 Index = IdToIndex.FindChecked(AddProjectile(ArchetypeIndex, Location, LaunchVelocity + Gravity * CatchUpTime, CatchUpTime));
+
+		// The skipped segment still has to stop at walls
+		if (CatchUpTime > 0.0f)
+		{
+			SubmitSweep(Index, Volley.Origin);
+		}
+	}
+
+	return Directions.Num();
+}
+
+int32 UHarmoniaProjectileSubsystem::SpawnProjectile(const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, const FVector& Location, const FVector& Direction, float DamageMultiplier, AActor* HomingTarget)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 ArchetypeIndex = AddArchetype(ProjectileData, InOwner, HomingTarget, DamageMultiplier, World->GetNetMode() != NM_Client);
+	const FVector Velocity = Direction.GetSafeNormal() * ArchetypeData[ArchetypeIndex].InitialSpeed;
+	return AddProjectile(ArchetypeIndex, Location, Velocity, 0.0f);
+}
+
+void UHarmoniaProjectileSubsystem::DestroyProjectile(int32 ProjectileId)
+{
+	// Removed during the next tick so the trail batch gets refreshed
+	if (const int32* Index = IdToIndex.Find(ProjectileId))
+	{
+		Flags[*Index] |= PF_PendingKill;
+	}
+}
+
+void UHarmoniaProjectileSubsystem::BuildVolleyDirections(const FHarmoniaProjectileVolley& Volley, TArray<FVector, TInlineAllocator<16>>& OutDirections)
+{
+	const int32 Count = FMath::Max<int32>(Volley.Count, 1);
+	const FVector BaseDirection = FVector(Volley.Direction).GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+	const float SpreadRadians = FMath::DegreesToRadians(FMath::Max(Volley.SpreadAngle, 0.0f));
+
+	OutDirections.Reset(Count);
+	OutDirections.Add(BaseDirection);
+
+	FRandomStream Stream(Volley.Seed);
+	for (int32 i = 1; i < Count; ++i)
+	{
+		OutDirections.Add(SpreadRadians > 0.0f ? Stream.VRandCone(BaseDirection, SpreadRadians) : BaseDirection);
+	}
+}
+
+int32 UHarmoniaProjectileSubsystem::AddArchetype(const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, AActor* HomingTarget, float DamageMultiplier, bool bAuthoritative)
+{
+	int32 ArchetypeIndex;
+	if (FreeArchetypes.Num() > 0)
+	{
+		ArchetypeIndex = FreeArchetypes.Pop(EAllowShrinking::No);
+		ArchetypeData[ArchetypeIndex] = ProjectileData;
+		Archetypes[ArchetypeIndex] = FArchetype();
+	}
+	else
+	{
+		ArchetypeIndex = Archetypes.AddDefaulted();
+		ArchetypeData.Add(ProjectileData);
+	}
+
+	FHarmoniaProjectileData& Data = ArchetypeData[ArchetypeIndex];
+	FArchetype& Archetype = Archetypes[ArchetypeIndex];
+	Archetype.Owner = InOwner;
+	Archetype.HomingTarget = HomingTarget;
+	Archetype.DamageMultiplier = DamageMultiplier;
+	Archetype.bAuthoritative = bAuthoritative;
+	Archetype.MaxSpeed = Data.MaxSpeed > 0.0f ? Data.MaxSpeed : Data.InitialSpeed;
+	Archetype.QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(HarmoniaProjectileSweep), false, InOwner);
+
+	// [ANTI-CHEAT] Same clamping as AHarmoniaProjectile::InitializeProjectile
+	if (bAuthoritative)
+	{
+		Archetype.DamageMultiplier = FMath::Clamp(Archetype.DamageMultiplier, 0.0f, 10.0f);
+		Data.DamageConfig.DamageMultiplier = FMath::Clamp(Data.DamageConfig.DamageMultiplier, 0.0f, 100.0f);
+		Data.DamageConfig.CriticalChance = FMath::Clamp(Data.DamageConfig.CriticalChance, 0.0f, 1.0f);
+		Data.DamageConfig.CriticalMultiplier = FMath::Clamp(Data.DamageConfig.CriticalMultiplier, 1.0f, 10.0f);
+	}
+
+	const float WorldGravityZ = GetWorld()->GetGravityZ();
+	switch (Data.MovementType)
+	{
+	case EHarmoniaProjectileMovement::Ballistic:
+		Archetype.GravityZ = WorldGravityZ * Data.GravityScale;
+		break;
+
+	case EHarmoniaProjectileMovement::Parabolic:
+		Archetype.GravityZ = WorldGravityZ * Data.GravityScale * 0.5f;
+		break;
+
+	default:
+		break;
+	}
+
+	if (ShouldRenderVisuals())
+	{
+		if (Data.ProjectileMesh)
+		{
+			Archetype.MeshBatch = FindOrAddMeshBatch(Data.ProjectileMesh);
+		}
+
+		if (Data.BatchedTrailSystem)
+		{
+			Archetype.TrailBatch = FindOrAddTrailBatch(Data.BatchedTrailSystem);
+		}
+	}
+
+	return ArchetypeIndex;
+}
+
+void UHarmoniaProjectileSubsystem::ReleaseArchetype(int32 ArchetypeIndex)
+{
+	FArchetype& Archetype = Archetypes[ArchetypeIndex];
+	if (--Archetype.NumProjectiles > 0)
+	{
+		return;
+	}
+
+	Archetype = FArchetype();
+	ArchetypeData[ArchetypeIndex] = FHarmoniaProjectileData();
+	FreeArchetypes.Add(ArchetypeIndex);
+}
+
+int32 UHarmoniaProjectileSubsystem::AddProjectile(int32 ArchetypeIndex, const FVector& Location, const FVector& Velocity, float InitialAge)
+{
+	const FHarmoniaProjectileData& Data = ArchetypeData[ArchetypeIndex];
+	FArchetype& Archetype = Archetypes[ArchetypeIndex];
+
+	const int32 Id = NextProjectileId;
+	NextProjectileId = NextProjectileId == MAX_int32 ? 1 : NextProjectileId + 1;
+
+	const int32 Index = Ids.Add(Id);
+	Positions.Add(Location);
+	PreviousPositions.Add(Location);
+	Velocities.Add(Velocity);
+	Ages.Add(InitialAge);
+	ArchetypeIndices.Add(ArchetypeIndex);
+	Flags.Add(PF_None);
+	RemainingPenetrations.Add(static_cast<int16>(FMath::Clamp(Data.PenetrationCount, 0, MAX_int16)));
+	RemainingBounces.Add(static_cast<int16>(FMath::Clamp(Data.BounceCount, 0, MAX_int16)));
+	MeshInstances.Add(Archetype.MeshBatch != INDEX_NONE ? AllocateMeshInstance(Archetype.MeshBatch) : INDEX_NONE);
+	HitActors.AddDefaulted();
+	StuckComponents.AddDefaulted();
+	StuckOffsets.Add(FVector::ZeroVector);
+
+	IdToIndex.Add(Id, Index);
+	++Archetype.NumProjectiles;
+
+	return Id;
+}
+
+void UHarmoniaProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	const int32 ArchetypeIndex = ArchetypeIndices[Index];
+	if (MeshInstances[Index] != INDEX_NONE)
+	{
+		FreeMeshInstance(Archetypes[ArchetypeIndex].MeshBatch, MeshInstances[Index]);
+	}
+	ReleaseArchetype(ArchetypeIndex);
+	IdToIndex.Remove(Ids[Index]);
+
+	Ids.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PreviousPositions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Ages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ArchetypeIndices.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Flags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingPenetrations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingBounces.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MeshInstances.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HitActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StuckOffsets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Index < Ids.Num())
+	{
+		IdToIndex[Ids[Index]] = Index;
+	}
+}
+
+void UHarmoniaProjectileSubsystem::RemovePendingKill()
+{
+	// Backwards so the entry swapped into Index has already been visited
+	for (int32 Index = Ids.Num() - 1; Index >= 0; --Index)
+	{
+		if (Flags[Index] & PF_PendingKill)
+		{
+			RemoveProjectileAt(Index);
+		}
+	}
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+void UHarmoniaProjectileSubsystem::ApplySweepResults()
+{
+	for (FSweepResult& Result : CompletedSweeps)
+	{
+		const int32* Index = IdToIndex.Find(Result.ProjectileId);
+		if (Index && !(Flags[*Index] & (PF_PendingKill | PF_Stuck)))
+		{
+			ProcessHits(*Index, Result.Hits);
+		}
+	}
+
+	CompletedSweeps.Reset();
+}
+
+void UHarmoniaProjectileSubsystem::ProcessHits(int32 Index, TArrayView<FHitResult> Hits)
+{
+	const int32 ArchetypeIndex = ArchetypeIndices[Index];
+	const FHarmoniaProjectileData& Data = ArchetypeData[ArchetypeIndex];
+	const FArchetype& Archetype = Archetypes[ArchetypeIndex];
+	AActor* ProjectileOwner = Archetype.Owner.Get();
+
+	Hits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+
+	for (const FHitResult& Hit : Hits)
+	{
+		AActor* HitActor = Hit.GetActor();
+		if (HitActor && (HitActor == ProjectileOwner || HitActors[Index].Contains(HitActor)))
+		{
+			continue;
+		}
+
+		if (HitActor)
+		{
+			HitActors[Index].Add(HitActor);
+		}
+
+		if (Archetype.bAuthoritative && HitActor)
+		{
+			OnProjectileHit.Broadcast(HitActor, Hit, Data);
+			ApplyProjectileDamage(Data, ProjectileOwner, this, HitActor, Hit, Archetype.DamageMultiplier, Data.PenetrationCount - RemainingPenetrations[Index]);
+		}
+
+		SpawnImpactEffects(Data, Hit);
+
+		// Continue through target
+		if (RemainingPenetrations[Index] > 0)
+		{
+			--RemainingPenetrations[Index];
+			continue;
+		}
+
+		if (RemainingBounces[Index] > 0)
+		{
+			--RemainingBounces[Index];
+
+			FVector& Velocity = Velocities[Index];
+			const FVector IncomingDirection = Velocity.GetSafeNormal();
+			const FVector BounceDirection = IncomingDirection - 2.0f * (IncomingDirection | Hit.ImpactNormal) * Hit.ImpactNormal;
+			Velocity = BounceDirection * Velocity.Size() * Data.BounceVelocityRetention;
+			Positions[Index] = Hit.Location + Hit.ImpactNormal;
+			return;
+		}
+
+		if (Data.bStickToSurfaces)
+		{
+			Flags[Index] |= PF_Stuck;
+			Ages[Index] = 0.0f;
+			Positions[Index] = Hit.Location;
+
+			// Follow moving surfaces (pawns, doors), static geometry keeps the world position
+			USceneComponent* HitComponent = Hit.GetComponent();
+			if (HitComponent && HitComponent->Mobility == EComponentMobility::Movable)
+			{
+				StuckComponents[Index] = HitComponent;
+				StuckOffsets[Index] = HitComponent->GetComponentTransform().InverseTransformPosition(Hit.Location);
+			}
+			return;
+		}
+
+		if (Data.bExplodeOnImpact && Archetype.bAuthoritative)
+		{
+			OnProjectileExplode.Broadcast(Hit.ImpactPoint, Data);
+			ApplyProjectileExplosion(GetWorld(), Data, ProjectileOwner, this, Hit.ImpactPoint, Archetype.DamageMultiplier, Data.PenetrationCount - RemainingPenetrations[Index]);
+		}
+
+		Flags[Index] |= PF_PendingKill;
+		return;
+	}
+}
+
+void UHarmoniaProjectileSubsystem::Integrate(float DeltaTime)
+{
+	const int32 NumProjectiles = Ids.Num();
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		uint8& ProjectileFlags = Flags[Index];
+		if (ProjectileFlags & PF_PendingKill)
+		{
+			continue;
+		}
+
+		const int32 ArchetypeIndex = ArchetypeIndices[Index];
+		const FHarmoniaProjectileData& Data = ArchetypeData[ArchetypeIndex];
+		const FArchetype& Archetype = Archetypes[ArchetypeIndex];
+
+		float& Age = Ages[Index];
+		Age += DeltaTime;
+
+		if (ProjectileFlags & PF_Stuck)
+		{
+			const TWeakObjectPtr<USceneComponent>& StuckComponent = StuckComponents[Index];
+			if (Age >= HarmoniaProjectile::StuckLifetime || (!StuckComponent.IsExplicitlyNull() && !StuckComponent.IsValid()))
+			{
+				ProjectileFlags |= PF_PendingKill;
+			}
+			else if (USceneComponent* Component = StuckComponent.Get())
+			{
+				Positions[Index] = Component->GetComponentTransform().TransformPosition(StuckOffsets[Index]);
+			}
+			continue;
+		}
+
+		if (Data.Lifetime > 0.0f && Age >= Data.Lifetime)
+		{
+			ProjectileFlags |= PF_PendingKill;
+			continue;
+		}
+
+		FVector& Position = Positions[Index];
+		FVector& Velocity = Velocities[Index];
+		PreviousPositions[Index] = Position;
+
+		switch (Data.MovementType)
+		{
+		case EHarmoniaProjectileMovement::Homing:
+			if (const AActor* Target = Archetype.HomingTarget.Get())
+			{
+				Velocity += (Target->GetActorLocation() - Position).GetSafeNormal() * Data.HomingAcceleration * DeltaTime;
+				Velocity = Velocity.GetClampedToMaxSize(Archetype.MaxSpeed);
+			}
+			break;
+
+		case EHarmoniaProjectileMovement::Boomerang:
+			// Outward for half of the lifetime, then back to the owner
+			if (!(ProjectileFlags & PF_Returning) && Age >= Data.Lifetime * 0.5f)
+			{
+				ProjectileFlags |= PF_Returning;
+			}
+
+			if (ProjectileFlags & PF_Returning)
+			{
+				const AActor* ProjectileOwner = Archetype.Owner.Get();
+				const FVector ToOwner = ProjectileOwner ? ProjectileOwner->GetActorLocation() - Position : FVector::ZeroVector;
+				const float DistanceToOwner = ToOwner.Size();
+				if (DistanceToOwner < HarmoniaProjectile::BoomerangCatchDistance)
+				{
+					ProjectileFlags |= PF_PendingKill;
+					continue;
+				}
+
+				Velocity = ToOwner / DistanceToOwner * Data.InitialSpeed;
+			}
+			break;
+
+		default:
+			Velocity.Z += Archetype.GravityZ * DeltaTime;
+			break;
+		}
+
+		Position += Velocity * DeltaTime;
+	}
+}
+
+void UHarmoniaProjectileSubsystem::SubmitSweeps()
+{
+	NumSweepsLastFrame = 0;
+
+	const int32 NumProjectiles = Ids.Num();
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		if (!(Flags[Index] & PF_Stuck))
+		{
+			SubmitSweep(Index, PreviousPositions[Index]);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_ManagedProjectileSweeps, NumSweepsLastFrame);
+}
+
+void UHarmoniaProjectileSubsystem::SubmitSweep(int32 Index, const FVector& Start)
+{
+	const FVector& End = Positions[Index];
+	if (Start.Equals(End))
+	{
+		return;
+	}
+
+	const int32 ArchetypeIndex = ArchetypeIndices[Index];
+	const FCollisionShape Shape = FCollisionShape::MakeSphere(ArchetypeData[ArchetypeIndex].CollisionRadius);
+
+	// Results arrive through OnSweepCompleted once the world has run this frame's async traces
+	GetWorld()->AsyncSweepByObjectType(EAsyncTraceType::Multi, Start, End, FQuat::Identity, SweepObjectParams, Shape,
+		Archetypes[ArchetypeIndex].QueryParams, &SweepDelegate, static_cast<uint32>(Ids[Index]));
+	++NumSweepsLastFrame;
+}
+
+void UHarmoniaProjectileSubsystem::OnSweepCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (Datum.OutHits.Num() == 0)
+	{
+		return;
+	}
+
+	FSweepResult& Result = CompletedSweeps.AddDefaulted_GetRef();
+	Result.ProjectileId = static_cast<int32>(Datum.UserData);
+	Result.Hits.Append(Datum.OutHits);
+}
+
+// ============================================================================
+// Damage
+// ============================================================================
+
+void UHarmoniaProjectileSubsystem::ApplyProjectileDamage(const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, UObject* SourceObject, AActor* Target, const FHitResult& HitResult, float DamageMultiplier, int32 PenetrationsUsed, float DamageScale)
+{
+	if (!Target || !InOwner)
+	{
+		return;
+	}
+
+	// Get ability system component from owner
+	UAbilitySystemComponent* OwnerASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(InOwner);
+	if (!OwnerASC)
+	{
+		return;
+	}
+
+	// Get target ability system component
+	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Target);
+	if (!TargetASC)
+	{
+		return;
+	}
+
+	// Calculate final damage using AttackPower from attributes as base
+	float BaseDamage = 0.0f;
+	float CriticalChance = ProjectileData.DamageConfig.CriticalChance;
+	float CriticalMultiplier = ProjectileData.DamageConfig.CriticalMultiplier;
+
+	if (const UHarmoniaAttributeSet* CombatSet = OwnerASC->GetSet<UHarmoniaAttributeSet>())
+	{
+		BaseDamage = CombatSet->GetAttackPower();
+		// Use attribute values if available
+		CriticalChance = CombatSet->GetCriticalChance();
+		CriticalMultiplier = CombatSet->GetCriticalDamage();
+	}
+
+	float FinalDamage = BaseDamage * ProjectileData.DamageConfig.DamageMultiplier * DamageMultiplier * DamageScale;
+
+	// Apply critical hit
+	if (ProjectileData.DamageConfig.bCanCritical && FMath::FRand() < CriticalChance)
+	{
+		FinalDamage *= CriticalMultiplier;
+	}
+
+	// Apply penetration damage falloff
+	if (PenetrationsUsed > 0)
+	{
+		FinalDamage *= FMath::Pow(ProjectileData.PenetrationDamageFalloff, PenetrationsUsed);
+	}
+
+	// Create gameplay effect context
+	FGameplayEffectContextHandle EffectContext = OwnerASC->MakeEffectContext();
+	EffectContext.AddSourceObject(SourceObject);
+	EffectContext.AddInstigator(InOwner, InOwner);
+	EffectContext.AddHitResult(HitResult);
+
+	// Apply damage via gameplay effect
+	if (ProjectileData.DamageConfig.DamageEffectClass)
+	{
+		FGameplayEffectSpecHandle SpecHandle = OwnerASC->MakeOutgoingSpec(ProjectileData.DamageConfig.DamageEffectClass, 1.0f, EffectContext);
+		if (SpecHandle.IsValid())
+		{
+			// Set damage magnitude using configured SetByCaller tag
+			if (ProjectileData.DamageConfig.SetByCallerDamageTag.IsValid())
+			{
+				SpecHandle.Data->SetSetByCallerMagnitude(ProjectileData.DamageConfig.SetByCallerDamageTag, FinalDamage);
+			}
+
+			// Add damage tags
+			SpecHandle.Data->DynamicGrantedTags.AppendTags(ProjectileData.DamageConfig.DamageTags);
+
+			// Apply effect to target
+			OwnerASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+		}
+	}
+
+	// Apply additional effects
+	for (const TSubclassOf<UGameplayEffect>& AdditionalEffect : ProjectileData.DamageConfig.AdditionalEffects)
+	{
+		if (AdditionalEffect)
+		{
+			FGameplayEffectSpecHandle SpecHandle = OwnerASC->MakeOutgoingSpec(AdditionalEffect, 1.0f, EffectContext);
+			if (SpecHandle.IsValid())
+			{
+				OwnerASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+			}
+		}
+	}
+
+	// Trigger gameplay cue
+	if (ProjectileData.ImpactGameplayCueTag.IsValid())
+	{
+		AActor* SourceActor = Cast<AActor>(SourceObject);
+
+		FGameplayCueParameters CueParams;
+		CueParams.Location = HitResult.ImpactPoint;
+		CueParams.Normal = HitResult.ImpactNormal;
+		CueParams.PhysicalMaterial = HitResult.PhysMaterial;
+		CueParams.Instigator = InOwner;
+		CueParams.EffectCauser = SourceActor ? SourceActor : InOwner;
+
+		TargetASC->ExecuteGameplayCue(ProjectileData.ImpactGameplayCueTag, CueParams);
+	}
+}
+
+void UHarmoniaProjectileSubsystem::ApplyProjectileExplosion(UWorld* World, const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, UObject* SourceObject, const FVector& Location, float DamageMultiplier, int32 PenetrationsUsed)
+{
+	if (!World || ProjectileData.ExplosionRadius <= 0.0f)
+	{
+		return;
+	}
+
+	TArray<FOverlapResult> OverlapResults;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(HarmoniaProjectileExplosion), false, InOwner);
+	if (AActor* SourceActor = Cast<AActor>(SourceObject))
+	{
+		QueryParams.AddIgnoredActor(SourceActor);
+	}
+
+	World->OverlapMultiByChannel(
+		OverlapResults,
+		Location,
+		FQuat::Identity,
+		ECC_Pawn,
+		FCollisionShape::MakeSphere(ProjectileData.ExplosionRadius),
+		QueryParams
+	);
+
+	for (const FOverlapResult& Overlap : OverlapResults)
+	{
+		if (AActor* HitActor = Overlap.GetActor())
+		{
+			// Calculate distance falloff
+			const float Distance = FVector::Dist(Location, HitActor->GetActorLocation());
+			float DamageFalloff = 1.0f - FMath::Pow(Distance / ProjectileData.ExplosionRadius, ProjectileData.DamageConfig.ExplosionFalloff);
+			DamageFalloff = FMath::Clamp(DamageFalloff, 0.0f, 1.0f);
+
+			FHitResult HitResult;
+			HitResult.ImpactPoint = HitActor->GetActorLocation();
+			HitResult.Location = HitActor->GetActorLocation();
+			HitResult.HitObjectHandle = FActorInstanceHandle(HitActor);
+
+			ApplyProjectileDamage(ProjectileData, InOwner, SourceObject, HitActor, HitResult, DamageMultiplier, PenetrationsUsed, DamageFalloff);
+		}
+	}
+}
+
+// ============================================================================
+// Visuals
+// ============================================================================
+
+bool UHarmoniaProjectileSubsystem::ShouldRenderVisuals() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UHarmoniaProjectileSubsystem::SpawnImpactEffects(const FHarmoniaProjectileData& ProjectileData, const FHitResult& Hit) const
+{
+	if (!ShouldRenderVisuals())
+	{
+		return;
+	}
+
+	if (ProjectileData.ImpactEffect)
+	{
+		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ProjectileData.ImpactEffect, Hit.ImpactPoint, Hit.ImpactNormal.Rotation());
+	}
+
+	if (ProjectileData.ImpactSound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(GetWorld(), ProjectileData.ImpactSound, Hit.ImpactPoint);
+	}
+}
+
+void UHarmoniaProjectileSubsystem::UpdateVisuals()
+{
+	if (!ShouldRenderVisuals() || (MeshBatches.Num() == 0 && TrailBatchPositions.Num() == 0))
+	{
+		return;
+	}
+
+	for (TArray<FVector>& TrailPositions : TrailBatchPositions)
+	{
+		TrailPositions.Reset();
+	}
+
+	const int32 NumProjectiles = Ids.Num();
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		const FArchetype& Archetype = Archetypes[ArchetypeIndices[Index]];
+
+		if (MeshInstances[Index] != INDEX_NONE)
+		{
+			FMeshBatch& Batch = MeshBatches[Archetype.MeshBatch];
+			const FVector& Velocity = Velocities[Index];
+			const FQuat Rotation = Velocity.IsNearlyZero() ? Batch.Transforms[MeshInstances[Index]].GetRotation() : Velocity.ToOrientationQuat();
+			Batch.Transforms[MeshInstances[Index]] = FTransform(Rotation, Positions[Index]);
+			Batch.bDirty = true;
+		}
+
+		if (Archetype.TrailBatch != INDEX_NONE)
+		{
+			TrailBatchPositions[Archetype.TrailBatch].Add(Positions[Index]);
+		}
+	}
+
+	for (int32 BatchIndex = 0; BatchIndex < MeshBatches.Num(); ++BatchIndex)
+	{
+		FMeshBatch& Batch = MeshBatches[BatchIndex];
+		UInstancedStaticMeshComponent* Component = MeshBatchComponents[BatchIndex];
+		if (Batch.bDirty && Component)
+		{
+			Component->BatchUpdateInstancesTransforms(0, Batch.Transforms, true, true, true);
+			Batch.bDirty = false;
+		}
+	}
+
+	for (int32 BatchIndex = 0; BatchIndex < TrailBatchPositions.Num(); ++BatchIndex)
+	{
+		if (UNiagaraComponent* Component = TrailBatchComponents[BatchIndex])
+		{
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(Component, HarmoniaProjectile::TrailPositionsParameterName, TrailBatchPositions[BatchIndex]);
+		}
+	}
+}
+
+AActor* UHarmoniaProjectileSubsystem::GetOrCreateVisualHost()
+{
+	if (VisualHost)
+	{
+		return VisualHost;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	VisualHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (VisualHost)
+	{
+		USceneComponent* Root = NewObject<USceneComponent>(VisualHost, TEXT("Root"));
+		Root->SetMobility(EComponentMobility::Static);
+		VisualHost->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	return VisualHost;
+}
+
+int32 UHarmoniaProjectileSubsystem::FindOrAddMeshBatch(UStaticMesh* Mesh)
+{
+	if (const int32* Existing = MeshBatchIndices.Find(Mesh))
+	{
+		return *Existing;
+	}
+
+	AActor* Host = GetOrCreateVisualHost();
+	if (!Host)
+	{
+		return INDEX_NONE;
+	}
+
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(Host, NAME_None, RF_Transient);
+	Component->SetStaticMesh(Mesh);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetCanEverAffectNavigation(false);
+	Component->RegisterComponent();
+	Host->AddInstanceComponent(Component);
+
+	const int32 BatchIndex = MeshBatchComponents.Add(Component);
+	MeshBatches.AddDefaulted();
+	MeshBatchIndices.Add(Mesh, BatchIndex);
+	return BatchIndex;
+}
+
+int32 UHarmoniaProjectileSubsystem::FindOrAddTrailBatch(UNiagaraSystem* System)
+{
+	if (const int32* Existing = TrailBatchIndices.Find(System))
+	{
+		return *Existing;
+	}
+
+	AActor* Host = GetOrCreateVisualHost();
+	if (!Host)
+	{
+		return INDEX_NONE;
+	}
+
+	UNiagaraComponent* Component = NewObject<UNiagaraComponent>(Host, NAME_None, RF_Transient);
+	Component->SetAsset(System);
+	Component->SetAutoDestroy(false);
+	Component->RegisterComponent();
+	Host->AddInstanceComponent(Component);
+	Component->Activate(true);
+
+	const int32 BatchIndex = TrailBatchComponents.Add(Component);
+	TrailBatchPositions.AddDefaulted();
+	TrailBatchIndices.Add(System, BatchIndex);
+	return BatchIndex;
+}
+
+int32 UHarmoniaProjectileSubsystem::AllocateMeshInstance(int32 BatchIndex)
+{
+	FMeshBatch& Batch = MeshBatches[BatchIndex];
+	if (Batch.FreeInstances.Num() > 0)
+	{
+		return Batch.FreeInstances.Pop(EAllowShrinking::No);
+	}
+
+	UInstancedStaticMeshComponent* Component = MeshBatchComponents[BatchIndex];
+	if (!Component)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 InstanceIndex = Component->AddInstance(HarmoniaProjectile::HiddenInstanceTransform, true);
+	Batch.Transforms.Add(HarmoniaProjectile::HiddenInstanceTransform);
+	check(Batch.Transforms.Num() == InstanceIndex + 1);
+	return InstanceIndex;
+}
+
+void UHarmoniaProjectileSubsystem::FreeMeshInstance(int32 BatchIndex, int32 InstanceIndex)
+{
+	// Instances are never removed (that would reorder the indices), only hidden until reused
+	FMeshBatch& Batch = MeshBatches[BatchIndex];
+	Batch.Transforms[InstanceIndex] = HarmoniaProjectile::HiddenInstanceTransform;
+	Batch.FreeInstances.Add(InstanceIndex);
+	Batch.bDirty = true;
+}
@@ -10,6 +10,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "HarmoniaLoadManager.h"
 #include "Containers/Ticker.h"
+#include "System/HarmoniaAssetResolverSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHarmoniaSoundCache, Log, All);
 
@@ -21,13 +22,17 @@ void UHarmoniaSoundCacheSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 
 	if (bPreloadAllSounds)
 	{
-		LoadAndCacheSounds();
+		LoadAndCacheSounds(bLoadTablesAsync);
 
 		if (bPreloadAssets)
 		{
-			PreloadSoundAssets(false);
+			CallOrRegister_OnCacheReady(FSimpleDelegate::CreateUObject(this, &ThisClass::PreloadSoundAssets, bLoadTablesAsync));
 		}
 	}
+	else
+	{
+		bCacheReady = true;
+	}
 
 	// Register tick for looping sound management
 	CleanupTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime) -> bool
@@ -36,7 +41,7 @@ void UHarmoniaSoundCacheSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 		return true;
 	}), 0.1f);
 
-	UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Sound Cache initialized with %d sounds"), SoundCache.Num());
+	UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Sound Cache initialized (%s)"), bCacheReady ? TEXT("ready") : TEXT("loading"));
 }
 
 void UHarmoniaSoundCacheSubsystem::Deinitialize()
@@ -98,7 +103,11 @@ const FHarmoniaSoundData* UHarmoniaSoundCacheSubsystem::GetSoundDataLazy(FGamepl
 			return SoundCache.Find(SoundTag);
 		}
 
-		FailedLoadTags.Add(SoundTag);
+		// Tables may still be streaming in, only remember misses once the cache is complete
+		if (bCacheReady)
+		{
+			FailedLoadTags.Add(SoundTag);
+		}
 	}
 
 	return nullptr;
@@ -328,16 +337,40 @@ void UHarmoniaSoundCacheSubsystem::ReloadSoundCache()
 	UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Reloading sound cache..."));
 
 	ClearCache();
-	LoadAndCacheSounds();
+	LoadAndCacheSounds(false);
 
 	UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Sound cache reloaded with %d sounds"), SoundCache.Num());
 }
 
 void UHarmoniaSoundCacheSubsystem::ClearCache()
 {
+	// Drop any startup load or worker build still in flight, an empty cache counts as ready
+	if (TablesHandle.IsValid())
+	{
+		TablesHandle->CancelHandle();
+		TablesHandle.Reset();
+	}
+	++CacheBuildSerial;
+
 	SoundCache.Empty();
 	LoadedDataTables.Empty();
 	FailedLoadTags.Empty();
+
+	bCacheReady = true;
+	OnCacheReady.Broadcast();
+	OnCacheReady.Clear();
+}
+
+void UHarmoniaSoundCacheSubsystem::CallOrRegister_OnCacheReady(FSimpleDelegate&& Delegate)
+{
+	if (bCacheReady)
+	{
+		Delegate.ExecuteIfBound();
+	}
+	else
+	{
+		OnCacheReady.Add(MoveTemp(Delegate));
+	}
 }
 
 void UHarmoniaSoundCacheSubsystem::PreloadSoundAssets(bool bAsync)
@@ -376,39 +409,68 @@ void UHarmoniaSoundCacheSubsystem::PreloadSoundAssets(bool bAsync)
 	}
 }
 
-void UHarmoniaSoundCacheSubsystem::LoadAndCacheSounds()
+void UHarmoniaSoundCacheSubsystem::LoadAndCacheSounds(bool bAsync)
 {
-	int32 TotalSoundsLoaded = 0;
+	bCacheReady = false;
+	++CacheBuildSerial;
 
-	// 1. HarmoniaLoadManager에서 Sound 테이블 로드 시도
+	TArray<FSoftObjectPath> TablePaths;
+
+	// 1. HarmoniaLoadManager의 Sound 테이블
 	if (UHarmoniaLoadManager* LoadManager = UHarmoniaLoadManager::Get())
 	{
-		UDataTable* SoundDataTable = LoadManager->GetDataTableByKey(TEXT("Sound"));
-		if (SoundDataTable)
+		const FSoftObjectPath SoundTablePath = LoadManager->GetDataTablePath(TEXT("Sound"));
+		if (!SoundTablePath.IsNull())
 		{
-			if (SoundDataTable->GetRowStruct() == FHarmoniaSoundData::StaticStruct())
-			{
-				int32 SoundsLoaded = LoadSoundsFromDataTable(SoundDataTable);
-				TotalSoundsLoaded += SoundsLoaded;
-				LoadedDataTables.Add(SoundDataTable);
-				UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Loaded %d sounds from LoadManager DataTable: %s"),
-					SoundsLoaded, *SoundDataTable->GetName());
-			}
-			else
-			{
-				UE_LOG(LogHarmoniaSoundCache, Warning, TEXT("Sound DataTable from LoadManager has wrong row structure"));
-			}
+			TablePaths.Add(SoundTablePath);
 		}
 	}
 
-	// 2. Config 경로에서 추가 테이블 로드 (폴백/추가 테이블용)
+	// 2. Config 경로의 추가 테이블 (폴백/추가 테이블용)
 	for (const FSoftObjectPath& TablePath : SoundDataTablePaths)
 	{
-		if (TablePath.IsNull())
+		if (!TablePath.IsNull())
 		{
-			continue;
+			TablePaths.AddUnique(TablePath);
+		}
+	}
+
+	if (TablePaths.Num() > 0 && UAssetManager::IsInitialized())
+	{
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		if (bAsync)
+		{
+			// All tables in one request, so their packages load in parallel
+			TablesHandle = StreamableManager.RequestAsyncLoad(TablePaths,
+				FStreamableDelegate::CreateUObject(this, &ThisClass::HandleSoundTablesLoaded, TablePaths, true, CacheBuildSerial));
+			if (TablesHandle.IsValid() && TablesHandle->IsLoadingInProgress())
+			{
+				return;
+			}
+		}
+		else
+		{
+			StreamableManager.RequestSyncLoad(TablePaths);
 		}
+	}
+
+	HandleSoundTablesLoaded(MoveTemp(TablePaths), bAsync, CacheBuildSerial);
+}
+
+void UHarmoniaSoundCacheSubsystem::HandleSoundTablesLoaded(TArray<FSoftObjectPath> TablePaths, bool bAsync, int32 BuildSerial)
+{
+	if (bCacheReady || BuildSerial != CacheBuildSerial || BuildSerial == TablesLoadedSerial)
+	{
+		return;
+	}
+	TablesLoadedSerial = BuildSerial;
+
+	// LoadedDataTables keeps the tables alive from here on
+	TablesHandle.Reset();
 
+	TArray<UDataTable*> Tables;
+	for (const FSoftObjectPath& TablePath : TablePaths)
+	{
 		UDataTable* DataTable = Cast<UDataTable>(TablePath.TryLoad());
 		if (!DataTable)
 		{
@@ -422,32 +484,70 @@ void UHarmoniaSoundCacheSubsystem::LoadAndCacheSounds()
 			continue;
 		}
 
-		// 이미 LoadManager에서 로드했으면 스킵
-		if (LoadedDataTables.Contains(DataTable))
+		if (!LoadedDataTables.Contains(DataTable))
 		{
-			continue;
+			LoadedDataTables.Add(DataTable);
+			Tables.Add(DataTable);
 		}
+	}
 
-		int32 SoundsLoaded = LoadSoundsFromDataTable(DataTable);
-		TotalSoundsLoaded += SoundsLoaded;
-
-		LoadedDataTables.Add(DataTable);
+	auto BuildCache = [](const TArray<const UDataTable*>& BuildTables, TMap<FGameplayTag, FHarmoniaSoundData>& OutCache)
+	{
+		for (const UDataTable* DataTable : BuildTables)
+		{
+			const int32 SoundsLoaded = LoadSoundsFromDataTable(DataTable, OutCache);
+			UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Loaded %d sounds from DataTable: %s"), SoundsLoaded, *DataTable->GetName());
+		}
+	};
 
-		UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Loaded %d sounds from DataTable: %s"),
-			SoundsLoaded, *DataTable->GetName());
+	if (bAsync)
+	{
+		UHarmoniaLoadManager::BuildTableCacheAsync<TMap<FGameplayTag, FHarmoniaSoundData>>(Tables, MoveTemp(BuildCache),
+			[WeakThis = TWeakObjectPtr<ThisClass>(this), BuildSerial](TMap<FGameplayTag, FHarmoniaSoundData>&& BuiltCache)
+			{
+				ThisClass* This = WeakThis.Get();
+				if (This && This->CacheBuildSerial == BuildSerial)
+				{
+					This->HandleSoundCacheBuilt(MoveTemp(BuiltCache));
+				}
+			});
 	}
+	else
+	{
+		TMap<FGameplayTag, FHarmoniaSoundData> BuiltCache;
+		BuildCache(TArray<const UDataTable*>(Tables), BuiltCache);
+		HandleSoundCacheBuilt(MoveTemp(BuiltCache));
+	}
+}
+
+void UHarmoniaSoundCacheSubsystem::HandleSoundCacheBuilt(TMap<FGameplayTag, FHarmoniaSoundData>&& BuiltCache)
+{
+	// Rows lazily added while the cache was building come from the same tables
+	SoundCache.Append(MoveTemp(BuiltCache));
+	bCacheReady = true;
 
-	if (TotalSoundsLoaded == 0)
+	if (SoundCache.Num() == 0)
 	{
 		UE_LOG(LogHarmoniaSoundCache, Warning, TEXT("No sounds loaded. Check HarmoniaLoadManager registry or SoundDataTablePaths config."));
 	}
 	else
 	{
-		UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Total sounds loaded: %d"), TotalSoundsLoaded);
+		UE_LOG(LogHarmoniaSoundCache, Log, TEXT("Total sounds loaded: %d"), SoundCache.Num());
 	}
+
+	OnCacheReady.Broadcast();
+	OnCacheReady.Clear();
 }
 
-int32 UHarmoniaSoundCacheSubsystem::LoadSoundsFromDataTable(UDataTable* DataTable)
+void UHarmoniaSoundCacheSubsystem::FlushPendingTableLoad()
+{
+	if (TablesHandle.IsValid() && TablesHandle->IsLoadingInProgress())
+	{
+		TablesHandle->WaitUntilComplete();
+	}
+}
+
+int32 UHarmoniaSoundCacheSubsystem::LoadSoundsFromDataTable(const UDataTable* DataTable, TMap<FGameplayTag, FHarmoniaSoundData>& OutCache)
 {
 	if (!DataTable)
 	{
@@ -466,12 +566,12 @@ int32 UHarmoniaSoundCacheSubsystem::LoadSoundsFromDataTable(UDataTable* DataTabl
 			continue;
 		}
 
-		if (SoundCache.Contains(RowData->SoundTag))
+		if (OutCache.Contains(RowData->SoundTag))
 		{
 			UE_LOG(LogHarmoniaSoundCache, Warning, TEXT("Duplicate sound tag found: %s"), *RowData->SoundTag.ToString());
 		}
 
-		SoundCache.Add(RowData->SoundTag, *RowData);
+		OutCache.Add(RowData->SoundTag, *RowData);
 		SoundsLoaded++;
 	}
 
@@ -485,6 +585,8 @@ bool UHarmoniaSoundCacheSubsystem::LoadSoundFromDataTables(FGameplayTag SoundTag
 		return false;
 	}
 
+	FlushPendingTableLoad();
+
 	for (UDataTable* DataTable : LoadedDataTables)
 	{
 		if (!DataTable)
@@ -512,9 +614,40 @@ USoundBase* UHarmoniaSoundCacheSubsystem::GetSoundBaseFromData(const FHarmoniaSo
 		return nullptr;
 	}
 
+	// Sounds play immediately or not at all, so a sound that was not preloaded is still loaded here (and reported)
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = GetGameInstance()->GetSubsystem<UHarmoniaAssetResolverSubsystem>())
+	{
+		return AssetResolver->ResolveSync(SoundData->SoundCue, TEXT("GetSoundBaseFromData"));
+	}
+
 	return SoundData->SoundCue.LoadSynchronous();
 }
 
+void UHarmoniaSoundCacheSubsystem::PreloadSoundsByTag(FGameplayTag ParentTag)
+{
+	UHarmoniaAssetResolverSubsystem* AssetResolver = GetGameInstance()->GetSubsystem<UHarmoniaAssetResolverSubsystem>();
+	if (!AssetResolver || !ParentTag.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const FHarmoniaSoundData& SoundData : GetSoundsByTag(ParentTag, false))
+	{
+		AssetsToLoad.Add(SoundData.SoundCue.ToSoftObjectPath());
+	}
+
+	AssetResolver->PreloadByTag(this, ParentTag, AssetsToLoad);
+}
+
+void UHarmoniaSoundCacheSubsystem::ReleaseSoundsByTag(FGameplayTag ParentTag)
+{
+	if (UHarmoniaAssetResolverSubsystem* AssetResolver = GetGameInstance()->GetSubsystem<UHarmoniaAssetResolverSubsystem>())
+	{
+		AssetResolver->ReleasePreloadByTag(this, ParentTag);
+	}
+}
+
 // ============================================================================
 // Priority-Based Sound Management Implementation
 // ============================================================================
@@ -4,6 +4,8 @@
 #include "Settings/HarmoniaTagSettings.h"
 #include "GameplayTagsManager.h"
 #include "Engine/DataTable.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -27,8 +29,19 @@ void UHarmoniaTagRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collect
 		UE_LOG(LogHarmoniaKit, Log, TEXT("HarmoniaTagRegistrySubsystem: Registered %d tags from INI"), TagCount);
 	}
 
+	// Tags must exist before anything else initializes, so both tables are still loaded here,
+	// but in one streaming request so the packages load in parallel instead of one after another
+	const bool bLoadTagTable = Settings->bAutoRegisterDataTableTags && !Settings->TagDefinitionsTable.IsNull();
+	const bool bLoadAttributeTable = !Settings->AttributeDefinitionsTable.IsNull();
+	if (bLoadTagTable && bLoadAttributeTable && UAssetManager::IsInitialized())
+	{
+		UAssetManager::GetStreamableManager().RequestSyncLoad(TArray<FSoftObjectPath>{
+			Settings->TagDefinitionsTable.ToSoftObjectPath(),
+			Settings->AttributeDefinitionsTable.ToSoftObjectPath() });
+	}
+
 	// Register tags from DataTable if enabled
-	if (Settings->bAutoRegisterDataTableTags && !Settings->TagDefinitionsTable.IsNull())
+	if (bLoadTagTable)
 	{
 		UDataTable* TagTable = Settings->TagDefinitionsTable.LoadSynchronous();
 		if (TagTable)
@@ -39,7 +52,7 @@ void UHarmoniaTagRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collect
 	}
 
 	// Register attributes from DataTable if available
-	if (!Settings->AttributeDefinitionsTable.IsNull())
+	if (bLoadAttributeTable)
 	{
 		UDataTable* AttributeTable = Settings->AttributeDefinitionsTable.LoadSynchronous();
 		if (AttributeTable)
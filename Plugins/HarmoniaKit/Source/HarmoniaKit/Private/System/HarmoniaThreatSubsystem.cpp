@@ -0,0 +1,695 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaThreatSubsystem.h"
+#include "Components/HarmoniaThreatComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Threat Maintenance"), STAT_ThreatMaintenance, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Threat Notifications"), STAT_ThreatNotifications, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Threat Tables"), STAT_ThreatTables, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Threat Entries"), STAT_ThreatEntries, STATGROUP_Game);
+
+namespace HarmoniaThreat
+{
+	// Max-heap on the normalized threat key
+	struct FHeapPredicate
+	{
+		template <typename NodeType>
+		bool operator()(const NodeType& A, const NodeType& B) const
+		{
+			return A.Key > B.Key;
+		}
+	};
+
+	// Heaps are rebuilt once stale nodes outnumber live entries by this much
+	static constexpr int32 HeapSlack = 16;
+}
+
+UHarmoniaThreatSubsystem* UHarmoniaThreatSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UHarmoniaThreatSubsystem>() : nullptr;
+}
+
+void UHarmoniaThreatSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHarmoniaThreatSubsystem::Tick),
+		0.0f // Tick every frame, notifications are flushed once per frame
+	);
+}
+
+void UHarmoniaThreatSubsystem::Deinitialize()
+{
+	if (TickDelegateHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+		TickDelegateHandle.Reset();
+	}
+
+	Entries.Empty();
+	FreeEntries.Empty();
+	Tables.Empty();
+	FreeTables.Empty();
+	PendingChanges.Empty();
+	PendingHighestTables.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHarmoniaThreatSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return true;
+	}
+
+	if (GetNumTotalEntries() > 0 && !World->IsPaused())
+	{
+		TimeSinceMaintenance += World->GetDeltaSeconds();
+		if (TimeSinceMaintenance >= MaintenanceInterval)
+		{
+			TimeSinceMaintenance = 0.0f;
+			RunMaintenance(GetNow());
+		}
+	}
+
+	FlushNotifications();
+
+	SET_DWORD_STAT(STAT_ThreatTables, GetNumTables());
+	SET_DWORD_STAT(STAT_ThreatEntries, GetNumTotalEntries());
+
+	return true;
+}
+
+// ============================================================================
+// Tables
+// ============================================================================
+
+int32 UHarmoniaThreatSubsystem::RegisterTable(UHarmoniaThreatComponent* Component)
+{
+	check(Component);
+
+	const int32 TableIndex = FreeTables.Num() > 0 ? FreeTables.Pop(EAllowShrinking::No) : Tables.AddDefaulted();
+
+	FTable& Table = Tables[TableIndex];
+	Table.Component = Component;
+	Table.Config = ReadConfig(*Component);
+	Table.bActive = true;
+
+	return TableIndex;
+}
+
+void UHarmoniaThreatSubsystem::UnregisterTable(int32 TableIndex)
+{
+	if (!Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+	const TArray<int32> EntryIndices = Tables[TableIndex].EntryIndices;
+	for (const int32 EntryIndex : EntryIndices)
+	{
+		RemoveEntry(EntryIndex, Now, false);
+	}
+
+	// Nothing is broadcast to a component that is going away
+	const UHarmoniaThreatComponent* Component = Tables[TableIndex].Component.Get();
+	for (FPendingChange& Change : PendingChanges)
+	{
+		if (Change.Component == Component)
+		{
+			Change.Component.Reset();
+		}
+	}
+
+	Tables[TableIndex] = FTable();
+	FreeTables.Add(TableIndex);
+}
+
+void UHarmoniaThreatSubsystem::RefreshTableConfig(int32 TableIndex)
+{
+	if (!Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive || !Tables[TableIndex].Component.IsValid())
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+	FTable& Table = Tables[TableIndex];
+
+	// Settle the decay so far with the old configuration, then continue with the new one
+	TArray<double, TInlineAllocator<32>> CurrentValues;
+	for (const int32 EntryIndex : Table.EntryIndices)
+	{
+		CurrentValues.Add(GetCurrentThreat(Entries[EntryIndex], Now));
+	}
+
+	Table.Config = ReadConfig(*Table.Component.Get());
+
+	for (int32 Index = 0; Index < Table.EntryIndices.Num(); ++Index)
+	{
+		const int32 EntryIndex = Table.EntryIndices[Index];
+		SetEntryValue(EntryIndex, CurrentValues[Index], Now, GetDecayClass(Table, Entries[EntryIndex].Actor.Get()));
+	}
+}
+
+// ============================================================================
+// Threat
+// ============================================================================
+
+void UHarmoniaThreatSubsystem::AddThreat(int32 TableIndex, AActor* ThreatActor, float ThreatAmount)
+{
+	if (!ThreatActor || ThreatAmount <= 0.0f || !Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+
+	int32 EntryIndex = FindEntry(Tables[TableIndex], ThreatActor);
+	if (EntryIndex == INDEX_NONE)
+	{
+		EntryIndex = AddEntry(TableIndex, ThreatActor, Now);
+	}
+
+	const FTable& Table = Tables[TableIndex];
+	const float OldThreat = (float)GetCurrentThreat(Entries[EntryIndex], Now);
+	const float NewThreat = FMath::Clamp(OldThreat + ThreatAmount, 0.0f, Table.Config.MaximumThreat);
+
+	SetEntryValue(EntryIndex, NewThreat, Now, GetDecayClass(Table, ThreatActor));
+	Entries[EntryIndex].LastThreatTime = (float)Now;
+	MarkChanged(EntryIndex, OldThreat);
+}
+
+void UHarmoniaThreatSubsystem::RemoveThreat(int32 TableIndex, AActor* ThreatActor, float ThreatAmount)
+{
+	if (!ThreatActor || ThreatAmount <= 0.0f || !Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const int32 EntryIndex = FindEntry(Tables[TableIndex], ThreatActor);
+	if (EntryIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+	const float OldThreat = (float)GetCurrentThreat(Entries[EntryIndex], Now);
+	const float NewThreat = FMath::Max(0.0f, OldThreat - ThreatAmount);
+
+	if (NewThreat < Tables[TableIndex].Config.MinimumThreat)
+	{
+		RemoveEntry(EntryIndex, Now, true);
+		return;
+	}
+
+	SetEntryValue(EntryIndex, NewThreat, Now, Entries[EntryIndex].DecayClass);
+	MarkChanged(EntryIndex, OldThreat);
+}
+
+void UHarmoniaThreatSubsystem::SetThreat(int32 TableIndex, AActor* ThreatActor, float ThreatValue)
+{
+	if (!ThreatActor || !Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+
+	int32 EntryIndex = FindEntry(Tables[TableIndex], ThreatActor);
+	if (EntryIndex == INDEX_NONE)
+	{
+		EntryIndex = AddEntry(TableIndex, ThreatActor, Now);
+	}
+
+	const FTable& Table = Tables[TableIndex];
+	const float OldThreat = (float)GetCurrentThreat(Entries[EntryIndex], Now);
+	const float NewThreat = FMath::Clamp(ThreatValue, 0.0f, Table.Config.MaximumThreat);
+
+	SetEntryValue(EntryIndex, NewThreat, Now, GetDecayClass(Table, ThreatActor));
+	Entries[EntryIndex].LastThreatTime = (float)Now;
+	MarkChanged(EntryIndex, OldThreat);
+}
+
+void UHarmoniaThreatSubsystem::ClearThreat(int32 TableIndex, AActor* ThreatActor)
+{
+	if (!ThreatActor || !Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const int32 EntryIndex = FindEntry(Tables[TableIndex], ThreatActor);
+	if (EntryIndex != INDEX_NONE)
+	{
+		RemoveEntry(EntryIndex, GetNow(), true);
+	}
+}
+
+void UHarmoniaThreatSubsystem::ClearAllThreat(int32 TableIndex)
+{
+	if (!Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+	const TArray<int32> EntryIndices = Tables[TableIndex].EntryIndices;
+	for (const int32 EntryIndex : EntryIndices)
+	{
+		RemoveEntry(EntryIndex, Now, true);
+	}
+}
+
+float UHarmoniaThreatSubsystem::GetThreat(int32 TableIndex, const AActor* ThreatActor) const
+{
+	if (!ThreatActor || !Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return 0.0f;
+	}
+
+	const int32 EntryIndex = FindEntry(Tables[TableIndex], ThreatActor);
+	return EntryIndex != INDEX_NONE ? (float)GetCurrentThreat(Entries[EntryIndex], GetNow()) : 0.0f;
+}
+
+AActor* UHarmoniaThreatSubsystem::GetHighestThreatActor(int32 TableIndex)
+{
+	if (!Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return nullptr;
+	}
+
+	const double Now = GetNow();
+
+	while (true)
+	{
+		// Each heap is ordered for its own decay rate, the top target is the larger of the two tops right now
+		int32 BestEntry = INDEX_NONE;
+		double BestThreat = 0.0;
+		for (uint8 DecayClass = 0; DecayClass < DC_Count; ++DecayClass)
+		{
+			const int32 EntryIndex = PeekHeap(TableIndex, DecayClass);
+			if (EntryIndex != INDEX_NONE)
+			{
+				const double Threat = GetCurrentThreat(Entries[EntryIndex], Now);
+				if (Threat > BestThreat)
+				{
+					BestThreat = Threat;
+					BestEntry = EntryIndex;
+				}
+			}
+		}
+
+		if (BestEntry == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		AActor* BestActor = Entries[BestEntry].Actor.Get();
+		if (BestActor && !BestActor->IsPendingKillPending())
+		{
+			return BestActor;
+		}
+
+		RemoveEntry(BestEntry, Now, true);
+	}
+}
+
+void UHarmoniaThreatSubsystem::GetThreatEntries(int32 TableIndex, TArray<FHarmoniaThreatEntry>& OutEntries) const
+{
+	OutEntries.Reset();
+
+	if (!Tables.IsValidIndex(TableIndex) || !Tables[TableIndex].bActive)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+	for (const int32 EntryIndex : Tables[TableIndex].EntryIndices)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (AActor* ThreatActor = Entry.Actor.Get())
+		{
+			FHarmoniaThreatEntry& OutEntry = OutEntries.AddDefaulted_GetRef();
+			OutEntry.ThreatActor = ThreatActor;
+			OutEntry.ThreatValue = (float)GetCurrentThreat(Entry, Now);
+			OutEntry.LastThreatTime = Entry.LastThreatTime;
+		}
+	}
+}
+
+int32 UHarmoniaThreatSubsystem::GetNumEntries(int32 TableIndex) const
+{
+	return (Tables.IsValidIndex(TableIndex) && Tables[TableIndex].bActive) ? Tables[TableIndex].EntryIndices.Num() : 0;
+}
+
+// ============================================================================
+// Entries
+// ============================================================================
+
+double UHarmoniaThreatSubsystem::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+UHarmoniaThreatSubsystem::FTableConfig UHarmoniaThreatSubsystem::ReadConfig(const UHarmoniaThreatComponent& Component)
+{
+	FTableConfig Config;
+	Config.DecayRate = FMath::Max(0.0f, Component.ThreatDecayRate);
+	Config.MinimumThreat = Component.MinimumThreat;
+	Config.MaximumThreat = Component.MaximumThreat;
+	Config.DecayDistanceSq = Component.ThreatDecayDistance > 0.0f ? FMath::Square(Component.ThreatDecayDistance) : 0.0f;
+	Config.OutOfRangeDecayMultiplier = Component.OutOfRangeDecayMultiplier;
+	return Config;
+}
+
+double UHarmoniaThreatSubsystem::GetDecayRate(const FTable& Table, uint8 DecayClass) const
+{
+	return Table.Config.DecayRate * (DecayClass == DC_OutOfRange ? Table.Config.OutOfRangeDecayMultiplier : 1.0f);
+}
+
+double UHarmoniaThreatSubsystem::GetCurrentThreat(const FEntry& Entry, double Now) const
+{
+	const double Rate = GetDecayRate(Tables[Entry.Table], Entry.DecayClass);
+	return Entry.BaseThreat * FMath::Exp(-Rate * FMath::Max(0.0, Now - Entry.BaseTime));
+}
+
+uint8 UHarmoniaThreatSubsystem::GetDecayClass(const FTable& Table, const AActor* ThreatActor) const
+{
+	const UHarmoniaThreatComponent* Component = Table.Component.Get();
+	const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	if (Table.Config.DecayDistanceSq <= 0.0f || !Owner || !ThreatActor)
+	{
+		return DC_InRange;
+	}
+
+	return FVector::DistSquared(Owner->GetActorLocation(), ThreatActor->GetActorLocation()) > Table.Config.DecayDistanceSq ? DC_OutOfRange : DC_InRange;
+}
+
+int32 UHarmoniaThreatSubsystem::FindEntry(const FTable& Table, const AActor* ThreatActor) const
+{
+	const int32 Position = Table.EntryActors.IndexOfByKey(TObjectKey<AActor>(ThreatActor));
+	return Position != INDEX_NONE ? Table.EntryIndices[Position] : INDEX_NONE;
+}
+
+int32 UHarmoniaThreatSubsystem::AddEntry(int32 TableIndex, AActor* ThreatActor, double Now)
+{
+	const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+	// The version keeps counting across reuse so heap nodes of the previous owner stay stale
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Actor = ThreatActor;
+	Entry.Table = TableIndex;
+	Entry.BaseThreat = 0.0;
+	Entry.BaseTime = Now;
+	Entry.ExpiryTime = Now;
+	Entry.LastThreatTime = (float)Now;
+	Entry.PendingChange = INDEX_NONE;
+	Entry.DecayClass = DC_InRange;
+	++Entry.Version;
+
+	FTable& Table = Tables[TableIndex];
+	Table.EntryIndices.Add(EntryIndex);
+	Table.EntryActors.Add(ThreatActor);
+
+	return EntryIndex;
+}
+
+void UHarmoniaThreatSubsystem::RemoveEntry(int32 EntryIndex, double Now, bool bNotify)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	const int32 TableIndex = Entry.Table;
+	FTable& Table = Tables[TableIndex];
+
+	if (bNotify)
+	{
+		MarkChanged(EntryIndex, (float)GetCurrentThreat(Entry, Now));
+	}
+
+	// Removed entries report 0, whatever they had when the change was queued
+	if (Entry.PendingChange != INDEX_NONE)
+	{
+		PendingChanges[Entry.PendingChange].Entry = INDEX_NONE;
+		PendingChanges[Entry.PendingChange].NewThreat = 0.0f;
+	}
+
+	const int32 Position = Table.EntryIndices.Find(EntryIndex);
+	Table.EntryIndices.RemoveAtSwap(Position, 1, EAllowShrinking::No);
+	Table.EntryActors.RemoveAtSwap(Position, 1, EAllowShrinking::No);
+
+	Entry.Actor.Reset();
+	Entry.Table = INDEX_NONE;
+	Entry.PendingChange = INDEX_NONE;
+	++Entry.Version;
+	FreeEntries.Add(EntryIndex);
+
+	if (bNotify)
+	{
+		MarkHighestCheck(TableIndex);
+	}
+}
+
+void UHarmoniaThreatSubsystem::SetEntryValue(int32 EntryIndex, double Value, double Now, uint8 DecayClass)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	FTable& Table = Tables[Entry.Table];
+
+	Entry.BaseThreat = Value;
+	Entry.BaseTime = Now;
+	Entry.DecayClass = DecayClass;
+	++Entry.Version;
+
+	// Solve Value * exp(-Rate * t) = MinimumThreat once, instead of testing every frame
+	const double Rate = GetDecayRate(Table, DecayClass);
+	const double MinimumThreat = Table.Config.MinimumThreat;
+	if (Value < MinimumThreat)
+	{
+		Entry.ExpiryTime = Now;
+	}
+	else if (Rate <= 0.0 || MinimumThreat <= 0.0)
+	{
+		Entry.ExpiryTime = TNumericLimits<double>::Max();
+	}
+	else
+	{
+		Entry.ExpiryTime = Now + FMath::Loge(Value / MinimumThreat) / Rate;
+	}
+
+	// ln(threat at any time t) = Key - Rate * t, so for one rate the key orders entries at every t
+	FHeapNode Node;
+	Node.Key = FMath::Loge(FMath::Max(Value, (double)UE_SMALL_NUMBER)) + Rate * Now;
+	Node.Entry = EntryIndex;
+	Node.Version = Entry.Version;
+
+	TArray<FHeapNode>& Heap = Table.Heaps[DecayClass];
+	Heap.HeapPush(Node, HarmoniaThreat::FHeapPredicate());
+
+	if (Heap.Num() > Table.EntryIndices.Num() * 2 + HarmoniaThreat::HeapSlack)
+	{
+		RebuildHeap(Table, DecayClass);
+	}
+
+	MarkHighestCheck(Entry.Table);
+}
+
+int32 UHarmoniaThreatSubsystem::PeekHeap(int32 TableIndex, uint8 DecayClass)
+{
+	TArray<FHeapNode>& Heap = Tables[TableIndex].Heaps[DecayClass];
+
+	while (Heap.Num() > 0)
+	{
+		const FHeapNode& Top = Heap.HeapTop();
+		if (Entries[Top.Entry].Version == Top.Version)
+		{
+			return Top.Entry;
+		}
+
+		Heap.HeapPopDiscard(HarmoniaThreat::FHeapPredicate(), EAllowShrinking::No);
+	}
+
+	return INDEX_NONE;
+}
+
+void UHarmoniaThreatSubsystem::RebuildHeap(FTable& Table, uint8 DecayClass)
+{
+	TArray<FHeapNode>& Heap = Table.Heaps[DecayClass];
+	Heap.Reset();
+
+	const double Rate = GetDecayRate(Table, DecayClass);
+	for (const int32 EntryIndex : Table.EntryIndices)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (Entry.DecayClass == DecayClass)
+		{
+			FHeapNode& Node = Heap.AddDefaulted_GetRef();
+			Node.Key = FMath::Loge(FMath::Max(Entry.BaseThreat, (double)UE_SMALL_NUMBER)) + Rate * Entry.BaseTime;
+			Node.Entry = EntryIndex;
+			Node.Version = Entry.Version;
+		}
+	}
+
+	Heap.Heapify(HarmoniaThreat::FHeapPredicate());
+}
+
+// ============================================================================
+// Notifications
+// ============================================================================
+
+void UHarmoniaThreatSubsystem::MarkChanged(int32 EntryIndex, float OldThreat)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	if (Entry.PendingChange != INDEX_NONE)
+	{
+		return;
+	}
+
+	FPendingChange& Change = PendingChanges.AddDefaulted_GetRef();
+	Change.Component = Tables[Entry.Table].Component;
+	Change.Actor = Entry.Actor;
+	Change.Entry = EntryIndex;
+	Change.OldThreat = OldThreat;
+
+	Entry.PendingChange = PendingChanges.Num() - 1;
+}
+
+void UHarmoniaThreatSubsystem::MarkHighestCheck(int32 TableIndex)
+{
+	FTable& Table = Tables[TableIndex];
+	if (!Table.bPendingHighestCheck)
+	{
+		Table.bPendingHighestCheck = true;
+		PendingHighestTables.Add(TableIndex);
+	}
+}
+
+void UHarmoniaThreatSubsystem::FlushNotifications()
+{
+	if (PendingChanges.Num() == 0 && PendingHighestTables.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ThreatNotifications);
+
+	const double Now = GetNow();
+
+	// Listeners may change threat again, those changes go to the next frame
+	TArray<FPendingChange> Changes = MoveTemp(PendingChanges);
+	PendingChanges.Reset();
+
+	for (FPendingChange& Change : Changes)
+	{
+		if (Change.Entry != INDEX_NONE)
+		{
+			Change.NewThreat = (float)GetCurrentThreat(Entries[Change.Entry], Now);
+			Entries[Change.Entry].PendingChange = INDEX_NONE;
+		}
+	}
+
+	for (const FPendingChange& Change : Changes)
+	{
+		UHarmoniaThreatComponent* Component = Change.Component.Get();
+		if (Component && !FMath::IsNearlyEqual(Change.OldThreat, Change.NewThreat))
+		{
+			Component->OnThreatChanged.Broadcast(Change.Actor.Get(), Change.OldThreat, Change.NewThreat);
+		}
+	}
+
+	TArray<int32> HighestTables = MoveTemp(PendingHighestTables);
+	PendingHighestTables.Reset();
+
+	for (const int32 TableIndex : HighestTables)
+	{
+		if (!Tables[TableIndex].bActive)
+		{
+			continue;
+		}
+
+		Tables[TableIndex].bPendingHighestCheck = false;
+
+		UHarmoniaThreatComponent* Component = Tables[TableIndex].Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		AActor* NewHighest = GetHighestThreatActor(TableIndex);
+		if (Component->CurrentHighestThreatActor != NewHighest)
+		{
+			AActor* OldHighest = Component->CurrentHighestThreatActor;
+			Component->CurrentHighestThreatActor = NewHighest;
+			Component->OnHighestThreatChanged.Broadcast(OldHighest, NewHighest);
+		}
+	}
+}
+
+// ============================================================================
+// Maintenance
+// ============================================================================
+
+void UHarmoniaThreatSubsystem::RunMaintenance(double Now)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ThreatMaintenance);
+
+	for (int32 TableIndex = 0; TableIndex < Tables.Num(); ++TableIndex)
+	{
+		FTable& Table = Tables[TableIndex];
+		if (!Table.bActive || Table.EntryIndices.Num() == 0)
+		{
+			continue;
+		}
+
+		const UHarmoniaThreatComponent* Component = Table.Component.Get();
+		if (!Component)
+		{
+			// Destroyed without EndPlay
+			UnregisterTable(TableIndex);
+			continue;
+		}
+
+		const AActor* Owner = Component->GetOwner();
+		const FVector OwnerLocation = Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
+		const bool bCheckRange = Owner && Table.Config.DecayDistanceSq > 0.0f && Table.Config.DecayRate > 0.0f;
+
+		bool bHasInRange = false;
+		bool bHasOutOfRange = false;
+
+		// Backwards: removal swaps the last entry into the current slot
+		for (int32 Position = Table.EntryIndices.Num() - 1; Position >= 0; --Position)
+		{
+			const int32 EntryIndex = Table.EntryIndices[Position];
+			const FEntry& Entry = Entries[EntryIndex];
+
+			const AActor* ThreatActor = Entry.Actor.Get();
+			if (!ThreatActor || ThreatActor->IsPendingKillPending() || Now >= Entry.ExpiryTime)
+			{
+				RemoveEntry(EntryIndex, Now, true);
+				continue;
+			}
+
+			// Crossing the decay distance only changes the rate, the value so far is kept
+			if (bCheckRange)
+			{
+				const uint8 DecayClass = FVector::DistSquared(OwnerLocation, ThreatActor->GetActorLocation()) > Table.Config.DecayDistanceSq ? DC_OutOfRange : DC_InRange;
+				if (DecayClass != Entry.DecayClass)
+				{
+					SetEntryValue(EntryIndex, GetCurrentThreat(Entry, Now), Now, DecayClass);
+				}
+			}
+
+			(Entries[EntryIndex].DecayClass == DC_OutOfRange ? bHasOutOfRange : bHasInRange) = true;
+		}
+
+		// Two decay rates can swap the top target without any event
+		if (bHasInRange && bHasOutOfRange)
+		{
+			MarkHighestCheck(TableIndex);
+		}
+	}
+}
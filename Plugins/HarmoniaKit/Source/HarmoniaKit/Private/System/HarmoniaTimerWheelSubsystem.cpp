@@ -0,0 +1,134 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "System/HarmoniaTimerWheelSubsystem.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("TimerWheel Tick"), STAT_TimerWheelTick, STATGROUP_Game);
+
+void UHarmoniaTimerWheelSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Slots.SetNum(NumSlots);
+	LastProcessedSlotTime = TimeToSlotTime(GetWorldTime());
+
+	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHarmoniaTimerWheelSubsystem::Tick),
+		0.0f // Tick every frame, only elapsed slots are visited
+	);
+}
+
+void UHarmoniaTimerWheelSubsystem::Deinitialize()
+{
+	if (TickDelegateHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+		TickDelegateHandle.Reset();
+	}
+
+	Slots.Empty();
+	EntrySlots.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHarmoniaTimerWheelSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TimerWheelTick);
+
+	const int64 CurrentSlotTime = TimeToSlotTime(GetWorldTime());
+	if (CurrentSlotTime <= LastProcessedSlotTime || EntrySlots.Num() == 0)
+	{
+		LastProcessedSlotTime = FMath::Max(LastProcessedSlotTime, CurrentSlotTime);
+		return true;
+	}
+
+	// After a long hitch every slot is visited once, entries are compared against their absolute time anyway
+	const int64 FirstSlotTime = FMath::Max(LastProcessedSlotTime + 1, CurrentSlotTime - NumSlots + 1);
+	LastProcessedSlotTime = CurrentSlotTime;
+
+	// Collect first and fire afterwards: callbacks are free to schedule or cancel other entries
+	TArray<FSimpleDelegate, TInlineAllocator<16>> Due;
+	for (int64 SlotTime = FirstSlotTime; SlotTime <= CurrentSlotTime; ++SlotTime)
+	{
+		TArray<FEntry>& Slot = Slots[SlotTime % NumSlots];
+		for (int32 i = Slot.Num() - 1; i >= 0; --i)
+		{
+			if (Slot[i].FireSlotTime <= CurrentSlotTime)
+			{
+				EntrySlots.Remove(Slot[i].Id);
+				Due.Add(MoveTemp(Slot[i].Callback));
+				Slot.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			}
+		}
+	}
+
+	for (FSimpleDelegate& Callback : Due)
+	{
+		Callback.ExecuteIfBound();
+	}
+	NumFired += Due.Num();
+
+	return true;
+}
+
+FHarmoniaTimerWheelHandle UHarmoniaTimerWheelSubsystem::ScheduleAt(double FireTime, FSimpleDelegate Callback)
+{
+	FHarmoniaTimerWheelHandle Handle;
+	if (!Callback.IsBound() || Slots.Num() == 0)
+	{
+		return Handle;
+	}
+
+	// Round up so a callback never fires before its deadline, and never into a slot that was already processed
+	const int64 FireSlotTime = FMath::Max(LastProcessedSlotTime + 1, (int64)FMath::CeilToDouble(FireTime / SlotDuration));
+	const int32 SlotIndex = (int32)(FireSlotTime % NumSlots);
+
+	FEntry& Entry = Slots[SlotIndex].AddDefaulted_GetRef();
+	Entry.Id = NextId++;
+	Entry.FireSlotTime = FireSlotTime;
+	Entry.Callback = MoveTemp(Callback);
+
+	EntrySlots.Add(Entry.Id, SlotIndex);
+
+	Handle.Id = Entry.Id;
+	return Handle;
+}
+
+FHarmoniaTimerWheelHandle UHarmoniaTimerWheelSubsystem::ScheduleAfter(double Delay, FSimpleDelegate Callback)
+{
+	return ScheduleAt(GetWorldTime() + FMath::Max(0.0, Delay), MoveTemp(Callback));
+}
+
+void UHarmoniaTimerWheelSubsystem::Cancel(FHarmoniaTimerWheelHandle& Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+
+	int32 SlotIndex = INDEX_NONE;
+	if (EntrySlots.RemoveAndCopyValue(Handle.Id, SlotIndex))
+	{
+		const uint64 Id = Handle.Id;
+		Slots[SlotIndex].RemoveAllSwap([Id](const FEntry& Entry) { return Entry.Id == Id; }, EAllowShrinking::No);
+	}
+
+	Handle.Invalidate();
+}
+
+bool UHarmoniaTimerWheelSubsystem::IsScheduled(const FHarmoniaTimerWheelHandle& Handle) const
+{
+	return Handle.IsValid() && EntrySlots.Contains(Handle.Id);
+}
+
+int64 UHarmoniaTimerWheelSubsystem::TimeToSlotTime(double Time) const
+{
+	return (int64)FMath::FloorToDouble(Time / SlotDuration);
+}
+
+double UHarmoniaTimerWheelSubsystem::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
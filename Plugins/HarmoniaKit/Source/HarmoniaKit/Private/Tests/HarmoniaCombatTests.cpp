@@ -3,6 +3,7 @@
 #include "Tests/HarmoniaTestBase.h"
 #include "System/HarmoniaCombatPowerCalculator.h"
 #include "Libraries/HarmoniaCombatLibrary.h"
+#include "Components/HarmoniaStatusEffectComponent.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -154,4 +155,42 @@ bool FStatusEffectTest_Stacking::RunTest(const FString& Parameters)
 	return true;
 }
 
+HARMONIA_SIMPLE_TEST(FStatusEffectTest_IndexedViews, "Combat.StatusEffect.IndexedViews")
+bool FStatusEffectTest_IndexedViews::RunTest(const FString& Parameters)
+{
+	UHarmoniaStatusEffectComponent* StatusComp = NewObject<UHarmoniaStatusEffectComponent>();
+
+	FHarmoniaStatusEffectUIData Buff;
+	Buff.EffectType = EHarmoniaStatusEffectType::Buff;
+	Buff.Category = EHarmoniaStatusEffectCategory::Movement;
+	Buff.bHasDuration = true;
+	Buff.TotalDuration = 10.0f;
+	Buff.RemainingDuration = 4.0f;
+
+	FHarmoniaStatusEffectUIData Debuff;
+	Debuff.EffectType = EHarmoniaStatusEffectType::Debuff;
+	Debuff.Category = EHarmoniaStatusEffectCategory::Control;
+
+	const FGuid FirstBuff = StatusComp->AddCustomEffect(Buff);
+	const FGuid DebuffID = StatusComp->AddCustomEffect(Debuff);
+	const FGuid SecondBuff = StatusComp->AddCustomEffect(Buff);
+
+	TestEqual(TEXT("Two buffs indexed"), StatusComp->GetEffectIDsByType(EHarmoniaStatusEffectType::Buff).Num(), 2);
+	TestEqual(TEXT("One control effect indexed"), StatusComp->GetEffectIDsByCategory(EHarmoniaStatusEffectCategory::Control).Num(), 1);
+	TestEqual(TEXT("Remaining duration derived from start time"), StatusComp->GetEffectRemainingDuration(FirstBuff), 4.0f);
+
+	TestTrue(TEXT("Custom effect removed"), StatusComp->RemoveCustomEffect(DebuffID));
+	TestEqual(TEXT("Debuff view emptied"), StatusComp->GetDebuffs().Num(), 0);
+
+	FHarmoniaStatusEffectUIData Found;
+	TestTrue(TEXT("Effect after the removed one still found by ID"), StatusComp->GetEffectByID(SecondBuff, Found));
+	TestEqual(TEXT("Found the right effect"), Found.EffectID, SecondBuff);
+
+	TestTrue(TEXT("Duration updated"), StatusComp->UpdateCustomEffectDuration(FirstBuff, 1.5f));
+	TestEqual(TEXT("Updated remaining duration"), StatusComp->GetEffectRemainingDuration(FirstBuff), 1.5f);
+	TestTrue(TEXT("Expiring soon once under the threshold"), StatusComp->GetBuffs()[0].bIsExpiringSoon);
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
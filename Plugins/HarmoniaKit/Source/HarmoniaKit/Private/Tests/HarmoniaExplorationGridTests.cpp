@@ -0,0 +1,71 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Tests/HarmoniaTestBase.h"
+#include "Definitions/HarmoniaMapSystemDefinitions.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Exploration Grid Tests
+//////////////////////////////////////////////////////////////////////////
+
+namespace HarmoniaExplorationGridTests
+{
+	const FBox MapBounds(FVector(-100000.0, -100000.0, 0.0), FVector(100000.0, 100000.0, 1000.0));
+}
+
+HARMONIA_SIMPLE_TEST(FExplorationGridTest_SaveLoad, "Map.ExplorationGrid.SaveLoad")
+bool FExplorationGridTest_SaveLoad::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaExplorationGridTests;
+
+	FHarmoniaExplorationGrid Grid;
+	Grid.Initialize(MapBounds, 256, nullptr);
+	Grid.RevealCircle(FVector(-50000.0, -50000.0, 0.0), 5000.0f);
+
+	TArray<uint8> SavedData;
+	Grid.SaveRLE(SavedData);
+
+	FHarmoniaExplorationGrid Loaded;
+	Loaded.Initialize(MapBounds, 256, nullptr);
+	TestTrue(TEXT("Load at the same resolution should succeed"), Loaded.LoadRLE(SavedData));
+	TestEqual(TEXT("Loaded grid should have the same explored tiles"), Loaded.GetNumExploredTiles(), Grid.GetNumExploredTiles());
+	TestEqual(TEXT("Revealed center should stay explored"), Loaded.GetAlpha(FVector(-50000.0, -50000.0, 0.0)), FHarmoniaExplorationGrid::MaxAlpha);
+	TestEqual(TEXT("Far corner should stay fogged"), Loaded.GetAlpha(FVector(90000.0, 90000.0, 0.0)), static_cast<uint8>(0));
+
+	TArray<uint8> Truncated = SavedData;
+	Truncated.SetNum(Truncated.Num() / 2);
+	TestFalse(TEXT("Truncated data should be rejected"), Loaded.LoadRLE(Truncated));
+
+	return true;
+}
+
+HARMONIA_SIMPLE_TEST(FExplorationGridTest_Resample, "Map.ExplorationGrid.Resample")
+bool FExplorationGridTest_Resample::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaExplorationGridTests;
+
+	const FVector Revealed(-50000.0, 30000.0, 0.0);
+	const FVector Fogged(60000.0, -60000.0, 0.0);
+
+	FHarmoniaExplorationGrid Grid;
+	Grid.Initialize(MapBounds, 256, nullptr);
+	Grid.RevealCircle(Revealed, 5000.0f);
+
+	TArray<uint8> SavedData;
+	Grid.SaveRLE(SavedData);
+
+	// Exploration must survive a change of ExplorationGridResolution in either direction
+	for (const int32 Resolution : { 128, 512 })
+	{
+		FHarmoniaExplorationGrid Loaded;
+		Loaded.Initialize(MapBounds, Resolution, nullptr);
+		TestTrue(FString::Printf(TEXT("Load at resolution %d should succeed"), Resolution), Loaded.LoadRLE(SavedData));
+		TestEqual(FString::Printf(TEXT("Revealed area should stay explored at resolution %d"), Resolution), Loaded.GetAlpha(Revealed), FHarmoniaExplorationGrid::MaxAlpha);
+		TestEqual(FString::Printf(TEXT("Unexplored area should stay fogged at resolution %d"), Resolution), Loaded.GetAlpha(Fogged), static_cast<uint8>(0));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,148 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Tests/HarmoniaTestBase.h"
+#include "System/HarmoniaMapClusterSystem.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Map Cluster System Tests
+//////////////////////////////////////////////////////////////////////////
+
+namespace HarmoniaMapClusterTests
+{
+	const FBox MapBounds(FVector(-100000.0, -100000.0, 0.0), FVector(100000.0, 100000.0, 1000.0));
+
+	int32 SumMarkerCounts(const TArray<FMarkerCluster>& Clusters)
+	{
+		int32 Total = 0;
+		for (const FMarkerCluster& Cluster : Clusters)
+		{
+			Total += Cluster.MarkerCount;
+		}
+		return Total;
+	}
+}
+
+HARMONIA_SIMPLE_TEST(FMapClusterTest_Incremental, "Map.Cluster.Incremental")
+bool FMapClusterTest_Incremental::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaMapClusterTests;
+
+	UHarmoniaMapClusterSystem* ClusterSystem = NewObject<UHarmoniaMapClusterSystem>();
+	ClusterSystem->ResetIndex(MapBounds);
+
+	// Two tight groups in opposite corners
+	TArray<int32> MarkerIds;
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		FMapLocationData Marker;
+		Marker.WorldPosition = FVector(Index < 4 ? -90000.0 : 90000.0, Index < 4 ? -90000.0 : 90000.0, 0.0) + FVector(Index * 10.0, 0.0, 0.0);
+		MarkerIds.Add(ClusterSystem->AddMarker(Marker));
+	}
+
+	const FBox2D FullView(FVector2D::ZeroVector, FVector2D::UnitVector);
+
+	TArray<FMarkerCluster> Clusters;
+	ClusterSystem->QueryClusters(FullView, 1.0f, Clusters);
+	TestEqual(TEXT("Two groups should form two clusters"), Clusters.Num(), 2);
+	TestEqual(TEXT("Clusters should hold every marker"), SumMarkerCounts(Clusters), 8);
+
+	// Only the lower corner is in view
+	ClusterSystem->QueryClusters(FBox2D(FVector2D::ZeroVector, FVector2D(0.25, 0.25)), 1.0f, Clusters);
+	TestEqual(TEXT("Viewport query should only return the visible group"), SumMarkerCounts(Clusters), 4);
+
+	// Move one marker across the map, then remove another
+	FMapLocationData Moved;
+	Moved.WorldPosition = FVector(90000.0, 90000.0, 0.0);
+	TestTrue(TEXT("Update should succeed"), ClusterSystem->UpdateMarker(MarkerIds[0], Moved));
+	TestTrue(TEXT("Remove should succeed"), ClusterSystem->RemoveMarker(MarkerIds[1]));
+	TestFalse(TEXT("Removing twice should fail"), ClusterSystem->RemoveMarker(MarkerIds[1]));
+
+	ClusterSystem->QueryClusters(FBox2D(FVector2D::ZeroVector, FVector2D(0.25, 0.25)), 1.0f, Clusters);
+	TestEqual(TEXT("Lower group should have lost two markers"), SumMarkerCounts(Clusters), 2);
+
+	ClusterSystem->QueryClusters(FullView, 1.0f, Clusters);
+	TestEqual(TEXT("Total should drop by the removed marker"), SumMarkerCounts(Clusters), 7);
+
+	return true;
+}
+
+HARMONIA_SIMPLE_TEST(FMapClusterTest_Benchmark50k, "Map.Cluster.Benchmark50k")
+bool FMapClusterTest_Benchmark50k::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaMapClusterTests;
+
+	const int32 NumMarkers = 50000;
+
+	UHarmoniaMapClusterSystem* ClusterSystem = NewObject<UHarmoniaMapClusterSystem>();
+	ClusterSystem->ResetIndex(MapBounds);
+
+	FRandomStream Random(1337);
+	TArray<int32> MarkerIds;
+	MarkerIds.Reserve(NumMarkers);
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumMarkers; ++Index)
+	{
+		FMapLocationData Marker;
+		Marker.WorldPosition = FVector(Random.FRandRange(-100000.0f, 100000.0f), Random.FRandRange(-100000.0f, 100000.0f), 0.0);
+		MarkerIds.Add(ClusterSystem->AddMarker(Marker));
+	}
+	const double InsertSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("All markers should be indexed"), ClusterSystem->GetNumMarkers(), NumMarkers);
+
+	const FBox2D FullView(FVector2D::ZeroVector, FVector2D::UnitVector);
+	const FBox2D ZoomedView(FVector2D(0.4, 0.4), FVector2D(0.6, 0.6));
+	const float Zooms[] = { 0.3f, 0.7f, 1.0f, 1.5f, 4.0f };
+
+	TArray<FMarkerCluster> Clusters;
+	TArray<FMarkerCluster> RepeatClusters;
+
+	for (const float Zoom : Zooms)
+	{
+		StartTime = FPlatformTime::Seconds();
+		ClusterSystem->QueryClusters(FullView, Zoom, Clusters);
+		const double QuerySeconds = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(FString::Printf(TEXT("Full view at zoom %.1f should cover every marker"), Zoom), SumMarkerCounts(Clusters), NumMarkers);
+
+		// Same input, same clusters
+		ClusterSystem->QueryClusters(FullView, Zoom, RepeatClusters);
+		bool bSameClusters = Clusters.Num() == RepeatClusters.Num();
+		for (int32 Index = 0; bSameClusters && Index < Clusters.Num(); ++Index)
+		{
+			bSameClusters = Clusters[Index].MarkerCount == RepeatClusters[Index].MarkerCount
+				&& Clusters[Index].ClusterCenter.Equals(RepeatClusters[Index].ClusterCenter);
+		}
+		TestTrue(FString::Printf(TEXT("Clusters at zoom %.1f should be deterministic"), Zoom), bSameClusters);
+
+		AddInfo(FString::Printf(TEXT("Zoom %.1f: depth %d, %d clusters in %.3f ms"),
+			Zoom, ClusterSystem->GetDepthForZoom(Zoom), Clusters.Num(), QuerySeconds * 1000.0));
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	ClusterSystem->QueryClusters(ZoomedView, 4.0f, Clusters);
+	const double ViewportSeconds = FPlatformTime::Seconds() - StartTime;
+	TestTrue(TEXT("Viewport query should return a subset of the markers"), SumMarkerCounts(Clusters) < NumMarkers);
+
+	// Remove every other marker
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumMarkers; Index += 2)
+	{
+		ClusterSystem->RemoveMarker(MarkerIds[Index]);
+	}
+	const double RemoveSeconds = FPlatformTime::Seconds() - StartTime;
+
+	ClusterSystem->QueryClusters(FullView, 1.0f, Clusters);
+	TestEqual(TEXT("Clusters should drop removed markers"), SumMarkerCounts(Clusters), NumMarkers / 2);
+
+	AddInfo(FString::Printf(TEXT("%d markers: insert %.2f ms, viewport query %.3f ms, remove half %.2f ms"),
+		NumMarkers, InsertSeconds * 1000.0, ViewportSeconds * 1000.0, RemoveSeconds * 1000.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
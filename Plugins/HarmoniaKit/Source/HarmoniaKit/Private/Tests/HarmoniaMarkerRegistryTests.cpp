@@ -0,0 +1,122 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Tests/HarmoniaTestBase.h"
+#include "System/HarmoniaMarkerRegistrySubsystem.h"
+#include "NativeGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Marker Registry Tests
+//////////////////////////////////////////////////////////////////////////
+
+namespace HarmoniaMarkerRegistryTests
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Test_Marker_Quest, "Test.Marker.Quest");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Test_Marker_Enemy, "Test.Marker.Enemy");
+
+	TSet<int32> ToPayloadSet(const TArray<FHarmoniaMarkerQueryHit>& Hits)
+	{
+		TSet<int32> Result;
+		for (const FHarmoniaMarkerQueryHit& Hit : Hits)
+		{
+			Result.Add(Hit.PayloadIndex);
+		}
+		return Result;
+	}
+}
+
+HARMONIA_SIMPLE_TEST(FMarkerRegistryTest_RadiusQuery, "Map.Markers.RadiusQuery")
+bool FMarkerRegistryTest_RadiusQuery::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaMarkerRegistryTests;
+
+	UHarmoniaMarkerRegistrySubsystem* Registry = NewObject<UHarmoniaMarkerRegistrySubsystem>();
+	const UObject* Owner = Registry;
+	const UObject* OtherOwner = GetTransientPackage();
+
+	// Random markers, every query hit must be a marker in range and every marker in range must be hit
+	FRandomStream Random(42);
+	TArray<FVector> Locations;
+	for (int32 Index = 0; Index < 2000; ++Index)
+	{
+		const FVector Location(Random.FRandRange(-100000.0f, 100000.0f), Random.FRandRange(-100000.0f, 100000.0f), 0.0);
+		Locations.Add(Location);
+		Registry->Register(Owner, Index, Location, nullptr, FGameplayTag(), false);
+	}
+	Registry->Register(OtherOwner, 0, FVector::ZeroVector, nullptr, FGameplayTag(), false);
+
+	const FVector Center(1000.0, -2000.0, 0.0);
+	const float Radius = 15000.0f;
+
+	TArray<FHarmoniaMarkerQueryHit> Hits;
+	Registry->QueryRadius(Owner, Center, Radius, 0, Hits);
+	const TSet<int32> HitSet = ToPayloadSet(Hits);
+
+	bool bAllInRangeFound = true;
+	for (int32 Index = 0; Index < Locations.Num(); ++Index)
+	{
+		if (FVector::DistXY(Locations[Index], Center) <= Radius && !HitSet.Contains(Index))
+		{
+			bAllInRangeFound = false;
+		}
+	}
+	TestTrue(TEXT("Every marker in range should be returned"), bAllInRangeFound);
+	TestTrue(TEXT("Query should skip most of the map"), Hits.Num() < Locations.Num() / 4);
+	TestTrue(TEXT("Query should only visit nearby cells"), Registry->GetLastQueryCellCount() < Registry->GetNumCells());
+
+	// Always relevant markers come back from any query
+	FHarmoniaMarkerHandle FarHandle = Registry->Register(Owner, 9999, FVector(900000.0, 0.0, 0.0), nullptr, FGameplayTag(), true);
+	Registry->QueryRadius(Owner, Center, Radius, 0, Hits);
+	TestTrue(TEXT("Always relevant marker should be returned"), ToPayloadSet(Hits).Contains(9999));
+
+	// Moving into range
+	Registry->Update(FarHandle, Center, nullptr, FGameplayTag(), false);
+	Registry->QueryRadius(Owner, Center, 10.0f, 0, Hits);
+	TestTrue(TEXT("Moved marker should be found in its new cell"), ToPayloadSet(Hits).Contains(9999));
+
+	// Stale handles are ignored
+	const FHarmoniaMarkerHandle StaleHandle = FarHandle;
+	Registry->Unregister(FarHandle);
+	TestFalse(TEXT("Unregister should reset the handle"), FarHandle.IsValid());
+	TestFalse(TEXT("Stale handle should not resolve"), Registry->IsRegistered(StaleHandle));
+	Registry->QueryRadius(Owner, Center, 10.0f, 0, Hits);
+	TestFalse(TEXT("Removed marker should not be returned"), ToPayloadSet(Hits).Contains(9999));
+
+	// Owners do not see each other's markers
+	Registry->UnregisterAll(Owner);
+	Registry->QueryRadius(Owner, FVector::ZeroVector, 200000.0f, 0, Hits);
+	TestEqual(TEXT("Owner should have no markers left"), Hits.Num(), 0);
+	TestEqual(TEXT("Other owner keeps its marker"), Registry->GetNumMarkers(), 1);
+
+	return true;
+}
+
+HARMONIA_SIMPLE_TEST(FMarkerRegistryTest_CategoryMask, "Map.Markers.CategoryMask")
+bool FMarkerRegistryTest_CategoryMask::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaMarkerRegistryTests;
+
+	UHarmoniaMarkerRegistrySubsystem* Registry = NewObject<UHarmoniaMarkerRegistrySubsystem>();
+	const UObject* Owner = Registry;
+
+	Registry->Register(Owner, 0, FVector::ZeroVector, nullptr, TAG_Test_Marker_Quest, false);
+	Registry->Register(Owner, 1, FVector::ZeroVector, nullptr, TAG_Test_Marker_Enemy, false);
+	Registry->Register(Owner, 2, FVector::ZeroVector, nullptr, FGameplayTag(), false);
+
+	TestEqual(TEXT("Invalid category should have no bit"), Registry->GetCategoryBit(FGameplayTag()), uint64(0));
+	TestNotEqual(TEXT("Categories should get distinct bits"), Registry->GetCategoryBit(TAG_Test_Marker_Quest), Registry->GetCategoryBit(TAG_Test_Marker_Enemy));
+
+	TArray<FHarmoniaMarkerQueryHit> Hits;
+	const uint64 HiddenMask = Registry->GetCategoryMask({ TAG_Test_Marker_Enemy });
+	Registry->QueryRadius(Owner, FVector::ZeroVector, 100.0f, HiddenMask, Hits);
+
+	const TSet<int32> HitSet = ToPayloadSet(Hits);
+	TestTrue(TEXT("Quest marker should be visible"), HitSet.Contains(0));
+	TestFalse(TEXT("Hidden category should be skipped"), HitSet.Contains(1));
+	TestTrue(TEXT("Uncategorized marker should never be filtered"), HitSet.Contains(2));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
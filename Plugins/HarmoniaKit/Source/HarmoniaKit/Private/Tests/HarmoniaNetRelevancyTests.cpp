@@ -0,0 +1,40 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Tests/HarmoniaTestBase.h"
+#include "Components/HarmoniaNetworkOptimizationComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Net Relevancy Tests
+//////////////////////////////////////////////////////////////////////////
+
+HARMONIA_SIMPLE_TEST(FNetRelevancyTest_Hysteresis, "Network.Tiering.Hysteresis")
+bool FNetRelevancyTest_Hysteresis::RunTest(const FString& Parameters)
+{
+	using ULevelCalc = UHarmoniaNetworkOptimizationComponent;
+
+	FHarmoniaNetOptConfig Config;
+	Config.HighDistance = 1500.0f;
+	Config.MediumDistance = 3000.0f;
+	Config.HysteresisDistance = 300.0f;
+
+	// Moving closer applies at once
+	TestEqual(TEXT("Closer level applies immediately"), ULevelCalc::CalculateLevel(Config, 1400.0f, EHarmoniaNetOptLevel::Medium, false), EHarmoniaNetOptLevel::High);
+
+	// Moving away holds the level until the threshold is cleared by the hysteresis distance
+	TestEqual(TEXT("Just past the threshold keeps the level"), ULevelCalc::CalculateLevel(Config, 1700.0f, EHarmoniaNetOptLevel::High, false), EHarmoniaNetOptLevel::High);
+	TestEqual(TEXT("Past the hysteresis distance drops the level"), ULevelCalc::CalculateLevel(Config, 1900.0f, EHarmoniaNetOptLevel::High, false), EHarmoniaNetOptLevel::Medium);
+	TestEqual(TEXT("Far away drops straight to dormant"), ULevelCalc::CalculateLevel(Config, 50000.0f, EHarmoniaNetOptLevel::Critical, false), EHarmoniaNetOptLevel::Dormant);
+
+	// Combat keeps at least CombatMinLevel
+	Config.CombatMinLevel = EHarmoniaNetOptLevel::High;
+	TestEqual(TEXT("Combat boost caps the level"), ULevelCalc::CalculateLevel(Config, 50000.0f, EHarmoniaNetOptLevel::Dormant, true), EHarmoniaNetOptLevel::High);
+
+	Config.bUseCombatBoost = false;
+	TestEqual(TEXT("Combat boost can be disabled"), ULevelCalc::CalculateLevel(Config, 50000.0f, EHarmoniaNetOptLevel::Dormant, true), EHarmoniaNetOptLevel::Dormant);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,44 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Tests/HarmoniaTestBase.h"
+#include "Managers/HarmoniaTerrainOwnershipManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Terrain Ownership Tests
+//////////////////////////////////////////////////////////////////////////
+
+HARMONIA_SIMPLE_TEST(FTerrainOwnershipTest_SmallestZone, "Building.TerrainOwnership.SmallestZone")
+bool FTerrainOwnershipTest_SmallestZone::RunTest(const FString& Parameters)
+{
+	UHarmoniaTerrainOwnershipManager* Manager = NewObject<UHarmoniaTerrainOwnershipManager>();
+
+	const int32 City = Manager->CreateProtectedZone(FVector::ZeroVector, 20000.0f, TEXT("City"));
+	const int32 Plot = Manager->CreatePlayerZone(FVector(3000.0f, 0.0f, 0.0f), 1000.0f, TEXT("PlayerA"), TEXT("Plot"));
+	const int32 Market = Manager->CreatePublicBuildingZone(FVector(-5000.0f, 0.0f, 0.0f), 2000.0f, TEXT("Market"));
+
+	TestEqual(TEXT("Smallest containing zone wins"), Manager->FindZoneIndexAtLocation(FVector(3200.0f, 0.0f, 0.0f)), Plot);
+	TestEqual(TEXT("Outside the plot falls back to the city"), Manager->FindZoneIndexAtLocation(FVector(4500.0f, 0.0f, 0.0f)), City);
+	TestEqual(TEXT("Outside every zone is unclaimed"), Manager->FindZoneIndexAtLocation(FVector(50000.0f, 0.0f, 0.0f)), INDEX_NONE);
+
+	TestTrue(TEXT("Owner can build on the plot"), Manager->HasBuildingPermissionByID(TEXT("PlayerA"), INDEX_NONE, FVector(3200.0f, 0.0f, 0.0f)));
+	TestFalse(TEXT("Others cannot build on the plot"), Manager->HasBuildingPermissionByID(TEXT("PlayerB"), INDEX_NONE, FVector(3200.0f, 0.0f, 0.0f)));
+	TestTrue(TEXT("Anyone can build in the market"), Manager->IsPublicBuildingArea(FVector(-5000.0f, 500.0f, 0.0f)));
+
+	// Removing a zone keeps the other indices and the lookups correct
+	Manager->UnregisterOwnershipZone(Plot);
+	TestEqual(TEXT("City takes over once the plot is gone"), Manager->FindZoneIndexAtLocation(FVector(3200.0f, 0.0f, 0.0f)), City);
+	TestEqual(TEXT("Market index unchanged"), Manager->FindZoneIndexAtLocation(FVector(-5000.0f, 0.0f, 0.0f)), Market);
+	TestEqual(TEXT("Owner list updated"), Manager->GetZonesOwnedByPlayer(TEXT("PlayerA")).Num(), 0);
+
+	const int32 NewPlot = Manager->CreatePlayerZone(FVector(3000.0f, 0.0f, 0.0f), 500.0f, TEXT("PlayerA"), TEXT("New Plot"));
+	TestEqual(TEXT("Freed index reused"), NewPlot, Plot);
+	const TArray<int32> OwnedZones = Manager->GetZonesOwnedByPlayer(TEXT("PlayerA"));
+	TestTrue(TEXT("Owner list has the new plot"), OwnedZones.Num() == 1 && OwnedZones[0] == NewPlot);
+	TestEqual(TEXT("Zone count"), Manager->GetNumZones(), 3);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
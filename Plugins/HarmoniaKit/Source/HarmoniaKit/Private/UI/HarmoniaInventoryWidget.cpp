@@ -10,25 +10,25 @@ void UHarmoniaInventoryWidget::NativeConstruct()
     Super::NativeConstruct();
     Refresh();
 
-	if (InventoryComponent)
-	{
-		InventoryComponent->OnInventoryChanged.AddDynamic(this, &UHarmoniaInventoryWidget::Refresh);
-	}
+	BindToInventoryComponent();
 }
 
 void UHarmoniaInventoryWidget::Refresh()
 {
+	SlotWidgets.Reset();
+
 	if (InventoryComponent && SlotPanel && SlotWidgetClass)
 	{
 		SlotPanel->ClearChildren();
 
 		const auto& Slots = InventoryComponent->InventoryData.Slots;
 		const int32 Columns = SlotMaxColumns;
-		int32 Index = 0;
 
 		for (const auto& SlotData : Slots)
 		{
-			if (Index != InventoryData.MaxSlotCount)
+			// Position by slot index, the replicated array order is not guaranteed on clients
+			const int32 Index = SlotData.Index;
+			if (Index >= 0 && Index < InventoryData.MaxSlotCount)
 			{
 				int32 Row = Index / Columns;
 				int32 Col = Index % Columns;
@@ -38,15 +38,51 @@ void UHarmoniaInventoryWidget::Refresh()
 				{
 					SlotWidget->SetSlotData(FInventorySlot(Index, SlotData.ItemID, SlotData.Count, SlotData.Durability), InventoryComponent, this);
 					SlotPanel->AddChildToUniformGrid(SlotWidget, Row, Col);
-					Index++;
+
+					if (SlotWidgets.Num() <= Index)
+					{
+						SlotWidgets.SetNum(Index + 1);
+					}
+					SlotWidgets[Index] = SlotWidget;
 				}
 			}
 		}
 	}
 }
 
+void UHarmoniaInventoryWidget::RefreshSlot(int32 SlotIndex, const FInventorySlot& SlotData)
+{
+	if (SlotWidgets.IsValidIndex(SlotIndex) && SlotWidgets[SlotIndex])
+	{
+		SlotWidgets[SlotIndex]->SetSlotData(FInventorySlot(SlotIndex, SlotData.ItemID, SlotData.Count, SlotData.Durability), InventoryComponent, this);
+	}
+	else if (SlotIndex >= 0 && SlotIndex < InventoryData.MaxSlotCount)
+	{
+		// A slot we haven't built a widget for yet (e.g. initial replication), rebuild the grid
+		Refresh();
+	}
+}
+
 void UHarmoniaInventoryWidget::SetInventoryComponent(UHarmoniaInventoryComponent* InComponent)
 {
+	UnbindFromInventoryComponent();
     InventoryComponent = InComponent;
+	BindToInventoryComponent();
     Refresh();
-}
\ No newline at end of file
+}
+
+void UHarmoniaInventoryWidget::BindToInventoryComponent()
+{
+	if (InventoryComponent)
+	{
+		InventoryComponent->OnInventorySlotChanged.AddUniqueDynamic(this, &UHarmoniaInventoryWidget::RefreshSlot);
+	}
+}
+
+void UHarmoniaInventoryWidget::UnbindFromInventoryComponent()
+{
+	if (InventoryComponent)
+	{
+		InventoryComponent->OnInventorySlotChanged.RemoveDynamic(this, &UHarmoniaInventoryWidget::RefreshSlot);
+	}
+}
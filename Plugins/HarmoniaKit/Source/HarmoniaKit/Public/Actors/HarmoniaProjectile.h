@@ -32,6 +32,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProjectileExplodeDelegate, const
  * - Homing projectiles
  * - Penetrating projectiles
  * - Bouncing projectiles
+ *
+ * One replicated actor per projectile. Ranged combat simulates projectiles in
+ * UHarmoniaProjectileSubsystem by default, this actor is only spawned when
+ * UHarmoniaRangedCombatComponent::bUseActorProjectiles is set.
  */
 UCLASS()
 class HARMONIAKIT_API AHarmoniaProjectile : public AActor
@@ -43,6 +47,7 @@ public:
 
 	//~AActor interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	//~End of AActor interface
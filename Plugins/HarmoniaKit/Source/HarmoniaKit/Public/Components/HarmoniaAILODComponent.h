@@ -7,6 +7,7 @@
 #include "HarmoniaAILODComponent.generated.h"
 
 class APlayerController;
+class ULyraSignificanceManager;
 
 /**
  * AI LOD (Level of Detail) Level
@@ -65,7 +66,7 @@ public:
 	bool bEnableLOD = true;
 
 	/**
-	 * Distance thresholds for LOD levels (in cm)
+	 * Distance thresholds for LOD levels (in cm), also applied when the owner is scored by the significance manager
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD|Distance")
 	float VeryHighDistance = 1500.0f;
@@ -180,6 +181,7 @@ public:
 
 	/**
 	 * Get nearest player controller
+	 * Only tracked when the owner is not scored by the significance manager
 	 */
 	UFUNCTION(BlueprintCallable, Category = "AI LOD")
 	APlayerController* GetNearestPlayer() const;
@@ -194,6 +196,12 @@ protected:
 	 */
 	void UpdateLODLevel();
 
+	/**
+	 * Take distance and visibility from the significance manager, map the distance through the LOD thresholds
+	 * and shift the result by the bucket's visibility, screen size and combat adjustments
+	 */
+	void UpdateLODLevelFromSignificance(const ULyraSignificanceManager& SignificanceManager);
+
 	/**
 	 * Calculate LOD level from distance
 	 */
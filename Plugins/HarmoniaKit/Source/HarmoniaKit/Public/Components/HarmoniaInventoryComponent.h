@@ -12,6 +12,9 @@ class AHarmoniaItemActor;
 // Inventory event delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryChanged);
 
+// Per-slot event delegate (fired for each slot that changed, on server and clients)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventorySlotChanged, int32, SlotIndex, const FInventorySlot&, Slot);
+
 UENUM(BlueprintType)
 enum class EInventorySortMethod : uint8
 {
@@ -31,11 +34,12 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
-	UFUNCTION()
-	void OnRep_InventoryData();
+	/** Called by the replicated slot array for each slot that was added or changed on this client */
+	void HandleSlotReplicated(const FInventorySlot& Slot);
 
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void RequestPickupItem(AHarmoniaItemActor* Item);
@@ -61,6 +65,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	int32 GetTotalCount(const FHarmoniaID& ItemID) const;
 
+	/** Looks up a slot by its slot index (not its position in the replicated array) */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	bool GetSlot(int32 SlotIndex, FInventorySlot& OutSlot) const;
+
 	// ============================================================================
 	// Internal Operations (Server-only, for plugin-internal use)
 	// WARNING: Do not call these directly from blueprints or client code!
@@ -101,6 +109,15 @@ protected:
 	UFUNCTION(Server, Reliable, WithValidation)
 	void ServerDropItem(int32 SlotIndex);
 
+	/** Server: keep the assets needed to drop this item resident while it is in the inventory */
+	void PreloadItemAssets(const FHarmoniaID& ItemID) const;
+
+	/** Server: drop the preload of ItemID once its last stack left the inventory */
+	void ReleaseItemAssets(const FHarmoniaID& ItemID) const;
+
+	/** Server: spawn the world actor of a dropped item, streaming its class in first if needed */
+	void SpawnDroppedItem(const TSoftClassPtr<AActor>& WorldActorClass, const FHarmoniaID& ItemID, int32 Count, float Durability);
+
 	UFUNCTION(Server, Reliable, WithValidation)
 	void ServerAddItem(const FHarmoniaID& ItemID, int32 Count, float Durability);
 
@@ -119,12 +136,19 @@ protected:
 	 */
 	void Clear();
 
+	/** Server: replicate a single changed slot and notify local per-slot listeners */
+	void NotifySlotChanged(int32 SlotIndex);
+
 public:
-	// Server <-> Client synchronization
-	UPROPERTY(ReplicatedUsing = OnRep_InventoryData, EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+	// Server <-> Client synchronization (delta replicated per slot)
+	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "Inventory")
 	FInventoryData InventoryData = FInventoryData();
 
-	// Delegate that client UI binds to
+	// Delegate that client UI binds to (once per change on the server, once per received update on clients)
 	UPROPERTY(BlueprintAssignable)
 	FOnInventoryChanged OnInventoryChanged;
+
+	// Delegate for UI that only wants to refresh the slots that changed
+	UPROPERTY(BlueprintAssignable)
+	FOnInventorySlotChanged OnInventorySlotChanged;
 };
\ No newline at end of file
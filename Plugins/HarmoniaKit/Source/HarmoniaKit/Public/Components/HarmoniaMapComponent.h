@@ -38,9 +38,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map")
 	TObjectPtr<UHarmoniaMapDataAsset> CurrentMapData;
 
-	// Explored regions (replicated to owner only)
-	UPROPERTY(ReplicatedUsing = OnRep_ExploredRegions, BlueprintReadOnly, Category = "Map|Exploration")
-	TArray<FExploredRegion> ExploredRegions;
+	// Exploration mask over the map bounds (tiles delta replicated to owner only)
+	UPROPERTY(Replicated)
+	FHarmoniaExplorationGrid ExplorationGrid;
 
 	// Discovered locations (replicated to owner only)
 	UPROPERTY(ReplicatedUsing = OnRep_DiscoveredLocations, BlueprintReadOnly, Category = "Map|Locations")
@@ -98,6 +98,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Map|Exploration")
 	void AddExploredRegion(const FVector& Center, float Radius);
 
+	// Called by ExplorationGrid on the owning client after a batch of tiles was received
+	void HandleExplorationReplicated();
+
 	// Discover a location
 	UFUNCTION(BlueprintCallable, Category = "Map|Locations")
 	void DiscoverLocation(const FMapLocationData& Location);
@@ -162,10 +165,6 @@ protected:
 	// Timer for exploration updates
 	float ExplorationUpdateTimer = 0.0f;
 
-	// Replication notify for explored regions
-	UFUNCTION()
-	void OnRep_ExploredRegions();
-
 	// Replication notify for discovered locations
 	UFUNCTION()
 	void OnRep_DiscoveredLocations();
@@ -199,6 +198,10 @@ protected:
 	UFUNCTION(Server, Reliable, WithValidation)
 	void ServerRemoveBookmark(int32 BookmarkIndex);
 
+	// Client RPC carrying the region the server revealed, so remote owners raise the same OnRegionExplored
+	UFUNCTION(Client, Reliable)
+	void ClientRegionExplored(const FExploredRegion& Region);
+
 	// Replication notify for bookmarks
 	UFUNCTION()
 	void OnRep_Bookmarks();
@@ -227,6 +230,15 @@ private:
 	// Initialize fog of war renderer
 	void InitializeFogOfWarRenderer();
 
+	// Upload the exploration tiles changed since the last flush
+	void FlushFogOfWarUpdates();
+
+	// Scratch list for FlushFogOfWarUpdates
+	TArray<int32> DirtyTileScratch;
+
+	// Regions received from the server whose tiles have not replicated yet
+	TArray<FExploredRegion> PendingExploredRegions;
+
 	// Rate limiting for ping creation
 	float LastPingTime = 0.0f;
 	TArray<float> PingTimestamps;
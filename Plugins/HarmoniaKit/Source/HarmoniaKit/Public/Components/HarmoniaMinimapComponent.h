@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
+#include "System/HarmoniaMarkerRegistrySubsystem.h"
 #include "HarmoniaMinimapComponent.generated.h"
 
 class UMaterialInstanceDynamic;
@@ -166,6 +167,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMinimapInitialized);
  * - Icon categories and filtering
  * - Off-screen direction indicators
  * - Fog of war integration (optional)
+ *
+ * Icons are indexed in the shared UHarmoniaMarkerRegistrySubsystem, so each update only
+ * positions the icons around the capture area (plus edge clamped ones) and UI reads the
+ * resulting priority-sorted list in place through ForEachVisibleIcon.
  */
 UCLASS(ClassGroup=(Harmonia), meta=(BlueprintSpawnableComponent))
 class HARMONIAKIT_API UHarmoniaMinimapComponent : public UActorComponent
@@ -269,12 +274,18 @@ public:
 
 	/** Get all icons */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|Minimap|Icons")
-	TArray<FHarmoniaMinimapIcon> GetAllIcons() const { return Icons; }
+	TArray<FHarmoniaMinimapIcon> GetAllIcons() const;
 
-	/** Get visible icons */
+	/** Get visible icons, sorted by priority */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|Minimap|Icons")
 	TArray<FHarmoniaMinimapIcon> GetVisibleIcons() const;
 
+	/** Visit the visible icons in priority order without copying them. Valid until the next update */
+	void ForEachVisibleIcon(TFunctionRef<void(const FHarmoniaMinimapIcon&)> Visitor) const;
+
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Minimap|Icons")
+	int32 GetNumVisibleIcons() const { return VisibleIconIndices.Num(); }
+
 	/** Get icon by ID */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|Minimap|Icons")
 	bool GetIconByID(FGuid IconID, FHarmoniaMinimapIcon& OutIcon) const;
@@ -345,7 +356,7 @@ protected:
 	/** Update tracked actor positions */
 	void UpdateTrackedIcons();
 
-	/** Update icon positions on minimap */
+	/** Update the icons around the capture area and rebuild the visible list */
 	void UpdateIconPositions();
 
 	/** Clean up invalid actor references */
@@ -377,14 +388,44 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Config")
 	FHarmoniaMinimapConfig Config;
 
-	/** All registered icons */
-	UPROPERTY()
-	TArray<FHarmoniaMinimapIcon> Icons;
+	struct FIconSlot
+	{
+		FHarmoniaMinimapIcon Data;
+		FHarmoniaMarkerHandle Handle;
+	};
+
+	/** Index the icon of a slot in the registry */
+	void RegisterSlot(int32 SlotIndex);
+
+	/** Remove a slot, its registry entry and broadcast OnIconRemoved */
+	void RemoveSlot(int32 SlotIndex);
+
+	int32 FindSlot(const FGuid& IconID) const;
+
+	void RefreshHiddenCategoryMask();
+
+	UHarmoniaMarkerRegistrySubsystem* GetRegistry() const;
+
+	/** All registered icons (slot indices are the registry payload indices) */
+	TSparseArray<FIconSlot> IconSlots;
+
+	TMap<FGuid, int32> IconSlotById;
+
+	/** Slots visible after the last update, highest priority first */
+	TArray<int32> VisibleIconIndices;
+
+	/** Query scratch buffers */
+	TArray<FHarmoniaMarkerQueryHit> QueryHits;
+	TArray<int32> LostSlots;
 
 	/** Hidden categories */
 	UPROPERTY()
 	TArray<FGameplayTag> HiddenCategories;
 
+	uint64 HiddenCategoryMask = 0;
+
+	TWeakObjectPtr<UHarmoniaMarkerRegistrySubsystem> CachedRegistry;
+
 	/** Actor to center minimap on */
 	UPROPERTY()
 	TWeakObjectPtr<AActor> CenterActor;
@@ -54,6 +54,10 @@ struct HARMONIAKIT_API FHarmoniaNetOptConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Distance")
 	float MinimalDistance = 10000.0f;
 
+	/** Extra distance past a threshold before dropping to a lower level, stops actors on a boundary from flipping every pass */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Distance", meta = (ClampMin = "0"))
+	float HysteresisDistance = 300.0f;
+
 	// ============================================================================
 	// Net Update Frequency Settings
 	// ============================================================================
@@ -110,7 +114,7 @@ struct HARMONIAKIT_API FHarmoniaNetOptConfig
 	// Update Settings
 	// ============================================================================
 
-	/** How often to recalculate optimization level (seconds) */
+	/** Unused, levels are recalculated by UHarmoniaNetRelevancySubsystem every TierUpdateInterval */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Update")
 	float RecalculationInterval = 0.5f;
 
@@ -135,6 +139,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNetOptLevelChanged, EHarmoniaNet
  * Reduces bandwidth usage by adjusting NetUpdateFrequency and
  * enabling dormancy for distant actors.
  *
+ * The component does not tick. On the server it registers with UHarmoniaNetRelevancySubsystem,
+ * which levels every registered actor in one pass and calls back only when the level changes.
+ *
  * Features:
  * - Distance-based NetUpdateFrequency adjustment
  * - Automatic dormancy management
@@ -152,7 +159,6 @@ public:
 
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// ============================================================================
 	// Configuration
@@ -213,18 +219,34 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Harmonia|Network")
 	FOnNetOptLevelChanged OnLevelChanged;
 
+	// ============================================================================
+	// Level Calculation
+	// ============================================================================
+
+	/** Convert distance to optimization level */
+	static EHarmoniaNetOptLevel DistanceToLevel(const FHarmoniaNetOptConfig& InConfig, float Distance);
+
+	/**
+	 * Level for Distance given the current level: moving closer applies at once,
+	 * moving away only once the distance clears the threshold by HysteresisDistance. Applies the combat boost.
+	 * Pure, safe to call from the parallel tier pass.
+	 */
+	static EHarmoniaNetOptLevel CalculateLevel(const FHarmoniaNetOptConfig& InConfig, float Distance, EHarmoniaNetOptLevel InCurrentLevel, bool bInCombat);
+
 protected:
-	/** Recalculate optimization level */
+	friend class UHarmoniaNetRelevancySubsystem;
+
+	/** Recalculate optimization level now, from the player locations of the last tier pass */
 	void RecalculateLevel();
 
-	/** Apply current level settings */
-	void ApplyLevelSettings();
+	/** Switch to a new level, applies frequency and dormancy only if it differs. Returns true on change */
+	bool SetLevel(EHarmoniaNetOptLevel NewLevel, float DistanceToNearestPlayer);
 
-	/** Calculate distance to nearest player */
-	float CalculateDistanceToNearestPlayer() const;
+	/** Advance the dormancy delay while at Dormant level */
+	void UpdateDormancyDelay(float DeltaTime);
 
-	/** Convert distance to optimization level */
-	EHarmoniaNetOptLevel DistanceToLevel(float Distance) const;
+	/** Apply current level settings */
+	void ApplyLevelSettings();
 
 	/** Get net update frequency for level */
 	float GetNetUpdateFrequencyForLevel(EHarmoniaNetOptLevel Level) const;
@@ -245,9 +267,6 @@ private:
 	/** Whether in combat */
 	bool bIsInCombat = false;
 
-	/** Time since last recalculation */
-	float TimeSinceRecalculation = 0.0f;
-
 	/** Cached distance to nearest player */
 	float CachedDistanceToNearestPlayer = 0.0f;
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Definitions/HarmoniaQuestSystemDefinitions.h"
+#include "System/HarmoniaTimerWheelSubsystem.h"
 #include "Engine/DataTable.h"
 #include "HarmoniaQuestComponent.generated.h"
 
@@ -27,6 +28,45 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQuestAbandoned, FHarmoniaID, Que
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQuestUnlocked, FHarmoniaID, QuestId, const FHarmoniaQuestData&, QuestData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQuestEventTriggered, FHarmoniaID, QuestId, const FQuestEvent&, Event);
 
+/**
+ * Key into the active objective index: objective type + target ID, or objective type + target tag
+ */
+struct FQuestObjectiveIndexKey
+{
+	EQuestObjectiveType ObjectiveType = EQuestObjectiveType::Kill;
+	FName Target;
+	bool bIsTag = false;
+
+	FQuestObjectiveIndexKey() = default;
+	FQuestObjectiveIndexKey(EQuestObjectiveType InType, const FHarmoniaID& InTargetId) : ObjectiveType(InType), Target(InTargetId.Id), bIsTag(false) {}
+	FQuestObjectiveIndexKey(EQuestObjectiveType InType, const FGameplayTag& InTag) : ObjectiveType(InType), Target(InTag.GetTagName()), bIsTag(true) {}
+
+	bool operator==(const FQuestObjectiveIndexKey& Other) const
+	{
+		return ObjectiveType == Other.ObjectiveType && Target == Other.Target && bIsTag == Other.bIsTag;
+	}
+
+	friend uint32 GetTypeHash(const FQuestObjectiveIndexKey& Key)
+	{
+		return HashCombine(HashCombine(::GetTypeHash((uint8)Key.ObjectiveType), GetTypeHash(Key.Target)), ::GetTypeHash(Key.bIsTag));
+	}
+};
+
+/**
+ * Objective of an active quest, as stored in the objective index
+ */
+struct FQuestObjectiveRef
+{
+	FHarmoniaID QuestId;
+	int32 Phase = 0;
+	int32 ObjectiveIndex = INDEX_NONE;
+
+	bool operator==(const FQuestObjectiveRef& Other) const
+	{
+		return QuestId == Other.QuestId && Phase == Other.Phase && ObjectiveIndex == Other.ObjectiveIndex;
+	}
+};
+
 /**
  * HarmoniaQuestComponent
  *
@@ -48,11 +88,12 @@ class HARMONIAKIT_API UHarmoniaQuestComponent : public UActorComponent
 public:
 	UHarmoniaQuestComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	//~==============================================
 	//~ Quest Data Configuration
@@ -66,17 +107,28 @@ public:
 	//~ Quest State
 	//~==============================================
 protected:
-	/** Active quests in progress */
-	UPROPERTY(ReplicatedUsing = OnRep_ActiveQuests, BlueprintReadOnly, Category = "Quest")
-	TArray<FActiveQuestProgress> ActiveQuests;
+	/** Active quests in progress (delta-replicated per quest) */
+	UPROPERTY(Replicated)
+	FActiveQuestList ActiveQuests;
 
 	/** Completed quest IDs */
-	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Quest")
-	TArray<FHarmoniaID> CompletedQuests;
+	UPROPERTY(Replicated)
+	FQuestIdSet CompletedQuests;
 
 	/** Failed quest IDs */
-	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Quest")
-	TArray<FHarmoniaID> FailedQuests;
+	UPROPERTY(Replicated)
+	FQuestIdSet FailedQuests;
+
+	/** Server: quests whose objective progress changed since the last net update */
+	TSet<FHarmoniaID> PendingDirtyQuests;
+
+	/** Client: last received objective counts per quest, used to detect which objectives changed */
+	struct FReplicatedObjectiveCounts
+	{
+		int32 Phase = INDEX_NONE;
+		TArray<int32> Counts;
+	};
+	TMap<FHarmoniaID, FReplicatedObjectiveCounts> ReplicatedObjectiveCounts;
 
 	/** Currently tracked quest (displayed prominently in UI) */
 	UPROPERTY(ReplicatedUsing = OnRep_TrackedQuest, BlueprintReadOnly, Category = "Quest")
@@ -90,12 +142,25 @@ protected:
 	UPROPERTY()
 	UHarmoniaCraftingComponent* CraftingComponent;
 
-	UFUNCTION()
-	void OnRep_ActiveQuests();
-
 	UFUNCTION()
 	void OnRep_TrackedQuest();
 
+	/**
+	 * Server: queue a modified quest for replication
+	 * Repeated updates to the same quest are coalesced and flushed once per net update in PreReplication
+	 */
+	void MarkQuestProgressDirty(FHarmoniaID QuestId);
+
+	/** Server: mark every pending quest dirty in the replicated list */
+	void FlushPendingQuestUpdates();
+
+public:
+	/** Client: called by FActiveQuestList when a quest entry is added or changed */
+	void HandleActiveQuestReplicated(const FActiveQuestProgress& Progress, bool bAdded);
+
+	/** Client: called by FActiveQuestList before a quest entry is removed */
+	void HandleActiveQuestRemovedReplicated(const FActiveQuestProgress& Progress);
+
 	//~==============================================
 	//~ Quest Operations
 	//~==============================================
@@ -166,21 +231,34 @@ public:
 
 	/**
 	 * Get all active quests
+	 * ElapsedTime of the entries is not refreshed, query GetQuestElapsedTime / GetQuestRemainingTime for timers
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest")
+	const TArray<FActiveQuestProgress>& GetActiveQuests() const { return ActiveQuests.Items; }
+
+	/**
+	 * Seconds since an active quest started (0 if not active)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Quest")
+	float GetQuestElapsedTime(FHarmoniaID QuestId) const;
+
+	/**
+	 * Seconds left before an active quest's time limit (0 if not active or without time limit)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Quest")
-	TArray<FActiveQuestProgress> GetActiveQuests() const { return ActiveQuests; }
+	float GetQuestRemainingTime(FHarmoniaID QuestId) const;
 
 	/**
 	 * Get all completed quests
 	 */
 	UFUNCTION(BlueprintPure, Category = "Quest")
-	TArray<FHarmoniaID> GetCompletedQuests() const { return CompletedQuests; }
+	const TArray<FHarmoniaID>& GetCompletedQuests() const { return CompletedQuests.GetIds(); }
 
 	/**
 	 * Get all failed quests
 	 */
 	UFUNCTION(BlueprintPure, Category = "Quest")
-	TArray<FHarmoniaID> GetFailedQuests() const { return FailedQuests; }
+	const TArray<FHarmoniaID>& GetFailedQuests() const { return FailedQuests.GetIds(); }
 
 	/**
 	 * Get currently tracked quest ID
@@ -388,9 +466,9 @@ public:
 
 protected:
 	/**
-	 * Update hint system (check if hints should be shown)
+	 * Called by the timer wheel once a hint's delay has passed for an active quest
 	 */
-	void UpdateHintSystem(float DeltaTime);
+	void OnHintDelayElapsed(FHarmoniaID QuestId, int32 HintIndex);
 
 	//~==============================================
 	//~ Quest Statistics
@@ -476,11 +554,21 @@ protected:
 	//~==============================================
 	//~ Quest Fail Conditions
 	//~==============================================
+public:
+	/**
+	 * Report a gameplay event that may fail active quests (NPC died, item lost, player died, custom)
+	 * Only quests indexed with a matching fail condition type are checked
+	 * @param ConditionType - Fail condition type the event corresponds to
+	 * @param TargetId - NPC / item the event is about (invalid matches conditions without a target)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Quest|FailConditions")
+	void NotifyFailConditionEvent(EQuestFailConditionType ConditionType, FHarmoniaID TargetId);
+
 protected:
 	/**
-	 * Check fail conditions for active quests
+	 * Check polled fail conditions (LocationLeft) of a single quest, reschedules itself while the quest is active
 	 */
-	void CheckFailConditions(float DeltaTime);
+	void CheckFailConditions(FHarmoniaID QuestId);
 
 	/**
 	 * Check specific fail condition
@@ -518,10 +606,23 @@ protected:
 	//~==============================================
 protected:
 	/**
-	 * Update time-limited quests
-	 * @param DeltaTime - Time elapsed since last tick
+	 * Called by the timer wheel when a time-limited quest reaches its deadline
+	 */
+	void OnQuestTimeLimitExpired(FHarmoniaID QuestId);
+
+	/**
+	 * Refresh ElapsedTime of an active quest from its start time
 	 */
-	void UpdateTimeLimitedQuests(float DeltaTime);
+	void RefreshElapsedTime(FActiveQuestProgress& Progress) const;
+
+	/**
+	 * Time base of quest start times: the server world time, also on clients
+	 */
+	float GetQuestTimeSeconds() const;
+
+	/** Interval between LocationLeft fail condition checks (seconds) */
+	UPROPERTY(EditDefaultsOnly, Category = "Quest|FailConditions", meta = (ClampMin = "0.1"))
+	float FailConditionCheckInterval = 0.5f;
 
 	/**
 	 * Check if quest time limit expired
@@ -562,9 +663,6 @@ protected:
 	UFUNCTION(Client, Reliable)
 	void ClientQuestAbandoned(FHarmoniaID QuestId);
 
-	UFUNCTION(Client, Reliable)
-	void ClientObjectiveUpdated(FHarmoniaID QuestId, int32 ObjectiveIndex);
-
 	//~==============================================
 	//~ Delegates
 	//~==============================================
@@ -656,6 +754,52 @@ protected:
 	 */
 	void CheckAutoComplete(FHarmoniaID QuestId);
 
+	/**
+	 * Row lookup without copying the quest data
+	 */
+	const FHarmoniaQuestData* FindQuestData(FHarmoniaID QuestId) const;
+
+	//~==============================================
+	//~ Objective Index
+	//~==============================================
+protected:
+	/**
+	 * Add the current phase's objectives and the fail conditions of an active quest to the indices,
+	 * and schedule its time limit, hints and polled fail conditions on the timer wheel
+	 */
+	void IndexActiveQuest(const FActiveQuestProgress& Progress);
+
+	/**
+	 * Remove a quest from the indices and cancel its scheduled timers
+	 */
+	void UnindexActiveQuest(FHarmoniaID QuestId);
+
+	/** Remove only the objective entries of a quest (phase change) */
+	void UnindexObjectives(FHarmoniaID QuestId);
+
+	/** Add the objective entries of a quest's current phase */
+	void IndexObjectives(const FActiveQuestProgress& Progress);
+
+	/** Rebuild all indices from the active quest list (save game load) */
+	void RebuildActiveQuestIndex();
+
+	/** Apply progress to the given objectives, skipping ones that completed or whose phase moved on */
+	void ApplyObjectiveProgress(TConstArrayView<FQuestObjectiveRef> Matches, int32 Progress);
+
+	UHarmoniaTimerWheelSubsystem* GetTimerWheel() const;
+
+	/** (objective type, target) -> objectives of active quests waiting for that target */
+	TMap<FQuestObjectiveIndexKey, TArray<FQuestObjectiveRef>> ObjectiveIndex;
+
+	/** Keys each quest is registered under, so it can be removed without scanning the index */
+	TMap<FHarmoniaID, TArray<FQuestObjectiveIndexKey>> ObjectiveIndexKeysByQuest;
+
+	/** Fail condition type -> active quests that have a condition of that type */
+	TMap<EQuestFailConditionType, TArray<FHarmoniaID>> FailConditionIndex;
+
+	/** Timer wheel entries (time limit, hints, polled fail conditions) of each active quest */
+	TMap<FHarmoniaID, TArray<FHarmoniaTimerWheelHandle>> QuestTimerHandles;
+
 	//~==============================================
 	//~ Security & Anti-Cheat
 	//~==============================================
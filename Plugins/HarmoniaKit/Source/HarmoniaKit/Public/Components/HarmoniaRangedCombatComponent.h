@@ -273,6 +273,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Harmonia|Ranged Combat")
 	AActor* SpawnProjectile(const FHarmoniaProjectileData& ProjectileData, const FVector& SpawnLocation, const FVector& Direction, float DamageMultiplier = 1.0f);
 
+	/**
+	 * Spawn a volley in UHarmoniaProjectileSubsystem and send it to clients (server only)
+	 * @return Number of projectiles spawned
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Harmonia|Ranged Combat")
+	int32 SpawnProjectileVolley(const FHarmoniaProjectileVolley& Volley);
+
 	// ============================================================================
 	// Delegates
 	// ============================================================================
@@ -339,6 +346,14 @@ protected:
 	UFUNCTION(Server, Reliable, WithValidation)
 	void ServerReleaseDrawing();
 
+	// ============================================================================
+	// Multicast RPCs
+	// ============================================================================
+
+	/** Spawn parameters of a managed volley, clients simulate it cosmetically */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastProjectileVolley(const FHarmoniaProjectileVolley& Volley);
+
 	// ============================================================================
 	// Replication Callbacks
 	// ============================================================================
@@ -364,6 +379,10 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Harmonia|Ranged Combat")
 	TSubclassOf<AActor> DefaultProjectileClass;
 
+	/** Spawn one DefaultProjectileClass actor per projectile instead of simulating them in UHarmoniaProjectileSubsystem */
+	UPROPERTY(EditDefaultsOnly, Category = "Harmonia|Ranged Combat")
+	bool bUseActorProjectiles = false;
+
 	/** Trajectory visualization component (optional) */
 	UPROPERTY(EditDefaultsOnly, Category = "Harmonia|Ranged Combat")
 	TObjectPtr<USplineComponent> TrajectorySpline;
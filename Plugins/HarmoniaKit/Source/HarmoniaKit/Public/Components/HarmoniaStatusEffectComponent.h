@@ -6,6 +6,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "GameplayEffectTypes.h"
+#include "System/HarmoniaTimerWheelSubsystem.h"
 #include "HarmoniaStatusEffectComponent.generated.h"
 
 class UAbilitySystemComponent;
@@ -101,11 +102,11 @@ struct HARMONIAKIT_API FHarmoniaStatusEffectUIData
 	UPROPERTY(BlueprintReadOnly, Category = "StatusEffect")
 	float TotalDuration = 0.0f;
 
-	/** Remaining duration in seconds */
+	/** Remaining duration in seconds, computed from StartTime + TotalDuration when the effect is read */
 	UPROPERTY(BlueprintReadOnly, Category = "StatusEffect")
 	float RemainingDuration = 0.0f;
 
-	/** Start time (world time) */
+	/** Start time (world time). Rebased when the remaining duration is changed, StartTime + TotalDuration is always the expiry time */
 	UPROPERTY(BlueprintReadOnly, Category = "StatusEffect")
 	float StartTime = 0.0f;
 
@@ -193,6 +194,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatusEffectExpiring, const FHarm
  * - Expiring effect warnings
  * - Custom effect configurations
  * - Blueprint-friendly events
+ *
+ * The component does not tick. Effects are stored as start time + duration and the remaining time
+ * is computed when an effect is read. "Expiring soon" warnings and the expiry of custom effects are
+ * scheduled on the shared UHarmoniaTimerWheelSubsystem, GAS effects are removed by GAS itself.
  */
 UCLASS(ClassGroup=(Harmonia), meta=(BlueprintSpawnableComponent))
 class HARMONIAKIT_API UHarmoniaStatusEffectComponent : public UActorComponent
@@ -204,7 +209,6 @@ public:
 
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// ============================================================================
 	// GAS Integration
@@ -224,7 +228,7 @@ public:
 
 	/** Get all active effects */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|StatusEffect")
-	TArray<FHarmoniaStatusEffectUIData> GetAllEffects() const { return ActiveEffects; }
+	TArray<FHarmoniaStatusEffectUIData> GetAllEffects() const;
 
 	/** Get effects by type (buff/debuff) */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|StatusEffect")
@@ -258,6 +262,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Harmonia|StatusEffect")
 	int32 GetEffectStackCount(FGameplayTag EffectTag) const;
 
+	/** Get remaining duration of an effect (0 if unknown or without duration) */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|StatusEffect")
+	float GetEffectRemainingDuration(FGuid EffectID) const;
+
+	/** IDs of active effects of a type, in the order they were added (no copy) */
+	const TArray<FGuid>& GetEffectIDsByType(EHarmoniaStatusEffectType Type) const;
+
+	/** IDs of active effects of a category, in the order they were added (no copy) */
+	const TArray<FGuid>& GetEffectIDsByCategory(EHarmoniaStatusEffectCategory Category) const;
+
 	// ============================================================================
 	// Manual Effect Management (for non-GAS effects)
 	// ============================================================================
@@ -326,8 +340,34 @@ public:
 	FOnStatusEffectExpiring OnEffectExpiring;
 
 protected:
-	/** Update all effect timers */
-	void UpdateEffectTimers(float DeltaTime);
+	/** Store, index and schedule a new effect, then broadcast OnEffectAdded */
+	void AddEffect(const FHarmoniaStatusEffectUIData& Effect);
+
+	/** Unindex, unschedule and remove the effect at Index, then broadcast OnEffectRemoved */
+	void RemoveEffectAt(int32 Index);
+
+	/** Index of an effect in ActiveEffects, INDEX_NONE if not active */
+	int32 FindEffectIndex(FGuid EffectID) const;
+
+	/** Fill RemainingDuration, DurationProgress and bIsExpiringSoon for the current world time */
+	void RefreshEffectTiming(FHarmoniaStatusEffectUIData& Effect) const;
+
+	/** Schedule the expiring warning (and expiry, for custom effects), cancelling the previous schedule */
+	void ScheduleEffectTimers(const FHarmoniaStatusEffectUIData& Effect);
+
+	/** Cancel the scheduled callbacks of an effect */
+	void CancelEffectTimers(FGuid EffectID);
+
+	/** Timer wheel callback: warn once that an effect is about to expire */
+	void OnEffectExpiringSoon(FGuid EffectID);
+
+	/** Timer wheel callback: remove a custom effect whose duration ran out */
+	void OnCustomEffectExpired(FGuid EffectID);
+
+	/** Stop listening to the tracked ASC */
+	void UnbindFromASC();
+
+	UHarmoniaTimerWheelSubsystem* GetTimerWheel() const;
 
 	/** Handle GAS effect applied */
 	void OnGameplayEffectApplied(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
@@ -338,6 +378,9 @@ protected:
 	/** Handle GAS effect stack changed */
 	void OnGameplayEffectStackChanged(FActiveGameplayEffectHandle Handle, int32 NewStackCount, int32 PreviousStackCount);
 
+	/** Handle GAS effect duration refreshed */
+	void OnGameplayEffectTimeChanged(FActiveGameplayEffectHandle Handle, float NewStartTime, float NewDuration);
+
 	/** Create UI data from gameplay effect */
 	FHarmoniaStatusEffectUIData CreateUIDataFromEffect(const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
 
@@ -347,18 +390,33 @@ protected:
 	/** Format magnitude text */
 	FText FormatMagnitudeText(const FGameplayEffectSpec& Spec) const;
 
-	/** Clean up expired custom effects */
-	void CleanupExpiredEffects();
-
 private:
 	/** Tracked Ability System Component */
 	UPROPERTY()
 	TWeakObjectPtr<UAbilitySystemComponent> TrackedASC;
 
-	/** All active effects for UI display */
+	/** All active effects for UI display, in the order they were added */
 	UPROPERTY()
 	TArray<FHarmoniaStatusEffectUIData> ActiveEffects;
 
+	/** Effect ID -> index in ActiveEffects */
+	TMap<FGuid, int32> EffectIndexByID;
+
+	/** GAS handle -> effect ID */
+	TMap<FActiveGameplayEffectHandle, FGuid> EffectIDByHandle;
+
+	/** Indexed views, kept up to date on add/remove */
+	TMap<EHarmoniaStatusEffectType, TArray<FGuid>> EffectIDsByType;
+	TMap<EHarmoniaStatusEffectCategory, TArray<FGuid>> EffectIDsByCategory;
+
+	/** Pending timer wheel callbacks of an effect */
+	struct FEffectTimers
+	{
+		FHarmoniaTimerWheelHandle ExpiringSoon;
+		FHarmoniaTimerWheelHandle Expiry;
+	};
+	TMap<FGuid, FEffectTimers> EffectTimers;
+
 	/** Effect configurations (tag -> config) */
 	TMap<FGameplayTag, FHarmoniaStatusEffectConfig> EffectConfigs;
 
@@ -6,6 +6,8 @@
 #include "Components/ActorComponent.h"
 #include "HarmoniaThreatComponent.generated.h"
 
+class UHarmoniaThreatSubsystem;
+
 /**
  * Threat Entry
  * Stores threat/aggro information for a single actor
@@ -52,6 +54,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHighestThreatChangedDelegate, AA
  * - Smart target selection based on threat
  * - Tank taunt support
  *
+ * The table itself lives in UHarmoniaThreatSubsystem, which decays, expires and notifies for every
+ * component in one place. This component does not tick, it forwards to its table and handles taunts.
+ * Threat events are batched: OnThreatChanged fires at most once per actor per frame.
+ *
  * Usage: Add to monster actors to enable threat system
  */
 UCLASS(Blueprintable, ClassGroup = (HarmoniaKit), meta = (BlueprintSpawnableComponent))
@@ -62,7 +68,8 @@ class HARMONIAKIT_API UHarmoniaThreatComponent : public UActorComponent
 public:
 	UHarmoniaThreatComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// ============================================================================
 	// Configuration
@@ -70,6 +77,7 @@ public:
 
 	/**
 	 * Threat decay rate per second (percentage)
+	 * Configuration is read when the table is registered, call RefreshThreatConfig after changing it at runtime
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Threat|Config")
 	float ThreatDecayRate = 0.05f;
@@ -145,6 +153,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Threat")
 	void Taunt(AActor* TauntActor, float Duration = 3.0f);
 
+	/**
+	 * Apply configuration changes made at runtime to the threat table
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Threat")
+	void RefreshThreatConfig();
+
 	// ============================================================================
 	// Threat Queries
 	// ============================================================================
@@ -171,7 +185,7 @@ public:
 	 * Get number of actors on threat table
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Threat")
-	int32 GetThreatTableSize() const { return ThreatTable.Num(); }
+	int32 GetThreatTableSize() const;
 
 	// ============================================================================
 	// Delegates
@@ -190,14 +204,15 @@ public:
 	FOnHighestThreatChangedDelegate OnHighestThreatChanged;
 
 protected:
+	friend class UHarmoniaThreatSubsystem;
+
 	/**
-	 * Threat table
+	 * Index of this component's table in the threat subsystem
 	 */
-	UPROPERTY(Transient)
-	TArray<FHarmoniaThreatEntry> ThreatTable;
+	int32 ThreatTableIndex = INDEX_NONE;
 
 	/**
-	 * Current highest threat actor (cached)
+	 * Highest threat actor as of the last OnHighestThreatChanged broadcast
 	 */
 	UPROPERTY(Transient)
 	TObjectPtr<AActor> CurrentHighestThreatActor = nullptr;
@@ -214,24 +229,14 @@ protected:
 	FTimerHandle TauntTimerHandle;
 
 	/**
-	 * Update threat decay
-	 */
-	void UpdateThreatDecay(float DeltaTime);
-
-	/**
-	 * Remove invalid/expired entries
-	 */
-	void CleanupThreatTable();
-
-	/**
-	 * Update highest threat actor
+	 * Threat subsystem with this component's table registered, null without a world
 	 */
-	void UpdateHighestThreatActor();
+	UHarmoniaThreatSubsystem* EnsureThreatTable();
 
 	/**
-	 * Find or create threat entry for actor
+	 * Threat subsystem if the table is registered
 	 */
-	FHarmoniaThreatEntry* FindOrAddThreatEntry(AActor* ThreatActor);
+	UHarmoniaThreatSubsystem* GetThreatSubsystem() const;
 
 	/**
 	 * Called when taunt expires
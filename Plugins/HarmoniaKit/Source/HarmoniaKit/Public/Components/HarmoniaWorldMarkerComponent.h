@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
+#include "System/HarmoniaMarkerRegistrySubsystem.h"
 #include "HarmoniaWorldMarkerComponent.generated.h"
 
 class UWidgetComponent;
@@ -149,6 +150,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWorldMarkerClicked, FGuid, Marke
  * - Category filtering
  * - Priority-based occlusion handling
  * - Multiple display modes
+ *
+ * Markers are indexed in the shared UHarmoniaMarkerRegistrySubsystem. Each update only
+ * visits the markers near the camera (plus the infinite-range ones) and rebuilds a
+ * priority-sorted visible list that UI reads in place through ForEachVisibleMarker.
  */
 UCLASS(ClassGroup=(Harmonia), meta=(BlueprintSpawnableComponent))
 class HARMONIAKIT_API UHarmoniaWorldMarkerComponent : public UActorComponent
@@ -159,6 +164,7 @@ public:
 	UHarmoniaWorldMarkerComponent();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// ============================================================================
@@ -207,12 +213,18 @@ public:
 
 	/** Get all markers */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|WorldMarker")
-	TArray<FHarmoniaWorldMarkerData> GetAllMarkers() const { return Markers; }
+	TArray<FHarmoniaWorldMarkerData> GetAllMarkers() const;
 
-	/** Get visible markers (for UI rendering) */
+	/** Get visible markers (for UI rendering), sorted by priority */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|WorldMarker")
 	TArray<FHarmoniaWorldMarkerData> GetVisibleMarkers() const;
 
+	/** Visit the visible markers in priority order without copying them. Valid until the next update */
+	void ForEachVisibleMarker(TFunctionRef<void(const FHarmoniaWorldMarkerData&)> Visitor) const;
+
+	UFUNCTION(BlueprintPure, Category = "Harmonia|WorldMarker")
+	int32 GetNumVisibleMarkers() const { return FMath::Min(VisibleMarkerIndices.Num(), MaxVisibleMarkers); }
+
 	/** Get marker by ID */
 	UFUNCTION(BlueprintPure, Category = "Harmonia|WorldMarker")
 	bool GetMarkerByID(FGuid MarkerID, FHarmoniaWorldMarkerData& OutMarker) const;
@@ -275,7 +287,7 @@ public:
 	FOnWorldMarkerClicked OnMarkerClicked;
 
 protected:
-	/** Update all marker positions and visibility */
+	/** Update position and visibility of the markers near the camera, rebuild the visible list */
 	void UpdateMarkers();
 
 	/** Calculate marker visibility based on display mode */
@@ -290,6 +302,9 @@ protected:
 	/** Clean up markers tracking destroyed actors */
 	void CleanupInvalidMarkers();
 
+	/** Clamp a projected position to the screen edge */
+	FVector2D ClampToScreenEdge(const FVector2D& ScreenPosition, float EdgePadding) const;
+
 	/** Get player camera location */
 	FVector GetCameraLocation() const;
 
@@ -297,14 +312,50 @@ protected:
 	FRotator GetCameraRotation() const;
 
 private:
-	/** All registered markers */
-	UPROPERTY()
-	TArray<FHarmoniaWorldMarkerData> Markers;
+	struct FMarkerSlot
+	{
+		FHarmoniaWorldMarkerData Data;
+		FHarmoniaMarkerHandle Handle;
+	};
+
+	/** Index the marker of a slot in the registry */
+	void RegisterSlot(int32 SlotIndex);
+
+	/** Remove a slot, its registry entry and broadcast OnMarkerRemoved */
+	void RemoveSlot(int32 SlotIndex);
+
+	int32 FindSlot(const FGuid& MarkerID) const;
+
+	void RefreshHiddenCategoryMask();
+
+	UHarmoniaMarkerRegistrySubsystem* GetRegistry() const;
+
+	/** All registered markers (slot indices are the registry payload indices) */
+	TSparseArray<FMarkerSlot> MarkerSlots;
+
+	TMap<FGuid, int32> MarkerSlotById;
+
+	/** Slots flagged bIsCurrentlyVisible by the last update */
+	TArray<int32> InRangeMarkerIndices;
+
+	/** Drawable slots (on screen or edge clamped) of the last update, highest priority first */
+	TArray<int32> VisibleMarkerIndices;
+
+	/** Query scratch buffers */
+	TArray<FHarmoniaMarkerQueryHit> QueryHits;
+	TArray<int32> LostSlots;
+
+	/** Largest finite MaxDisplayDistance, the registry query radius */
+	float MaxFiniteDisplayDistance = 0.0f;
 
 	/** Hidden categories */
 	UPROPERTY()
 	TArray<FGameplayTag> HiddenCategories;
 
+	uint64 HiddenCategoryMask = 0;
+
+	TWeakObjectPtr<UHarmoniaMarkerRegistrySubsystem> CachedRegistry;
+
 	/** Cached viewport size */
 	FVector2D CachedViewportSize;
 
@@ -7,6 +7,7 @@
 #include "GameplayEffectTypes.h"
 #include "SenseSysHelpers.h"
 #include "SenseStimulusBase.h"
+#include "Engine/NetSerialization.h"
 #include "HarmoniaCombatSystemDefinitions.generated.h"
 
 class UGameplayEffect;
@@ -1136,10 +1137,19 @@ struct HARMONIAKIT_API FHarmoniaProjectileData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visuals")
 	TObjectPtr<UStaticMesh> ProjectileMesh;
 
-	// Particle trail effect
+	// Collision sphere radius used for sweeps (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile", meta = (ClampMin = "0.0"))
+	float CollisionRadius = 10.0f;
+
+	// Particle trail effect (actor projectiles only)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
 	TObjectPtr<UParticleSystem> TrailEffect;
 
+	// Niagara system drawing the trails of all managed projectiles of this type in one component.
+	// Receives the projectile positions through the "ProjectilePositions" array parameter.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+	TObjectPtr<UNiagaraSystem> BatchedTrailSystem;
+
 	// Impact effect
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
 	TObjectPtr<UParticleSystem> ImpactEffect;
@@ -1153,6 +1163,57 @@ struct HARMONIAKIT_API FHarmoniaProjectileData
 	FGameplayTag ImpactGameplayCueTag;
 };
 
+/**
+ * Projectile Volley
+ * Everything needed to reproduce one shot (one or more projectiles) on every machine.
+ * Individual directions are regenerated from Seed, so a shotgun blast costs one RPC.
+ */
+USTRUCT(BlueprintType)
+struct HARMONIAKIT_API FHarmoniaProjectileVolley
+{
+	GENERATED_BODY()
+
+	// Shared configuration of every projectile in the volley
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	FHarmoniaProjectileData ProjectileData;
+
+	// Actor that fired the volley (ignored by the sweeps, source of damage)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	TObjectPtr<AActor> Instigator = nullptr;
+
+	// Target for homing projectiles
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	TObjectPtr<AActor> HomingTarget = nullptr;
+
+	// Spawn location
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	FVector_NetQuantize10 Origin = FVector::ZeroVector;
+
+	// Direction of the first projectile, the others are spread around it
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	FVector_NetQuantizeNormal Direction = FVector::ForwardVector;
+
+	// Spread cone half angle (degrees)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float SpreadAngle = 0.0f;
+
+	// Number of projectiles
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	uint8 Count = 1;
+
+	// Random seed for the spread directions
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	int32 Seed = 0;
+
+	// Damage multiplier (from weapon/ability)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float DamageMultiplier = 1.0f;
+
+	// Server world time of the shot, used by clients to catch up
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	double ServerSpawnTime = 0.0;
+};
+
 /**
  * Spell Data
  * Defines properties of a magic spell
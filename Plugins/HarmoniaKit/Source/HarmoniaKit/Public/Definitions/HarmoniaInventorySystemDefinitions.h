@@ -3,11 +3,14 @@
 #pragma once
 
 #include "Definitions/HarmoniaCoreDefinitions.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "HarmoniaInventorySystemDefinitions.generated.h"
 
+class UHarmoniaInventoryComponent;
+
 // �κ��丮 ����
 USTRUCT(BlueprintType)
-struct FInventorySlot
+struct FInventorySlot : public FFastArraySerializerItem
 {
     GENERATED_BODY()
 
@@ -29,15 +32,41 @@ struct FInventorySlot
 
     FInventorySlot() : Index(0), ItemID(), Count(0), Durability(0.f) {}
     FInventorySlot(int32 InIndex, FHarmoniaID InId, int32 InCount, float InDurability) : Index(InIndex), ItemID(InId), Count(InCount), Durability(InDurability) {}
+
+    bool IsEmpty() const { return !ItemID.IsValid() || Count <= 0; }
+
+    // Slot contents only; Index and the replication key stay with the slot
+    bool HasSameContents(const FInventorySlot& Other) const
+    {
+        return ItemID == Other.ItemID && Count == Other.Count && Durability == Other.Durability && Icon == Other.Icon;
+    }
+
+    void CopyContentsFrom(const FInventorySlot& Other)
+    {
+        ItemID = Other.ItemID;
+        Count = Other.Count;
+        Durability = Other.Durability;
+        Icon = Other.Icon;
+    }
+
+    void ResetContents()
+    {
+        ItemID = FHarmoniaID();
+        Count = 0;
+        Durability = 0.f;
+        Icon = nullptr;
+    }
 };
 
 // �κ��丮 ��ü ������
 USTRUCT(BlueprintType)
-struct FInventoryData
+struct FInventoryData : public FFastArraySerializer
 {
     GENERATED_BODY()
 
     // ���� �迭
+    // Replicated per slot: only slots marked dirty are sent. Slots never move inside the array on the server,
+    // so a slot's Index is its position; clients should still look slots up by Index (see FindSlot).
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TArray<FInventorySlot> Slots;
 
@@ -45,7 +74,38 @@ struct FInventoryData
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     int32 MaxSlotCount = 20;
 
-    FInventoryData() : MaxSlotCount(20) { Slots.SetNum(MaxSlotCount); }
+    // Slots are created by the server in Initialize and then replicated, clients start empty
+    FInventoryData() : MaxSlotCount(20) {}
+
+    // Server: size the slot array, assign slot indices and mark everything for replication
+    void Initialize(UHarmoniaInventoryComponent* InOwnerComponent);
+
+    // Server: queue a single slot for replication
+    void MarkSlotDirty(int32 SlotIndex);
+
+    const FInventorySlot* FindSlot(int32 SlotIndex) const;
+
+    //~FFastArraySerializer contract
+    void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+    void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+    void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+    //~End of FFastArraySerializer contract
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FInventorySlot, FInventoryData>(Slots, DeltaParms, *this);
+    }
+
+    // Receives the per-slot callbacks on clients
+    UPROPERTY(NotReplicated, Transient)
+    TObjectPtr<UHarmoniaInventoryComponent> OwnerComponent = nullptr;
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryData> : public TStructOpsTypeTraitsBase2<FInventoryData>
+{
+    enum { WithNetDeltaSerializer = true };
 };
 
 UENUM(BlueprintType)
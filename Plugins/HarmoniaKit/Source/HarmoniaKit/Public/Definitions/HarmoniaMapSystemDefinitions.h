@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "GameplayTagContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "HarmoniaMapSystemDefinitions.generated.h"
 
+class UHarmoniaMapComponent;
+
 /**
  * Enum for map marker types
  */
@@ -174,6 +177,115 @@ struct FExploredRegion
 	}
 };
 
+/**
+ * One TileSize x TileSize block of the exploration grid.
+ * Only tiles that have been (partly) explored exist, and each one replicates on its own.
+ */
+USTRUCT()
+struct FHarmoniaExplorationTile : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	// Tile position in the grid (TileY * TilesPerSide + TileX)
+	UPROPERTY()
+	int32 TileIndex = INDEX_NONE;
+
+	// 4-bit exploration alpha per cell, two cells per byte (low nibble first), row-major inside the tile
+	UPROPERTY()
+	TArray<uint8> Cells;
+};
+
+/**
+ * Fixed-resolution exploration mask over the map bounds.
+ *
+ * Every cell stores an exploration alpha from 0 (fogged) to MaxAlpha (explored), so point queries are
+ * a tile lookup and a nibble read. Tiles are delta replicated through the fast array, changed tiles are
+ * collected for the fog of war renderer and the whole grid is saved run-length encoded.
+ */
+USTRUCT()
+struct HARMONIAKIT_API FHarmoniaExplorationGrid : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	static constexpr int32 TileSize = 32;
+	static constexpr int32 BytesPerTile = TileSize * TileSize / 2;
+	static constexpr uint8 MaxAlpha = 15;
+
+	// Size the grid over the map bounds, Resolution is rounded up to whole tiles. Keeps already received tiles
+	void Initialize(const FBox& WorldBounds, int32 Resolution, UHarmoniaMapComponent* InOwnerComponent);
+
+	bool IsInitialized() const { return CellsPerSide > 0; }
+
+	// Server: reveal cells within Radius, fading out up to 1.5 x Radius. Returns true if any cell changed
+	bool RevealCircle(const FVector& Center, float Radius);
+
+	// Exploration alpha at a world position (0 - MaxAlpha)
+	uint8 GetAlpha(const FVector& WorldLocation) const;
+
+	// Exploration alpha of a cell in a tile, Tile may be null for unexplored tiles
+	static uint8 GetTileCellAlpha(const FHarmoniaExplorationTile* Tile, int32 LocalX, int32 LocalY);
+
+	const FHarmoniaExplorationTile* FindTile(int32 TileIndex) const;
+
+	int32 GetCellsPerSide() const { return CellsPerSide; }
+	int32 GetTilesPerSide() const { return TilesPerSide; }
+	int32 GetNumExploredTiles() const { return Tiles.Num(); }
+
+	// Hand over the tiles changed since the last call (for texture uploads)
+	void ConsumeDirtyTiles(TArray<int32>& OutTileIndices);
+
+	// Server: drop all exploration
+	void Reset();
+
+	// Run-length encode the grid for save games
+	void SaveRLE(TArray<uint8>& OutData) const;
+
+	// Server: replace the grid with saved data, data saved with another resolution is resampled. Fails on unknown or corrupt data
+	bool LoadRLE(const TArray<uint8>& Data);
+
+	//~FFastArraySerializer contract
+	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+	//~End of FFastArraySerializer contract
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FHarmoniaExplorationTile, FHarmoniaExplorationGrid>(Tiles, DeltaParms, *this);
+	}
+
+	// Explored tiles, in no particular order (see TileLookup)
+	UPROPERTY()
+	TArray<FHarmoniaExplorationTile> Tiles;
+
+	// Receives the replication callbacks on clients
+	UPROPERTY(NotReplicated, Transient)
+	TObjectPtr<UHarmoniaMapComponent> OwnerComponent = nullptr;
+
+private:
+	FHarmoniaExplorationTile& FindOrAddTile(int32 TileIndex);
+	void RebuildTileLookup();
+	void MarkTileDirty(int32 TileIndex);
+
+	FVector2D Origin = FVector2D::ZeroVector;
+	FVector2D CellSize = FVector2D::UnitVector;
+	int32 CellsPerSide = 0;
+	int32 TilesPerSide = 0;
+
+	// Tile index -> position in Tiles, INDEX_NONE while the tile is unexplored
+	TArray<int32> TileLookup;
+
+	TBitArray<> DirtyTileBits;
+	TArray<int32> DirtyTiles;
+};
+
+template<>
+struct TStructOpsTypeTraits<FHarmoniaExplorationGrid> : public TStructOpsTypeTraitsBase2<FHarmoniaExplorationGrid>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
 /**
  * Struct for map location/POI data
  */
@@ -344,6 +456,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Exploration")
 	float ExplorationUpdateInterval = 1.0f;
 
+	// Exploration grid cells along each side of the map bounds (rounded up to multiples of 32)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Exploration", meta = (ClampMin = "32", ClampMax = "4096"))
+	int32 ExplorationGridResolution = 512;
+
 	// Default ping lifetime
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ping")
 	float DefaultPingLifetime = 5.0f;
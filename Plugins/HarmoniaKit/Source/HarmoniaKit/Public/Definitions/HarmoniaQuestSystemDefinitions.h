@@ -13,9 +13,11 @@
 #include "Engine/DataTable.h"
 #include "GameplayTagContainer.h"
 #include "Definitions/HarmoniaCoreDefinitions.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "HarmoniaQuestSystemDefinitions.generated.h"
 
 class ULevelSequence;
+class UHarmoniaQuestComponent;
 
 /**
  * @enum EQuestState
@@ -988,9 +990,10 @@ struct FHarmoniaQuestData : public FTableRowBase
 /**
  * Active quest progress data
  * Tracks player's progress on an active quest
+ * Replicated as an entry of FActiveQuestList, so only changed quests are sent
  */
 USTRUCT(BlueprintType)
-struct FActiveQuestProgress
+struct FActiveQuestProgress : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 
@@ -1010,12 +1013,14 @@ struct FActiveQuestProgress
 	UPROPERTY(BlueprintReadOnly, Category = "Quest")
 	TArray<FQuestObjective> ObjectiveProgress;
 
-	// Quest start timestamp
+	// Quest start timestamp (server world time)
 	UPROPERTY(BlueprintReadOnly, Category = "Quest")
 	float StartTime = 0.0f;
 
 	// Elapsed time since quest started
-	UPROPERTY(BlueprintReadOnly, Category = "Quest")
+	// Not advanced every frame or replicated: derived from StartTime and the server world time when read through
+	// UHarmoniaQuestComponent::GetActiveQuestProgress. Entries of GetActiveQuests are not refreshed, use GetQuestElapsedTime / GetQuestRemainingTime
+	UPROPERTY(NotReplicated, BlueprintReadOnly, Category = "Quest")
 	float ElapsedTime = 0.0f;
 
 	// Whether this quest is tracked in UI
@@ -1086,6 +1091,124 @@ struct FActiveQuestProgress
 	}
 };
 
+/**
+ * Replicated list of active quests
+ * Delta-replicated per quest: objective progress changes only send the quest that changed.
+ * Server code must call MarkQuestDirty (or go through the owning component) after modifying an entry.
+ */
+USTRUCT(BlueprintType)
+struct FActiveQuestList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	// Active quest entries
+	UPROPERTY(BlueprintReadOnly, Category = "Quest")
+	TArray<FActiveQuestProgress> Items;
+
+	// Receives per-quest callbacks on clients
+	UPROPERTY(NotReplicated, Transient)
+	TObjectPtr<UHarmoniaQuestComponent> OwnerComponent = nullptr;
+
+	FActiveQuestProgress* Find(const FHarmoniaID& QuestId);
+	const FActiveQuestProgress* Find(const FHarmoniaID& QuestId) const;
+
+	// Server: add a new entry and mark it for replication
+	FActiveQuestProgress& Add(const FActiveQuestProgress& Progress);
+
+	// Server: remove an entry, returns true if it existed
+	bool Remove(const FHarmoniaID& QuestId);
+
+	// Server: replace all entries (save game load)
+	void Reset(const TArray<FActiveQuestProgress>& NewItems);
+
+	// Server: queue a single entry for replication
+	void MarkQuestDirty(FActiveQuestProgress& Progress) { MarkItemDirty(Progress); }
+
+	//~FFastArraySerializer contract
+	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+	//~End of FFastArraySerializer contract
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FActiveQuestProgress, FActiveQuestList>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FActiveQuestList> : public TStructOpsTypeTraitsBase2<FActiveQuestList>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+/**
+ * Single entry of a replicated quest ID set
+ */
+USTRUCT(BlueprintType)
+struct FQuestIdSetEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Quest")
+	FHarmoniaID QuestId;
+
+	FQuestIdSetEntry() {}
+	FQuestIdSetEntry(const FHarmoniaID& InQuestId) : QuestId(InQuestId) {}
+};
+
+/**
+ * Compact replicated set of quest IDs (completed / failed quests)
+ * Adding or removing an ID only sends that ID; lookups go through a local hash set on both server and clients.
+ */
+USTRUCT(BlueprintType)
+struct FQuestIdSet : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	bool Contains(const FHarmoniaID& QuestId) const { return Lookup.Contains(QuestId); }
+	int32 Num() const { return Entries.Num(); }
+
+	// Server: returns true if the ID was not already in the set
+	bool Add(const FHarmoniaID& QuestId);
+
+	// Server: returns true if the ID was in the set
+	bool Remove(const FHarmoniaID& QuestId);
+
+	void Empty();
+
+	// Server: replace the whole set (save game load)
+	void Reset(const TArray<FHarmoniaID>& QuestIds);
+
+	// Flat copy of the IDs, in insertion order
+	const TArray<FHarmoniaID>& GetIds() const { return Ids; }
+
+	//~FFastArraySerializer contract
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+	//~End of FFastArraySerializer contract
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FQuestIdSetEntry, FQuestIdSet>(Entries, DeltaParms, *this);
+	}
+
+private:
+	void RebuildIds();
+
+	UPROPERTY()
+	TArray<FQuestIdSetEntry> Entries;
+
+	// Not replicated, rebuilt from Entries
+	TSet<FHarmoniaID> Lookup;
+	TArray<FHarmoniaID> Ids;
+};
+
+template<>
+struct TStructOpsTypeTraits<FQuestIdSet> : public TStructOpsTypeTraitsBase2<FQuestIdSet>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
 /**
  * Quest statistics
  * Player quest completion statistics
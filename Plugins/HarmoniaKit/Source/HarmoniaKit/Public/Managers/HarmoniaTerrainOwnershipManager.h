@@ -53,8 +53,13 @@ struct FTerrainOwnershipZone
  * - Building permission validation
  * - Protected zones (cities, dungeons, etc.)
  * - Public building areas
+ *
+ * Zones are indexed in a 2D grid (XY) of GridCellSize cells. Each cell lists the zones overlapping it,
+ * smallest first, so a point query tests candidates in order and stops at the first containing zone.
+ * Owner player IDs are interned to integers with per-owner zone lists.
+ * Zone indices stay valid until the zone is unregistered, freed indices are reused.
  */
-UCLASS()
+UCLASS(Config=Game)
 class HARMONIAKIT_API UHarmoniaTerrainOwnershipManager : public UWorldSubsystem
 {
 	GENERATED_BODY()
@@ -79,6 +84,7 @@ public:
 
 	/**
 	 * Unregister an ownership zone
+	 * Indices of other zones are not affected
 	 * @param ZoneIndex - Index of zone to remove
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Terrain|Ownership")
@@ -93,6 +99,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Terrain|Ownership")
 	bool GetZoneAtLocation(const FVector& Location, FTerrainOwnershipZone& OutZone) const;
 
+	/**
+	 * Index of the smallest zone containing a location, without copying the zone
+	 * @return Zone index, INDEX_NONE if the location is unclaimed
+	 */
+	int32 FindZoneIndexAtLocation(const FVector& Location) const;
+
+	/** Number of registered zones */
+	int32 GetNumZones() const { return OwnershipZones.Num() - FreeZoneIndices.Num(); }
+
 	/**
 	 * Get all zones owned by a player
 	 * @param PlayerID - Player ID to check
@@ -202,10 +217,18 @@ public:
 	bool GetAllowBuildingInUnclaimedAreas() const { return bAllowBuildingInUnclaimedAreas; }
 
 protected:
-	/** All registered ownership zones */
+	/** All registered ownership zones, slots in FreeZoneIndices are unused */
 	UPROPERTY()
 	TArray<FTerrainOwnershipZone> OwnershipZones;
 
+	/** Size (cm) of the zone grid cells */
+	UPROPERTY(Config, EditAnywhere, Category = "Terrain|Ownership", meta = (ClampMin = "100"))
+	float GridCellSize = 2500.0f;
+
+	/** Zones overlapping more cells than this are kept out of the grid and tested on every query */
+	UPROPERTY(Config, EditAnywhere, Category = "Terrain|Ownership", meta = (ClampMin = "1"))
+	int32 MaxCellsPerZone = 4096;
+
 	/** Whether building is allowed in unclaimed areas */
 	UPROPERTY()
 	bool bAllowBuildingInUnclaimedAreas = true;
@@ -219,4 +242,51 @@ protected:
 	 * Get team ID from actor
 	 */
 	int32 GetTeamIDFromActor(AActor* Actor) const;
+
+private:
+	/** Index data of a registered zone */
+	struct FZoneRecord
+	{
+		FIntPoint MinCell = FIntPoint::ZeroValue;
+		FIntPoint MaxCell = FIntPoint::ZeroValue;
+		int32 OwnerPlayerKey = INDEX_NONE;
+		uint64 Serial = 0;
+		bool bRegistered = false;
+		bool bOversized = false;
+	};
+
+	/** Zones overlapping a grid cell, in lookup order (smallest first) */
+	struct FZoneCell
+	{
+		TArray<int32> Zones;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** True if zone A wins over zone B when both contain a location: smaller radius, then registered first */
+	bool ZonePrecedes(int32 ZoneA, int32 ZoneB) const;
+
+	bool ZoneContains(int32 ZoneIndex, const FVector& Location) const;
+
+	/** Insert into a lookup-ordered zone list */
+	void InsertOrdered(TArray<int32>& Zones, int32 ZoneIndex) const;
+
+	void IndexZone(int32 ZoneIndex);
+	void UnindexZone(int32 ZoneIndex);
+
+	/** Interned key of a player ID, INDEX_NONE for empty or unknown IDs */
+	int32 FindPlayerKey(const FString& PlayerID) const;
+	int32 InternPlayerID(const FString& PlayerID);
+
+	TArray<FZoneRecord> ZoneRecords;
+	TArray<int32> FreeZoneIndices;
+
+	TMap<FIntPoint, FZoneCell> ZoneGrid;
+	TArray<int32> OversizedZones;
+
+	TMap<FString, int32> PlayerKeys;
+	TArray<TArray<int32>> ZonesByPlayerKey;
+	TMap<int32, TArray<int32>> ZonesByTeam;
+
+	uint64 NextZoneSerial = 1;
 };
@@ -7,6 +7,7 @@
 #include "Monsters/HarmoniaMonsterInterface.h"
 #include "Definitions/HarmoniaMonsterSystemDefinitions.h"
 #include "Definitions/HarmoniaTeamSystemDefinitions.h"
+#include "System/LyraReplicationLODInterface.h"
 #include "HarmoniaMonsterBase.generated.h"
 
 class UHarmoniaMonsterData;
@@ -43,9 +44,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMonsterStateChangedDelegate, EHa
  * - Network replication ready
  * - Team-based friend-or-foe identification
  * - Unreal's standard IGenericTeamAgentInterface integration
+ * - Replication rate follows the AI LOD (ILyraReplicationLODInterface)
  */
 UCLASS(Blueprintable)
-class HARMONIAKIT_API AHarmoniaMonsterBase : public ALyraCharacterWithAbilities, public IHarmoniaMonsterInterface, public IHarmoniaTeamAgentInterface
+class HARMONIAKIT_API AHarmoniaMonsterBase : public ALyraCharacterWithAbilities, public IHarmoniaMonsterInterface, public IHarmoniaTeamAgentInterface, public ILyraReplicationLODInterface
 {
 	GENERATED_BODY()
 
@@ -92,6 +94,10 @@ public:
 	virtual bool IsEnemyWith_Implementation(AActor* OtherActor) const override;
 	//~End of IHarmoniaTeamAgentInterface
 
+	//~ILyraReplicationLODInterface
+	virtual int32 GetReplicationLOD() const override;
+	//~End of ILyraReplicationLODInterface
+
 	// ============================================================================
 	// Monster Configuration
 	// ============================================================================
@@ -257,6 +263,9 @@ protected:
 	UFUNCTION()
 	virtual void OnRep_MonsterState(EHarmoniaMonsterState OldState);
 
+	/** Pushes the combat flag to ULyraSignificanceManager */
+	void UpdateSignificanceCombatState();
+
 	// ============================================================================
 	// Attribute Callbacks
 	// ============================================================================
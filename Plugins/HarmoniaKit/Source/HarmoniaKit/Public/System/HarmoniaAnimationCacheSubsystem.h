@@ -8,6 +8,8 @@
 #include "Definitions/HarmoniaAnimationDataDefinitions.h"
 #include "HarmoniaAnimationCacheSubsystem.generated.h"
 
+struct FStreamableHandle;
+
 /**
  * Harmonia Animation Cache Subsystem
  * Loads and caches animation data from DataTables at game startup
@@ -101,7 +103,7 @@ public:
 	 * @param Character - Character to play animation on
 	 * @param AnimationTag - Tag identifying the animation
 	 * @param Context - Optional playback context for overrides
-	 * @return Duration of the animation, or 0 if failed
+	 * @return Duration of the animation, or 0 if failed or if the montage is still streaming in (it plays once loaded)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Harmonia|Animations")
 	float PlayAnimationByTag(
@@ -158,6 +160,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Harmonia|Animations")
 	int32 GetCachedAnimationCount() const { return AnimationCache.Num(); }
 
+	/**
+	 * Whether the startup load of all animation DataTables has finished and the tag cache is built
+	 */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Animations")
+	bool IsCacheReady() const { return bCacheReady; }
+
+	/**
+	 * Calls Delegate right away if the cache is ready, otherwise once it is
+	 */
+	void CallOrRegister_OnCacheReady(FSimpleDelegate&& Delegate);
+
 	/**
 	 * Preload all assets referenced by cached animations
 	 * @param bAsync - If true, loads asynchronously
@@ -165,6 +178,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Harmonia|Animations")
 	void PreloadAnimationAssets(bool bAsync = false);
 
+	/**
+	 * Keep the assets of every animation under ParentTag resident (e.g. when a weapon type or zone becomes active)
+	 * @param ParentTag - Parent tag (e.g., "Anim.Player.Attack.Sword")
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Animations")
+	void PreloadAnimationsByTag(FGameplayTag ParentTag);
+
+	/** Release assets kept by PreloadAnimationsByTag */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Animations")
+	void ReleaseAnimationsByTag(FGameplayTag ParentTag);
+
 protected:
 	// ============================================================================
 	// Configuration
@@ -188,16 +212,39 @@ protected:
 	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
 	bool bPreloadAssets = false;
 
+	/**
+	 * Whether the startup load streams all tables in one request and builds the cache on a worker thread
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
+	bool bLoadTablesAsync = true;
+
 private:
 	/**
 	 * Load and cache animations from all configured DataTables
+	 * @param bAsync - Stream the tables and build the cache on a worker thread instead of blocking
+	 */
+	void LoadAndCacheAnimations(bool bAsync);
+
+	/**
+	 * Called once the table request is complete, keeps the tables alive and builds the cache
+	 */
+	void HandleAnimationTablesLoaded(TArray<FSoftObjectPath> TablePaths, bool bAsync);
+
+	/**
+	 * Merges a built cache and marks the cache ready
 	 */
-	void LoadAndCacheAnimations();
+	void HandleAnimationCacheBuilt(TMap<FGameplayTag, FHarmoniaAnimationData>&& BuiltCache);
 
 	/**
-	 * Load animations from a specific DataTable
+	 * Blocks on the startup table request if it is still in flight (lazy lookups before the cache is ready)
 	 */
-	int32 LoadAnimationsFromDataTable(UDataTable* DataTable);
+	void FlushPendingTableLoad();
+
+	/**
+	 * Load animations from a specific DataTable into OutCache, only reads the table (safe on worker threads)
+	 * @return Number of animations loaded
+	 */
+	static int32 LoadAnimationsFromDataTable(const UDataTable* DataTable, TMap<FGameplayTag, FHarmoniaAnimationData>& OutCache);
 
 	/**
 	 * Load a single animation from DataTable by tag
@@ -214,4 +261,15 @@ private:
 
 	/** Set of tags that failed to load */
 	TSet<FGameplayTag> FailedLoadTags;
+
+	/** Startup table request, only valid while streaming */
+	TSharedPtr<FStreamableHandle> TablesHandle;
+
+	/** Listeners waiting for the cache */
+	FSimpleMulticastDelegate OnCacheReady;
+
+	/** Incremented on every (re)load so a stale worker build is dropped */
+	int32 CacheBuildSerial = 0;
+
+	bool bCacheReady = false;
 };
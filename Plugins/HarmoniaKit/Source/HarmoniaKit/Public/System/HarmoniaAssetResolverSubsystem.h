@@ -0,0 +1,162 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/PrimaryAssetId.h"
+#include "UObject/ObjectKey.h"
+#include "HarmoniaAssetResolverSubsystem.generated.h"
+
+/**
+ * Harmonia Asset Resolver Subsystem
+ *
+ * Shared async resolution of soft asset references used on gameplay hot paths
+ * (equip, mount, crafting, item drop, animation/sound by tag).
+ *
+ * - Preload / PreloadByTag / PreloadBundles keep assets resident while an item sits in an
+ *   inventory or a zone is active, so the action later finds them already loaded. Preloads are
+ *   held per owner, so two owners preloading the same key never replace or release each other's
+ * - RequestAssets runs an action right away when every asset is resident, otherwise queues it
+ *   until one streamable request for the missing assets completes
+ * - ResolveSync is the fallback for APIs that must return the asset immediately; every blocking
+ *   load it does on the game thread is counted (and logged) so remaining hitches can be tracked down
+ *
+ * Bind callbacks to UObjects (CreateUObject / CreateWeakLambda) so destroyed requesters are skipped.
+ */
+UCLASS(Config=Game)
+class HARMONIAKIT_API UHarmoniaAssetResolverSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UHarmoniaAssetResolverSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// ============================================================================
+	// Preloading
+	// ============================================================================
+
+	/** Start loading Paths and keep them resident until ReleasePreload(Owner, Key). Preloading a key again replaces its assets */
+	void Preload(const UObject* Owner, FName Key, const TArray<FSoftObjectPath>& Paths);
+
+	/** Load the given bundles of primary assets and keep them resident until ReleasePreload(Owner, Key) */
+	void PreloadBundles(const UObject* Owner, FName Key, const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& Bundles);
+
+	/** Drop the preload Owner holds under Key, assets still referenced elsewhere stay loaded */
+	void ReleasePreload(const UObject* Owner, FName Key);
+
+	/** Drop every preload held by Owner */
+	void ReleaseAllPreloads(const UObject* Owner);
+
+	bool IsPreloaded(const UObject* Owner, FName Key) const { return Preloads.Contains(FPreloadKey(Owner, Key)); }
+
+	/** Preload assets for a gameplay tag (zone, encounter, ...) */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets", meta = (DefaultToSelf = "Owner"))
+	void PreloadByTag(const UObject* Owner, FGameplayTag Tag, const TArray<FSoftObjectPath>& Paths);
+
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets", meta = (DefaultToSelf = "Owner"))
+	void ReleasePreloadByTag(const UObject* Owner, FGameplayTag Tag);
+
+	// ============================================================================
+	// Resolution
+	// ============================================================================
+
+	/**
+	 * Run OnReady once every path is loaded.
+	 * @return true if everything was resident and OnReady already ran
+	 */
+	bool RequestAssets(const TArray<FSoftObjectPath>& Paths, FSimpleDelegate OnReady);
+
+	bool RequestAsset(const FSoftObjectPath& Path, FSimpleDelegate OnReady)
+	{
+		return RequestAssets(TArray<FSoftObjectPath>{ Path }, MoveTemp(OnReady));
+	}
+
+	/** Return the loaded asset, loading it synchronously (and counting that load) when it is not resident */
+	UObject* ResolveSync(const FSoftObjectPath& Path, const TCHAR* Context);
+
+	template<typename T>
+	T* ResolveSync(const TSoftObjectPtr<T>& Asset, const TCHAR* Context)
+	{
+		return Cast<T>(ResolveSync(Asset.ToSoftObjectPath(), Context));
+	}
+
+	template<typename T>
+	TSubclassOf<T> ResolveSync(const TSoftClassPtr<T>& Class, const TCHAR* Context)
+	{
+		return Cast<UClass>(ResolveSync(Class.ToSoftObjectPath(), Context));
+	}
+
+	/** True when the path is null or already in memory */
+	static bool IsResident(const FSoftObjectPath& Path);
+
+	// ============================================================================
+	// Debug
+	// ============================================================================
+
+	/** Blocking loads done by ResolveSync on the game thread */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets")
+	int32 GetNumSyncLoads() const { return NumSyncLoads; }
+
+	/** Requests that had to wait for streaming */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets")
+	int32 GetNumQueuedRequests() const { return NumQueuedRequests; }
+
+	/** Requests whose assets were already resident */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets")
+	int32 GetNumImmediateRequests() const { return NumImmediateRequests; }
+
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets")
+	int32 GetNumPendingRequests() const { return PendingRequests.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Assets")
+	void ResetStats();
+
+protected:
+	/** Log every blocking load with its context (first occurrence per asset) */
+	UPROPERTY(Config, EditAnywhere, Category = "Debug")
+	bool bLogSyncLoads = true;
+
+private:
+	void OnRequestCompleted(uint64 RequestId);
+
+	struct FPendingRequest
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		FSimpleDelegate OnReady;
+	};
+
+	TMap<uint64, FPendingRequest> PendingRequests;
+	uint64 NextRequestId = 1;
+
+	/** Owner and key of a preload. Plain values, so keying per owner never creates names at runtime */
+	struct FPreloadKey
+	{
+		FObjectKey Owner;
+		FName Key;
+
+		FPreloadKey(const UObject* InOwner, FName InKey) : Owner(InOwner), Key(InKey) {}
+
+		bool operator==(const FPreloadKey& Other) const { return Owner == Other.Owner && Key == Other.Key; }
+
+		friend uint32 GetTypeHash(const FPreloadKey& PreloadKey)
+		{
+			return HashCombine(GetTypeHash(PreloadKey.Owner), GetTypeHash(PreloadKey.Key));
+		}
+	};
+
+	TMap<FPreloadKey, TSharedPtr<FStreamableHandle>> Preloads;
+
+	/** Assets already reported by bLogSyncLoads */
+	TSet<FSoftObjectPath> LoggedSyncLoads;
+
+	int32 NumSyncLoads = 0;
+	int32 NumQueuedRequests = 0;
+	int32 NumImmediateRequests = 0;
+};
@@ -0,0 +1,83 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/Future.h"
+#include "LoadingProcessInterface.h"
+#include "HarmoniaDataLoadingSubsystem.generated.h"
+
+/**
+ * Harmonia Data Loading Subsystem
+ *
+ * Starts the startup data load as soon as the game instance exists and tracks when it is done:
+ * - every registry DataTable of UHarmoniaLoadManager, streamed in one request
+ * - the sound / effect / animation tag caches, whose tables stream in parallel and whose
+ *   tag maps are built on worker threads
+ *
+ * Keeps the loading screen up until all of them are ready, exposes a readiness future and
+ * measures the time from the start of the load to the first frame rendered after it.
+ */
+UCLASS(Config=Game)
+class HARMONIAKIT_API UHarmoniaDataLoadingSubsystem : public UGameInstanceSubsystem, public ILoadingProcessInterface
+{
+	GENERATED_BODY()
+
+public:
+	static UHarmoniaDataLoadingSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~ILoadingProcessInterface interface
+	virtual bool ShouldShowLoadingScreen(FString& OutReason) const override;
+	//~End of ILoadingProcessInterface interface
+
+	/** Whether all startup DataTables are loaded and every tag cache is built */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Loading")
+	bool IsDataReady() const { return bDataReady; }
+
+	/** Completes once IsDataReady() becomes true */
+	TSharedFuture<void> GetDataReadyFuture() const { return DataReadyFuture; }
+
+	/** Calls Delegate right away if the data is ready, otherwise once it is */
+	void CallOrRegister_OnDataReady(FSimpleDelegate&& Delegate);
+
+	/** Seconds from the start of the load until everything was ready (0 while loading) */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Loading")
+	float GetDataLoadSeconds() const { return bDataReady ? float(DataReadyTime - LoadStartTime) : 0.0f; }
+
+	/** Seconds from the start of the load until the first frame rendered after it was ready (0 until then) */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Loading")
+	float GetTimeToFirstFrameSeconds() const { return FirstFrameTime > 0.0 ? float(FirstFrameTime - LoadStartTime) : 0.0f; }
+
+protected:
+	/**
+	 * Whether the loading screen stays up until the startup data is ready
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
+	bool bHoldLoadingScreenUntilReady = true;
+
+private:
+	void HandleSourceReady();
+
+	void HandleEndFrame();
+
+	/** Startup sources (tables, caches) still loading */
+	int32 PendingSources = 0;
+
+	TPromise<void> DataReadyPromise;
+	TSharedFuture<void> DataReadyFuture;
+	FSimpleMulticastDelegate OnDataReady;
+
+	FDelegateHandle EndFrameHandle;
+
+	double LoadStartTime = 0.0;
+	double DataReadyTime = 0.0;
+	double FirstFrameTime = 0.0;
+
+	bool bDataReady = false;
+};
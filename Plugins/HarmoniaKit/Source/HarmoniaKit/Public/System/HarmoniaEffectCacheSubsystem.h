@@ -8,6 +8,8 @@
 #include "Definitions/HarmoniaAnimationEffectDefinitions.h"
 #include "HarmoniaEffectCacheSubsystem.generated.h"
 
+struct FStreamableHandle;
+
 /**
  * Harmonia Effect Cache Subsystem
  * Loads and caches animation effect data from DataTables at game startup
@@ -108,6 +110,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Harmonia|Effects")
 	int32 GetCachedEffectCount() const { return EffectCache.Num(); }
 
+	/**
+	 * Whether the startup load of all effect DataTables has finished and the tag cache is built
+	 */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Effects")
+	bool IsCacheReady() const { return bCacheReady; }
+
+	/**
+	 * Calls Delegate right away if the cache is ready, otherwise once it is
+	 */
+	void CallOrRegister_OnCacheReady(FSimpleDelegate&& Delegate);
+
 	/**
 	 * Preload all assets referenced by cached effects
 	 * @param bAsync - If true, loads asynchronously
@@ -140,6 +153,12 @@ protected:
 	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
 	bool bPreloadAssets = false;
 
+	/**
+	 * Whether the startup load streams all tables in one request and builds the cache on a worker thread
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
+	bool bLoadTablesAsync = true;
+
 	// ============================================================================
 	// Internal
 	// ============================================================================
@@ -147,15 +166,30 @@ protected:
 private:
 	/**
 	 * Load and cache effects from all configured DataTables
+	 * @param bAsync - Stream the tables and build the cache on a worker thread instead of blocking
 	 */
-	void LoadAndCacheEffects();
+	void LoadAndCacheEffects(bool bAsync);
 
 	/**
-	 * Load effects from a specific DataTable
-	 * @param DataTable - DataTable to load from
+	 * Called once the table request is complete, keeps the tables alive and builds the cache
+	 */
+	void HandleEffectTablesLoaded(TArray<FSoftObjectPath> TablePaths, bool bAsync);
+
+	/**
+	 * Merges a built cache and marks the cache ready
+	 */
+	void HandleEffectCacheBuilt(TMap<FGameplayTag, FHarmoniaAnimationEffectData>&& BuiltCache);
+
+	/**
+	 * Blocks on the startup table request if it is still in flight (lazy lookups before the cache is ready)
+	 */
+	void FlushPendingTableLoad();
+
+	/**
+	 * Load effects from a specific DataTable into OutCache, only reads the table (safe on worker threads)
 	 * @return Number of effects loaded
 	 */
-	int32 LoadEffectsFromDataTable(UDataTable* DataTable);
+	static int32 LoadEffectsFromDataTable(const UDataTable* DataTable, TMap<FGameplayTag, FHarmoniaAnimationEffectData>& OutCache);
 
 	/**
 	 * Load a single effect from DataTable by tag
@@ -174,4 +208,15 @@ private:
 
 	/** Set of tags that failed to load (to avoid repeated warnings) */
 	TSet<FGameplayTag> FailedLoadTags;
+
+	/** Startup table request, only valid while streaming */
+	TSharedPtr<FStreamableHandle> TablesHandle;
+
+	/** Listeners waiting for the cache */
+	FSimpleMulticastDelegate OnCacheReady;
+
+	/** Incremented on every (re)load so a stale worker build is dropped */
+	int32 CacheBuildSerial = 0;
+
+	bool bCacheReady = false;
 };
@@ -4,20 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
-#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/Texture2D.h"
 #include "HarmoniaFogOfWarRenderer.generated.h"
 
-struct FExploredRegion;
-class UCanvas;
+struct FHarmoniaExplorationGrid;
 class UMaterialInterface;
 class UMaterialInstanceDynamic;
 
 /**
- * Renders fog of war mask texture from explored regions
- * Creates a dynamic texture that can be used in materials to hide unexplored areas
+ * Renders fog of war mask texture from the exploration grid
+ * Creates a dynamic texture (one texel per grid cell) that can be used in materials to hide unexplored areas
+ *
+ * Only the grid tiles that changed are converted and uploaded, so the cost of an update does not grow
+ * with the explored area.
  *
  * NETWORK NOTE: This is a CLIENT-ONLY system. Do not replicate.
- * Each client creates its own renderer based on replicated ExploredRegions data.
+ * Each client creates its own renderer based on the replicated exploration grid.
  */
 UCLASS()
 class HARMONIAKIT_API UHarmoniaFogOfWarRenderer : public UObject
@@ -27,13 +29,15 @@ class HARMONIAKIT_API UHarmoniaFogOfWarRenderer : public UObject
 public:
     UHarmoniaFogOfWarRenderer();
 
-    // Initialize the renderer with map bounds and resolution
+    // Initialize the renderer with map bounds and resolution (exploration grid cells per side)
     UFUNCTION(BlueprintCallable, Category = "Fog of War")
     void Initialize(const FBox& MapBounds, FIntPoint Resolution);
 
-    // Update fog of war with explored regions
-    UFUNCTION(BlueprintCallable, Category = "Fog of War")
-    void UpdateFogOfWar(const TArray<FExploredRegion>& ExploredRegions);
+    // Upload the given grid tiles to the texture
+    void UpdateTiles(const FHarmoniaExplorationGrid& Grid, TConstArrayView<int32> TileIndices);
+
+    // Clear the texture and upload every explored tile of the grid
+    void UpdateAllTiles(const FHarmoniaExplorationGrid& Grid);
 
     // Clear all explored regions (reset fog of war)
     UFUNCTION(BlueprintCallable, Category = "Fog of War")
@@ -41,7 +45,7 @@ public:
 
     // Get the fog of war mask texture
     UFUNCTION(BlueprintPure, Category = "Fog of War")
-    UTextureRenderTarget2D* GetFogOfWarTexture() const { return FogOfWarTexture; }
+    UTexture2D* GetFogOfWarTexture() const { return FogOfWarTexture; }
 
     // Get fog of war material instance (for UI)
     UFUNCTION(BlueprintPure, Category = "Fog of War")
@@ -55,10 +59,6 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Fog of War")
     float GetExplorationAlphaAtPosition(const FVector& WorldPosition) const;
 
-    // Fog of war blend mode
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog of War|Settings")
-    float FogBlendRadius = 200.0f; // Pixels for smooth blend
-
     // Fog color
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog of War|Settings")
     FLinearColor FogColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.8f);
@@ -68,9 +68,9 @@ public:
     FLinearColor ExploredColor = FLinearColor(1.0f, 1.0f, 1.0f, 0.0f);
 
 protected:
-    // Render target for fog of war
+    // Fog of war mask, BGRA8 with bilinear filtering to soften cell edges
     UPROPERTY(Transient)
-    TObjectPtr<UTextureRenderTarget2D> FogOfWarTexture;
+    TObjectPtr<UTexture2D> FogOfWarTexture;
 
     // Material for rendering fog of war
     UPROPERTY(Transient)
@@ -84,12 +84,12 @@ protected:
     UPROPERTY()
     FIntPoint TextureResolution;
 
-    // Create render target
-    void CreateRenderTarget();
+    // Grid last uploaded from, owned by the map component that owns this renderer
+    const FHarmoniaExplorationGrid* SourceGrid = nullptr;
 
-    // Render explored regions to texture
-    void RenderExploredRegions(const TArray<FExploredRegion>& Regions);
+    // Create the mask texture
+    void CreateTexture();
 
-    // Draw a single explored region
-    void DrawExploredRegion(UCanvas* Canvas, const FExploredRegion& Region);
+    // Fog to explored color for every exploration alpha
+    void BuildColorTable(FColor (&OutColors)[16]) const;
 };
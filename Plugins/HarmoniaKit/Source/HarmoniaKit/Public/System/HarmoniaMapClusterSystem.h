@@ -76,6 +76,11 @@ enum class EMapMarkerLOD : uint8
 /**
  * System for clustering markers and LOD management
  *
+ * Markers are kept in a multi-level grid over map UV space: level N splits the map into 2^N x 2^N cells
+ * and every cell keeps its marker count, centroid and bounds. Adding, moving or removing a marker only
+ * touches one cell per level, a zoom level maps to a grid depth, and a viewport query reads the cells
+ * it overlaps at that depth. Results are deterministic, so clusters do not flicker between zoom changes.
+ *
  * NETWORK NOTE: This is a CLIENT-ONLY system. Do not replicate.
  * Each client performs clustering calculations locally based on their current zoom level.
  */
@@ -107,7 +112,19 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clustering")
     bool bEnableClustering = true;
 
-    // Cluster markers from a list
+    // Deepest grid level (2^Depth cells per side), reached when zoomed in far enough
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clustering", meta = (ClampMin = "1", ClampMax = "15"))
+    int32 MaxClusterDepth = 10;
+
+    // Markers copied into FMarkerCluster::Markers per cluster (0 = all), large clusters only report MarkerCount
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clustering")
+    int32 MaxListedMarkersPerCluster = 32;
+
+    // Map size in pixels at zoom 1, used to turn ClusterDistanceThreshold into a grid depth
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clustering")
+    float MapPixelSize = 1024.0f;
+
+    // Cluster markers from a list (rebuilds the index, prefer the incremental API for live maps)
     UFUNCTION(BlueprintCallable, Category = "Clustering")
     TArray<FMarkerCluster> ClusterMarkers(
         const TArray<FMapLocationData>& Markers,
@@ -115,6 +132,36 @@ public:
         float CurrentZoom
     );
 
+    // ============================================================================
+    // Incremental Index
+    // ============================================================================
+
+    // Clear the index and set the world bounds markers are mapped from
+    UFUNCTION(BlueprintCallable, Category = "Clustering")
+    void ResetIndex(const FBox& MapBounds);
+
+    // Add a marker, returns its id (ids of removed markers are reused)
+    UFUNCTION(BlueprintCallable, Category = "Clustering")
+    int32 AddMarker(const FMapLocationData& Marker);
+
+    // Replace a marker's data, moving it between cells if its position changed
+    UFUNCTION(BlueprintCallable, Category = "Clustering")
+    bool UpdateMarker(int32 MarkerId, const FMapLocationData& Marker);
+
+    UFUNCTION(BlueprintCallable, Category = "Clustering")
+    bool RemoveMarker(int32 MarkerId);
+
+    UFUNCTION(BlueprintPure, Category = "Clustering")
+    int32 GetNumMarkers() const { return IndexedMarkers.Num(); }
+
+    // Grid depth used for a zoom level
+    UFUNCTION(BlueprintPure, Category = "Clustering")
+    int32 GetDepthForZoom(float ZoomLevel) const;
+
+    // Clusters overlapping a UV rectangle at the given zoom, cost grows with the visible cells only
+    UFUNCTION(BlueprintCallable, Category = "Clustering")
+    void QueryClusters(const FBox2D& ViewUV, float CurrentZoom, TArray<FMarkerCluster>& OutClusters) const;
+
     // Get LOD level for current zoom
     UFUNCTION(BlueprintPure, Category = "LOD")
     EMapMarkerLOD GetLODForZoom(float ZoomLevel) const;
@@ -132,21 +179,50 @@ public:
     float GetMarkerOpacity(float ZoomLevel, float FadeStart, float FadeEnd) const;
 
 protected:
-    // Build clusters using spatial hashing
-    void BuildClustersKMeans(
-        const TArray<FMapLocationData>& Markers,
-        TArray<FMarkerCluster>& OutClusters,
-        float DistanceThreshold
-    );
-
-    // Simple distance-based clustering
-    void BuildClustersSimple(
-        const TArray<FMapLocationData>& Markers,
-        const FBox& MapBounds,
-        TArray<FMarkerCluster>& OutClusters,
-        float DistanceThreshold
-    );
-
     // Convert world position to normalized UV
     FVector2D WorldToNormalizedUV(const FVector& WorldPos, const FBox& MapBounds) const;
+
+private:
+    struct FIndexedMarker
+    {
+        FMapLocationData Data;
+        FVector2D UV = FVector2D::ZeroVector;
+        FIntPoint LeafCell = FIntPoint::ZeroValue;
+    };
+
+    struct FClusterCell
+    {
+        int32 Count = 0;
+        FVector2D SumUV = FVector2D::ZeroVector;
+        FBox2D Bounds = FBox2D(ForceInit);
+
+        // Marker ids, only kept at the deepest level
+        TArray<int32> MarkerIds;
+    };
+
+    static uint32 MakeCellKey(int32 X, int32 Y) { return (static_cast<uint32>(X) << 16) | static_cast<uint32>(Y); }
+
+    FIntPoint GetLeafCell(const FVector2D& UV) const;
+    void InsertIntoLevels(int32 MarkerId);
+    void RemoveFromLevels(int32 MarkerId);
+
+    // Recompute the bounds of the cells above a leaf after a removal
+    void RefreshBounds(const FIntPoint& LeafCell);
+
+    // Append the marker ids of a cell by walking its leaf cells (MaxMarkers <= 0 collects all)
+    void CollectMarkerIds(int32 Depth, const FIntPoint& Cell, int32 MaxMarkers, TArray<int32>& OutMarkerIds) const;
+
+    // Append one cluster for a cell, or one per marker when it holds fewer than MinMarkersForCluster
+    void EmitCell(int32 Depth, const FIntPoint& Cell, const FClusterCell& ClusterCell, float PixelScale, TArray<FMarkerCluster>& OutClusters) const;
+
+    // Bounds markers are mapped from
+    FBox IndexBounds = FBox(ForceInit);
+
+    // Depth the levels were built with
+    int32 IndexDepth = 0;
+
+    TSparseArray<FIndexedMarker> IndexedMarkers;
+
+    // One map per depth, cell key -> cell
+    TArray<TMap<uint32, FClusterCell>> Levels;
 };
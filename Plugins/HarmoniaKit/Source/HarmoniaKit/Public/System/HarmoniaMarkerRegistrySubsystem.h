@@ -0,0 +1,171 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "HarmoniaMarkerRegistrySubsystem.generated.h"
+
+class AActor;
+
+/**
+ * Handle to a marker registered in UHarmoniaMarkerRegistrySubsystem.
+ * Stale handles (marker unregistered, slot reused) are detected through the serial.
+ */
+struct FHarmoniaMarkerHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/** One marker returned by a registry query */
+struct FHarmoniaMarkerQueryHit
+{
+	/** Index the owner passed to Register (its own storage slot) */
+	int32 PayloadIndex = INDEX_NONE;
+
+	/** Current location, already refreshed from the tracked actor */
+	FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * Harmonia Marker Registry Subsystem
+ *
+ * Shared spatial index for the minimap icons and 3D world markers of every local player.
+ * The owning components keep their marker data; the registry keeps where each marker is:
+ *
+ * - Markers are bucketed in a 2D grid of CellSize cells, so a view only visits the cells
+ *   overlapping its radius instead of every marker
+ * - Markers that must be considered at any distance (infinite display distance, edge clamped
+ *   icons) go to an always-relevant list instead of the grid
+ * - Category tags are interned to bits, queries skip hidden categories with one mask test
+ * - Actor-tracking markers are refreshed once per frame, on the first query of that frame;
+ *   markers whose actor is destroyed are reported back to their owner through ConsumeLostMarkers
+ */
+UCLASS(Config=Game)
+class HARMONIAKIT_API UHarmoniaMarkerRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UHarmoniaMarkerRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// ============================================================================
+	// Registration
+	// ============================================================================
+
+	/**
+	 * Register a marker owned by Owner.
+	 * @param PayloadIndex	Owner side index reported back by queries
+	 * @param TrackedActor	Optional actor the marker follows
+	 * @param bAlwaysRelevant	Return the marker from every query regardless of distance
+	 */
+	FHarmoniaMarkerHandle Register(const UObject* Owner, int32 PayloadIndex, const FVector& Location, AActor* TrackedActor, FGameplayTag Category, bool bAlwaysRelevant);
+
+	void Unregister(FHarmoniaMarkerHandle& Handle);
+
+	/** Unregister every marker of Owner */
+	void UnregisterAll(const UObject* Owner);
+
+	/** Replace the location, tracked actor, category and relevance of a marker */
+	void Update(const FHarmoniaMarkerHandle& Handle, const FVector& Location, AActor* TrackedActor, FGameplayTag Category, bool bAlwaysRelevant);
+
+	/** Move a marker. A tracked actor, if any, overrides the location again on the next refresh */
+	void SetLocation(const FHarmoniaMarkerHandle& Handle, const FVector& Location);
+
+	bool IsRegistered(const FHarmoniaMarkerHandle& Handle) const { return FindEntry(Handle) != nullptr; }
+
+	// ============================================================================
+	// Categories
+	// ============================================================================
+
+	/** Bit assigned to a category tag, 0 for an invalid tag (never filtered out) */
+	uint64 GetCategoryBit(FGameplayTag Category);
+
+	/** Combined bits of the given categories */
+	uint64 GetCategoryMask(const TArray<FGameplayTag>& Categories);
+
+	// ============================================================================
+	// Queries
+	// ============================================================================
+
+	/**
+	 * Collect the markers of Owner whose cell overlaps the circle (XY plane) around Center,
+	 * plus its always-relevant markers. Markers in HiddenCategoryMask are skipped.
+	 * Callers still run their exact visibility test on the hits.
+	 */
+	void QueryRadius(const UObject* Owner, const FVector& Center, float Radius, uint64 HiddenCategoryMask, TArray<FHarmoniaMarkerQueryHit>& OutHits);
+
+	/** Payload indices of Owner's markers whose tracked actor was destroyed since the last call */
+	void ConsumeLostMarkers(const UObject* Owner, TArray<int32>& OutPayloadIndices);
+
+	// ============================================================================
+	// Debug
+	// ============================================================================
+
+	int32 GetNumMarkers() const { return Entries.Num(); }
+	int32 GetNumCells() const { return Cells.Num(); }
+
+	/** Grid cells visited by the last query */
+	int32 GetLastQueryCellCount() const { return LastQueryCellCount; }
+
+protected:
+	/** Grid cell size in world units */
+	UPROPERTY(Config, EditAnywhere, Category = "Markers", meta = (ClampMin = "100"))
+	float CellSize = 5000.0f;
+
+private:
+	struct FEntry
+	{
+		const UObject* Owner = nullptr;
+		TWeakObjectPtr<AActor> TrackedActor;
+		FVector Location = FVector::ZeroVector;
+		uint64 CategoryBit = 0;
+		int32 PayloadIndex = INDEX_NONE;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		uint32 Serial = 0;
+		bool bTracked = false;
+		bool bAlwaysRelevant = false;
+		bool bLost = false;
+	};
+
+	FEntry* FindEntry(const FHarmoniaMarkerHandle& Handle);
+	const FEntry* FindEntry(const FHarmoniaMarkerHandle& Handle) const;
+
+	FIntPoint ToCell(const FVector& Location) const;
+
+	/** Put an entry in the grid or the always-relevant list, and in the tracked list */
+	void LinkEntry(int32 Index);
+	void UnlinkEntry(int32 Index);
+
+	/** Move an entry to the cell of its current location */
+	void RelinkCell(int32 Index);
+
+	/** Pull tracked actor locations, once per frame */
+	void RefreshTrackedEntries();
+
+	TSparseArray<FEntry> Entries;
+	uint32 NextSerial = 1;
+
+	TMap<FIntPoint, TArray<int32>> Cells;
+	TArray<int32> AlwaysRelevantEntries;
+	TArray<int32> TrackedEntries;
+
+	/** Payload indices of markers whose actor is gone, per owner */
+	TMap<const UObject*, TArray<int32>> LostPayloads;
+
+	/** Interned categories, the index is the bit */
+	TArray<FGameplayTag> CategoryTags;
+	bool bWarnedCategoryOverflow = false;
+
+	uint64 LastRefreshFrame = MAX_uint64;
+	int32 LastQueryCellCount = 0;
+};
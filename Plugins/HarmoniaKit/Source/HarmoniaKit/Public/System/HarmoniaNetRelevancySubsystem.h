@@ -0,0 +1,117 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Components/HarmoniaNetworkOptimizationComponent.h"
+#include "HarmoniaNetRelevancySubsystem.generated.h"
+
+/**
+ * Harmonia Net Relevancy Subsystem
+ *
+ * Server side replacement for the per-actor tick of UHarmoniaNetworkOptimizationComponent.
+ * Every TierUpdateInterval:
+ * - Player pawn locations are gathered once
+ * - Every registered actor is levelled against them in one batched pass (parallel above
+ *   MinComponentsForParallelTiering), with the hysteresis of UHarmoniaNetworkOptimizationComponent::CalculateLevel
+ * - Only actors whose level changed get their NetUpdateFrequency / dormancy rewritten
+ *
+ * Level transitions per second are reported in the "Net Tier Transitions/s" stat.
+ */
+UCLASS(Config=Game)
+class HARMONIAKIT_API UHarmoniaNetRelevancySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UHarmoniaNetRelevancySubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// Tick (returns bool for FTSTicker compatibility)
+	bool Tick(float DeltaTime);
+
+	// ============================================================================
+	// Registration
+	// ============================================================================
+
+	/** Start levelling a component's owner, server only */
+	void Register(UHarmoniaNetworkOptimizationComponent* Component);
+
+	void Unregister(UHarmoniaNetworkOptimizationComponent* Component);
+
+	bool IsRegistered(const UHarmoniaNetworkOptimizationComponent* Component) const { return ComponentIndices.Contains(Component); }
+
+	// ============================================================================
+	// Queries
+	// ============================================================================
+
+	/** Distance from Location to the nearest player pawn of the last tier pass, MAX_flt without players */
+	float GetDistanceToNearestPlayer(const FVector& Location) const;
+
+	/** Level transitions per second, averaged over the last second */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Network")
+	float GetTierTransitionsPerSecond() const { return TierTransitionsPerSecond; }
+
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Network")
+	int32 GetNumRegistered() const { return ComponentIndices.Num(); }
+
+	int32 GetNumTierTransitionsLastPass() const { return TierTransitionsLastPass; }
+
+protected:
+	/** Seconds between two tier passes */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "0"))
+	float TierUpdateInterval = 0.25f;
+
+	/** The tier pass runs in parallel from this many registered actors on */
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "1"))
+	int32 MinComponentsForParallelTiering = 256;
+
+private:
+	/** Per actor inputs gathered on the game thread before the pass */
+	struct FTieringInput
+	{
+		FVector Location = FVector::ZeroVector;
+		const FHarmoniaNetOptConfig* Config = nullptr;
+		EHarmoniaNetOptLevel CurrentLevel = EHarmoniaNetOptLevel::Critical;
+		bool bInCombat = false;
+		bool bSkip = false;
+	};
+
+	struct FTieringOutput
+	{
+		float Distance = MAX_flt;
+		EHarmoniaNetOptLevel Level = EHarmoniaNetOptLevel::Critical;
+	};
+
+	void GatherPlayerLocations(UWorld& World);
+	void RunTierPass(float PassDeltaTime);
+	void RemoveStaleComponents();
+	void UpdateTransitionRate(float DeltaTime, int32 NumTransitions);
+
+	/** Registered components. Unregister only clears the slot, slots are compacted at the start of the next pass */
+	TArray<TWeakObjectPtr<UHarmoniaNetworkOptimizationComponent>> Components;
+	TArray<const UHarmoniaNetworkOptimizationComponent*> ComponentKeys;
+	TMap<const UHarmoniaNetworkOptimizationComponent*, int32> ComponentIndices;
+
+	TArray<FTieringInput> TieringInputs;
+	TArray<FTieringOutput> TieringOutputs;
+
+	/** Player pawn locations of the last pass */
+	TArray<FVector> PlayerLocations;
+
+	float TimeSinceTierPass = 0.0f;
+
+	float TransitionWindowTime = 0.0f;
+	int32 TransitionsInWindow = 0;
+	float TierTransitionsPerSecond = 0.0f;
+	int32 TierTransitionsLastPass = 0;
+
+	/** Delegate handle for tick */
+	FTSTicker::FDelegateHandle TickDelegateHandle;
+};
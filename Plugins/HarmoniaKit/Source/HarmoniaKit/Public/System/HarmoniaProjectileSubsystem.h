@@ -0,0 +1,230 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "Definitions/HarmoniaCombatSystemDefinitions.h"
+#include "HarmoniaProjectileSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UNiagaraComponent;
+class UStaticMesh;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnManagedProjectileHitDelegate, AActor*, HitActor, const FHitResult&, HitResult, const FHarmoniaProjectileData&, ProjectileData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnManagedProjectileExplodeDelegate, const FVector&, ExplosionLocation, const FHarmoniaProjectileData&, ProjectileData);
+
+/**
+ * Harmonia Projectile Subsystem
+ *
+ * Simulates projectiles without spawning an actor per projectile.
+ * State lives in contiguous arrays (position, velocity, age, ...) indexed by a dense slot,
+ * everything shared by one volley (data, owner, query params) lives in a refcounted archetype.
+ *
+ * Each frame:
+ * - Sweep results of the previous frame are applied (damage, penetration, bounce, stick, explode)
+ * - All projectiles are integrated (gravity, homing, boomerang, lifetime)
+ * - One async sphere sweep per moving projectile is submitted for the new segment
+ * - Meshes are written to one pooled instanced static mesh per mesh asset,
+ *   trails to one Niagara component per BatchedTrailSystem
+ *
+ * Only the server applies gameplay. Clients receive the volley (spawn parameters + seed)
+ * and run the same simulation cosmetically.
+ */
+UCLASS()
+class HARMONIAKIT_API UHarmoniaProjectileSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Tick (returns bool for FTSTicker compatibility)
+	bool Tick(float DeltaTime);
+
+	/**
+	 * Spawn every projectile of a volley
+	 * @param bAuthoritative True on the server: hits apply damage. False for cosmetic client copies
+	 * @return Number of projectiles spawned
+	 */
+	int32 SpawnVolley(const FHarmoniaProjectileVolley& Volley, bool bAuthoritative);
+
+	/** Spawn a single projectile, returns its id (INDEX_NONE on failure) */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Projectile")
+	int32 SpawnProjectile(const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, const FVector& Location, const FVector& Direction, float DamageMultiplier = 1.0f, AActor* HomingTarget = nullptr);
+
+	/** Remove a projectile without impact */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Projectile")
+	void DestroyProjectile(int32 ProjectileId);
+
+	/** Is the projectile still simulated? */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Projectile")
+	bool IsProjectileActive(int32 ProjectileId) const { return IdToIndex.Contains(ProjectileId); }
+
+	/** Number of simulated projectiles */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Projectile")
+	int32 GetNumActiveProjectiles() const { return Ids.Num(); }
+
+	/** Sweeps submitted last frame */
+	int32 GetNumSweepsLastFrame() const { return NumSweepsLastFrame; }
+
+	/** Fired on the server for every target a projectile hits */
+	UPROPERTY(BlueprintAssignable, Category = "Harmonia|Projectile")
+	FOnManagedProjectileHitDelegate OnProjectileHit;
+
+	/** Fired on the server when an explosive projectile detonates */
+	UPROPERTY(BlueprintAssignable, Category = "Harmonia|Projectile")
+	FOnManagedProjectileExplodeDelegate OnProjectileExplode;
+
+	// ============================================================================
+	// Shared Damage Helpers (also used by AHarmoniaProjectile)
+	// ============================================================================
+
+	/**
+	 * Apply projectile damage, additional effects and impact cue to Target
+	 * @param PenetrationsUsed Targets already pierced, scales damage by PenetrationDamageFalloff
+	 * @param DamageScale Extra scale (explosion falloff)
+	 */
+	static void ApplyProjectileDamage(const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, UObject* SourceObject, AActor* Target, const FHitResult& HitResult, float DamageMultiplier, int32 PenetrationsUsed, float DamageScale = 1.0f);
+
+	/** Apply radial damage with distance falloff around Location */
+	static void ApplyProjectileExplosion(UWorld* World, const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, UObject* SourceObject, const FVector& Location, float DamageMultiplier, int32 PenetrationsUsed = 0);
+
+	/** Directions of every projectile in a volley, identical on every machine for the same seed */
+	static void BuildVolleyDirections(const FHarmoniaProjectileVolley& Volley, TArray<FVector, TInlineAllocator<16>>& OutDirections);
+
+private:
+	enum EProjectileFlags : uint8
+	{
+		PF_None = 0,
+		PF_Returning = 1 << 0,	// Boomerang on its way back
+		PF_Stuck = 1 << 1,		// Stuck to a surface, no longer moving
+		PF_PendingKill = 1 << 2,	// Removed at the end of the tick
+	};
+
+	/** State shared by every projectile of one volley. ProjectileData is kept in ArchetypeData for GC */
+	struct FArchetype
+	{
+		TWeakObjectPtr<AActor> Owner;
+		TWeakObjectPtr<AActor> HomingTarget;
+		FCollisionQueryParams QueryParams;
+		float DamageMultiplier = 1.0f;
+		float MaxSpeed = 0.0f;
+		float GravityZ = 0.0f;
+		int32 MeshBatch = INDEX_NONE;
+		int32 TrailBatch = INDEX_NONE;
+		int32 NumProjectiles = 0;
+		bool bAuthoritative = false;
+	};
+
+	/** Pooled instanced mesh for one mesh asset. Freed instances are hidden and reused */
+	struct FMeshBatch
+	{
+		TArray<FTransform> Transforms;
+		TArray<int32> FreeInstances;
+		bool bDirty = false;
+	};
+
+	/** Sweep results delivered by the trace delegate, applied next tick */
+	struct FSweepResult
+	{
+		int32 ProjectileId = INDEX_NONE;
+		TArray<FHitResult, TInlineAllocator<2>> Hits;
+	};
+
+	using FHitActorList = TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>>;
+
+	int32 AddArchetype(const FHarmoniaProjectileData& ProjectileData, AActor* InOwner, AActor* HomingTarget, float DamageMultiplier, bool bAuthoritative);
+	void ReleaseArchetype(int32 ArchetypeIndex);
+	int32 AddProjectile(int32 ArchetypeIndex, const FVector& Location, const FVector& Velocity, float InitialAge);
+	void RemoveProjectileAt(int32 Index);
+
+	void ApplySweepResults();
+	void ProcessHits(int32 Index, TArrayView<FHitResult> Hits);
+	void Integrate(float DeltaTime);
+	void SubmitSweeps();
+	void SubmitSweep(int32 Index, const FVector& Start);
+	void RemovePendingKill();
+	void UpdateVisuals();
+
+	void OnSweepCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void SpawnImpactEffects(const FHarmoniaProjectileData& ProjectileData, const FHitResult& Hit) const;
+
+	bool ShouldRenderVisuals() const;
+	int32 FindOrAddMeshBatch(UStaticMesh* Mesh);
+	int32 FindOrAddTrailBatch(UNiagaraSystem* System);
+	int32 AllocateMeshInstance(int32 BatchIndex);
+	void FreeMeshInstance(int32 BatchIndex, int32 InstanceIndex);
+	AActor* GetOrCreateVisualHost();
+
+	// ============================================================================
+	// Projectile State (one entry per projectile, swap-removed)
+	// ============================================================================
+
+	TArray<int32> Ids;
+	TArray<FVector> Positions;
+	TArray<FVector> PreviousPositions;
+	TArray<FVector> Velocities;
+	TArray<float> Ages;
+	TArray<int32> ArchetypeIndices;
+	TArray<uint8> Flags;
+	TArray<int16> RemainingPenetrations;
+	TArray<int16> RemainingBounces;
+	TArray<int32> MeshInstances;
+	TArray<FHitActorList> HitActors;
+
+	/** Surface a stuck projectile follows, with the offset in its local space */
+	TArray<TWeakObjectPtr<USceneComponent>> StuckComponents;
+	TArray<FVector> StuckOffsets;
+
+	/** Projectile id -> dense index */
+	TMap<int32, int32> IdToIndex;
+	int32 NextProjectileId = 1;
+
+	// ============================================================================
+	// Archetypes
+	// ============================================================================
+
+	/** Parallel to Archetypes, referenced for GC (meshes, effects, damage classes) */
+	UPROPERTY(Transient)
+	TArray<FHarmoniaProjectileData> ArchetypeData;
+
+	TArray<FArchetype> Archetypes;
+	TArray<int32> FreeArchetypes;
+
+	// ============================================================================
+	// Sweeps
+	// ============================================================================
+
+	FTraceDelegate SweepDelegate;
+	FCollisionObjectQueryParams SweepObjectParams;
+	TArray<FSweepResult> CompletedSweeps;
+	int32 NumSweepsLastFrame = 0;
+
+	// ============================================================================
+	// Visuals
+	// ============================================================================
+
+	/** Transient actor owning the pooled visual components */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> VisualHost;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> MeshBatchComponents;
+	TArray<FMeshBatch> MeshBatches;
+	TMap<TObjectKey<UStaticMesh>, int32> MeshBatchIndices;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UNiagaraComponent>> TrailBatchComponents;
+	TArray<TArray<FVector>> TrailBatchPositions;
+	TMap<TObjectKey<UNiagaraSystem>, int32> TrailBatchIndices;
+
+	/** Delegate handle for tick */
+	FTSTicker::FDelegateHandle TickDelegateHandle;
+};
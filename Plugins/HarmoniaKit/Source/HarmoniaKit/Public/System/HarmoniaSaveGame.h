@@ -172,10 +172,14 @@ struct FHarmoniaPlayerSaveData
 	UPROPERTY(SaveGame)
 	FName LastCheckpointID;
 
-	/** Explored region list */
+	/** Explored region list (legacy, only read to migrate saves made before ExplorationGridData) */
 	UPROPERTY(SaveGame)
 	TArray<FExploredRegion> ExploredRegions;
 
+	/** Run-length encoded exploration grid (see FHarmoniaExplorationGrid::SaveRLE) */
+	UPROPERTY(SaveGame)
+	TArray<uint8> ExplorationGridData;
+
 	/** Discovered location list */
 	UPROPERTY(SaveGame)
 	TArray<FMapLocationData> DiscoveredLocations;
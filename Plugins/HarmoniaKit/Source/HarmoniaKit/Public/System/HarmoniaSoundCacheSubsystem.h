@@ -10,6 +10,8 @@
 #include "Definitions/HarmoniaSoundDataDefinitions.h"
 #include "HarmoniaSoundCacheSubsystem.generated.h"
 
+struct FStreamableHandle;
+
 /**
  * Active Sound - Tracks currently playing sounds for priority management
  */
@@ -220,12 +222,34 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Harmonia|Sounds")
 	int32 GetCachedSoundCount() const { return SoundCache.Num(); }
 
+	/**
+	 * Whether the startup load of all sound DataTables has finished and the tag cache is built
+	 */
+	UFUNCTION(BlueprintPure, Category = "Harmonia|Sounds")
+	bool IsCacheReady() const { return bCacheReady; }
+
+	/**
+	 * Calls Delegate right away if the cache is ready, otherwise once it is
+	 */
+	void CallOrRegister_OnCacheReady(FSimpleDelegate&& Delegate);
+
 	/**
 	 * Preload all assets referenced by cached sounds
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Harmonia|Sounds")
 	void PreloadSoundAssets(bool bAsync = false);
 
+	/**
+	 * Keep the sounds under ParentTag resident (e.g. when a zone or encounter becomes active),
+	 * so playing them later does not block on a load
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Sounds")
+	void PreloadSoundsByTag(FGameplayTag ParentTag);
+
+	/** Release sounds kept by PreloadSoundsByTag */
+	UFUNCTION(BlueprintCallable, Category = "Harmonia|Sounds")
+	void ReleaseSoundsByTag(FGameplayTag ParentTag);
+
 protected:
 	// ============================================================================
 	// Configuration
@@ -249,16 +273,39 @@ protected:
 	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
 	bool bPreloadAssets = false;
 
+	/**
+	 * Whether the startup load streams all tables in one request and builds the cache on a worker thread
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Configuration")
+	bool bLoadTablesAsync = true;
+
 private:
 	/**
-	 * Load and cache sounds from all configured DataTables
+	 * Load and cache sounds from the LoadManager "Sound" table and all configured DataTables
+	 * @param bAsync - Stream the tables and build the cache on a worker thread instead of blocking
+	 */
+	void LoadAndCacheSounds(bool bAsync);
+
+	/**
+	 * Called once the table request is complete, keeps the tables alive and builds the cache
+	 * Runs at most once per BuildSerial, the streamable callback may still fire after a direct call
+	 */
+	void HandleSoundTablesLoaded(TArray<FSoftObjectPath> TablePaths, bool bAsync, int32 BuildSerial);
+
+	/**
+	 * Merges a built cache and marks the cache ready
 	 */
-	void LoadAndCacheSounds();
+	void HandleSoundCacheBuilt(TMap<FGameplayTag, FHarmoniaSoundData>&& BuiltCache);
 
 	/**
-	 * Load sounds from a specific DataTable
+	 * Blocks on the startup table request if it is still in flight (lazy lookups before the cache is ready)
 	 */
-	int32 LoadSoundsFromDataTable(UDataTable* DataTable);
+	void FlushPendingTableLoad();
+
+	/**
+	 * Load sounds from a specific DataTable into OutCache, only reads the table (safe on worker threads)
+	 */
+	static int32 LoadSoundsFromDataTable(const UDataTable* DataTable, TMap<FGameplayTag, FHarmoniaSoundData>& OutCache);
 
 	/**
 	 * Load a single sound from DataTable by tag
@@ -281,6 +328,20 @@ private:
 	/** Set of tags that failed to load */
 	TSet<FGameplayTag> FailedLoadTags;
 
+	/** Startup table request, only valid while streaming */
+	TSharedPtr<FStreamableHandle> TablesHandle;
+
+	/** Listeners waiting for the cache */
+	FSimpleMulticastDelegate OnCacheReady;
+
+	/** Incremented on every (re)load so a stale worker build is dropped */
+	int32 CacheBuildSerial = 0;
+
+	/** CacheBuildSerial whose tables were already handed to the cache build */
+	int32 TablesLoadedSerial = 0;
+
+	bool bCacheReady = false;
+
 	/** Ticker handle for cleanup - must be removed on deinitialize */
 	FTSTicker::FDelegateHandle CleanupTickerHandle;
 
@@ -0,0 +1,185 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "HarmoniaThreatSubsystem.generated.h"
+
+class UHarmoniaThreatComponent;
+struct FHarmoniaThreatEntry;
+
+/**
+ * Harmonia Threat Subsystem
+ *
+ * Owns the threat tables of every UHarmoniaThreatComponent, so nothing ticks per monster:
+ * - Entries of all tables live in one contiguous array (free-listed), tables hold indices into it
+ * - Decay is analytic: an entry stores its threat at a base time and its decay rate, the current
+ *   value is Base * exp(-Rate * (Now - BaseTime)). Entries are only rebased when threat is added or
+ *   the out-of-range rate kicks in, and expire at a precomputed time instead of being checked each frame
+ * - Each table keeps a max-heap per decay rate (in range / out of range). Within one rate the order never
+ *   changes as threat decays, so the top target is the larger of the two heap tops (stale nodes are popped lazily)
+ * - OnThreatChanged / OnHighestThreatChanged are coalesced and broadcast once per frame
+ *
+ * Range checks, expiry and cleanup of destroyed actors run in one pass every MaintenanceInterval.
+ */
+UCLASS(Config=Game)
+class HARMONIAKIT_API UHarmoniaThreatSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UHarmoniaThreatSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// Tick (returns bool for FTSTicker compatibility)
+	bool Tick(float DeltaTime);
+
+	// ============================================================================
+	// Tables
+	// ============================================================================
+
+	/** Create the table of a component, reading its decay configuration. Returns the table index */
+	int32 RegisterTable(UHarmoniaThreatComponent* Component);
+
+	/** Drop a table and its entries without notifying */
+	void UnregisterTable(int32 TableIndex);
+
+	/** Re-read the decay configuration of the table's component. Entries are rebased first so past decay is kept */
+	void RefreshTableConfig(int32 TableIndex);
+
+	// ============================================================================
+	// Threat
+	// ============================================================================
+
+	void AddThreat(int32 TableIndex, AActor* ThreatActor, float ThreatAmount);
+	void RemoveThreat(int32 TableIndex, AActor* ThreatActor, float ThreatAmount);
+	void SetThreat(int32 TableIndex, AActor* ThreatActor, float ThreatValue);
+	void ClearThreat(int32 TableIndex, AActor* ThreatActor);
+	void ClearAllThreat(int32 TableIndex);
+
+	float GetThreat(int32 TableIndex, const AActor* ThreatActor) const;
+
+	/** Actor with the highest threat right now, destroyed actors are dropped on the way */
+	AActor* GetHighestThreatActor(int32 TableIndex);
+
+	/** Current entries of a table, unsorted */
+	void GetThreatEntries(int32 TableIndex, TArray<FHarmoniaThreatEntry>& OutEntries) const;
+
+	int32 GetNumEntries(int32 TableIndex) const;
+
+	// ============================================================================
+	// Debug
+	// ============================================================================
+
+	int32 GetNumTables() const { return Tables.Num() - FreeTables.Num(); }
+	int32 GetNumTotalEntries() const { return Entries.Num() - FreeEntries.Num(); }
+
+protected:
+	/** Seconds between two range / expiry passes */
+	UPROPERTY(Config, EditAnywhere, Category = "Threat", meta = (ClampMin = "0"))
+	float MaintenanceInterval = 0.5f;
+
+private:
+	enum EDecayClass : uint8
+	{
+		DC_InRange = 0,
+		DC_OutOfRange = 1,
+		DC_Count
+	};
+
+	/** Decay configuration copied from the component */
+	struct FTableConfig
+	{
+		float DecayRate = 0.0f;
+		float MinimumThreat = 0.0f;
+		float MaximumThreat = 0.0f;
+		float DecayDistanceSq = 0.0f;
+		float OutOfRangeDecayMultiplier = 1.0f;
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 Table = INDEX_NONE;
+		double BaseThreat = 0.0;
+		double BaseTime = 0.0;
+		double ExpiryTime = 0.0;
+		float LastThreatTime = 0.0f;
+		uint32 Version = 0;
+		int32 PendingChange = INDEX_NONE;
+		uint8 DecayClass = DC_InRange;
+	};
+
+	/** Heap node, stale once the entry's version moved on */
+	struct FHeapNode
+	{
+		double Key = 0.0;
+		int32 Entry = INDEX_NONE;
+		uint32 Version = 0;
+	};
+
+	struct FTable
+	{
+		TWeakObjectPtr<UHarmoniaThreatComponent> Component;
+		FTableConfig Config;
+		TArray<int32> EntryIndices;
+		TArray<TObjectKey<AActor>> EntryActors;
+		TArray<FHeapNode> Heaps[DC_Count];
+		bool bActive = false;
+		bool bPendingHighestCheck = false;
+	};
+
+	/** Coalesced OnThreatChanged, NewThreat is read at flush time unless the entry was removed */
+	struct FPendingChange
+	{
+		TWeakObjectPtr<UHarmoniaThreatComponent> Component;
+		TWeakObjectPtr<AActor> Actor;
+		int32 Entry = INDEX_NONE;
+		float OldThreat = 0.0f;
+		float NewThreat = 0.0f;
+	};
+
+	double GetNow() const;
+	static FTableConfig ReadConfig(const UHarmoniaThreatComponent& Component);
+
+	double GetDecayRate(const FTable& Table, uint8 DecayClass) const;
+	double GetCurrentThreat(const FEntry& Entry, double Now) const;
+	uint8 GetDecayClass(const FTable& Table, const AActor* ThreatActor) const;
+
+	int32 FindEntry(const FTable& Table, const AActor* ThreatActor) const;
+	int32 AddEntry(int32 TableIndex, AActor* ThreatActor, double Now);
+	void RemoveEntry(int32 EntryIndex, double Now, bool bNotify);
+
+	/** Restart the analytic decay of an entry from Value at Now, in DecayClass */
+	void SetEntryValue(int32 EntryIndex, double Value, double Now, uint8 DecayClass);
+
+	int32 PeekHeap(int32 TableIndex, uint8 DecayClass);
+	void RebuildHeap(FTable& Table, uint8 DecayClass);
+
+	void MarkChanged(int32 EntryIndex, float OldThreat);
+	void MarkHighestCheck(int32 TableIndex);
+
+	void RunMaintenance(double Now);
+	void FlushNotifications();
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+
+	TArray<FTable> Tables;
+	TArray<int32> FreeTables;
+
+	TArray<FPendingChange> PendingChanges;
+	TArray<int32> PendingHighestTables;
+
+	float TimeSinceMaintenance = 0.0f;
+
+	/** Delegate handle for tick */
+	FTSTicker::FDelegateHandle TickDelegateHandle;
+};
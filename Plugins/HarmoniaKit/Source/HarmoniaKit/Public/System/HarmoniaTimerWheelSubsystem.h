@@ -0,0 +1,99 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Ticker.h"
+#include "HarmoniaTimerWheelSubsystem.generated.h"
+
+/**
+ * Handle to a callback scheduled on the timer wheel
+ */
+struct HARMONIAKIT_API FHarmoniaTimerWheelHandle
+{
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+
+	bool operator==(const FHarmoniaTimerWheelHandle& Other) const { return Id == Other.Id; }
+
+private:
+	friend class UHarmoniaTimerWheelSubsystem;
+
+	uint64 Id = 0;
+};
+
+/**
+ * Harmonia Timer Wheel Subsystem
+ *
+ * Shared one-shot deadline scheduler for gameplay systems that would otherwise tick
+ * every frame only to find out whether something expired (quest time limits, hints, ...).
+ *
+ * Deadlines are bucketed into a fixed ring of slots by world time, so scheduling and
+ * cancelling are O(1) and a frame only touches the slots that elapsed since the last one.
+ * Deadlines further away than one revolution stay in their slot until their revolution comes up.
+ *
+ * Callbacks fire on the game thread at most one slot (SlotDuration) late, never early.
+ * Bind callbacks to UObjects (CreateUObject / CreateWeakLambda) so destroyed owners are skipped.
+ */
+UCLASS()
+class HARMONIAKIT_API UHarmoniaTimerWheelSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Tick (returns bool for FTSTicker compatibility)
+	bool Tick(float DeltaTime);
+
+	/** Schedule Callback to run once world time reaches FireTime (seconds, UWorld::GetTimeSeconds) */
+	FHarmoniaTimerWheelHandle ScheduleAt(double FireTime, FSimpleDelegate Callback);
+
+	/** Schedule Callback to run once Delay seconds of world time have passed */
+	FHarmoniaTimerWheelHandle ScheduleAfter(double Delay, FSimpleDelegate Callback);
+
+	/** Cancel a pending callback and invalidate the handle. Safe to call with expired or invalid handles */
+	void Cancel(FHarmoniaTimerWheelHandle& Handle);
+
+	/** Returns true if the callback has not fired or been cancelled yet */
+	bool IsScheduled(const FHarmoniaTimerWheelHandle& Handle) const;
+
+	/** Number of pending callbacks */
+	int32 GetNumScheduled() const { return EntrySlots.Num(); }
+
+	/** Callbacks fired since the subsystem was created */
+	int64 GetNumFired() const { return NumFired; }
+
+	static constexpr int32 NumSlots = 512;
+	static constexpr double SlotDuration = 0.1;
+
+private:
+	struct FEntry
+	{
+		uint64 Id = 0;
+		int64 FireSlotTime = 0;
+		FSimpleDelegate Callback;
+	};
+
+	int64 TimeToSlotTime(double Time) const;
+	double GetWorldTime() const;
+
+	/** Ring of buckets, indexed by absolute slot time modulo NumSlots */
+	TArray<TArray<FEntry>> Slots;
+
+	/** Pending entry id -> ring index, used by Cancel and IsScheduled */
+	TMap<uint64, int32> EntrySlots;
+
+	/** Last absolute slot time that has been processed */
+	int64 LastProcessedSlotTime = INDEX_NONE;
+
+	uint64 NextId = 1;
+	int64 NumFired = 0;
+
+	/** Delegate handle for tick */
+	FTSTicker::FDelegateHandle TickDelegateHandle;
+};
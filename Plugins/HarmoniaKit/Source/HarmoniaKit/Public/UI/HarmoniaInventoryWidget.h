@@ -24,6 +24,14 @@ public:
     UFUNCTION(BlueprintCallable)
     void SetInventoryComponent(UHarmoniaInventoryComponent* InComponent);
 
+    // Updates only the widget of the slot that changed
+    UFUNCTION()
+    void RefreshSlot(int32 SlotIndex, const FInventorySlot& SlotData);
+
+protected:
+    void BindToInventoryComponent();
+    void UnbindFromInventoryComponent();
+
 public:
     UPROPERTY(meta = (BindWidget))
     TObjectPtr<UUniformGridPanel> SlotPanel = nullptr;
@@ -39,4 +47,9 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Inventory")
     int32 SlotMaxColumns = 10;
+
+protected:
+    // Slot widgets indexed by slot index, rebuilt by Refresh
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UHarmoniaInventorySlotWidget>> SlotWidgets;
 };
\ No newline at end of file
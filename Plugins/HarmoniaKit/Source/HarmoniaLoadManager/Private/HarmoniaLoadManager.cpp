@@ -3,6 +3,7 @@
 #include "HarmoniaLoadManager.h"
 #include "HarmoniaRegistryAsset.h"
 #include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 UHarmoniaLoadManager* UHarmoniaLoadManager::SingletonInstance = nullptr;
 
@@ -64,6 +65,18 @@ void UHarmoniaLoadManager::InitializeFromRegistry(const UHarmoniaRegistryAsset*
 	SoftTableMap.Empty();
 	LoadedTableMap.Empty();
 
+	// 이전 레지스트리의 일괄 로드 상태 초기화
+	if (TablesHandle.IsValid())
+	{
+		TablesHandle->CancelHandle();
+		TablesHandle.Reset();
+	}
+
+	// 진행 중이던 요청은 새 레지스트리로 다시 발행하여 기존 대기자(Future, OnTablesReady)가 새 테이블로 완료되도록 함
+	const bool bReissueRequest = bTablesRequested && !bTablesReady;
+	bTablesRequested = bReissueRequest;
+	bTablesReady = false;
+
 	for (const FHarmoniaDataTableEntry& Entry : Registry->Entries)
 	{
 		if (!Entry.FunctionName.IsEmpty() && !Entry.Table.IsNull())
@@ -76,6 +89,11 @@ void UHarmoniaLoadManager::InitializeFromRegistry(const UHarmoniaRegistryAsset*
 
 	bIsInitialized = true;
 	UE_LOG(LogTemp, Log, TEXT("[Harmonia] LoadManager initialized with %d DataTable entries"), SoftTableMap.Num());
+
+	if (bReissueRequest)
+	{
+		RequestTables();
+	}
 }
 
 UDataTable* UHarmoniaLoadManager::GetDataTableByKey(FName Key)
@@ -114,16 +132,124 @@ UDataTable* UHarmoniaLoadManager::GetDataTableByKey(FName Key)
 
 void UHarmoniaLoadManager::LoadAllTables()
 {
+	if (!bIsInitialized)
+	{
+		AutoLoadRegistry();
+	}
+
+	if (bTablesRequested)
+	{
+		return;
+	}
+
+	bTablesRequested = true;
+	bTablesReady = false;
+	TablesReadyPromise = TPromise<void>();
+	TablesReadyFuture = TablesReadyPromise.GetFuture().Share();
+	TablesRequestTime = FPlatformTime::Seconds();
+
+	RequestTables();
+}
+
+void UHarmoniaLoadManager::RequestTables()
+{
+	TArray<FSoftObjectPath> TablePaths;
+	TablePaths.Reserve(SoftTableMap.Num());
 	for (const auto& Pair : SoftTableMap)
 	{
-		if (!Pair.Value.IsNull())
+		if (!Pair.Value.IsNull() && !LoadedTableMap.Contains(Pair.Key))
+		{
+			TablePaths.AddUnique(Pair.Value.ToSoftObjectPath());
+		}
+	}
+
+	if (TablePaths.Num() == 0)
+	{
+		HandleTablesLoaded();
+		return;
+	}
+
+	if (!UAssetManager::IsInitialized())
+	{
+		// AssetManager 초기화 전 (에디터 유틸리티 등)에는 동기 로드
+		for (const FSoftObjectPath& TablePath : TablePaths)
 		{
-			UDataTable* Loaded = Pair.Value.LoadSynchronous();
-			if (Loaded)
-			{
-				LoadedTableMap.Add(Pair.Key, Loaded);
-			}
+			TablePath.TryLoad();
 		}
+		HandleTablesLoaded();
+		return;
 	}
-	UE_LOG(LogTemp, Log, TEXT("[Harmonia] Pre-loaded %d DataTables"), LoadedTableMap.Num());
-}
\ No newline at end of file
+
+	// 모든 테이블을 하나의 요청으로 스트리밍하여 패키지 로드가 병렬로 진행되도록 함
+	TablesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(TablePaths),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::HandleTablesLoaded),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (!TablesHandle.IsValid())
+	{
+		HandleTablesLoaded();
+	}
+}
+
+void UHarmoniaLoadManager::HandleTablesLoaded()
+{
+	if (bTablesReady)
+	{
+		return;
+	}
+
+	for (const auto& Pair : SoftTableMap)
+	{
+		if (LoadedTableMap.Contains(Pair.Key))
+		{
+			continue;
+		}
+
+		if (UDataTable* Loaded = Pair.Value.Get())
+		{
+			LoadedTableMap.Add(Pair.Key, Loaded);
+		}
+		else if (!Pair.Value.IsNull())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Harmonia] Failed to load DataTable for key: %s"), *Pair.Key.ToString());
+		}
+	}
+
+	// 테이블 참조는 LoadedTableMap이 유지
+	TablesHandle.Reset();
+
+	bTablesReady = true;
+	TablesReadyTime = FPlatformTime::Seconds();
+	UE_LOG(LogTemp, Log, TEXT("[Harmonia] Pre-loaded %d DataTables in %.1f ms"), LoadedTableMap.Num(), (TablesReadyTime - TablesRequestTime) * 1000.0);
+
+	TablesReadyPromise.SetValue();
+	OnTablesReady.Broadcast();
+	OnTablesReady.Clear();
+}
+
+void UHarmoniaLoadManager::CallOrRegister_OnTablesReady(FSimpleDelegate&& Delegate)
+{
+	if (bTablesReady)
+	{
+		Delegate.ExecuteIfBound();
+	}
+	else
+	{
+		OnTablesReady.Add(MoveTemp(Delegate));
+	}
+}
+
+FSoftObjectPath UHarmoniaLoadManager::GetDataTablePath(FName Key)
+{
+	if (!bIsInitialized)
+	{
+		AutoLoadRegistry();
+	}
+
+	if (const TSoftObjectPtr<UDataTable>* SoftPtr = SoftTableMap.Find(Key))
+	{
+		return SoftPtr->ToSoftObjectPath();
+	}
+	return FSoftObjectPath();
+}
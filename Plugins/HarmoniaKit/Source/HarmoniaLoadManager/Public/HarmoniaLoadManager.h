@@ -11,9 +11,13 @@
 #pragma once
 
 #include "Engine/DataTable.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "UObject/GarbageCollection.h"
 #include "HarmoniaLoadManager.generated.h"
 
 class UHarmoniaRegistryAsset;
+struct FStreamableHandle;
 
 /**
  * @class UHarmoniaLoadManager
@@ -54,12 +58,81 @@ public:
      */
     void InitializeFromRegistry(const UHarmoniaRegistryAsset* Registry);
 
-    /** @brief 모든 등록된 테이블 비동기 로드 시작 */
+    /**
+     * @brief 모든 등록된 테이블을 하나의 스트리밍 요청으로 비동기 로드 시작
+     * 
+     * 이미 로드 중이거나 완료된 경우 아무것도 하지 않습니다.
+     * 완료 전에 GetDataTableByKey가 호출되면 해당 테이블만 동기 로드됩니다.
+     */
     void LoadAllTables();
 
     /** @brief 초기화 완료 여부 확인 */
     bool IsInitialized() const { return bIsInitialized; }
 
+    /** @brief 등록된 모든 테이블의 로드 완료 여부 */
+    bool AreTablesReady() const { return bTablesReady; }
+
+    /**
+     * @brief 모든 테이블이 로드되면 완료되는 Future (로딩 화면 등에서 폴링)
+     * @note LoadAllTables 호출 전에는 유효하지 않을 수 있습니다
+     */
+    TSharedFuture<void> GetTablesReadyFuture() const { return TablesReadyFuture; }
+
+    /** @brief 테이블이 이미 준비되었으면 즉시, 아니면 로드 완료 시 호출 */
+    void CallOrRegister_OnTablesReady(FSimpleDelegate&& Delegate);
+
+    /** @brief 키에 등록된 테이블 경로 (다른 테이블과 함께 일괄 로드할 때 사용) */
+    FSoftObjectPath GetDataTablePath(FName Key);
+
+    /** @brief LoadAllTables 요청부터 완료까지 걸린 시간 (초, 완료 전에는 0) */
+    double GetTablesLoadSeconds() const { return bTablesReady ? TablesReadyTime - TablesRequestTime : 0.0; }
+
+    /**
+     * @brief 로드된 테이블로부터 캐시를 워커 스레드에서 생성하고, 결과를 게임 스레드로 전달
+     * 
+     * @param Tables 캐시를 만들 테이블 (호출자가 로드된 상태로 유지해야 함)
+     * @param Build 워커 스레드에서 실행, 테이블을 읽기만 하고 OutCache를 채움
+     * @param OnBuilt 게임 스레드에서 완성된 캐시와 함께 호출
+     */
+    template<typename CacheType>
+    static void BuildTableCacheAsync(const TArray<UDataTable*>& Tables,
+        TUniqueFunction<void(const TArray<const UDataTable*>&, CacheType&)>&& Build,
+        TUniqueFunction<void(CacheType&&)>&& OnBuilt)
+    {
+        TArray<TWeakObjectPtr<const UDataTable>> WeakTables;
+        WeakTables.Reserve(Tables.Num());
+        for (const UDataTable* Table : Tables)
+        {
+            WeakTables.Add(Table);
+        }
+
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakTables = MoveTemp(WeakTables), Build = MoveTemp(Build), OnBuilt = MoveTemp(OnBuilt)]() mutable
+        {
+            CacheType Cache;
+            {
+                // 행 데이터를 읽는 동안 테이블이 GC되지 않도록
+                FGCScopeGuard GCGuard;
+
+                TArray<const UDataTable*> ResolvedTables;
+                ResolvedTables.Reserve(WeakTables.Num());
+                for (const TWeakObjectPtr<const UDataTable>& WeakTable : WeakTables)
+                {
+                    if (const UDataTable* Table = WeakTable.Get())
+                    {
+                        ResolvedTables.Add(Table);
+                    }
+                }
+
+                Build(ResolvedTables, Cache);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Cache = MoveTemp(Cache), OnBuilt = MoveTemp(OnBuilt)]() mutable
+            {
+                OnBuilt(MoveTemp(Cache));
+            });
+        });
+    }
+
 private:
     /** @brief 프로젝트 내 레지스트리 에셋 자동 탐색 및 로드 */
     void AutoLoadRegistry();
@@ -67,10 +140,29 @@ private:
     /** @brief Soft 참조 테이블 맵 (로드 전) */
     TMap<FName, TSoftObjectPtr<UDataTable>> SoftTableMap;
     
-    /** @brief 로드된 테이블 맵 */
+    /** @brief 로드된 테이블 맵 (테이블이 GC되지 않도록 참조 유지) */
+    UPROPERTY(Transient)
     TMap<FName, TObjectPtr<UDataTable>> LoadedTableMap;
 
+    /** @brief 아직 로드되지 않은 테이블들의 스트리밍 요청 발행 */
+    void RequestTables();
+
+    /** @brief 일괄 로드 완료 처리 */
+    void HandleTablesLoaded();
+
+    /** @brief 진행 중인 일괄 로드 요청 */
+    TSharedPtr<FStreamableHandle> TablesHandle;
+
+    TPromise<void> TablesReadyPromise;
+    TSharedFuture<void> TablesReadyFuture;
+    FSimpleMulticastDelegate OnTablesReady;
+
+    double TablesRequestTime = 0.0;
+    double TablesReadyTime = 0.0;
+
     bool bIsInitialized = false;
+    bool bTablesRequested = false;
+    bool bTablesReady = false;
 
     static UHarmoniaLoadManager* SingletonInstance;
 };
\ No newline at end of file
@@ -5,15 +5,113 @@
 
 DEFINE_LOG_CATEGORY(LogHarmoniaDataTablePatcher);
 
+// ============================================================================
+// FHarmoniaCompiledPatchPlan / FHarmoniaPatchSnapshot
+// ============================================================================
+
+bool FHarmoniaCompiledPatchPlan::IsValid() const
+{
+	for (const TWeakObjectPtr<UDataTable>& Table : Tables)
+	{
+		if (!Table.IsValid())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+FHarmoniaPatchSnapshot::FHarmoniaPatchSnapshot(FHarmoniaPatchSnapshot&& Other)
+	: Property(Other.Property)
+	, ValuePtr(Other.ValuePtr)
+	, Bytes(MoveTemp(Other.Bytes))
+{
+	Other.Property = nullptr;
+	Other.ValuePtr = nullptr;
+}
+
+FHarmoniaPatchSnapshot& FHarmoniaPatchSnapshot::operator=(FHarmoniaPatchSnapshot&& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		Property = Other.Property;
+		ValuePtr = Other.ValuePtr;
+		Bytes = MoveTemp(Other.Bytes);
+		Other.Property = nullptr;
+		Other.ValuePtr = nullptr;
+	}
+	return *this;
+}
+
+bool FHarmoniaPatchSnapshot::UsesMemcpy() const
+{
+	// Bitfield bools share their byte with other fields, so they go through the property
+	return Property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !Property->IsA<FBoolProperty>();
+}
+
+void FHarmoniaPatchSnapshot::Capture(const FProperty* InProperty, uint8* InValuePtr)
+{
+	Reset();
+
+	Property = InProperty;
+	ValuePtr = InValuePtr;
+
+	const int32 Size = Property->GetSize();
+	Bytes.SetNumUninitialized(Size);
+
+	if (UsesMemcpy())
+	{
+		FMemory::Memcpy(Bytes.GetData(), ValuePtr, Size);
+	}
+	else
+	{
+		Property->InitializeValue(Bytes.GetData());
+		Property->CopyCompleteValue(Bytes.GetData(), ValuePtr);
+	}
+}
+
+void FHarmoniaPatchSnapshot::Restore() const
+{
+	if (!Property || !ValuePtr)
+	{
+		return;
+	}
+
+	if (UsesMemcpy())
+	{
+		FMemory::Memcpy(ValuePtr, Bytes.GetData(), Bytes.Num());
+	}
+	else
+	{
+		Property->CopyCompleteValue(ValuePtr, Bytes.GetData());
+	}
+}
+
+void FHarmoniaPatchSnapshot::Reset()
+{
+	if (Property && Bytes.Num() > 0 && !UsesMemcpy())
+	{
+		Property->DestroyValue(Bytes.GetData());
+	}
+
+	Property = nullptr;
+	ValuePtr = nullptr;
+	Bytes.Reset();
+}
+
+// ============================================================================
+// UHarmoniaDataTablePatcher
+// ============================================================================
+
 void UHarmoniaDataTablePatcher::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	UE_LOG(LogHarmoniaDataTablePatcher, Log, TEXT("Initializing Harmonia Data Table Patcher"));
 
-	OriginalValues.Empty();
-	ActivePatches.Empty();
-	PatchesByMod.Empty();
+	AppliedPatches.Empty();
+	PatchTargetsByMod.Empty();
 	DataTableCache.Empty();
 }
 
@@ -39,22 +137,7 @@ bool UHarmoniaDataTablePatcher::ApplyPatch(const FHarmoniaDataTablePatch& Patch,
 		return false;
 	}
 
-	// Load data table
-	UDataTable* DataTable = nullptr;
-
-	if (DataTableCache.Contains(Patch.TargetDataTable))
-	{
-		DataTable = DataTableCache[Patch.TargetDataTable];
-	}
-	else
-	{
-		DataTable = Cast<UDataTable>(Patch.TargetDataTable.TryLoad());
-		if (DataTable)
-		{
-			DataTableCache.Add(Patch.TargetDataTable, DataTable);
-		}
-	}
-
+	UDataTable* DataTable = FindOrLoadDataTable(Patch.TargetDataTable);
 	if (!DataTable)
 	{
 		OutResult.ErrorMessage = FString::Printf(TEXT("Failed to load data table: %s"), *Patch.TargetDataTable.ToString());
@@ -62,58 +145,33 @@ bool UHarmoniaDataTablePatcher::ApplyPatch(const FHarmoniaDataTablePatch& Patch,
 		return false;
 	}
 
-	// Find row
-	uint8* RowData = DataTable->FindRowUnchecked(Patch.RowName);
-	if (!RowData)
-	{
-		OutResult.ErrorMessage = FString::Printf(TEXT("Row '%s' not found in table"), *Patch.RowName.ToString());
-		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("%s"), *OutResult.ErrorMessage);
-		return false;
-	}
+	FHarmoniaCompiledPatchPlan Plan;
+	Plan.Patches.Add(Patch);
+	Plan.Tables.Add(DataTable);
 
-	// Find property
-	FProperty* Property = DataTable->GetRowStruct()->FindPropertyByName(Patch.PropertyName);
-	if (!Property)
+	TMap<FName, FProperty*> PropertyCache;
+	FHarmoniaCompiledPatch& Compiled = Plan.Entries.AddDefaulted_GetRef();
+	if (!CompilePatch(Patch, DataTable, PropertyCache, Compiled, OutResult.ErrorMessage))
 	{
-		OutResult.ErrorMessage = FString::Printf(TEXT("Property '%s' not found in row struct"), *Patch.PropertyName.ToString());
 		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("%s"), *OutResult.ErrorMessage);
 		return false;
 	}
+	Compiled.SourceIndex = 0;
 
-	// Generate patch key
-	FString PatchKey = GeneratePatchKey(Patch.TargetDataTable, Patch.RowName, Patch.PropertyName);
-
-	// Backup original value if not already backed up
-	if (!OriginalValues.Contains(PatchKey))
+	const FHarmoniaPatchTarget Target(Patch);
+	if (const FAppliedPatch* Applied = AppliedPatches.Find(Target))
 	{
-		FString OriginalValue = GetPropertyValueAsString(Property, RowData);
-		OriginalValues.Add(PatchKey, OriginalValue);
-		OutResult.OldValue = OriginalValue;
+		OutResult.OldValue = GetPropertyValueAsString(Applied->Original.GetProperty(), Applied->Original.GetData());
 	}
 	else
 	{
-		OutResult.OldValue = OriginalValues[PatchKey];
+		OutResult.OldValue = GetPropertyValueAsString(Compiled.Property, Compiled.ValuePtr);
 	}
 
-	// Apply patch operation
-	if (!ApplyPatchOperation(Property, RowData, Patch, OutResult))
-	{
-		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Failed to apply patch operation: %s"), *OutResult.ErrorMessage);
-		return false;
-	}
-
-	// Register patch
-	ActivePatches.Add(PatchKey, Patch);
-
-	// Track by mod
-	if (!PatchesByMod.Contains(ModId))
-	{
-		PatchesByMod.Add(ModId, FHarmoniaPatchKeyArray());
-	}
-	PatchesByMod[ModId].PatchKeys.AddUnique(PatchKey);
+	ApplyPlan(Plan, ModId);
 
 	OutResult.bSuccess = true;
-	OutResult.NewValue = GetPropertyValueAsString(Property, RowData);
+	OutResult.NewValue = GetPropertyValueAsString(Compiled.Property, Compiled.ValuePtr);
 
 	UE_LOG(LogHarmoniaDataTablePatcher, Log, TEXT("Applied patch: %s.%s.%s = %s (was: %s) [Mod: %s]"),
 		*Patch.TargetDataTable.ToString(),
@@ -128,78 +186,136 @@ bool UHarmoniaDataTablePatcher::ApplyPatch(const FHarmoniaDataTablePatch& Patch,
 
 int32 UHarmoniaDataTablePatcher::ApplyPatches(const TArray<FHarmoniaDataTablePatch>& Patches, FName ModId)
 {
-	int32 AppliedCount = 0;
+	FHarmoniaCompiledPatchPlan Plan;
+	CompilePatches(Patches, Plan);
+	const int32 AppliedCount = ApplyPlan(Plan, ModId);
+
+	UE_LOG(LogHarmoniaDataTablePatcher, Log, TEXT("Applied %d/%d patches for mod: %s"),
+		AppliedCount, Patches.Num(), *ModId.ToString());
 
-	for (const FHarmoniaDataTablePatch& Patch : Patches)
+	return AppliedCount;
+}
+
+int32 UHarmoniaDataTablePatcher::CompilePatches(const TArray<FHarmoniaDataTablePatch>& Patches, FHarmoniaCompiledPatchPlan& OutPlan)
+{
+	OutPlan = FHarmoniaCompiledPatchPlan();
+	OutPlan.Patches = Patches;
+	OutPlan.Entries.Reserve(Patches.Num());
+
+	// Group by table so every table is loaded and searched once
+	TMap<FSoftObjectPath, TArray<int32>> PatchIndicesByTable;
+	for (int32 Index = 0; Index < Patches.Num(); ++Index)
 	{
-		FHarmoniaPatchResult Result;
-		if (ApplyPatch(Patch, ModId, Result))
+		FString ErrorMessage;
+		if (!ValidatePatch(Patches[Index], ErrorMessage))
 		{
-			AppliedCount++;
+			UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Invalid patch: %s"), *ErrorMessage);
+			++OutPlan.NumFailed;
+			continue;
 		}
+
+		PatchIndicesByTable.FindOrAdd(Patches[Index].TargetDataTable).Add(Index);
 	}
 
-	UE_LOG(LogHarmoniaDataTablePatcher, Log, TEXT("Applied %d/%d patches for mod: %s"),
-		AppliedCount, Patches.Num(), *ModId.ToString());
+	for (const TPair<FSoftObjectPath, TArray<int32>>& Pair : PatchIndicesByTable)
+	{
+		UDataTable* DataTable = FindOrLoadDataTable(Pair.Key);
+		if (!DataTable)
+		{
+			UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Failed to load data table: %s (%d patches skipped)"), *Pair.Key.ToString(), Pair.Value.Num());
+			OutPlan.NumFailed += Pair.Value.Num();
+			continue;
+		}
 
-	return AppliedCount;
+		OutPlan.Tables.Add(DataTable);
+
+		TMap<FName, FProperty*> PropertyCache;
+		for (const int32 Index : Pair.Value)
+		{
+			FHarmoniaCompiledPatch Compiled;
+			FString ErrorMessage;
+			if (CompilePatch(Patches[Index], DataTable, PropertyCache, Compiled, ErrorMessage))
+			{
+				Compiled.SourceIndex = Index;
+				OutPlan.Entries.Add(MoveTemp(Compiled));
+			}
+			else
+			{
+				UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("%s"), *ErrorMessage);
+				++OutPlan.NumFailed;
+			}
+		}
+	}
+
+	return OutPlan.Entries.Num();
 }
 
-bool UHarmoniaDataTablePatcher::RevertPatch(const FHarmoniaDataTablePatch& Patch, FName ModId)
+int32 UHarmoniaDataTablePatcher::ApplyPlan(const FHarmoniaCompiledPatchPlan& Plan, FName ModId)
 {
-	FString PatchKey = GeneratePatchKey(Patch.TargetDataTable, Patch.RowName, Patch.PropertyName);
-
-	if (!ActivePatches.Contains(PatchKey))
+	if (!Plan.IsValid())
 	{
-		UE_LOG(LogHarmoniaDataTablePatcher, Warning, TEXT("Patch not active: %s"), *PatchKey);
-		return false;
+		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Patch plan for mod %s points into an unloaded data table, compile it again"), *ModId.ToString());
+		return 0;
 	}
 
-	// Load data table
-	UDataTable* DataTable = Cast<UDataTable>(Patch.TargetDataTable.TryLoad());
-	if (!DataTable)
+	TSet<FHarmoniaPatchTarget>& ModTargets = PatchTargetsByMod.FindOrAdd(ModId);
+	ModTargets.Reserve(ModTargets.Num() + Plan.Entries.Num());
+	AppliedPatches.Reserve(AppliedPatches.Num() + Plan.Entries.Num());
+
+	for (const FHarmoniaCompiledPatch& Compiled : Plan.Entries)
 	{
-		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Failed to load data table: %s"), *Patch.TargetDataTable.ToString());
-		return false;
+		const FHarmoniaDataTablePatch& Patch = Plan.Patches[Compiled.SourceIndex];
+
+		// Backup original value if not already backed up
+		FAppliedPatch* Applied = AppliedPatches.Find(Compiled.Target);
+		if (!Applied)
+		{
+			Applied = &AppliedPatches.Add(Compiled.Target);
+			Applied->Original.Capture(Compiled.Property, Compiled.ValuePtr);
+		}
+
+		ExecuteCompiledPatch(Compiled, Patch);
+
+		Applied->Patch = Patch;
+		ModTargets.Add(Compiled.Target);
+
+		UE_LOG(LogHarmoniaDataTablePatcher, Verbose, TEXT("Applied patch: %s.%s.%s [Mod: %s]"),
+			*Patch.TargetDataTable.ToString(), *Patch.RowName.ToString(), *Patch.PropertyName.ToString(), *ModId.ToString());
 	}
 
-	// Find row
-	uint8* RowData = DataTable->FindRowUnchecked(Patch.RowName);
-	if (!RowData)
+	if (ModTargets.Num() == 0)
 	{
-		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Row not found: %s"), *Patch.RowName.ToString());
-		return false;
+		PatchTargetsByMod.Remove(ModId);
 	}
 
-	// Find property
-	FProperty* Property = DataTable->GetRowStruct()->FindPropertyByName(Patch.PropertyName);
-	if (!Property)
+	return Plan.Entries.Num();
+}
+
+bool UHarmoniaDataTablePatcher::RevertPatch(const FHarmoniaDataTablePatch& Patch, FName ModId)
+{
+	const FHarmoniaPatchTarget Target(Patch);
+
+	FAppliedPatch* Applied = AppliedPatches.Find(Target);
+	if (!Applied)
 	{
-		UE_LOG(LogHarmoniaDataTablePatcher, Error, TEXT("Property not found: %s"), *Patch.PropertyName.ToString());
+		UE_LOG(LogHarmoniaDataTablePatcher, Warning, TEXT("Patch not active: %s"), *GeneratePatchKey(Target.Table, Target.RowName, Target.PropertyName));
 		return false;
 	}
 
 	// Restore original value
-	if (OriginalValues.Contains(PatchKey))
-	{
-		FString OriginalValue = OriginalValues[PatchKey];
-		if (SetPropertyValueFromString(Property, RowData, OriginalValue))
-		{
-			UE_LOG(LogHarmoniaDataTablePatcher, Log, TEXT("Reverted patch: %s = %s"), *PatchKey, *OriginalValue);
-		}
-	}
+	Applied->Original.Restore();
+	AppliedPatches.Remove(Target);
 
-	// Remove from active patches
-	ActivePatches.Remove(PatchKey);
+	UE_LOG(LogHarmoniaDataTablePatcher, Verbose, TEXT("Reverted patch: %s"), *GeneratePatchKey(Target.Table, Target.RowName, Target.PropertyName));
 
 	// Remove from mod tracking
-	if (PatchesByMod.Contains(ModId))
+	if (TSet<FHarmoniaPatchTarget>* ModTargets = PatchTargetsByMod.Find(ModId))
 	{
-		PatchesByMod[ModId].PatchKeys.Remove(PatchKey);
+		ModTargets->Remove(Target);
 
-		if (PatchesByMod[ModId].PatchKeys.Num() == 0)
+		if (ModTargets->Num() == 0)
 		{
-			PatchesByMod.Remove(ModId);
+			PatchTargetsByMod.Remove(ModId);
 		}
 	}
 
@@ -208,23 +324,21 @@ bool UHarmoniaDataTablePatcher::RevertPatch(const FHarmoniaDataTablePatch& Patch
 
 int32 UHarmoniaDataTablePatcher::RevertAllModPatches(FName ModId)
 {
-	if (!PatchesByMod.Contains(ModId))
+	TSet<FHarmoniaPatchTarget> ModTargets;
+	if (!PatchTargetsByMod.RemoveAndCopyValue(ModId, ModTargets))
 	{
 		return 0;
 	}
 
-	TArray<FString> PatchKeys = PatchesByMod[ModId].PatchKeys;
 	int32 RevertedCount = 0;
 
-	for (const FString& PatchKey : PatchKeys)
+	for (const FHarmoniaPatchTarget& Target : ModTargets)
 	{
-		if (ActivePatches.Contains(PatchKey))
+		if (FAppliedPatch* Applied = AppliedPatches.Find(Target))
 		{
-			const FHarmoniaDataTablePatch& Patch = ActivePatches[PatchKey];
-			if (RevertPatch(Patch, ModId))
-			{
-				RevertedCount++;
-			}
+			Applied->Original.Restore();
+			AppliedPatches.Remove(Target);
+			RevertedCount++;
 		}
 	}
 
@@ -237,27 +351,21 @@ void UHarmoniaDataTablePatcher::RevertAllPatches()
 {
 	UE_LOG(LogHarmoniaDataTablePatcher, Log, TEXT("Reverting all patches..."));
 
-	TArray<FName> ModIds;
-	PatchesByMod.GetKeys(ModIds);
-
-	for (const FName& ModId : ModIds)
+	for (const TPair<FHarmoniaPatchTarget, FAppliedPatch>& Pair : AppliedPatches)
 	{
-		RevertAllModPatches(ModId);
+		Pair.Value.Original.Restore();
 	}
 
-	OriginalValues.Empty();
-	ActivePatches.Empty();
-	PatchesByMod.Empty();
+	AppliedPatches.Empty();
+	PatchTargetsByMod.Empty();
 	DataTableCache.Empty();
 }
 
 bool UHarmoniaDataTablePatcher::GetOriginalValue(const FSoftObjectPath& TablePath, FName RowName, FName PropertyName, FString& OutOriginalValue) const
 {
-	FString PatchKey = GeneratePatchKey(TablePath, RowName, PropertyName);
-
-	if (OriginalValues.Contains(PatchKey))
+	if (const FAppliedPatch* Applied = AppliedPatches.Find(FHarmoniaPatchTarget(TablePath, RowName, PropertyName)))
 	{
-		OutOriginalValue = OriginalValues[PatchKey];
+		OutOriginalValue = GetPropertyValueAsString(Applied->Original.GetProperty(), Applied->Original.GetData());
 		return true;
 	}
 
@@ -266,12 +374,19 @@ bool UHarmoniaDataTablePatcher::GetOriginalValue(const FSoftObjectPath& TablePat
 
 bool UHarmoniaDataTablePatcher::IsValuePatched(const FSoftObjectPath& TablePath, FName RowName, FName PropertyName) const
 {
-	FString PatchKey = GeneratePatchKey(TablePath, RowName, PropertyName);
-	return ActivePatches.Contains(PatchKey);
+	return AppliedPatches.Contains(FHarmoniaPatchTarget(TablePath, RowName, PropertyName));
 }
 
 TMap<FString, FHarmoniaDataTablePatch> UHarmoniaDataTablePatcher::GetAllActivePatches() const
 {
+	TMap<FString, FHarmoniaDataTablePatch> ActivePatches;
+	ActivePatches.Reserve(AppliedPatches.Num());
+
+	for (const TPair<FHarmoniaPatchTarget, FAppliedPatch>& Pair : AppliedPatches)
+	{
+		ActivePatches.Add(GeneratePatchKey(Pair.Key.Table, Pair.Key.RowName, Pair.Key.PropertyName), Pair.Value.Patch);
+	}
+
 	return ActivePatches;
 }
 
@@ -279,15 +394,15 @@ TArray<FHarmoniaDataTablePatch> UHarmoniaDataTablePatcher::GetModPatches(FName M
 {
 	TArray<FHarmoniaDataTablePatch> Patches;
 
-	if (PatchesByMod.Contains(ModId))
+	if (const TSet<FHarmoniaPatchTarget>* ModTargets = PatchTargetsByMod.Find(ModId))
 	{
-		const TArray<FString>& PatchKeys = PatchesByMod[ModId].PatchKeys;
+		Patches.Reserve(ModTargets->Num());
 
-		for (const FString& Key : PatchKeys)
+		for (const FHarmoniaPatchTarget& Target : *ModTargets)
 		{
-			if (ActivePatches.Contains(Key))
+			if (const FAppliedPatch* Applied = AppliedPatches.Find(Target))
 			{
-				Patches.Add(ActivePatches[Key]);
+				Patches.Add(Applied->Patch);
 			}
 		}
 	}
@@ -330,76 +445,246 @@ bool UHarmoniaDataTablePatcher::ValidatePatch(const FHarmoniaDataTablePatch& Pat
 	return true;
 }
 
-bool UHarmoniaDataTablePatcher::ApplyPatchOperation(FProperty* Property, void* DataPtr, const FHarmoniaDataTablePatch& Patch, FHarmoniaPatchResult& OutResult)
+UDataTable* UHarmoniaDataTablePatcher::FindOrLoadDataTable(const FSoftObjectPath& TablePath)
 {
+	if (const TObjectPtr<UDataTable>* CachedTable = DataTableCache.Find(TablePath))
+	{
+		return *CachedTable;
+	}
+
+	UDataTable* DataTable = Cast<UDataTable>(TablePath.TryLoad());
+	if (DataTable)
+	{
+		DataTableCache.Add(TablePath, DataTable);
+	}
+	return DataTable;
+}
+
+bool UHarmoniaDataTablePatcher::CompilePatch(const FHarmoniaDataTablePatch& Patch, UDataTable* DataTable, TMap<FName, FProperty*>& PropertyCache, FHarmoniaCompiledPatch& OutCompiled, FString& OutErrorMessage) const
+{
+	// Find row
+	uint8* RowData = DataTable->FindRowUnchecked(Patch.RowName);
+	if (!RowData)
+	{
+		OutErrorMessage = FString::Printf(TEXT("Row '%s' not found in table %s"), *Patch.RowName.ToString(), *DataTable->GetName());
+		return false;
+	}
+
+	// Find property
+	FProperty** CachedProperty = PropertyCache.Find(Patch.PropertyName);
+	FProperty* Property = CachedProperty ? *CachedProperty : PropertyCache.Add(Patch.PropertyName, DataTable->GetRowStruct()->FindPropertyByName(Patch.PropertyName));
+	if (!Property)
+	{
+		OutErrorMessage = FString::Printf(TEXT("Property '%s' not found in row struct of %s"), *Patch.PropertyName.ToString(), *DataTable->GetName());
+		return false;
+	}
+
+	OutCompiled.Target = FHarmoniaPatchTarget(Patch);
+	OutCompiled.Property = Property;
+	OutCompiled.ValuePtr = Property->ContainerPtrToValuePtr<uint8>(RowData);
+
+	// Parse operation
 	if (Patch.Operation == TEXT("Set"))
 	{
-		// Direct set operation
-		return SetPropertyValueFromString(Property, DataPtr, Patch.NewValue);
+		OutCompiled.Operation = EHarmoniaPatchOperation::Set;
 	}
 	else if (Patch.Operation == TEXT("Add"))
 	{
-		// Add to numeric value
-		if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		OutCompiled.Operation = EHarmoniaPatchOperation::Add;
+	}
+	else if (Patch.Operation == TEXT("Multiply"))
+	{
+		OutCompiled.Operation = EHarmoniaPatchOperation::Multiply;
+	}
+	else if (Patch.Operation == TEXT("Append"))
+	{
+		OutCompiled.Operation = EHarmoniaPatchOperation::Append;
+	}
+	else
+	{
+		OutErrorMessage = FString::Printf(TEXT("Unsupported operation: %s"), *Patch.Operation);
+		return false;
+	}
+
+	// Resolve value type and parse the operand once
+	const FByteProperty* ByteProperty = CastField<FByteProperty>(Property);
+	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+	if (NumericProperty && !(ByteProperty && ByteProperty->Enum))
+	{
+		if (Property->IsA<FIntProperty>())
+		{
+			OutCompiled.ValueType = EHarmoniaPatchValueType::Int32;
+		}
+		else if (Property->IsA<FInt64Property>())
+		{
+			OutCompiled.ValueType = EHarmoniaPatchValueType::Int64;
+		}
+		else if (ByteProperty)
+		{
+			OutCompiled.ValueType = EHarmoniaPatchValueType::UInt8;
+		}
+		else if (Property->IsA<FFloatProperty>())
 		{
-			double CurrentValue = NumericProperty->GetFloatingPointPropertyValue(DataPtr);
-			double AddValue = FCString::Atod(*Patch.NewValue);
-			double NewValue = CurrentValue + AddValue;
+			OutCompiled.ValueType = EHarmoniaPatchValueType::Float;
+		}
+		else if (Property->IsA<FDoubleProperty>())
+		{
+			OutCompiled.ValueType = EHarmoniaPatchValueType::Double;
+		}
+		else
+		{
+			OutCompiled.ValueType = EHarmoniaPatchValueType::Numeric;
+		}
 
-			if (NumericProperty->IsInteger())
-			{
-				NumericProperty->SetIntPropertyValue(DataPtr, static_cast<int64>(NewValue));
-			}
-			else
-			{
-				NumericProperty->SetFloatingPointPropertyValue(DataPtr, NewValue);
-			}
+		OutCompiled.Operand = FCString::Atod(*Patch.NewValue);
+		OutCompiled.IntOperand = FCString::Atoi64(*Patch.NewValue);
+	}
+	else if (Property->IsA<FBoolProperty>())
+	{
+		OutCompiled.ValueType = EHarmoniaPatchValueType::Bool;
+		OutCompiled.bBoolOperand = Patch.NewValue.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Patch.NewValue.Equals(TEXT("1"));
+	}
+	else if (Property->IsA<FStrProperty>())
+	{
+		OutCompiled.ValueType = EHarmoniaPatchValueType::String;
+	}
+	else if (Property->IsA<FNameProperty>())
+	{
+		OutCompiled.ValueType = EHarmoniaPatchValueType::Name;
+		OutCompiled.NameOperand = FName(*Patch.NewValue);
+	}
+	else
+	{
+		OutCompiled.ValueType = EHarmoniaPatchValueType::Text;
+	}
 
-			return true;
-		}
+	// Check the operation fits the value
+	const bool bIsNumeric = OutCompiled.ValueType <= EHarmoniaPatchValueType::Numeric;
+	const bool bSupported = OutCompiled.Operation == EHarmoniaPatchOperation::Set
+		|| (bIsNumeric && OutCompiled.Operation != EHarmoniaPatchOperation::Append)
+		|| (OutCompiled.ValueType == EHarmoniaPatchValueType::String && OutCompiled.Operation == EHarmoniaPatchOperation::Append);
+	if (!bSupported)
+	{
+		OutErrorMessage = FString::Printf(TEXT("Unsupported operation or property type: %s on %s.%s"),
+			*Patch.Operation, *Patch.RowName.ToString(), *Patch.PropertyName.ToString());
+		return false;
 	}
-	else if (Patch.Operation == TEXT("Multiply"))
+
+	return true;
+}
+
+namespace HarmoniaDataTablePatcher
+{
+	void SetIntegerPropertyValue(const FNumericProperty& Property, void* ValuePtr, double Result)
 	{
-		// Multiply numeric value
-		if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		if (Property.IsA<FInt8Property>())
+		{
+			Property.SetIntPropertyValue(ValuePtr, static_cast<int64>(ConvertArithmeticResult<int8>(Result)));
+		}
+		else if (Property.IsA<FInt16Property>())
+		{
+			Property.SetIntPropertyValue(ValuePtr, static_cast<int64>(ConvertArithmeticResult<int16>(Result)));
+		}
+		else if (Property.IsA<FUInt16Property>())
+		{
+			Property.SetIntPropertyValue(ValuePtr, static_cast<uint64>(ConvertArithmeticResult<uint16>(Result)));
+		}
+		else if (Property.IsA<FUInt32Property>())
 		{
-			double CurrentValue = NumericProperty->GetFloatingPointPropertyValue(DataPtr);
-			double Multiplier = FCString::Atod(*Patch.NewValue);
-			double NewValue = CurrentValue * Multiplier;
+			Property.SetIntPropertyValue(ValuePtr, static_cast<uint64>(ConvertArithmeticResult<uint32>(Result)));
+		}
+		else if (Property.IsA<FUInt64Property>())
+		{
+			Property.SetIntPropertyValue(ValuePtr, ConvertArithmeticResult<uint64>(Result));
+		}
+		else
+		{
+			Property.SetIntPropertyValue(ValuePtr, ConvertArithmeticResult<int64>(Result));
+		}
+	}
+}
 
-			if (NumericProperty->IsInteger())
+void UHarmoniaDataTablePatcher::ExecuteCompiledPatch(const FHarmoniaCompiledPatch& Compiled, const FHarmoniaDataTablePatch& Patch) const
+{
+	using namespace HarmoniaDataTablePatcher;
+
+	uint8* ValuePtr = Compiled.ValuePtr;
+
+	switch (Compiled.ValueType)
+	{
+	case EHarmoniaPatchValueType::Int32:
+		ApplyNumericOperation<int32>(ValuePtr, Compiled.Operation, Compiled.Operand, Compiled.IntOperand);
+		break;
+	case EHarmoniaPatchValueType::Int64:
+		ApplyNumericOperation<int64>(ValuePtr, Compiled.Operation, Compiled.Operand, Compiled.IntOperand);
+		break;
+	case EHarmoniaPatchValueType::UInt8:
+		ApplyNumericOperation<uint8>(ValuePtr, Compiled.Operation, Compiled.Operand, Compiled.IntOperand);
+		break;
+	case EHarmoniaPatchValueType::Float:
+		ApplyNumericOperation<float>(ValuePtr, Compiled.Operation, Compiled.Operand, Compiled.IntOperand);
+		break;
+	case EHarmoniaPatchValueType::Double:
+		ApplyNumericOperation<double>(ValuePtr, Compiled.Operation, Compiled.Operand, Compiled.IntOperand);
+		break;
+	case EHarmoniaPatchValueType::Numeric:
+	{
+		const FNumericProperty* NumericProperty = CastFieldChecked<const FNumericProperty>(Compiled.Property);
+		if (NumericProperty->IsInteger())
+		{
+			if (Compiled.Operation == EHarmoniaPatchOperation::Set)
 			{
-				NumericProperty->SetIntPropertyValue(DataPtr, static_cast<int64>(NewValue));
+				NumericProperty->SetIntPropertyValue(ValuePtr, Compiled.IntOperand);
 			}
 			else
 			{
-				NumericProperty->SetFloatingPointPropertyValue(DataPtr, NewValue);
+				const double CurrentValue = NumericProperty->IsA<FUInt64Property>()
+					? static_cast<double>(NumericProperty->GetUnsignedIntPropertyValue(ValuePtr))
+					: static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+				const double NewValue = Compiled.Operation == EHarmoniaPatchOperation::Add ? CurrentValue + Compiled.Operand : CurrentValue * Compiled.Operand;
+				SetIntegerPropertyValue(*NumericProperty, ValuePtr, NewValue);
 			}
-
-			return true;
 		}
+		else
+		{
+			const double CurrentValue = NumericProperty->GetFloatingPointPropertyValue(ValuePtr);
+			const double NewValue = Compiled.Operation == EHarmoniaPatchOperation::Set ? Compiled.Operand
+				: Compiled.Operation == EHarmoniaPatchOperation::Add ? CurrentValue + Compiled.Operand
+				: CurrentValue * Compiled.Operand;
+			NumericProperty->SetFloatingPointPropertyValue(ValuePtr, NewValue);
+		}
+		break;
 	}
-	else if (Patch.Operation == TEXT("Append"))
+	case EHarmoniaPatchValueType::Bool:
+		CastFieldChecked<const FBoolProperty>(Compiled.Property)->SetPropertyValue(ValuePtr, Compiled.bBoolOperand);
+		break;
+	case EHarmoniaPatchValueType::String:
 	{
-		// Append to string value
-		if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+		FString& Value = *reinterpret_cast<FString*>(ValuePtr);
+		if (Compiled.Operation == EHarmoniaPatchOperation::Append)
+		{
+			Value += Patch.NewValue;
+		}
+		else
 		{
-			FString CurrentValue = StrProperty->GetPropertyValue(DataPtr);
-			FString NewValue = CurrentValue + Patch.NewValue;
-			StrProperty->SetPropertyValue(DataPtr, NewValue);
-			return true;
+			Value = Patch.NewValue;
 		}
+		break;
+	}
+	case EHarmoniaPatchValueType::Name:
+		*reinterpret_cast<FName*>(ValuePtr) = Compiled.NameOperand;
+		break;
+	case EHarmoniaPatchValueType::Text:
+		SetPropertyValueFromString(Compiled.Property, ValuePtr, Patch.NewValue);
+		break;
 	}
-
-	OutResult.ErrorMessage = FString::Printf(TEXT("Unsupported operation or property type: %s"), *Patch.Operation);
-	return false;
 }
 
-FString UHarmoniaDataTablePatcher::GetPropertyValueAsString(FProperty* Property, const void* DataPtr) const
+FString UHarmoniaDataTablePatcher::GetPropertyValueAsString(const FProperty* Property, const void* DataPtr) const
 {
 	FString ValueString;
 
-	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
 	{
 		if (NumericProperty->IsInteger())
 		{
@@ -410,15 +695,15 @@ FString UHarmoniaDataTablePatcher::GetPropertyValueAsString(FProperty* Property,
 			ValueString = FString::Printf(TEXT("%f"), NumericProperty->GetFloatingPointPropertyValue(DataPtr));
 		}
 	}
-	else if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	else if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
 	{
 		ValueString = StrProperty->GetPropertyValue(DataPtr);
 	}
-	else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
 	{
 		ValueString = BoolProperty->GetPropertyValue(DataPtr) ? TEXT("true") : TEXT("false");
 	}
-	else if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	else if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
 	{
 		ValueString = NameProperty->GetPropertyValue(DataPtr).ToString();
 	}
@@ -430,9 +715,9 @@ FString UHarmoniaDataTablePatcher::GetPropertyValueAsString(FProperty* Property,
 	return ValueString;
 }
 
-bool UHarmoniaDataTablePatcher::SetPropertyValueFromString(FProperty* Property, void* DataPtr, const FString& Value) const
+bool UHarmoniaDataTablePatcher::SetPropertyValueFromString(const FProperty* Property, void* DataPtr, const FString& Value) const
 {
-	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
 	{
 		if (NumericProperty->IsInteger())
 		{
@@ -446,18 +731,18 @@ bool UHarmoniaDataTablePatcher::SetPropertyValueFromString(FProperty* Property,
 		}
 		return true;
 	}
-	else if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	else if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
 	{
 		StrProperty->SetPropertyValue(DataPtr, Value);
 		return true;
 	}
-	else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
 	{
 		bool BoolValue = Value.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Value.Equals(TEXT("1"));
 		BoolProperty->SetPropertyValue(DataPtr, BoolValue);
 		return true;
 	}
-	else if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	else if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
 	{
 		NameProperty->SetPropertyValue(DataPtr, FName(*Value));
 		return true;
@@ -0,0 +1,53 @@
+﻿// Copyright 2025 Snow Game Studio.
+
+#include "Misc/AutomationTest.h"
+#include "System/HarmoniaDataTablePatcher.h"
+
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//////////////////////////////////////////////////////////////////////////
+// Data Table Patcher Tests
+//////////////////////////////////////////////////////////////////////////
+
+#define HARMONIA_MOD_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::HighPriority)
+
+namespace HarmoniaDataTablePatcherTests
+{
+	template<typename T>
+	T Patch(T Value, EHarmoniaPatchOperation Operation, double Operand)
+	{
+		HarmoniaDataTablePatcher::ApplyNumericOperation<T>(reinterpret_cast<uint8*>(&Value), Operation, Operand, static_cast<int64>(Operand));
+		return Value;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHarmoniaDataTablePatcherIntegerOverflowTest, "HarmoniaKit.Mod.DataTablePatcher.IntegerOverflow", HARMONIA_MOD_TEST_FLAGS)
+bool FHarmoniaDataTablePatcherIntegerOverflowTest::RunTest(const FString& Parameters)
+{
+	using namespace HarmoniaDataTablePatcherTests;
+
+	// int32 saturates at both ends
+	TestEqual(TEXT("int32 Add overflow saturates to Max"), Patch<int32>(MAX_int32 - 5, EHarmoniaPatchOperation::Add, 1e10), MAX_int32);
+	TestEqual(TEXT("int32 Add underflow saturates to Lowest"), Patch<int32>(MIN_int32 + 5, EHarmoniaPatchOperation::Add, -1e10), MIN_int32);
+	TestEqual(TEXT("int32 Multiply overflow saturates to Lowest"), Patch<int32>(1000, EHarmoniaPatchOperation::Multiply, -1e10), MIN_int32);
+	TestEqual(TEXT("int32 in range Add is exact"), Patch<int32>(40, EHarmoniaPatchOperation::Add, 2.0), 42);
+
+	// int64 upper bound is not exactly representable as a double
+	TestEqual(TEXT("int64 Multiply overflow saturates to Max"), Patch<int64>(MAX_int64 / 2, EHarmoniaPatchOperation::Multiply, 4.0), MAX_int64);
+	TestEqual(TEXT("int64 Add underflow saturates to Lowest"), Patch<int64>(MIN_int64, EHarmoniaPatchOperation::Add, -1e30), MIN_int64);
+
+	// uint8 clamps at zero and 255
+	TestEqual(TEXT("uint8 Add overflow saturates to Max"), Patch<uint8>(250, EHarmoniaPatchOperation::Add, 100.0), static_cast<uint8>(255));
+	TestEqual(TEXT("uint8 Add underflow saturates to zero"), Patch<uint8>(5, EHarmoniaPatchOperation::Add, -100.0), static_cast<uint8>(0));
+
+	// NaN operands leave a defined value
+	TestEqual(TEXT("int32 NaN result becomes zero"), Patch<int32>(7, EHarmoniaPatchOperation::Multiply, std::numeric_limits<double>::quiet_NaN()), 0);
+
+	return true;
+}
+
+#undef HARMONIA_MOD_TEST_FLAGS
+
+#endif // WITH_DEV_AUTOMATION_TESTS
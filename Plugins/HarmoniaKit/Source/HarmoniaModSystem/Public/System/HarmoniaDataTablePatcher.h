@@ -11,15 +11,190 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogHarmoniaDataTablePatcher, Log, All);
 
 /**
- * Wrapper struct for TArray<FString> to be used as TMap value
+ * Identifies one patched value (table, row, property)
  */
-USTRUCT()
-struct FHarmoniaPatchKeyArray
+struct HARMONIAMODSYSTEM_API FHarmoniaPatchTarget
 {
-	GENERATED_BODY()
+	FSoftObjectPath Table;
+	FName RowName;
+	FName PropertyName;
 
-	UPROPERTY()
-	TArray<FString> PatchKeys;
+	FHarmoniaPatchTarget() = default;
+	explicit FHarmoniaPatchTarget(const FHarmoniaDataTablePatch& Patch)
+		: Table(Patch.TargetDataTable)
+		, RowName(Patch.RowName)
+		, PropertyName(Patch.PropertyName)
+	{}
+	FHarmoniaPatchTarget(const FSoftObjectPath& InTable, FName InRowName, FName InPropertyName)
+		: Table(InTable)
+		, RowName(InRowName)
+		, PropertyName(InPropertyName)
+	{}
+
+	friend bool operator==(const FHarmoniaPatchTarget& Lhs, const FHarmoniaPatchTarget& Rhs)
+	{
+		return Lhs.RowName == Rhs.RowName && Lhs.PropertyName == Rhs.PropertyName && Lhs.Table == Rhs.Table;
+	}
+
+	friend uint32 GetTypeHash(const FHarmoniaPatchTarget& Target)
+	{
+		return HashCombineFast(GetTypeHash(Target.Table), HashCombineFast(GetTypeHash(Target.RowName), GetTypeHash(Target.PropertyName)));
+	}
+};
+
+/** Patch operation, parsed once from FHarmoniaDataTablePatch::Operation */
+enum class EHarmoniaPatchOperation : uint8
+{
+	Set,
+	Add,
+	Multiply,
+	Append
+};
+
+/** How a compiled patch writes its value */
+enum class EHarmoniaPatchValueType : uint8
+{
+	Int32,
+	Int64,
+	UInt8,
+	Float,
+	Double,
+	/** Any other numeric property, written through FNumericProperty */
+	Numeric,
+	Bool,
+	String,
+	Name,
+	/** Anything else (structs, enums, containers), Set only, imported from text */
+	Text
+};
+
+/**
+ * One patch resolved down to the memory it writes
+ */
+struct FHarmoniaCompiledPatch
+{
+	FHarmoniaPatchTarget Target;
+
+	/** Row memory + property offset */
+	uint8* ValuePtr = nullptr;
+
+	const FProperty* Property = nullptr;
+
+	EHarmoniaPatchOperation Operation = EHarmoniaPatchOperation::Set;
+	EHarmoniaPatchValueType ValueType = EHarmoniaPatchValueType::Text;
+
+	/** Parsed operand for numeric values */
+	double Operand = 0.0;
+	int64 IntOperand = 0;
+
+	/** Parsed operand for bool / name values */
+	bool bBoolOperand = false;
+	FName NameOperand;
+
+	/** Index of the source patch in FHarmoniaCompiledPatchPlan::Patches */
+	int32 SourceIndex = INDEX_NONE;
+};
+
+/**
+ * Patches compiled once: every table loaded and every row / property resolved, grouped by table.
+ * Pointers stay valid while the tables are loaded, the patcher keeps patched tables alive.
+ */
+struct HARMONIAMODSYSTEM_API FHarmoniaCompiledPatchPlan
+{
+	/** Source patches, referenced by FHarmoniaCompiledPatch::SourceIndex */
+	TArray<FHarmoniaDataTablePatch> Patches;
+
+	/** Compiled patches, entries of the same table are contiguous */
+	TArray<FHarmoniaCompiledPatch> Entries;
+
+	/** Tables the entries point into */
+	TArray<TWeakObjectPtr<UDataTable>> Tables;
+
+	/** Patches that failed to compile (logged) */
+	int32 NumFailed = 0;
+
+	/** False once one of the tables has been unloaded, the plan must be compiled again */
+	bool IsValid() const;
+};
+
+namespace HarmoniaDataTablePatcher
+{
+	/** Convert the result of a numeric patch to T. Integral results saturate at the limits of T, out of range conversions are undefined */
+	template<typename T>
+	T ConvertArithmeticResult(double Result)
+	{
+		if constexpr (TIsIntegral<T>::Value)
+		{
+			// Max() + 1 is a power of two and exact as a double, Max() itself is not for 64-bit types
+			constexpr double Lowest = static_cast<double>(TNumericLimits<T>::Lowest());
+			constexpr double UpperBound = static_cast<double>(TNumericLimits<T>::Max()) + 1.0;
+			if (FMath::IsNaN(Result))
+			{
+				return T(0);
+			}
+			if (Result <= Lowest)
+			{
+				return TNumericLimits<T>::Lowest();
+			}
+			if (Result >= UpperBound)
+			{
+				return TNumericLimits<T>::Max();
+			}
+		}
+		return static_cast<T>(Result);
+	}
+
+	/** Apply a Set / Add / Multiply patch to a value of type T */
+	template<typename T>
+	void ApplyNumericOperation(uint8* ValuePtr, EHarmoniaPatchOperation Operation, double Operand, int64 IntOperand)
+	{
+		T& Value = *reinterpret_cast<T*>(ValuePtr);
+		switch (Operation)
+		{
+		case EHarmoniaPatchOperation::Set:
+			Value = TIsIntegral<T>::Value ? static_cast<T>(IntOperand) : static_cast<T>(Operand);
+			break;
+		case EHarmoniaPatchOperation::Add:
+			Value = ConvertArithmeticResult<T>(static_cast<double>(Value) + Operand);
+			break;
+		case EHarmoniaPatchOperation::Multiply:
+			Value = ConvertArithmeticResult<T>(static_cast<double>(Value) * Operand);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/**
+ * Original bytes of one patched value.
+ * Plain old data is copied as is, other values (strings, arrays, bitfield bools) are copied through their property.
+ */
+struct HARMONIAMODSYSTEM_API FHarmoniaPatchSnapshot
+{
+	FHarmoniaPatchSnapshot() = default;
+	FHarmoniaPatchSnapshot(FHarmoniaPatchSnapshot&& Other);
+	FHarmoniaPatchSnapshot& operator=(FHarmoniaPatchSnapshot&& Other);
+	FHarmoniaPatchSnapshot(const FHarmoniaPatchSnapshot&) = delete;
+	FHarmoniaPatchSnapshot& operator=(const FHarmoniaPatchSnapshot&) = delete;
+	~FHarmoniaPatchSnapshot() { Reset(); }
+
+	void Capture(const FProperty* InProperty, uint8* InValuePtr);
+
+	/** Write the captured value back to where it was captured from */
+	void Restore() const;
+
+	void Reset();
+
+	const FProperty* GetProperty() const { return Property; }
+	const uint8* GetData() const { return Bytes.GetData(); }
+
+private:
+	bool UsesMemcpy() const;
+
+	const FProperty* Property = nullptr;
+	uint8* ValuePtr = nullptr;
+	TArray<uint8, TAlignedHeapAllocator<16>> Bytes;
 };
 
 /**
@@ -136,6 +311,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Data Table Patcher")
 	TArray<FHarmoniaDataTablePatch> GetModPatches(FName ModId) const;
 
+	/**
+	 * Compile patches into a plan: each table is loaded and its rows / properties resolved once
+	 * @param Patches - Patches to compile
+	 * @param OutPlan - Compiled plan, can be applied (again) with ApplyPlan while its tables stay loaded
+	 * @return Number of patches compiled
+	 */
+	int32 CompilePatches(const TArray<FHarmoniaDataTablePatch>& Patches, FHarmoniaCompiledPatchPlan& OutPlan);
+
+	/**
+	 * Apply a compiled plan, snapshotting the original bytes of every value patched for the first time
+	 * @param Plan - Plan from CompilePatches
+	 * @param ModId - ID of the mod applying the plan
+	 * @return Number of patches applied
+	 */
+	int32 ApplyPlan(const FHarmoniaCompiledPatchPlan& Plan, FName ModId);
+
 protected:
 	/**
 	 * Validate a patch
@@ -146,14 +337,23 @@ protected:
 	bool ValidatePatch(const FHarmoniaDataTablePatch& Patch, FString& OutErrorMessage) const;
 
 	/**
-	 * Apply patch operation to a property
-	 * @param Property - Property to modify
-	 * @param DataPtr - Pointer to the data
-	 * @param Patch - Patch information
-	 * @param OutResult - Result of the operation
-	 * @return True if operation succeeded
+	 * Load a patch target table once, kept alive while patches are applied
+	 */
+	UDataTable* FindOrLoadDataTable(const FSoftObjectPath& TablePath);
+
+	/**
+	 * Resolve one patch against an already loaded table
+	 * @param PropertyCache - Properties already found in this table's row struct
+	 * @return True if the patch compiled
 	 */
-	bool ApplyPatchOperation(FProperty* Property, void* DataPtr, const FHarmoniaDataTablePatch& Patch, FHarmoniaPatchResult& OutResult);
+	bool CompilePatch(const FHarmoniaDataTablePatch& Patch, UDataTable* DataTable, TMap<FName, FProperty*>& PropertyCache, FHarmoniaCompiledPatch& OutCompiled, FString& OutErrorMessage) const;
+
+	/**
+	 * Apply a compiled patch directly on its typed memory
+	 * @param Compiled - Compiled patch
+	 * @param Patch - Source patch (string operands)
+	 */
+	void ExecuteCompiledPatch(const FHarmoniaCompiledPatch& Compiled, const FHarmoniaDataTablePatch& Patch) const;
 
 	/**
 	 * Get property value as string
@@ -161,7 +361,7 @@ protected:
 	 * @param DataPtr - Pointer to the data
 	 * @return String representation of the value
 	 */
-	FString GetPropertyValueAsString(FProperty* Property, const void* DataPtr) const;
+	FString GetPropertyValueAsString(const FProperty* Property, const void* DataPtr) const;
 
 	/**
 	 * Set property value from string
@@ -170,7 +370,7 @@ protected:
 	 * @param Value - String value to set
 	 * @return True if value set successfully
 	 */
-	bool SetPropertyValueFromString(FProperty* Property, void* DataPtr, const FString& Value) const;
+	bool SetPropertyValueFromString(const FProperty* Property, void* DataPtr, const FString& Value) const;
 
 	/**
 	 * Generate patch key
@@ -182,19 +382,23 @@ protected:
 	FString GeneratePatchKey(const FSoftObjectPath& TablePath, FName RowName, FName PropertyName) const;
 
 private:
-	/** Backup of original values (PatchKey -> OriginalValue) */
-	UPROPERTY()
-	TMap<FString, FString> OriginalValues;
+	/** A value currently patched */
+	struct FAppliedPatch
+	{
+		/** Last patch applied to the value */
+		FHarmoniaDataTablePatch Patch;
 
-	/** Active patches (PatchKey -> Patch) */
-	UPROPERTY()
-	TMap<FString, FHarmoniaDataTablePatch> ActivePatches;
+		/** Value before the first patch */
+		FHarmoniaPatchSnapshot Original;
+	};
 
-	/** Patches by mod (ModId -> PatchKeys) */
-	UPROPERTY()
-	TMap<FName, FHarmoniaPatchKeyArray> PatchesByMod;
+	/** Patched values (Target -> latest patch + original bytes) */
+	TMap<FHarmoniaPatchTarget, FAppliedPatch> AppliedPatches;
+
+	/** Patched values by mod (ModId -> Targets) */
+	TMap<FName, TSet<FHarmoniaPatchTarget>> PatchTargetsByMod;
 
-	/** Loaded data table cache */
+	/** Loaded data table cache, keeps patched tables (and the row memory snapshots point to) alive */
 	UPROPERTY()
 	TMap<FSoftObjectPath, TObjectPtr<UDataTable>> DataTableCache;
 };
@@ -79,6 +79,38 @@ void UNumberISMComponent::ResetInstancesTransforms(const TArray<FNumberInstance>
 void UNumberISMComponent::ClearInstances()
 {
 	Super::ClearInstances();
+	FreeInstances.Reset();
+}
+
+int32 UNumberISMComponent::AddAnimatedInstance(const FTransform& InstanceTransform, TArrayView<const float> CustomData)
+{
+	int32 InstanceIndex = INDEX_NONE;
+	if (FreeInstances.Num() > 0)
+	{
+		// Reuse a released slot, the instance count only grows to the peak number of live numbers
+		InstanceIndex = FreeInstances.Pop(EAllowShrinking::No);
+		UpdateInstanceTransform(InstanceIndex, InstanceTransform, true, false, true);
+	}
+	else
+	{
+		InstanceIndex = AddInstance(InstanceTransform, true);
+	}
+
+	SetCustomData(InstanceIndex, CustomData, true);
+	return InstanceIndex;
+}
+
+void UNumberISMComponent::ReleaseAnimatedInstance(int32 InstanceIndex)
+{
+	if (!IsValidInstance(InstanceIndex))
+	{
+		return;
+	}
+
+	// Collapse the instance instead of removing it so the indices of the live numbers stay stable
+	FTransform Hidden(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	UpdateInstanceTransform(InstanceIndex, Hidden, true, true, true);
+	FreeInstances.Add(InstanceIndex);
 }
 
 bool UNumberISMComponent::UpdateInstancesMesh(const TArray<FNumberInstance>& Instances)
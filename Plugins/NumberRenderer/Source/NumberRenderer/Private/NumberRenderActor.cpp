@@ -9,6 +9,8 @@
 #include "Curves/CurveLinearColor.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 
 
@@ -16,6 +18,18 @@ DECLARE_CYCLE_STAT(TEXT("Number Renderer - Number Render Actor tick"), STAT_Numb
 
 DECLARE_DWORD_COUNTER_STAT(TEXT("Number count"), STAT_Number_Count, STATGROUP_Number_Renderer);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Numbers spawned"), STAT_Number_Spawned, STATGROUP_Number_Renderer);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Numbers expired"), STAT_Number_Expired, STATGROUP_Number_Renderer);
+
+namespace NumberRenderActor_Private
+{
+	// Material parameters read by GPU animated number materials
+	static const FName AnimationTextureParamName(TEXT("NumberAnimationTexture"));
+	static const FName AnimationRowCountParamName(TEXT("NumberAnimationRowCount"));
+	static const FName AnimationSampleCountParamName(TEXT("NumberAnimationSampleCount"));
+}
+
 
 ANumberRenderActor::ANumberRenderActor()
 {
@@ -30,6 +44,7 @@ ANumberRenderActor::ANumberRenderActor()
 	Meshes->PreAllocateInstancesMemory(InitialMaxCount);
 	Meshes->NumCustomDataFloats = 6;
 	Instances.Reserve(InitialMaxCount);
+	ExpiryHeap.Reserve(InitialMaxCount);
 	PendingDelete.Reserve(InitialMaxCount);
 	SetRootComponent(Meshes);
 #endif
@@ -42,10 +57,29 @@ void ANumberRenderActor::BeginPlay()
 
 #if !UE_SERVER
 	if (NumberAnimationTable)
+	{
 		RowNames = NumberAnimationTable->GetRowNames();
 
+		RowNameIndices.Reserve(RowNames.Num());
+		AnimationRows.Reserve(RowNames.Num());
+		for (int32 RowIndex = 0; RowIndex < RowNames.Num(); ++RowIndex)
+		{
+			RowNameIndices.Add(RowNames[RowIndex], RowIndex);
+			AnimationRows.Add(NumberAnimationTable->FindRow<FNumberAnimationTable>(RowNames[RowIndex], FString(), false));
+		}
+	}
+
 	TempFontXYSizeRate = FontXYSizeRate * 0.333f;
 
+	if (bAnimateOnGPU && Meshes)
+	{
+		Meshes->NumCustomDataFloats = NumberRendererCustomData::Num;
+		BakeAnimationCurves();
+
+		// Nothing to do until the first number is spawned
+		SetActorTickEnabled(false);
+	}
+
 	bInitialized = true;
 #endif
 
@@ -60,6 +94,42 @@ void ANumberRenderActor::Tick(float DeltaTime)
 
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 
+	if (bAnimateOnGPU)
+	{
+		TickGPUAnimation(CurrentTime);
+	}
+	else
+	{
+		TickCPUAnimation(CurrentTime);
+	}
+#endif
+}
+
+void ANumberRenderActor::TickGPUAnimation(float CurrentTime)
+{
+#if !UE_SERVER
+	// Only expired numbers are touched, everything else is animated by the material
+	while (ExpiryHeap.Num() > 0 && ExpiryHeap.HeapTop().ExpireTime <= CurrentTime)
+	{
+		FNumberExpiry Expiry;
+		ExpiryHeap.HeapPop(Expiry, EAllowShrinking::No);
+		Meshes->ReleaseAnimatedInstance(Expiry.InstanceIndex);
+
+		INC_DWORD_STAT(STAT_Number_Expired);
+	}
+
+	SET_DWORD_STAT(STAT_Number_Count, ExpiryHeap.Num());
+
+	if (ExpiryHeap.Num() == 0)
+	{
+		SetActorTickEnabled(false);
+	}
+#endif
+}
+
+void ANumberRenderActor::TickCPUAnimation(float CurrentTime)
+{
+#if !UE_SERVER
 	PendingDelete.Empty(InitialMaxCount);
 
 	FQuat BillobrdRotate(FQuat::Identity);
@@ -96,65 +166,62 @@ void ANumberRenderActor::Tick(float DeltaTime)
 				Instance.CurrentTranform.SetLocation(Instance.StartTranform.GetLocation());
 				Instance.CurrentTranform.SetScale3D(Instance.StartTranform.GetScale3D());
 
-				if (NumberAnimationTable && Instance.bUseCurveAnim)
+				const FNumberAnimationTable* Anim = (Instance.bUseCurveAnim && AnimationRows.IsValidIndex(Instance.RowIndex)) ? AnimationRows[Instance.RowIndex] : nullptr;
+				if (Anim)
 				{
-					FNumberAnimationTable* Anim = NumberAnimationTable->FindRow<FNumberAnimationTable>(Instance.RowName, FString(), true);
-					if (Anim)
+					if (Anim->NumberAnimation.Location)
 					{
-						if (Anim->NumberAnimation.Location)
-						{
-							FVector AnimLocation = Anim->NumberAnimation.Location->GetVectorValue(LastTime);
-							Instance.CurrentTranform.SetLocation(Instance.CurrentTranform.GetLocation() + AnimLocation);
-						}
+						FVector AnimLocation = Anim->NumberAnimation.Location->GetVectorValue(LastTime);
+						Instance.CurrentTranform.SetLocation(Instance.CurrentTranform.GetLocation() + AnimLocation);
+					}
+
+					if (Anim->NumberAnimation.RotationX)
+					{
+						float AnimRotation = Anim->NumberAnimation.RotationX->GetFloatValue(LastTime);
+						FQuat NewRot = FRotator(0, 0, AnimRotation).Quaternion();
 
-						if (Anim->NumberAnimation.RotationX)
+						if (!Instance.bLockZAxis)
 						{
-							float AnimRotation = Anim->NumberAnimation.RotationX->GetFloatValue(LastTime);
-							FQuat NewRot = FRotator(0, 0, AnimRotation).Quaternion();
-
-							if (!Instance.bLockZAxis)
-							{
-								NewRot = BillobrdRotate * NewRot;
-								NewRot.Normalize();
-								Instance.CurrentTranform.SetRotation(NewRot);
-							}
-							else
-							{
-								FVector DirToCamera = PlayerController->PlayerCameraManager->GetCameraLocation() - Instance.CurrentTranform.GetLocation();
-								DirToCamera.Normalize();
-
-								NewRot = FRotationMatrix::MakeFromZX(FVector(0, 0, 1), DirToCamera).ToQuat() * NewRot;
-								NewRot.Normalize();
-								Instance.CurrentTranform.SetRotation(NewRot);
-							}
+							NewRot = BillobrdRotate * NewRot;
+							NewRot.Normalize();
+							Instance.CurrentTranform.SetRotation(NewRot);
 						}
 						else
 						{
-							if (!Instance.bLockZAxis)
-							{
-								Instance.CurrentTranform.SetRotation(BillobrdRotate); // BillBoard Transform
-							}
-							else
-							{
-								FVector DirToCamera = PlayerController->PlayerCameraManager->GetCameraLocation() - Instance.CurrentTranform.GetLocation();
-								DirToCamera.Normalize();
-								Instance.CurrentTranform.SetRotation(FRotationMatrix::MakeFromZX(FVector(0, 0, 1), DirToCamera).ToQuat());
-							}
-						}
+							FVector DirToCamera = PlayerController->PlayerCameraManager->GetCameraLocation() - Instance.CurrentTranform.GetLocation();
+							DirToCamera.Normalize();
 
-						if (Anim->NumberAnimation.Scale)
+							NewRot = FRotationMatrix::MakeFromZX(FVector(0, 0, 1), DirToCamera).ToQuat() * NewRot;
+							NewRot.Normalize();
+							Instance.CurrentTranform.SetRotation(NewRot);
+						}
+					}
+					else
+					{
+						if (!Instance.bLockZAxis)
 						{
-							FVector AnimScale = Anim->NumberAnimation.Scale->GetVectorValue(LastTime);
-							Instance.CurrentTranform.SetScale3D(Instance.CurrentTranform.GetScale3D() * AnimScale);
+							Instance.CurrentTranform.SetRotation(BillobrdRotate); // BillBoard Transform
 						}
-
-						if (Anim->NumberAnimation.Color)
+						else
 						{
-							FLinearColor Color = Anim->NumberAnimation.Color->GetLinearColorValue(LastTime);
-							Instance.Color = Color;
-							Instance.Alpha = Color.A;
+							FVector DirToCamera = PlayerController->PlayerCameraManager->GetCameraLocation() - Instance.CurrentTranform.GetLocation();
+							DirToCamera.Normalize();
+							Instance.CurrentTranform.SetRotation(FRotationMatrix::MakeFromZX(FVector(0, 0, 1), DirToCamera).ToQuat());
 						}
 					}
+
+					if (Anim->NumberAnimation.Scale)
+					{
+						FVector AnimScale = Anim->NumberAnimation.Scale->GetVectorValue(LastTime);
+						Instance.CurrentTranform.SetScale3D(Instance.CurrentTranform.GetScale3D() * AnimScale);
+					}
+
+					if (Anim->NumberAnimation.Color)
+					{
+						FLinearColor Color = Anim->NumberAnimation.Color->GetLinearColorValue(LastTime);
+						Instance.Color = Color;
+						Instance.Alpha = Color.A;
+					}
 				}
 				else
 				{
@@ -214,7 +281,7 @@ FNumberHandle ANumberRenderActor::AddNumber(int32 Number, const FTransform& Tran
 		Instance.Color = Color;
 		Instance.StartTranform = Trans;
 		Instance.StartTranform.SetScale3D(NewScale);
-		Instances.Add(Instance);
+		SubmitInstance(Instance);
 
 #if WITH_EDITOR
 		if (FMath::IsNearlyZero(Duration))
@@ -222,9 +289,9 @@ FNumberHandle ANumberRenderActor::AddNumber(int32 Number, const FTransform& Tran
 			UE_LOG(LogNumberRenderer, Error, TEXT("Duration is 0.0"));
 		}
 
-		if (Instances.Num() >= InitialMaxCount)
+		if (GetCurrentDrawCount() >= InitialMaxCount)
 		{
-			UE_LOG(LogNumberRenderer, Warning, TEXT("Max Count = %d"), Instances.Num());
+			UE_LOG(LogNumberRenderer, Warning, TEXT("Max Count = %d"), GetCurrentDrawCount());
 		}
 #endif // WITH_EDITOR
 
@@ -248,6 +315,10 @@ FNumberHandle ANumberRenderActor::AddDrawNumberByTable(int32 Number, const FTran
 		Instance.bUseCurveAnim = true;
 		Instance.bLockZAxis = LockZAxis;
 		Instance.RowName = TableRowName;
+		if (const int32* RowIndex = RowNameIndices.Find(TableRowName))
+		{
+			Instance.RowIndex = *RowIndex;
+		}
 		Instance.Number = Number;
 		Instance.NumberCount = Count;
 		Instance.Handle = FNumberHandle(FNumberHandle::EGenerateNewHandleType::GenerateNewHandle);
@@ -257,7 +328,7 @@ FNumberHandle ANumberRenderActor::AddDrawNumberByTable(int32 Number, const FTran
 		Instance.Color = FLinearColor::White;
 		Instance.StartTranform = Trans;
 		Instance.StartTranform.SetScale3D(NewScale);
-		Instances.Add(Instance);
+		SubmitInstance(Instance);
 
 #if WITH_EDITOR
 		if (FMath::IsNearlyZero(Duration))
@@ -265,9 +336,9 @@ FNumberHandle ANumberRenderActor::AddDrawNumberByTable(int32 Number, const FTran
 			UE_LOG(LogNumberRenderer, Error, TEXT("Duration is 0.0"));
 		}
 
-		if (Instances.Num() >= InitialMaxCount)
+		if (GetCurrentDrawCount() >= InitialMaxCount)
 		{
-			UE_LOG(LogNumberRenderer, Warning, TEXT("Max Count = %d"), Instances.Num());
+			UE_LOG(LogNumberRenderer, Warning, TEXT("Max Count = %d"), GetCurrentDrawCount());
 		}
 #endif // WITH_EDITOR
 
@@ -319,3 +390,116 @@ void ANumberRenderActor::Preload(const FTransform& Trans, float Duration)
 	}
 }
 
+FNumberHandle ANumberRenderActor::SubmitInstance(FNumberInstance& Instance)
+{
+#if !UE_SERVER
+	INC_DWORD_STAT(STAT_Number_Spawned);
+
+	if (!bAnimateOnGPU)
+	{
+		Instances.Add(Instance);
+		return Instance.Handle;
+	}
+
+	float CustomData[NumberRendererCustomData::Num];
+	CustomData[NumberRendererCustomData::ColorR] = Instance.Color.R;
+	CustomData[NumberRendererCustomData::ColorG] = Instance.Color.G;
+	CustomData[NumberRendererCustomData::ColorB] = Instance.Color.B;
+	CustomData[NumberRendererCustomData::ColorA] = Instance.Color.A;
+	CustomData[NumberRendererCustomData::Number] = Instance.Number;
+	CustomData[NumberRendererCustomData::NumberCount] = Instance.NumberCount;
+	CustomData[NumberRendererCustomData::StartTime] = Instance.StartTime;
+	CustomData[NumberRendererCustomData::Duration] = Instance.Duration;
+	CustomData[NumberRendererCustomData::FadeTime] = FMath::Max(Instance.FadeTime, UE_KINDA_SMALL_NUMBER);
+	CustomData[NumberRendererCustomData::AnimationRow] = (Instance.bUseCurveAnim && AnimationRows.IsValidIndex(Instance.RowIndex) && AnimationRows[Instance.RowIndex]) ? (float)Instance.RowIndex : -1.0f;
+	CustomData[NumberRendererCustomData::LockZAxis] = Instance.bLockZAxis ? 1.0f : 0.0f;
+
+	// Rotation is left to the material (billboard), the transform only carries location and digit scale
+	FTransform InstanceTransform(FQuat::Identity, Instance.StartTranform.GetLocation(), Instance.StartTranform.GetScale3D());
+
+	FNumberExpiry Expiry;
+	Expiry.ExpireTime = Instance.StartTime + Instance.Duration;
+	Expiry.InstanceIndex = Meshes->AddAnimatedInstance(InstanceTransform, MakeArrayView(CustomData));
+	ExpiryHeap.HeapPush(Expiry);
+
+	SetActorTickEnabled(true);
+#endif // !UE_SERVER
+	return Instance.Handle;
+}
+
+void ANumberRenderActor::BakeAnimationCurves()
+{
+#if !UE_SERVER
+	using namespace NumberRendererAnimationTexture;
+
+	const int32 SampleCount = FMath::Clamp(AnimationTextureSamples, 2, 256);
+	const int32 RowCount = FMath::Max(AnimationRows.Num(), 1);
+
+	AnimationCurveTexture = UTexture2D::CreateTransient(SampleCount, RowCount * TexelRows, PF_A32B32G32R32F, TEXT("NumberAnimationCurves"));
+	if (!AnimationCurveTexture)
+	{
+		return;
+	}
+
+	AnimationCurveTexture->Filter = TF_Bilinear;
+	AnimationCurveTexture->AddressX = TA_Clamp;
+	AnimationCurveTexture->AddressY = TA_Clamp;
+	AnimationCurveTexture->SRGB = false;
+	AnimationCurveTexture->NeverStream = true;
+
+	FTexture2DMipMap& Mip = AnimationCurveTexture->GetPlatformData()->Mips[0];
+	FLinearColor* Texels = static_cast<FLinearColor*>(Mip.BulkData.Lock(LOCK_READ_WRITE));
+
+	for (int32 RowIndex = 0; RowIndex < RowCount; ++RowIndex)
+	{
+		FLinearColor* TransformRow = Texels + (RowIndex * TexelRows + 0) * SampleCount;
+		FLinearColor* ScaleRow = Texels + (RowIndex * TexelRows + 1) * SampleCount;
+		FLinearColor* ColorRow = Texels + (RowIndex * TexelRows + 2) * SampleCount;
+
+		const FNumberAnimationTable* Anim = AnimationRows.IsValidIndex(RowIndex) ? AnimationRows[RowIndex] : nullptr;
+		const FNumberAnimation* Animation = Anim ? &Anim->NumberAnimation : nullptr;
+
+		// Samples span the longest curve, the material clamps to the last sample afterwards like the curves do
+		float CurveDuration = 0.0f;
+		if (Animation)
+		{
+			const UCurveBase* Curves[] = { Animation->Location, Animation->RotationX, Animation->Scale, Animation->Color };
+			for (const UCurveBase* Curve : Curves)
+			{
+				if (Curve)
+				{
+					float MinTime = 0.0f;
+					float MaxTime = 0.0f;
+					Curve->GetTimeRange(MinTime, MaxTime);
+					CurveDuration = FMath::Max(CurveDuration, MaxTime);
+				}
+			}
+		}
+		CurveDuration = FMath::Max(CurveDuration, UE_KINDA_SMALL_NUMBER);
+
+		for (int32 Sample = 0; Sample < SampleCount; ++Sample)
+		{
+			const float Time = CurveDuration * (float)Sample / (float)(SampleCount - 1);
+
+			const FVector Location = (Animation && Animation->Location) ? Animation->Location->GetVectorValue(Time) : FVector::ZeroVector;
+			const float RotationX = (Animation && Animation->RotationX) ? Animation->RotationX->GetFloatValue(Time) : 0.0f;
+			const FVector Scale = (Animation && Animation->Scale) ? Animation->Scale->GetVectorValue(Time) : FVector::OneVector;
+			const FLinearColor Color = (Animation && Animation->Color) ? Animation->Color->GetLinearColorValue(Time) : FLinearColor(1.0f, 1.0f, 1.0f, -1.0f);
+
+			TransformRow[Sample] = FLinearColor(Location.X, Location.Y, Location.Z, RotationX);
+			ScaleRow[Sample] = FLinearColor(Scale.X, Scale.Y, Scale.Z, CurveDuration);
+			ColorRow[Sample] = Color;
+		}
+	}
+
+	Mip.BulkData.Unlock();
+	AnimationCurveTexture->UpdateResource();
+
+	if (UMaterialInstanceDynamic* MaterialInstance = Meshes->CreateAndSetMaterialInstanceDynamic(0))
+	{
+		MaterialInstance->SetTextureParameterValue(NumberRenderActor_Private::AnimationTextureParamName, AnimationCurveTexture);
+		MaterialInstance->SetScalarParameterValue(NumberRenderActor_Private::AnimationRowCountParamName, (float)RowCount);
+		MaterialInstance->SetScalarParameterValue(NumberRenderActor_Private::AnimationSampleCountParamName, (float)SampleCount);
+	}
+#endif // !UE_SERVER
+}
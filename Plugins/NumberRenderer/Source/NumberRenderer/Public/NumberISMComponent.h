@@ -26,8 +26,18 @@ public:
 
 	virtual void ClearInstances() override;
 
+	// GPU animated numbers: an instance is written once when spawned and hidden/recycled when it expires
+	int32 AddAnimatedInstance(const FTransform& Transform, TArrayView<const float> CustomData);
+
+	void ReleaseAnimatedInstance(int32 InstanceIndex);
+
+	int32 GetNumAnimatedInstances() const { return GetInstanceCount() - FreeInstances.Num(); }
+
 protected:
 	bool UpdateInstancesMesh(const TArray<FNumberInstance>& Instances);
 
 	int32 MaxDrawCount = 300;
+
+	// Hidden instances ready for reuse
+	TArray<int32> FreeInstances;
 };
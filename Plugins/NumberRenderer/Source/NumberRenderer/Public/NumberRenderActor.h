@@ -8,6 +8,7 @@
 #include "NumberRenderActor.generated.h"
 
 class UNumberISMComponent;
+class UTexture2D;
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class NUMBERRENDERER_API ANumberRenderActor : public AActor
@@ -18,7 +19,7 @@ public:
 	ANumberRenderActor();
 
 	UFUNCTION(BlueprintCallable, Category = NumberRender)
-	int32 GetCurrentDrawCount() const { return Instances.Num(); }
+	int32 GetCurrentDrawCount() const { return bAnimateOnGPU ? ExpiryHeap.Num() : Instances.Num(); }
 
 protected:
 	virtual void BeginPlay() override;
@@ -35,6 +36,15 @@ public:
 	void Preload(const FTransform& Trans, float Duration);
 
 protected:
+	FNumberHandle SubmitInstance(FNumberInstance& Instance);
+
+	// Samples every row of NumberAnimationTable into AnimationCurveTexture and binds it to the material
+	void BakeAnimationCurves();
+
+	void TickGPUAnimation(float CurrentTime);
+
+	void TickCPUAnimation(float CurrentTime);
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = NumberRender, meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UNumberISMComponent> Meshes = nullptr;
 
@@ -51,7 +61,34 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = NumberRender, meta = (AllowPrivateAccess = "true"))
 	int32 InitialMaxCount = 100;
 
+	// Animate in the material from baked curves (see NumberRendererCustomData), the CPU only touches a number when it spawns and expires.
+	// Requires a material that samples NumberAnimationTexture, off by default since the shipped materials expect the transform and color to be updated every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = NumberRender, meta = (AllowPrivateAccess = "true"))
+	bool bAnimateOnGPU = false;
+
+	// Samples per curve in the baked animation texture
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = NumberRender, meta = (AllowPrivateAccess = "true", ClampMin = "2", ClampMax = "256"))
+	int32 AnimationTextureSamples = 64;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UTexture2D> AnimationCurveTexture = nullptr;
+
+	struct FNumberExpiry
+	{
+		float ExpireTime = 0.0f;
+		int32 InstanceIndex = INDEX_NONE;
+
+		bool operator<(const FNumberExpiry& Other) const { return ExpireTime < Other.ExpireTime; }
+	};
+
+	// GPU animated numbers ordered by expire time
+	TArray<FNumberExpiry> ExpiryHeap;
+
 	TArray<FName> RowNames;
+	TMap<FName, int32> RowNameIndices;
+
+	// Rows resolved once at BeginPlay, indexed by FNumberInstance::RowIndex
+	TArray<const FNumberAnimationTable*> AnimationRows;
 
 	bool bInitialized = false;
 
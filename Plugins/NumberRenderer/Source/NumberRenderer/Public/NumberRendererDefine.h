@@ -95,8 +95,47 @@ struct FNumberInstance
 	FTransform StartTranform = FTransform::Identity;
 	FTransform CurrentTranform = FTransform::Identity;
 	FName RowName;
+	int32 RowIndex = INDEX_NONE;
 };
 
+/**
+ * Per-instance custom data of GPU animated numbers (ANumberRenderActor::bAnimateOnGPU).
+ * Written once when the number is spawned, the material derives everything else from the game time.
+ * Slots 0-5 keep the layout of the CPU path so existing number materials still read color and digits.
+ */
+namespace NumberRendererCustomData
+{
+	enum Type : int32
+	{
+		ColorR = 0,
+		ColorG,
+		ColorB,
+		ColorA,
+		Number,
+		NumberCount,
+
+		StartTime,
+		Duration,
+		FadeTime,
+		AnimationRow,	// Row in the baked curve texture, -1 when not curve animated
+		LockZAxis,		// 0 = camera facing billboard, 1 = upright and only yawed towards the camera
+
+		Num
+	};
+}
+
+/**
+ * Layout of the baked animation curve texture (PF_A32B32G32R32F, bilinear, clamped).
+ * Width is the number of samples, each animation row occupies TexelRows rows:
+ *   Row 0: Location.xyz, RotationX
+ *   Row 1: Scale.xyz, curve duration in seconds (time spanned by the samples)
+ *   Row 2: Color.rgba, alpha < 0 when the row has no color curve (use instance color and fade)
+ */
+namespace NumberRendererAnimationTexture
+{
+	constexpr int32 TexelRows = 3;
+}
+
 USTRUCT(BlueprintType)
 struct FNumberAnimation
 {
@@ -37,6 +37,8 @@ ALyraCharacter::ALyraCharacter(const FObjectInitializer& ObjectInitializer)
 
 	SetNetCullDistanceSquared(900000000.0f);
 
+	SignificanceTag = LyraSignificanceTags::Character;
+
 	UCapsuleComponent* CapsuleComp = GetCapsuleComponent();
 	check(CapsuleComp);
 	CapsuleComp->InitCapsuleSize(40.0f, 90.0f);
@@ -110,15 +112,10 @@ void ALyraCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
-	UWorld* World = GetWorld();
-
-	const bool bRegisterWithSignificanceManager = !IsNetMode(NM_DedicatedServer);
-	if (bRegisterWithSignificanceManager)
+	// Registered on servers too, AI and network budgets read the result there
+	if (ULyraSignificanceManager* SignificanceManager = ULyraSignificanceManager::Get(this))
 	{
-		if (ULyraSignificanceManager* SignificanceManager = USignificanceManager::Get<ULyraSignificanceManager>(World))
-		{
-//@TODO: SignificanceManager->RegisterObject(this, (EFortSignificanceType)SignificanceType);
-		}
+		SignificanceManager->RegisterSignificantObject(this, SignificanceTag, GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
 	}
 }
 
@@ -126,15 +123,9 @@ void ALyraCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
-	UWorld* World = GetWorld();
-
-	const bool bRegisterWithSignificanceManager = !IsNetMode(NM_DedicatedServer);
-	if (bRegisterWithSignificanceManager)
+	if (ULyraSignificanceManager* SignificanceManager = ULyraSignificanceManager::Get(this))
 	{
-		if (ULyraSignificanceManager* SignificanceManager = USignificanceManager::Get<ULyraSignificanceManager>(World))
-		{
-			SignificanceManager->UnregisterObject(this);
-		}
+		SignificanceManager->UnregisterSignificantObject(this);
 	}
 }
 
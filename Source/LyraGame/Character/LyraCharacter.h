@@ -220,6 +220,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Lyra|Character", Meta = (AllowPrivateAccess = "true"))
 	bool UseSpringArm = false;
 
+	/** Tag this character is scored with by ULyraSignificanceManager */
+	UPROPERTY(EditDefaultsOnly, Category = "Lyra|Character")
+	FName SignificanceTag;
+
 protected:
 	// Called to determine what happens to the team ID when possession ends
 	virtual FGenericTeamId DetermineNewTeamAfterPossessionEnds(FGenericTeamId OldTeamID) const
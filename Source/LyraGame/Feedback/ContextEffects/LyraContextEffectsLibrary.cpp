@@ -8,26 +8,146 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraContextEffectsLibrary)
 
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Effect Lookups"), STAT_LyraContextEffectLookups, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Effect Lookup Cache Misses"), STAT_LyraContextEffectLookupMisses, STATGROUP_Game);
+
+namespace LyraConsoleVariables
+{
+	static int32 ContextEffectsLookupCacheSize = 16;
+	static FAutoConsoleVariableRef CVarContextEffectsLookupCacheSize(
+		TEXT("Lyra.ContextEffects.LookupCacheSize"),
+		ContextEffectsLookupCacheSize,
+		TEXT("Number of (effect, context) lookups memoized per context effects library"),
+		ECVF_Default);
+}
+
 void ULyraContextEffectsLibrary::GetEffects(const FGameplayTag Effect, const FGameplayTagContainer Context, 
 	TArray<USoundBase*>& Sounds, TArray<UNiagaraSystem*>& NiagaraSystems)
 {
+	TArrayView<USoundBase* const> FoundSounds;
+	TArrayView<UNiagaraSystem* const> FoundNiagaraSystems;
+	if (FindEffects(Effect, Context, FoundSounds, FoundNiagaraSystems))
+	{
+		Sounds.Append(FoundSounds.GetData(), FoundSounds.Num());
+		NiagaraSystems.Append(FoundNiagaraSystems.GetData(), FoundNiagaraSystems.Num());
+	}
+}
+
+bool ULyraContextEffectsLibrary::FindEffects(const FGameplayTag Effect, const FGameplayTagContainer& Context,
+	TArrayView<USoundBase* const>& OutSounds, TArrayView<UNiagaraSystem* const>& OutNiagaraSystems)
+{
+	OutSounds = TArrayView<USoundBase* const>();
+	OutNiagaraSystems = TArrayView<UNiagaraSystem* const>();
+
 	// Make sure Effect is valid and Library is loaded
-	if (Effect.IsValid() && Context.IsValid() && EffectsLoadState == EContextEffectsLibraryLoadState::Loaded)
+	if (!Effect.IsValid() || !Context.IsValid() || EffectsLoadState != EContextEffectsLibraryLoadState::Loaded)
 	{
-		// Loop through Context Effects
-		for (const auto& ActiveContextEffect : ActiveContextEffects)
+		return false;
+	}
+
+	const FLookupCacheEntry* Entry = FindOrAddLookup(Effect, Context);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	OutSounds = Entry->Sounds;
+	OutNiagaraSystems = Entry->NiagaraSystems;
+	return OutSounds.Num() > 0 || OutNiagaraSystems.Num() > 0;
+}
+
+const ULyraContextEffectsLibrary::FLookupCacheEntry* ULyraContextEffectsLibrary::FindOrAddLookup(const FGameplayTag Effect, const FGameplayTagContainer& Context)
+{
+	INC_DWORD_STAT(STAT_LyraContextEffectLookups);
+
+	const uint32 ContextHash = HashContext(Context);
+	++LookupCounter;
+
+	// Most callers repeat the same few (effect, surface) pairs, so a linear scan over a handful of entries is enough
+	FLookupCacheEntry* LeastRecentlyUsed = nullptr;
+	for (FLookupCacheEntry& Entry : LookupCache)
+	{
+		if (Entry.ContextHash == ContextHash && Entry.Effect == Effect && Entry.Context == Context)
 		{
-			// Make sure the Effect is an exact Tag Match and ensure the Context has all tags in the Effect (and neither or both are empty)
-			if (Effect.MatchesTagExact(ActiveContextEffect->EffectTag)
-				&& Context.HasAllExact(ActiveContextEffect->Context)
-				&& (ActiveContextEffect->Context.IsEmpty() == Context.IsEmpty()))
-			{
-				// Get all Matching Sounds and Niagara Systems
-				Sounds.Append(ActiveContextEffect->Sounds);
-				NiagaraSystems.Append(ActiveContextEffect->NiagaraSystems);
-			}
+			Entry.LastUsed = LookupCounter;
+			return &Entry;
+		}
+
+		if (LeastRecentlyUsed == nullptr || Entry.LastUsed < LeastRecentlyUsed->LastUsed)
+		{
+			LeastRecentlyUsed = &Entry;
 		}
 	}
+
+	const TArray<int32>* Candidates = EffectIndex.Find(Effect);
+	if (Candidates == nullptr)
+	{
+		// Effect tag not in this library, nothing worth caching
+		return nullptr;
+	}
+
+	INC_DWORD_STAT(STAT_LyraContextEffectLookupMisses);
+
+	const int32 CacheSize = FMath::Max(LyraConsoleVariables::ContextEffectsLookupCacheSize, 1);
+	FLookupCacheEntry* Entry = (LookupCache.Num() < CacheSize || LeastRecentlyUsed == nullptr) ? &LookupCache.AddDefaulted_GetRef() : LeastRecentlyUsed;
+	Entry->Effect = Effect;
+	Entry->Context = Context;
+	Entry->ContextHash = ContextHash;
+	Entry->LastUsed = LookupCounter;
+	Entry->Sounds.Reset();
+	Entry->NiagaraSystems.Reset();
+
+	for (const int32 CandidateIndex : *Candidates)
+	{
+		const ULyraActiveContextEffects* ActiveContextEffect = ActiveContextEffects[CandidateIndex];
+
+		// Ensure the Context has all tags in the Effect (and neither or both are empty)
+		if (Context.HasAllExact(ActiveContextEffect->Context)
+			&& (ActiveContextEffect->Context.IsEmpty() == Context.IsEmpty()))
+		{
+			// Get all Matching Sounds and Niagara Systems
+			Entry->Sounds.Append(ActiveContextEffect->Sounds);
+			Entry->NiagaraSystems.Append(ActiveContextEffect->NiagaraSystems);
+		}
+	}
+
+	return Entry;
+}
+
+uint32 ULyraContextEffectsLibrary::HashContext(const FGameplayTagContainer& Context)
+{
+	// Sum of mixed tag hashes, so containers with the same tags in a different order hash the same
+	uint32 Hash = Context.Num();
+	for (const FGameplayTag& Tag : Context)
+	{
+		Hash += MurmurFinalize32(GetTypeHash(Tag));
+	}
+	return Hash;
+}
+
+void ULyraContextEffectsLibrary::BuildEffectIndex()
+{
+	EffectIndex.Reset();
+	LookupCache.Reset();
+
+	for (int32 Index = 0; Index < ActiveContextEffects.Num(); ++Index)
+	{
+		if (const ULyraActiveContextEffects* ActiveContextEffect = ActiveContextEffects[Index])
+		{
+			EffectIndex.FindOrAdd(ActiveContextEffect->EffectTag).Add(Index);
+		}
+	}
+
+	// Most specific context first, ties keep the authored order
+	for (TPair<FGameplayTag, TArray<int32>>& Pair : EffectIndex)
+	{
+		Pair.Value.StableSort([this](const int32 A, const int32 B)
+		{
+			return ActiveContextEffects[A]->Context.Num() > ActiveContextEffects[B]->Context.Num();
+		});
+	}
+
+	LookupCache.Reserve(FMath::Max(LyraConsoleVariables::ContextEffectsLookupCacheSize, 1));
 }
 
 void ULyraContextEffectsLibrary::LoadEffects()
@@ -40,6 +160,7 @@ void ULyraContextEffectsLibrary::LoadEffects()
 
 		// Clear out any old Active Effects
 		ActiveContextEffects.Empty();
+		BuildEffectIndex();
 
 		// Call internal loading function
 		LoadEffectsInternal();
@@ -115,5 +236,8 @@ void ULyraContextEffectsLibrary::LyraContextEffectLibraryLoadingComplete(
 
 	// Append incoming Context Effects Array to current list of Active Context Effects
 	ActiveContextEffects.Append(LyraActiveContextEffects);
+
+	// Precompile the lookup table once instead of scanning every entry per notify
+	BuildEffectIndex();
 }
 
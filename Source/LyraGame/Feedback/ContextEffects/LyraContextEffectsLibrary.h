@@ -83,6 +83,13 @@ public:
 	UFUNCTION(BlueprintCallable)
 	UE_API void GetEffects(const FGameplayTag Effect, const FGameplayTagContainer Context, TArray<USoundBase*>& Sounds, TArray<UNiagaraSystem*>& NiagaraSystems);
 
+	/**
+	 * Non-allocating version of GetEffects, results are ordered from the most specific context to the least.
+	 * The views point into the library's lookup cache and are only valid until the next lookup on this library.
+	 * Returns false if the library is not loaded or nothing matched.
+	 */
+	UE_API bool FindEffects(const FGameplayTag Effect, const FGameplayTagContainer& Context, TArrayView<USoundBase* const>& OutSounds, TArrayView<UNiagaraSystem* const>& OutNiagaraSystems);
+
 	UFUNCTION(BlueprintCallable)
 	UE_API void LoadEffects();
 
@@ -93,11 +100,39 @@ private:
 
 	void LyraContextEffectLibraryLoadingComplete(TArray<ULyraActiveContextEffects*> LyraActiveContextEffects);
 
+	// Rebuilds EffectIndex from ActiveContextEffects and drops all memoized lookups
+	void BuildEffectIndex();
+
+	// Memoized result of one (effect, context) lookup
+	struct FLookupCacheEntry
+	{
+		FGameplayTag Effect;
+		FGameplayTagContainer Context;
+		uint32 ContextHash = 0;
+		uint64 LastUsed = 0;
+
+		// Objects are kept alive by ActiveContextEffects, the cache is cleared whenever that changes
+		TArray<USoundBase*> Sounds;
+		TArray<UNiagaraSystem*> NiagaraSystems;
+	};
+
+	const FLookupCacheEntry* FindOrAddLookup(const FGameplayTag Effect, const FGameplayTagContainer& Context);
+
+	// Order independent hash of the tags in a context container
+	static uint32 HashContext(const FGameplayTagContainer& Context);
+
 	UPROPERTY(Transient)
 	TArray< TObjectPtr<ULyraActiveContextEffects>> ActiveContextEffects;
 
 	UPROPERTY(Transient)
 	EContextEffectsLibraryLoadState EffectsLoadState = EContextEffectsLibraryLoadState::Unloaded;
+
+	// Effect tag -> indices into ActiveContextEffects, sorted by context specificity (most tags first)
+	TMap<FGameplayTag, TArray<int32>> EffectIndex;
+
+	// Small LRU of recent lookups, evicts the least recently used entry when full
+	TArray<FLookupCacheEntry> LookupCache;
+	uint64 LookupCounter = 0;
 };
 
 #undef UE_API
@@ -37,26 +37,39 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 		// Validate the pointers from the Map Find
 		if (ULyraContextEffectsSet* EffectsLibraries = *EffectsLibrariesSetPtr)
 		{
-			// Prepare Arrays for Sounds and Niagara Systems
-			TArray<USoundBase*> TotalSounds;
-			TArray<UNiagaraSystem*> TotalNiagaraSystems;
-
 			// Cycle through Effect Libraries
 			for (ULyraContextEffectsLibrary* EffectLibrary : EffectsLibraries->LyraContextEffectsLibraries)
 			{
 				// Check if the Effect Library is valid and data Loaded
 				if (EffectLibrary && EffectLibrary->GetContextEffectsLibraryLoadState() == EContextEffectsLibraryLoadState::Loaded)
 				{
-					// Set up local list of Sounds and Niagara Systems
-					TArray<USoundBase*> Sounds;
-					TArray<UNiagaraSystem*> NiagaraSystems;
-
-					// Get Sounds and Niagara Systems
-					EffectLibrary->GetEffects(Effect, Contexts, Sounds, NiagaraSystems);
-
-					// Append to accumulating array
-					TotalSounds.Append(Sounds);
-					TotalNiagaraSystems.Append(NiagaraSystems);
+					// Get Sounds and Niagara Systems, the views are only valid until the next lookup on this library
+					TArrayView<USoundBase* const> Sounds;
+					TArrayView<UNiagaraSystem* const> NiagaraSystems;
+					if (!EffectLibrary->FindEffects(Effect, Contexts, Sounds, NiagaraSystems))
+					{
+						continue;
+					}
+
+					// Cycle through found Sounds
+					for (USoundBase* Sound : Sounds)
+					{
+						// Spawn Sounds Attached, add Audio Component to List of ACs
+						UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAttached(Sound, AttachToComponent, AttachPoint, LocationOffset, RotationOffset, EAttachLocation::KeepRelativeOffset,
+							false, AudioVolume, AudioPitch, 0.0f, nullptr, nullptr, true);
+
+						AudioOut.Add(AudioComponent);
+					}
+
+					// Cycle through found Niagara Systems
+					for (UNiagaraSystem* NiagaraSystem : NiagaraSystems)
+					{
+						// Spawn Niagara Systems Attached, add Niagara Component to List of NCs
+						UNiagaraComponent* NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(NiagaraSystem, AttachToComponent, AttachPoint, LocationOffset,
+							RotationOffset, VFXScale, EAttachLocation::KeepRelativeOffset, true, ENCPoolMethod::None, true, true);
+
+						NiagaraOut.Add(NiagaraComponent);
+					}
 				}
 				else if (EffectLibrary && EffectLibrary->GetContextEffectsLibraryLoadState() == EContextEffectsLibraryLoadState::Unloaded)
 				{
@@ -64,26 +77,6 @@ void ULyraContextEffectsSubsystem::SpawnContextEffects(
 					EffectLibrary->LoadEffects();
 				}
 			}
-
-			// Cycle through found Sounds
-			for (USoundBase* Sound : TotalSounds)
-			{
-				// Spawn Sounds Attached, add Audio Component to List of ACs
-				UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAttached(Sound, AttachToComponent, AttachPoint, LocationOffset, RotationOffset, EAttachLocation::KeepRelativeOffset,
-					false, AudioVolume, AudioPitch, 0.0f, nullptr, nullptr, true);
-
-				AudioOut.Add(AudioComponent);
-			}
-
-			// Cycle through found Niagara Systems
-			for (UNiagaraSystem* NiagaraSystem : TotalNiagaraSystems)
-			{
-				// Spawn Niagara Systems Attached, add Niagara Component to List of NCs
-				UNiagaraComponent* NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(NiagaraSystem, AttachToComponent, AttachPoint, LocationOffset,
-					RotationOffset, VFXScale, EAttachLocation::KeepRelativeOffset, true, ENCPoolMethod::None, true, true);
-
-				NiagaraOut.Add(NiagaraComponent);
-			}
 		}
 	}
 }
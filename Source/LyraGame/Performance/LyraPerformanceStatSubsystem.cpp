@@ -8,9 +8,18 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerState.h"
 #include "GameModes/LyraGameState.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraLogChannels.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
 #include "Performance/LyraPerformanceStatTypes.h"
 #include "Performance/LatencyMarkerModule.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "Serialization/JsonWriter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraPerformanceStatSubsystem)
 
@@ -18,6 +27,308 @@ CSV_DEFINE_CATEGORY(LyraPerformance, /*bIsEnabledByDefault=*/false);
 
 class FSubsystemCollectionBase;
 
+namespace LyraPerformanceStats
+{
+	static float HitchThresholdMs = 60.0f;
+	static FAutoConsoleVariableRef CVarHitchThresholdMs(
+		TEXT("Lyra.Perf.HitchThresholdMs"),
+		HitchThresholdMs,
+		TEXT("Frames (or game thread times) longer than this are counted as hitches by performance captures"),
+		ECVF_Default);
+
+	static float CaptureWindowSeconds = 10.0f;
+	static FAutoConsoleVariableRef CVarCaptureWindowSeconds(
+		TEXT("Lyra.Perf.CaptureWindowSeconds"),
+		CaptureWindowSeconds,
+		TEXT("Default length of the time windows summarized by performance captures"),
+		ECVF_Default);
+
+	static const double ReportedPercentiles[] = { 0.5, 0.95, 0.99 };
+
+	static FString GetStatName(ELyraDisplayablePerformanceStat Stat)
+	{
+		return StaticEnum<ELyraDisplayablePerformanceStat>()->GetNameStringByValue((int64)Stat);
+	}
+
+	static void AtomicAdd(std::atomic<double>& Target, double Value)
+	{
+		double Current = Target.load(std::memory_order_relaxed);
+		while (!Target.compare_exchange_weak(Current, Current + Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static void AtomicMin(std::atomic<double>& Target, double Value)
+	{
+		double Current = Target.load(std::memory_order_relaxed);
+		while (Value < Current && !Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static void AtomicMax(std::atomic<double>& Target, double Value)
+	{
+		double Current = Target.load(std::memory_order_relaxed);
+		while (Value > Current && !Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraStatHistogram
+
+void FLyraStatHistogram::RecordValue(double Value)
+{
+	Buckets[GetBucketIndex(Value)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+
+	LyraPerformanceStats::AtomicAdd(Sum, Value);
+	LyraPerformanceStats::AtomicMin(MinRecorded, Value);
+	LyraPerformanceStats::AtomicMax(MaxRecorded, Value);
+}
+
+void FLyraStatHistogram::Reset()
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	Sum.store(0.0, std::memory_order_relaxed);
+	MinRecorded.store(TNumericLimits<double>::Max(), std::memory_order_relaxed);
+	MaxRecorded.store(TNumericLimits<double>::Lowest(), std::memory_order_relaxed);
+}
+
+double FLyraStatHistogram::GetMean() const
+{
+	const uint64 NumSamples = GetCount();
+	return NumSamples > 0 ? Sum.load(std::memory_order_relaxed) / (double)NumSamples : 0.0;
+}
+
+double FLyraStatHistogram::GetPercentile(double Percentile) const
+{
+	const uint64 NumSamples = GetCount();
+	if (NumSamples == 0)
+	{
+		return 0.0;
+	}
+
+	// Rank of the sample we are looking for, 1 based
+	const uint64 Rank = FMath::Clamp<uint64>((uint64)FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 1.0) * (double)NumSamples), 1, NumSamples);
+
+	uint64 Cumulative = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		Cumulative += Buckets[BucketIndex].load(std::memory_order_relaxed);
+		if (Cumulative >= Rank)
+		{
+			// The bucket's value can lie a bit outside what was actually recorded at either end
+			return FMath::Clamp(GetBucketValue(BucketIndex), GetMin(), GetMax());
+		}
+	}
+
+	return GetMax();
+}
+
+int32 FLyraStatHistogram::GetBucketIndex(double Value)
+{
+	if (!(Value > MinValue))
+	{
+		return 0;
+	}
+
+	const double Octaves = FMath::Log2(Value / MinValue);
+	return FMath::Clamp(1 + (int32)(Octaves * BucketsPerOctave), 1, NumBuckets - 1);
+}
+
+double FLyraStatHistogram::GetBucketValue(int32 BucketIndex)
+{
+	if (BucketIndex == 0)
+	{
+		return 0.0;
+	}
+
+	// Geometric middle of the bucket
+	return MinValue * FMath::Pow(2.0, ((double)BucketIndex - 0.5) / BucketsPerOctave);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraPerformanceCapture
+
+FLyraPerformanceCapture::FLyraPerformanceCapture(const FString& InName, double InWindowSeconds, double InHitchThresholdSeconds)
+	: Name(InName)
+	, StartDateTime(FDateTime::UtcNow())
+	, StartTime(FPlatformTime::Seconds())
+	, WindowSeconds(FMath::Max(InWindowSeconds, 0.1))
+	, HitchThresholdSeconds(InHitchThresholdSeconds)
+{
+	WindowStartTime = StartTime;
+}
+
+void FLyraPerformanceCapture::BeginFrame(double Now, const FFrameData& FrameData)
+{
+	if (Now - WindowStartTime >= WindowSeconds)
+	{
+		CloseWindow(Now);
+	}
+
+	++NumFrames;
+	++WindowFrames;
+
+	if (FrameData.TrueDeltaSeconds > HitchThresholdSeconds)
+	{
+		++NumHitches;
+		++WindowHitches;
+	}
+
+	if (FrameData.GameThreadTimeSeconds > HitchThresholdSeconds)
+	{
+		++NumGameThreadHitches;
+	}
+}
+
+void FLyraPerformanceCapture::RecordStat(ELyraDisplayablePerformanceStat Stat, double Value)
+{
+	Histograms[(int32)Stat].RecordValue(Value);
+
+	if (Stat == ELyraDisplayablePerformanceStat::FrameTime)
+	{
+		WindowFrameTime.RecordValue(Value);
+	}
+	else if (Stat == ELyraDisplayablePerformanceStat::FrameTime_GameThread)
+	{
+		WindowGameThreadTime.RecordValue(Value);
+	}
+}
+
+void FLyraPerformanceCapture::CloseWindow(double Now)
+{
+	if (WindowFrames > 0)
+	{
+		FWindowSummary& Window = Windows.AddDefaulted_GetRef();
+		Window.StartSeconds = WindowStartTime - StartTime;
+		Window.DurationSeconds = Now - WindowStartTime;
+		Window.NumFrames = WindowFrames;
+		Window.NumHitches = WindowHitches;
+
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(LyraPerformanceStats::ReportedPercentiles); ++Index)
+		{
+			Window.FrameTimeMs[Index] = WindowFrameTime.GetPercentile(LyraPerformanceStats::ReportedPercentiles[Index]) * 1000.0;
+			Window.GameThreadMs[Index] = WindowGameThreadTime.GetPercentile(LyraPerformanceStats::ReportedPercentiles[Index]) * 1000.0;
+		}
+	}
+
+	WindowStartTime = Now;
+	WindowFrames = 0;
+	WindowHitches = 0;
+	WindowFrameTime.Reset();
+	WindowGameThreadTime.Reset();
+}
+
+bool FLyraPerformanceCapture::Finish(double Now, const FString& OutputDir)
+{
+	CloseWindow(Now);
+
+	const FString BasePath = OutputDir / FPaths::MakeValidFileName(Name);
+	const bool bWroteCsv = FFileHelper::SaveStringToFile(ToCsv(), *(BasePath + TEXT(".csv")));
+	const bool bWroteJson = FFileHelper::SaveStringToFile(ToJson(), *(BasePath + TEXT(".json")));
+
+	UE_CLOG(bWroteCsv && bWroteJson, LogLyra, Display, TEXT("Performance capture '%s': %d frames, %d hitches, written to %s.csv/.json"), *Name, NumFrames, NumHitches, *BasePath);
+	UE_CLOG(!bWroteCsv || !bWroteJson, LogLyra, Error, TEXT("Performance capture '%s' could not be written to %s"), *Name, *BasePath);
+
+	return bWroteCsv && bWroteJson;
+}
+
+const FLyraStatHistogram& FLyraPerformanceCapture::GetHistogram(ELyraDisplayablePerformanceStat Stat) const
+{
+	return Histograms[(int32)Stat];
+}
+
+FString FLyraPerformanceCapture::ToCsv() const
+{
+	FString Csv = TEXT("Stat,Count,Min,Mean,P50,P95,P99,Max\n");
+
+	for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		const FLyraStatHistogram& Histogram = GetHistogram(Stat);
+		Csv += FString::Printf(TEXT("%s,%llu,%g,%g,%g,%g,%g,%g\n"),
+			*LyraPerformanceStats::GetStatName(Stat),
+			Histogram.GetCount(),
+			Histogram.GetMin(),
+			Histogram.GetMean(),
+			Histogram.GetPercentile(0.5),
+			Histogram.GetPercentile(0.95),
+			Histogram.GetPercentile(0.99),
+			Histogram.GetMax());
+	}
+
+	return Csv;
+}
+
+FString FLyraPerformanceCapture::ToJson() const
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("name"), Name);
+	Writer->WriteValue(TEXT("startUtc"), StartDateTime.ToIso8601());
+	Writer->WriteValue(TEXT("build"), FApp::GetBuildVersion());
+	Writer->WriteValue(TEXT("buildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+	Writer->WriteValue(TEXT("changelist"), (int64)FEngineVersion::Current().GetChangelist());
+	Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+	Writer->WriteValue(TEXT("durationSeconds"), Windows.Num() > 0 ? Windows.Last().StartSeconds + Windows.Last().DurationSeconds : 0.0);
+	Writer->WriteValue(TEXT("frames"), NumFrames);
+	Writer->WriteValue(TEXT("hitchThresholdMs"), HitchThresholdSeconds * 1000.0);
+	Writer->WriteValue(TEXT("hitches"), NumHitches);
+	Writer->WriteValue(TEXT("gameThreadHitches"), NumGameThreadHitches);
+
+	Writer->WriteObjectStart(TEXT("stats"));
+	for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		const FLyraStatHistogram& Histogram = GetHistogram(Stat);
+		if (Histogram.GetCount() == 0)
+		{
+			continue;
+		}
+
+		Writer->WriteObjectStart(LyraPerformanceStats::GetStatName(Stat));
+		Writer->WriteValue(TEXT("count"), (int64)Histogram.GetCount());
+		Writer->WriteValue(TEXT("min"), Histogram.GetMin());
+		Writer->WriteValue(TEXT("mean"), Histogram.GetMean());
+		Writer->WriteValue(TEXT("p50"), Histogram.GetPercentile(0.5));
+		Writer->WriteValue(TEXT("p95"), Histogram.GetPercentile(0.95));
+		Writer->WriteValue(TEXT("p99"), Histogram.GetPercentile(0.99));
+		Writer->WriteValue(TEXT("max"), Histogram.GetMax());
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteObjectEnd();
+
+	Writer->WriteArrayStart(TEXT("windows"));
+	for (const FWindowSummary& Window : Windows)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("startSeconds"), Window.StartSeconds);
+		Writer->WriteValue(TEXT("durationSeconds"), Window.DurationSeconds);
+		Writer->WriteValue(TEXT("frames"), Window.NumFrames);
+		Writer->WriteValue(TEXT("hitches"), Window.NumHitches);
+		Writer->WriteValue(TEXT("frameTimeP50Ms"), Window.FrameTimeMs[0]);
+		Writer->WriteValue(TEXT("frameTimeP95Ms"), Window.FrameTimeMs[1]);
+		Writer->WriteValue(TEXT("frameTimeP99Ms"), Window.FrameTimeMs[2]);
+		Writer->WriteValue(TEXT("gameThreadP50Ms"), Window.GameThreadMs[0]);
+		Writer->WriteValue(TEXT("gameThreadP95Ms"), Window.GameThreadMs[1]);
+		Writer->WriteValue(TEXT("gameThreadP99Ms"), Window.GameThreadMs[2]);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Json;
+}
+
 //////////////////////////////////////////////////////////////////////
 // FLyraPerformanceStatCache
 
@@ -27,6 +338,15 @@ void FLyraPerformanceStatCache::StartCharting()
 
 void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
 {
+	if (Captures.Num() > 0)
+	{
+		const double Now = FPlatformTime::Seconds();
+		for (TPair<FString, TUniquePtr<FLyraPerformanceCapture>>& Pair : Captures)
+		{
+			Pair.Value->BeginFrame(Now, FrameData);
+		}
+	}
+
 	// Record stats about the frame data
 	{
 		RecordStat(
@@ -131,6 +451,12 @@ void FLyraPerformanceStatCache::StopCharting()
 void FLyraPerformanceStatCache::RecordStat(const ELyraDisplayablePerformanceStat Stat, const double Value)
 {
 	PerfStateCache.FindOrAdd(Stat).RecordSample(Value);
+	Histograms[(int32)Stat].RecordValue(Value);
+
+	for (TPair<FString, TUniquePtr<FLyraPerformanceCapture>>& Pair : Captures)
+	{
+		Pair.Value->RecordStat(Stat, Value);
+	}
 }
 
 double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat Stat) const
@@ -152,6 +478,46 @@ const FSampledStatCache* FLyraPerformanceStatCache::GetCachedStatData(const ELyr
 	return PerfStateCache.Find(Stat);
 }
 
+const FLyraStatHistogram& FLyraPerformanceStatCache::GetStatHistogram(const ELyraDisplayablePerformanceStat Stat) const
+{
+	check(Stat < ELyraDisplayablePerformanceStat::Count);
+	return Histograms[(int32)Stat];
+}
+
+bool FLyraPerformanceStatCache::StartCapture(const FString& Name, double WindowSeconds, double HitchThresholdSeconds)
+{
+	if (Name.IsEmpty() || Captures.Contains(Name))
+	{
+		return false;
+	}
+
+	Captures.Add(Name, MakeUnique<FLyraPerformanceCapture>(Name, WindowSeconds, HitchThresholdSeconds));
+	UE_LOG(LogLyra, Display, TEXT("Started performance capture '%s'"), *Name);
+	return true;
+}
+
+bool FLyraPerformanceStatCache::StopCapture(const FString& Name, const FString& OutputDir)
+{
+	TUniquePtr<FLyraPerformanceCapture> Capture;
+	if (!Captures.RemoveAndCopyValue(Name, Capture))
+	{
+		return false;
+	}
+
+	return Capture->Finish(FPlatformTime::Seconds(), OutputDir);
+}
+
+void FLyraPerformanceStatCache::StopAllCaptures(const FString& OutputDir)
+{
+	TArray<FString> Names;
+	Captures.GetKeys(Names);
+
+	for (const FString& Name : Names)
+	{
+		StopCapture(Name, OutputDir);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 // ULyraPerformanceStatSubsystem
 
@@ -159,10 +525,22 @@ void ULyraPerformanceStatSubsystem::Initialize(FSubsystemCollectionBase& Collect
 {
 	Tracker = MakeShared<FLyraPerformanceStatCache>(this);
 	GEngine->AddPerformanceDataConsumer(Tracker);
+
+	// Headless benchmark runs can capture the whole session with -LyraPerfCapture=<Name>
+	FString CaptureName;
+	if (FParse::Value(FCommandLine::Get(), TEXT("LyraPerfCapture="), CaptureName))
+	{
+		StartCapture(CaptureName);
+	}
 }
 
 void ULyraPerformanceStatSubsystem::Deinitialize()
 {
+	if (Tracker.IsValid())
+	{
+		Tracker->StopAllCaptures(GetCaptureOutputDir());
+	}
+
 	if (GEngine)
 	{
 		GEngine->RemovePerformanceDataConsumer(Tracker);
@@ -180,3 +558,101 @@ const FSampledStatCache* ULyraPerformanceStatSubsystem::GetCachedStatData(const
 	return Tracker->GetCachedStatData(Stat);
 }
 
+double ULyraPerformanceStatSubsystem::GetStatPercentile(ELyraDisplayablePerformanceStat Stat, double Percentile) const
+{
+	const FLyraStatHistogram* Histogram = GetStatHistogram(Stat);
+	return Histogram ? Histogram->GetPercentile(Percentile) : 0.0;
+}
+
+const FLyraStatHistogram* ULyraPerformanceStatSubsystem::GetStatHistogram(const ELyraDisplayablePerformanceStat Stat) const
+{
+	return (Stat < ELyraDisplayablePerformanceStat::Count) ? &Tracker->GetStatHistogram(Stat) : nullptr;
+}
+
+bool ULyraPerformanceStatSubsystem::StartCapture(const FString& Name, double WindowSeconds)
+{
+	const double Window = (WindowSeconds > 0.0) ? WindowSeconds : LyraPerformanceStats::CaptureWindowSeconds;
+	return Tracker->StartCapture(Name, Window, LyraPerformanceStats::HitchThresholdMs / 1000.0);
+}
+
+bool ULyraPerformanceStatSubsystem::StopCapture(const FString& Name)
+{
+	return Tracker->StopCapture(Name, GetCaptureOutputDir());
+}
+
+bool ULyraPerformanceStatSubsystem::IsCapturing(const FString& Name) const
+{
+	return Tracker->IsCapturing(Name);
+}
+
+FString ULyraPerformanceStatSubsystem::GetCaptureOutputDir()
+{
+	return FPaths::ProfilingDir() / TEXT("LyraPerformance");
+}
+
+//////////////////////////////////////////////////////////////////////
+// Console commands
+
+namespace LyraPerformanceStats
+{
+	static ULyraPerformanceStatSubsystem* GetSubsystem(UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<ULyraPerformanceStatSubsystem>() : nullptr;
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs StartCaptureCommand(
+		TEXT("Lyra.Perf.StartCapture"),
+		TEXT("Lyra.Perf.StartCapture <Name> [WindowSeconds]: starts a named capture of the performance stats (percentiles, hitches, time windows)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+		{
+			ULyraPerformanceStatSubsystem* Subsystem = GetSubsystem(World);
+			if (!Subsystem || Args.Num() < 1)
+			{
+				UE_LOG(LogLyra, Warning, TEXT("Usage: Lyra.Perf.StartCapture <Name> [WindowSeconds]"));
+				return;
+			}
+
+			const double WindowSeconds = Args.IsValidIndex(1) ? FCString::Atod(*Args[1]) : 0.0;
+			UE_CLOG(!Subsystem->StartCapture(Args[0], WindowSeconds), LogLyra, Warning, TEXT("Performance capture '%s' is already running"), *Args[0]);
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCaptureCommand(
+		TEXT("Lyra.Perf.StopCapture"),
+		TEXT("Lyra.Perf.StopCapture <Name>: stops a performance capture and writes its CSV/JSON summary to Saved/Profiling/LyraPerformance"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+		{
+			ULyraPerformanceStatSubsystem* Subsystem = GetSubsystem(World);
+			if (!Subsystem || Args.Num() < 1)
+			{
+				UE_LOG(LogLyra, Warning, TEXT("Usage: Lyra.Perf.StopCapture <Name>"));
+				return;
+			}
+
+			UE_CLOG(!Subsystem->IsCapturing(Args[0]), LogLyra, Warning, TEXT("No performance capture named '%s'"), *Args[0]);
+			Subsystem->StopCapture(Args[0]);
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs PrintPercentilesCommand(
+		TEXT("Lyra.Perf.PrintPercentiles"),
+		TEXT("Prints p50/p95/p99 of every performance stat since startup"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+		{
+			const ULyraPerformanceStatSubsystem* Subsystem = GetSubsystem(World);
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+			{
+				const FLyraStatHistogram* Histogram = Subsystem->GetStatHistogram(Stat);
+				if (Histogram && Histogram->GetCount() > 0)
+				{
+					UE_LOG(LogLyra, Display, TEXT("%-24s n=%-8llu p50 %-10g p95 %-10g p99 %-10g max %g"),
+						*GetStatName(Stat), Histogram->GetCount(), Histogram->GetPercentile(0.5), Histogram->GetPercentile(0.95), Histogram->GetPercentile(0.99), Histogram->GetMax());
+				}
+			}
+		}));
+}
+
@@ -9,6 +9,8 @@
 #include "Stats/StatsData.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
+#include <atomic>
+
 #include "LyraPerformanceStatSubsystem.generated.h"
 
 enum class ELyraDisplayablePerformanceStat : uint8;
@@ -119,6 +121,115 @@ private:
 
 //////////////////////////////////////////////////////////////////////
 
+/**
+ * Log-linear histogram of a stat, for percentiles over any number of samples in fixed memory.
+ * Buckets are BucketsPerOctave per power of two (about 4% relative error) from MinValue up to ~1.7e7,
+ * values at or below MinValue (including 0) share the first bucket.
+ *
+ * Recording is a few relaxed atomic operations and never allocates or locks, so any thread can record.
+ * Readers see a consistent enough view for reporting, not a snapshot.
+ */
+class FLyraStatHistogram
+{
+public:
+	static constexpr int32 BucketsPerOctave = 16;
+	static constexpr int32 NumOctaves = 44;
+	static constexpr int32 NumBuckets = BucketsPerOctave * NumOctaves + 1;
+	static constexpr double MinValue = 1e-6;
+
+	FLyraStatHistogram() { Reset(); }
+
+	FLyraStatHistogram(const FLyraStatHistogram&) = delete;
+	FLyraStatHistogram& operator=(const FLyraStatHistogram&) = delete;
+
+	void RecordValue(double Value);
+	void Reset();
+
+	uint64 GetCount() const { return Count.load(std::memory_order_relaxed); }
+	double GetMin() const { return GetCount() > 0 ? MinRecorded.load(std::memory_order_relaxed) : 0.0; }
+	double GetMax() const { return GetCount() > 0 ? MaxRecorded.load(std::memory_order_relaxed) : 0.0; }
+	double GetMean() const;
+
+	/** @param Percentile in [0, 1], e.g. 0.95 for p95. 0 when empty */
+	double GetPercentile(double Percentile) const;
+
+private:
+	static int32 GetBucketIndex(double Value);
+	static double GetBucketValue(int32 BucketIndex);
+
+	std::atomic<uint32> Buckets[NumBuckets];
+	std::atomic<uint64> Count;
+	std::atomic<double> Sum;
+	std::atomic<double> MinRecorded;
+	std::atomic<double> MaxRecorded;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * A named capture of every performance stat, between StartCapture and StopCapture on the subsystem.
+ * Keeps a histogram per stat for the whole capture, hitch counts, and frame / game thread percentiles
+ * per time window. Written out as a CSV (one row per stat) and a JSON summary (stats and windows)
+ * so benchmark runs of different builds can be compared by tools.
+ */
+class FLyraPerformanceCapture
+{
+public:
+	FLyraPerformanceCapture(const FString& InName, double InWindowSeconds, double InHitchThresholdSeconds);
+
+	FLyraPerformanceCapture(const FLyraPerformanceCapture&) = delete;
+	FLyraPerformanceCapture& operator=(const FLyraPerformanceCapture&) = delete;
+
+	/** Counts the frame and its hitches, closing the current window when it is over */
+	void BeginFrame(double Now, const FFrameData& FrameData);
+	void RecordStat(ELyraDisplayablePerformanceStat Stat, double Value);
+
+	/** Closes the last window and writes <Name>.csv and <Name>.json to OutputDir. Returns false if a file could not be written */
+	bool Finish(double Now, const FString& OutputDir);
+
+	const FString& GetName() const { return Name; }
+	int32 GetNumFrames() const { return NumFrames; }
+	int32 GetNumHitches() const { return NumHitches; }
+	const FLyraStatHistogram& GetHistogram(ELyraDisplayablePerformanceStat Stat) const;
+
+	FString ToCsv() const;
+	FString ToJson() const;
+
+private:
+	struct FWindowSummary
+	{
+		double StartSeconds = 0.0;
+		double DurationSeconds = 0.0;
+		int32 NumFrames = 0;
+		int32 NumHitches = 0;
+		double FrameTimeMs[3] = {};
+		double GameThreadMs[3] = {};
+	};
+
+	void CloseWindow(double Now);
+
+	FString Name;
+	FDateTime StartDateTime;
+	double StartTime = 0.0;
+	double WindowSeconds = 10.0;
+	double HitchThresholdSeconds = 0.06;
+
+	int32 NumFrames = 0;
+	int32 NumHitches = 0;
+	int32 NumGameThreadHitches = 0;
+
+	FLyraStatHistogram Histograms[(int32)ELyraDisplayablePerformanceStat::Count];
+
+	double WindowStartTime = 0.0;
+	int32 WindowFrames = 0;
+	int32 WindowHitches = 0;
+	FLyraStatHistogram WindowFrameTime;
+	FLyraStatHistogram WindowGameThreadTime;
+	TArray<FWindowSummary> Windows;
+};
+
+//////////////////////////////////////////////////////////////////////
+
 // Observer which caches the stats for the previous frame
 struct FLyraPerformanceStatCache : public IPerformanceDataConsumer
 {
@@ -146,6 +257,16 @@ public:
 	 */
 	const FSampledStatCache* GetCachedStatData(const ELyraDisplayablePerformanceStat Stat) const;
 
+	/**
+	 * Returns the histogram of every sample of the given stat since the subsystem started
+	 */
+	const FLyraStatHistogram& GetStatHistogram(const ELyraDisplayablePerformanceStat Stat) const;
+
+	bool StartCapture(const FString& Name, double WindowSeconds, double HitchThresholdSeconds);
+	bool StopCapture(const FString& Name, const FString& OutputDir);
+	void StopAllCaptures(const FString& OutputDir);
+	bool IsCapturing(const FString& Name) const { return Captures.Contains(Name); }
+
 protected:
 
 	void RecordStat(const ELyraDisplayablePerformanceStat Stat, const double Value);
@@ -156,6 +277,16 @@ protected:
 	 * Caches the sampled data for each of the performance stats currently available
 	 */
 	TMap<ELyraDisplayablePerformanceStat, FSampledStatCache> PerfStateCache;
+
+	/**
+	 * Every sample of each stat since the subsystem started
+	 */
+	FLyraStatHistogram Histograms[(int32)ELyraDisplayablePerformanceStat::Count];
+
+	/**
+	 * Named captures in progress
+	 */
+	TMap<FString, TUniquePtr<FLyraPerformanceCapture>> Captures;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -172,6 +303,29 @@ public:
 
 	const FSampledStatCache* GetCachedStatData(const ELyraDisplayablePerformanceStat Stat) const;
 
+	// Returns the given percentile (0-1) of every sample of the stat since startup
+	UFUNCTION(BlueprintCallable)
+	double GetStatPercentile(ELyraDisplayablePerformanceStat Stat, double Percentile) const;
+
+	const FLyraStatHistogram* GetStatHistogram(const ELyraDisplayablePerformanceStat Stat) const;
+
+	/**
+	 * Starts a named capture of every stat. Captures are written to Saved/Profiling/LyraPerformance when stopped,
+	 * or when the game instance shuts down. Returns false if a capture with that name is already running.
+	 * @param WindowSeconds length of the time windows in the summary, <= 0 uses Lyra.Perf.CaptureWindowSeconds
+	 */
+	UFUNCTION(BlueprintCallable)
+	bool StartCapture(const FString& Name, double WindowSeconds = 0.0);
+
+	// Stops a named capture and writes its CSV/JSON summary. Returns false if it was not running or could not be written
+	UFUNCTION(BlueprintCallable)
+	bool StopCapture(const FString& Name);
+
+	UFUNCTION(BlueprintCallable)
+	bool IsCapturing(const FString& Name) const;
+
+	static FString GetCaptureOutputDir();
+
 	//~USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
@@ -40,6 +40,18 @@
 *		to simulated connections at a low, steady frequency, and to take advantage of serialization sharing. Auto proxy player states are replicated at higher frequency (to the
 *		owning connection only) via ULyraReplicationGraphNode_AlwaysRelevant_ForConnection.
 *		
+*		ULyraReplicationGraphNode_ChunkedDormancy
+*		Spatialization for placed, mostly dormant actors (buildings, placeables; EClassRepNodeMapping::Spatialize_Chunked). Actors are bucketed by world chunk with
+*		separate awake/dormant lists. Once every actor of a chunk's dormant list is dormant on a connection, the list is no longer gathered for it until the chunk
+*		changes or the viewer moves, so large bases cost nothing per frame while nobody touches them.
+*		
+*		ULyraReplicationGraphNode_TeamRelevant
+*		Actors only relevant to their own team (party-only actors; EClassRepNodeMapping::RelevantToTeam). One list per team, gathered by the connections of that team.
+*		
+*		ULyraReplicationGraphNode_LODReplicationPeriod
+*		Does not gather anything. Polls ILyraReplicationLODInterface on spatialized actors (monsters; EClassRepNodeMapping::Spatialize_LODScaled) and scales their
+*		replication period with their LOD. These actors are replicated through the GridNode like any dynamic actor.
+*		
 *		UReplicationGraphNode_TearOff_ForConnection
 *		Connection specific node for handling tear off actors. This is created and managed in the base implementation of Replication Graph.
 *	
@@ -65,6 +77,9 @@
 *		Net.RepGraph.PrintAllActorInfo <ActorMatchString> - will print the class, global, and connection replication info associated with an actor/class. If MatchString is empty will print everything. Call directly from client.
 *		
 *		Lyra.RepGraph.PrintRouting - will print the EClassRepNodeMapping for each class. That is, how a given actor class is routed (or not) in the Replication Graph.
+*		
+*		Lyra.RepGraph.PrintConnectionStats [reset] - will print the actors gathered by the Lyra nodes for each connection last frame, and the server replication time.
+*		The same counts are available through "stat LyraRepGraph".
 *	
 */
 
@@ -88,13 +103,24 @@
 #include "UObject/UObjectIterator.h"
 
 #include "LyraReplicationGraphSettings.h"
+#include "LyraReplicationLODInterface.h"
 #include "Character/LyraCharacter.h"
 #include "Player/LyraPlayerController.h"
+#include "Teams/LyraTeamSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraReplicationGraph)
 
 DEFINE_LOG_CATEGORY( LogLyraRepGraph );
 
+DECLARE_STATS_GROUP(TEXT("LyraRepGraph"), STATGROUP_LyraRepGraph, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("ServerReplicateActors"), STAT_LyraRepGraph_ServerReplicateActors, STATGROUP_LyraRepGraph);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Always Relevant Actors Gathered"), STAT_LyraRepGraph_AlwaysRelevantActors, STATGROUP_LyraRepGraph);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Chunk Actors Gathered"), STAT_LyraRepGraph_ChunkActors, STATGROUP_LyraRepGraph);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Settled Chunks Skipped"), STAT_LyraRepGraph_SettledChunks, STATGROUP_LyraRepGraph);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Team Actors Gathered"), STAT_LyraRepGraph_TeamActors, STATGROUP_LyraRepGraph);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LOD Period Changes"), STAT_LyraRepGraph_LODPeriodChanges, STATGROUP_LyraRepGraph);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Max Actors Gathered Per Connection"), STAT_LyraRepGraph_MaxConnectionActors, STATGROUP_LyraRepGraph);
+
 namespace Lyra::RepGraph
 {
 	float DestructionInfoMaxDist = 30000.f;
@@ -134,6 +160,25 @@ namespace Lyra::RepGraph
 	int32 EnableFastSharedPath = 1;
 	static FAutoConsoleVariableRef CVarLyraRepEnableFastSharedPath(TEXT("Lyra.RepGraph.EnableFastSharedPath"), EnableFastSharedPath, TEXT(""), ECVF_Default);
 
+	// Size of the Spatialize_Chunked buckets. Matches the world generator chunks (64 cells of 100cm).
+	float ChunkSize = 6400.f;
+	static FAutoConsoleVariableRef CVarLyraRepChunkSize(TEXT("Lyra.RepGraph.Chunk.Size"), ChunkSize, TEXT(""), ECVF_Default);
+
+	float ChunkCullDistance = 20000.f;
+	static FAutoConsoleVariableRef CVarLyraRepChunkCullDistance(TEXT("Lyra.RepGraph.Chunk.CullDistance"), ChunkCullDistance, TEXT("Chunks farther than this from every viewer of a connection are not gathered for it"), ECVF_Default);
+
+	float ChunkResettleDistance = 1000.f;
+	static FAutoConsoleVariableRef CVarLyraRepChunkResettleDistance(TEXT("Lyra.RepGraph.Chunk.ResettleDistance"), ChunkResettleDistance, TEXT("How far a viewer can move before settled chunks are checked again"), ECVF_Default);
+
+	int32 TeamRefreshFrames = 30;
+	static FAutoConsoleVariableRef CVarLyraRepTeamRefreshFrames(TEXT("Lyra.RepGraph.Team.RefreshFrames"), TeamRefreshFrames, TEXT("Frames between two full passes over the team relevant actors"), ECVF_Default);
+
+	int32 LODRefreshFrames = 10;
+	static FAutoConsoleVariableRef CVarLyraRepLODRefreshFrames(TEXT("Lyra.RepGraph.LOD.RefreshFrames"), LODRefreshFrames, TEXT("Frames over which every LOD scaled actor is polled once"), ECVF_Default);
+
+	int32 LODMaxPeriodFrames = 32;
+	static FAutoConsoleVariableRef CVarLyraRepLODMaxPeriodFrames(TEXT("Lyra.RepGraph.LOD.MaxPeriodFrames"), LODMaxPeriodFrames, TEXT("Upper bound for LOD scaled replication periods"), ECVF_Default);
+
 	UReplicationDriver* ConditionalCreateReplicationDriver(UNetDriver* ForNetDriver, UWorld* World)
 	{
 		// Only create for GameNetDriver
@@ -240,6 +285,12 @@ EClassRepNodeMapping ULyraReplicationGraph::GetClassNodeMapping(UClass* Class) c
 		return FString::Printf(TEXT("%s [%d/%d/%d]"), *CDO->GetClass()->GetName(), CDO->bAlwaysRelevant, CDO->bOnlyRelevantToOwner, CDO->bNetUseOwnerRelevancy);
 	};
 
+	// Checked before deferring to the super class: the relevancy flags usually match the super class, the interface does not
+	if (ShouldSpatialize(ActorCDO) && Class->ImplementsInterface(ULyraReplicationLODInterface::StaticClass()))
+	{
+		return EClassRepNodeMapping::Spatialize_LODScaled;
+	}
+
 	// Only handle this class if it differs from its super. There is no need to put every child class explicitly in the graph class mapping
 	UClass* SuperClass = Class->GetSuperClass();
 	if (AActor* SuperCDO = Cast<AActor>(SuperClass->GetDefaultObject()))
@@ -564,6 +615,30 @@ void ULyraReplicationGraph::InitGlobalGraphNodes()
 	// -----------------------------------------------
 	ULyraReplicationGraphNode_PlayerStateFrequencyLimiter* PlayerStateNode = CreateNewNode<ULyraReplicationGraphNode_PlayerStateFrequencyLimiter>();
 	AddGlobalGraphNode(PlayerStateNode);
+
+	// -----------------------------------------------
+	//	Placed, mostly dormant actors bucketed by world chunk
+	// -----------------------------------------------
+	ChunkNode = CreateNewNode<ULyraReplicationGraphNode_ChunkedDormancy>();
+	ChunkNode->ChunkSize = FMath::Max(Lyra::RepGraph::ChunkSize, 100.f);
+	ChunkNode->CullDistance = Lyra::RepGraph::ChunkCullDistance;
+	ChunkNode->ResettleDistance = Lyra::RepGraph::ChunkResettleDistance;
+	AddGlobalGraphNode(ChunkNode);
+
+	// -----------------------------------------------
+	//	Actors relevant to their own team only
+	// -----------------------------------------------
+	TeamNode = CreateNewNode<ULyraReplicationGraphNode_TeamRelevant>();
+	TeamNode->RefreshFrames = FMath::Max(Lyra::RepGraph::TeamRefreshFrames, 1);
+	AddGlobalGraphNode(TeamNode);
+
+	// -----------------------------------------------
+	//	Replication period of LOD scaled actors. Gathers nothing, these actors are in the GridNode
+	// -----------------------------------------------
+	LODNode = CreateNewNode<ULyraReplicationGraphNode_LODReplicationPeriod>();
+	LODNode->RefreshFrames = FMath::Max(Lyra::RepGraph::LODRefreshFrames, 1);
+	LODNode->MaxPeriodFrames = FMath::Clamp(Lyra::RepGraph::LODMaxPeriodFrames, 1, (int32)MAX_uint16);
+	AddGlobalGraphNode(LODNode);
 }
 
 void ULyraReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
@@ -610,6 +685,12 @@ void ULyraReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActo
 			break;
 		}
 
+		case EClassRepNodeMapping::RelevantToTeam:
+		{
+			TeamNode->NotifyAddNetworkActor(ActorInfo);
+			break;
+		}
+
 		case EClassRepNodeMapping::Spatialize_Static:
 		{
 			GridNode->AddActor_Static(ActorInfo, GlobalInfo);
@@ -627,6 +708,19 @@ void ULyraReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActo
 			GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
 			break;
 		}
+
+		case EClassRepNodeMapping::Spatialize_Chunked:
+		{
+			ChunkNode->AddChunkedActor(ActorInfo, GlobalInfo);
+			break;
+		}
+
+		case EClassRepNodeMapping::Spatialize_LODScaled:
+		{
+			GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+			LODNode->NotifyAddNetworkActor(ActorInfo);
+			break;
+		}
 	};
 }
 
@@ -660,6 +754,13 @@ void ULyraReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedA
 			break;
 		}
 
+		case EClassRepNodeMapping::RelevantToTeam:
+		{
+			TeamNode->NotifyRemoveNetworkActor(ActorInfo);
+			SetActorDestructionInfoToIgnoreDistanceCulling(ActorInfo.GetActor());
+			break;
+		}
+
 		case EClassRepNodeMapping::Spatialize_Static:
 		{
 			GridNode->RemoveActor_Static(ActorInfo);
@@ -677,9 +778,108 @@ void ULyraReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedA
 			GridNode->RemoveActor_Dormancy(ActorInfo);
 			break;
 		}
+
+		case EClassRepNodeMapping::Spatialize_Chunked:
+		{
+			ChunkNode->RemoveChunkedActor(ActorInfo);
+			break;
+		}
+
+		case EClassRepNodeMapping::Spatialize_LODScaled:
+		{
+			GridNode->RemoveActor_Dynamic(ActorInfo);
+			LODNode->NotifyRemoveNetworkActor(ActorInfo);
+			break;
+		}
 	};
 }
 
+int32 ULyraReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LyraRepGraph_ServerReplicateActors);
+
+	for (auto It = ConnectionStats.CreateIterator(); It; ++It)
+	{
+		if (It.Key().ResolveObjectPtr() == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+		else
+		{
+			It.Value() = FLyraRepGraphConnectionStats();
+		}
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumReplicated = Super::ServerReplicateActors(DeltaSeconds);
+	TimingStats.AddSample((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	int32 MaxConnectionActors = 0;
+	for (const TPair<TObjectKey<UNetReplicationGraphConnection>, FLyraRepGraphConnectionStats>& Pair : ConnectionStats)
+	{
+		MaxConnectionActors = FMath::Max(MaxConnectionActors, Pair.Value.GetTotalActors());
+	}
+	SET_DWORD_STAT(STAT_LyraRepGraph_MaxConnectionActors, MaxConnectionActors);
+
+	return NumReplicated;
+}
+
+FLyraRepGraphConnectionStats& ULyraReplicationGraph::GetConnectionStats(const UNetReplicationGraphConnection& ConnectionManager)
+{
+	return ConnectionStats.FindOrAdd(&ConnectionManager);
+}
+
+void ULyraReplicationGraph::SetActorReplicationPeriod(FActorRepListType Actor, uint16 ReplicationPeriodFrame)
+{
+	if (FGlobalActorReplicationInfo* GlobalInfo = GlobalActorReplicationInfoMap.Find(Actor))
+	{
+		GlobalInfo->Settings.ReplicationPeriodFrame = ReplicationPeriodFrame;
+	}
+
+	// Connection infos copy the global settings when they are created, existing ones have to be updated as well
+	for (UNetReplicationGraphConnection* ConnManager : Connections)
+	{
+		if (FConnectionReplicationActorInfo* ConnectionActorInfo = ConnManager->ActorInfoMap.Find(Actor))
+		{
+			ConnectionActorInfo->ReplicationPeriodFrame = ReplicationPeriodFrame;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------
+
+void FLyraRepGraphTimingStats::AddSample(double Ms)
+{
+	NumFrames++;
+	LastMs = Ms;
+	TotalMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+
+	if (SamplesMs.Num() < MaxSamples)
+	{
+		SamplesMs.Add((float)Ms);
+	}
+}
+
+void FLyraRepGraphTimingStats::Reset()
+{
+	*this = FLyraRepGraphTimingStats();
+}
+
+double FLyraRepGraphTimingStats::GetPercentileMs(float Percentile) const
+{
+	if (SamplesMs.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	TArray<float> Sorted = SamplesMs;
+	Sorted.Sort();
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
 // Since we listen to global (static) events, we need to watch out for cross world broadcasts (PIE)
 #if WITH_EDITOR
 #define CHECK_WORLDS(X) if(X->GetWorld() != GetWorld()) return;
@@ -795,6 +995,7 @@ void ULyraReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsFor
 	FPerConnectionActorInfoMap& ConnectionActorInfoMap = Params.ConnectionManager.ActorInfoMap;
 	
 	TMap<FName, FActorRepListRefView>& AlwaysRelevantStreamingLevelActors = LyraGraph->AlwaysRelevantStreamingLevelActors;
+	int32 NumStreamingLevelActors = 0;
 
 	for (int32 Idx=AlwaysRelevantStreamingLevelsNeedingReplication.Num()-1; Idx >= 0; --Idx)
 	{
@@ -833,6 +1034,7 @@ void ULyraReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsFor
 			{
 				UE_CLOG(Lyra::RepGraph::DisplayClientLevelStreaming > 0, LogLyraRepGraph, Display, TEXT("CLIENTSTREAMING Adding always Actors on StreamingLevel %s for %s because it has at least one non dormant actor"), *StreamingLevel.ToString(), *Params.ConnectionManager.GetName());
 				Params.OutGatheredReplicationLists.AddReplicationActorList(RepList);
+				NumStreamingLevelActors += RepList.Num();
 			}
 		}
 		else
@@ -850,6 +1052,10 @@ void ULyraReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsFor
 #endif
 
 	Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+
+	const int32 NumActors = ReplicationActorList.Num() + NumStreamingLevelActors;
+	LyraGraph->GetConnectionStats(Params.ConnectionManager).AlwaysRelevantActors += NumActors;
+	INC_DWORD_STAT_BY(STAT_LyraRepGraph_AlwaysRelevantActors, NumActors);
 }
 
 void ULyraReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityAdd(FName LevelName, UWorld* StreamingWorld)
@@ -945,6 +1151,512 @@ void ULyraReplicationGraphNode_PlayerStateFrequencyLimiter::LogNode(FReplication
 
 // ------------------------------------------------------------------------------
 
+FIntPoint ULyraReplicationGraphNode_ChunkedDormancy::GetChunkCoord(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / ChunkSize), FMath::FloorToInt32(Location.Y / ChunkSize));
+}
+
+ULyraReplicationGraphNode_ChunkedDormancy::FChunk* ULyraReplicationGraphNode_ChunkedDormancy::FindActorChunk(FActorRepListType Actor)
+{
+	const FIntPoint* Coord = ActorChunks.Find(Actor);
+	return Coord ? Chunks.Find(*Coord) : nullptr;
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::AddChunkedActor(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	AActor* Actor = ActorInfo.GetActor();
+	if (ActorChunks.Contains(Actor))
+	{
+		UE_LOG(LogLyraRepGraph, Warning, TEXT("ULyraReplicationGraphNode_ChunkedDormancy::AddChunkedActor - %s was already added"), *GetActorRepListTypeDebugString(Actor));
+		return;
+	}
+
+	// Chunked actors are expected to stay where they were placed. Their chunk is not updated if they move.
+	const FIntPoint Coord = GetChunkCoord(Actor->GetActorLocation());
+	ActorChunks.Add(Actor, Coord);
+
+	FChunk& Chunk = Chunks.FindOrAdd(Coord);
+	if (Actor->NetDormancy > DORM_Awake)
+	{
+		Chunk.DormantActors.Add(Actor);
+		MarkChunkChanged(Chunk);
+	}
+	else
+	{
+		Chunk.AwakeActors.Add(Actor);
+	}
+
+	GlobalInfo.Events.DormancyChange.AddUObject(this, &ThisClass::OnNetDormancyChange);
+	GlobalInfo.Events.DormancyFlush.AddUObject(this, &ThisClass::OnNetDormancyFlush);
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::RemoveChunkedActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	FIntPoint Coord;
+	if (!ActorChunks.RemoveAndCopyValue(ActorInfo.Actor, Coord))
+	{
+		UE_LOG(LogLyraRepGraph, Warning, TEXT("ULyraReplicationGraphNode_ChunkedDormancy::RemoveChunkedActor - %s was not found"), *GetActorRepListTypeDebugString(ActorInfo.Actor));
+		return;
+	}
+
+	if (FGlobalActorReplicationInfo* GlobalInfo = GraphGlobals->GlobalActorReplicationInfoMap->Find(ActorInfo.Actor))
+	{
+		GlobalInfo->Events.DormancyChange.RemoveAll(this);
+		GlobalInfo->Events.DormancyFlush.RemoveAll(this);
+	}
+
+	if (FChunk* Chunk = Chunks.Find(Coord))
+	{
+		if (!Chunk->AwakeActors.RemoveFast(ActorInfo.Actor))
+		{
+			Chunk->DormantActors.RemoveFast(ActorInfo.Actor);
+		}
+
+		if (Chunk->AwakeActors.Num() == 0 && Chunk->DormantActors.Num() == 0)
+		{
+			Chunks.Remove(Coord);
+		}
+	}
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::NotifyResetAllNetworkActors()
+{
+	for (const TPair<FActorRepListType, FIntPoint>& Pair : ActorChunks)
+	{
+		if (FGlobalActorReplicationInfo* GlobalInfo = GraphGlobals->GlobalActorReplicationInfoMap->Find(Pair.Key))
+		{
+			GlobalInfo->Events.DormancyChange.RemoveAll(this);
+			GlobalInfo->Events.DormancyFlush.RemoveAll(this);
+		}
+	}
+
+	Chunks.Reset();
+	ActorChunks.Reset();
+	SettledChunksPerConnection.Reset();
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::OnNetDormancyChange(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, ENetDormancy NewValue, ENetDormancy OldValue)
+{
+	FChunk* Chunk = FindActorChunk(Actor);
+	if (!Chunk)
+	{
+		return;
+	}
+
+	const bool bCurrentDormant = NewValue > DORM_Awake;
+	const bool bPreviousDormant = OldValue > DORM_Awake;
+
+	if (bCurrentDormant && !bPreviousDormant)
+	{
+		// The actor still has to be replicated until its channel closes as dormant on each connection
+		Chunk->AwakeActors.RemoveFast(Actor);
+		Chunk->DormantActors.Add(Actor);
+		MarkChunkChanged(*Chunk);
+	}
+	else if (!bCurrentDormant && bPreviousDormant)
+	{
+		Chunk->DormantActors.RemoveFast(Actor);
+		Chunk->AwakeActors.Add(Actor);
+	}
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::OnNetDormancyFlush(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	// Flushing resets bDormantOnConnection, the dormant list has to be gathered again until the actor went back to sleep everywhere
+	if (FChunk* Chunk = FindActorChunk(Actor))
+	{
+		MarkChunkChanged(*Chunk);
+	}
+}
+
+bool ULyraReplicationGraphNode_ChunkedDormancy::AreDormantActorsSettled(const FChunk& Chunk, UNetReplicationGraphConnection& ConnectionManager, const FVector& ViewLocation) const
+{
+	for (FActorRepListType Actor : Chunk.DormantActors)
+	{
+		FConnectionReplicationActorInfo& ConnectionActorInfo = ConnectionManager.ActorInfoMap.FindOrAdd(Actor);
+		if (ConnectionActorInfo.bDormantOnConnection)
+		{
+			continue;
+		}
+
+		// Not sent because it is out of range: nothing to do until the viewer comes closer, which invalidates the settled state.
+		// A cull distance of 0 means the actor is never culled by distance
+		const float CullDistanceSquared = ConnectionActorInfo.GetCullDistanceSquared();
+		if (CullDistanceSquared > 0.f && FVector::DistSquared(Actor->GetActorLocation(), ViewLocation) > CullDistanceSquared)
+		{
+			continue;
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (Chunks.Num() == 0)
+	{
+		return;
+	}
+
+	ULyraReplicationGraph* LyraGraph = CastChecked<ULyraReplicationGraph>(GetOuter());
+	FLyraRepGraphConnectionStats& ConnectionStats = LyraGraph->GetConnectionStats(Params.ConnectionManager);
+
+	TMap<FIntPoint, FSettledChunk>& SettledChunks = SettledChunksPerConnection.FindOrAdd(&Params.ConnectionManager);
+
+	const int32 ChunkRadius = FMath::CeilToInt32(CullDistance / ChunkSize);
+	const double CullDistanceSq = FMath::Square((double)CullDistance);
+	const double ResettleDistanceSq = FMath::Square((double)ResettleDistance);
+
+	// Only needed to avoid gathering a chunk twice with split screen
+	TArray<FIntPoint, TInlineAllocator<16>> GatheredChunks;
+	const bool bMultipleViewers = Params.Viewers.Num() > 1;
+
+	int32 NumActors = 0;
+	int32 NumSettled = 0;
+
+	for (const FNetViewer& CurViewer : Params.Viewers)
+	{
+		const FIntPoint ViewerCoord = GetChunkCoord(CurViewer.ViewLocation);
+
+		for (int32 Y = ViewerCoord.Y - ChunkRadius; Y <= ViewerCoord.Y + ChunkRadius; ++Y)
+		{
+			for (int32 X = ViewerCoord.X - ChunkRadius; X <= ViewerCoord.X + ChunkRadius; ++X)
+			{
+				const FIntPoint Coord(X, Y);
+				FChunk* Chunk = Chunks.Find(Coord);
+				if (!Chunk)
+				{
+					continue;
+				}
+
+				const FBox2D ChunkBounds(FVector2D(X * ChunkSize, Y * ChunkSize), FVector2D((X + 1) * ChunkSize, (Y + 1) * ChunkSize));
+				if (ChunkBounds.ComputeSquaredDistanceToPoint(FVector2D(CurViewer.ViewLocation)) > CullDistanceSq)
+				{
+					continue;
+				}
+
+				if (bMultipleViewers)
+				{
+					if (GatheredChunks.Contains(Coord))
+					{
+						continue;
+					}
+					GatheredChunks.Add(Coord);
+				}
+
+				ConnectionStats.ChunksInRange++;
+
+				if (Chunk->AwakeActors.Num() > 0)
+				{
+					Params.OutGatheredReplicationLists.AddReplicationActorList(Chunk->AwakeActors);
+					NumActors += Chunk->AwakeActors.Num();
+				}
+
+				if (Chunk->DormantActors.Num() == 0)
+				{
+					continue;
+				}
+
+				const FSettledChunk* Settled = SettledChunks.Find(Coord);
+				if (Settled && Settled->Version == Chunk->Version && FVector::DistSquared(Settled->ViewLocation, CurViewer.ViewLocation) <= ResettleDistanceSq)
+				{
+					NumSettled++;
+				}
+				else if (AreDormantActorsSettled(*Chunk, Params.ConnectionManager, CurViewer.ViewLocation))
+				{
+					SettledChunks.Add(Coord, FSettledChunk{ Chunk->Version, CurViewer.ViewLocation });
+					NumSettled++;
+				}
+				else
+				{
+					SettledChunks.Remove(Coord);
+					Params.OutGatheredReplicationLists.AddReplicationActorList(Chunk->DormantActors);
+					NumActors += Chunk->DormantActors.Num();
+				}
+			}
+		}
+	}
+
+	ConnectionStats.ChunkActors += NumActors;
+	ConnectionStats.SettledChunks += NumSettled;
+	INC_DWORD_STAT_BY(STAT_LyraRepGraph_ChunkActors, NumActors);
+	INC_DWORD_STAT_BY(STAT_LyraRepGraph_SettledChunks, NumSettled);
+
+	// Drop the state of connections that went away. Cheap enough to do from the first connection each frame.
+	if (Params.ConnectionManager.ConnectionOrderNum == 0)
+	{
+		for (auto It = SettledChunksPerConnection.CreateIterator(); It; ++It)
+		{
+			if (It.Key().ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void ULyraReplicationGraphNode_ChunkedDormancy::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+
+	for (const TPair<FIntPoint, FChunk>& Pair : Chunks)
+	{
+		LogActorRepList(DebugInfo, FString::Printf(TEXT("Chunk[%d,%d] Awake"), Pair.Key.X, Pair.Key.Y), Pair.Value.AwakeActors);
+		LogActorRepList(DebugInfo, FString::Printf(TEXT("Chunk[%d,%d] Dormant"), Pair.Key.X, Pair.Key.Y), Pair.Value.DormantActors);
+	}
+
+	DebugInfo.PopIndent();
+}
+
+// ------------------------------------------------------------------------------
+
+ULyraReplicationGraphNode_TeamRelevant::ULyraReplicationGraphNode_TeamRelevant()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void ULyraReplicationGraphNode_TeamRelevant::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	if (ActorTeams.Contains(ActorInfo.Actor))
+	{
+		return;
+	}
+
+	ActorTeams.Add(ActorInfo.Actor, INDEX_NONE);
+	Actors.Add(ActorInfo.Actor);
+	NewActors.Add(ActorInfo.Actor);
+}
+
+bool ULyraReplicationGraphNode_TeamRelevant::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	int32 TeamId = INDEX_NONE;
+	if (!ActorTeams.RemoveAndCopyValue(ActorInfo.Actor, TeamId))
+	{
+		UE_CLOG(bWarnIfNotFound, LogLyraRepGraph, Warning, TEXT("ULyraReplicationGraphNode_TeamRelevant::NotifyRemoveNetworkActor - %s was not found"), *GetActorRepListTypeDebugString(ActorInfo.Actor));
+		return false;
+	}
+
+	if (FActorRepListRefView* List = TeamActors.Find(TeamId))
+	{
+		List->RemoveFast(ActorInfo.Actor);
+	}
+
+	Actors.RemoveSingleSwap(ActorInfo.Actor, EAllowShrinking::No);
+	NewActors.RemoveSingleSwap(ActorInfo.Actor, EAllowShrinking::No);
+	return true;
+}
+
+void ULyraReplicationGraphNode_TeamRelevant::NotifyResetAllNetworkActors()
+{
+	TeamActors.Reset();
+	ActorTeams.Reset();
+	Actors.Reset();
+	NewActors.Reset();
+	RefreshCursor = 0;
+}
+
+void ULyraReplicationGraphNode_TeamRelevant::RefreshActorTeam(FActorRepListType Actor, const ULyraTeamSubsystem& TeamSubsystem)
+{
+	int32* CurrentTeam = ActorTeams.Find(Actor);
+	if (!CurrentTeam)
+	{
+		return;
+	}
+
+	const int32 NewTeam = TeamSubsystem.FindTeamFromObject(Actor);
+	if (NewTeam == *CurrentTeam)
+	{
+		return;
+	}
+
+	if (FActorRepListRefView* OldList = TeamActors.Find(*CurrentTeam))
+	{
+		OldList->RemoveFast(Actor);
+	}
+
+	if (NewTeam != INDEX_NONE)
+	{
+		TeamActors.FindOrAdd(NewTeam).Add(Actor);
+	}
+
+	*CurrentTeam = NewTeam;
+}
+
+void ULyraReplicationGraphNode_TeamRelevant::PrepareForReplication()
+{
+	const ULyraTeamSubsystem* TeamSubsystem = GetWorld() ? GetWorld()->GetSubsystem<ULyraTeamSubsystem>() : nullptr;
+	if (!TeamSubsystem)
+	{
+		return;
+	}
+
+	for (FActorRepListType Actor : NewActors)
+	{
+		RefreshActorTeam(Actor, *TeamSubsystem);
+	}
+	NewActors.Reset();
+
+	if (Actors.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 NumToRefresh = FMath::Min(FMath::DivideAndRoundUp(Actors.Num(), RefreshFrames), Actors.Num());
+	for (int32 i = 0; i < NumToRefresh; ++i)
+	{
+		RefreshCursor = (RefreshCursor + 1) % Actors.Num();
+		RefreshActorTeam(Actors[RefreshCursor], *TeamSubsystem);
+	}
+}
+
+void ULyraReplicationGraphNode_TeamRelevant::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (TeamActors.Num() == 0)
+	{
+		return;
+	}
+
+	const ULyraTeamSubsystem* TeamSubsystem = GetWorld() ? GetWorld()->GetSubsystem<ULyraTeamSubsystem>() : nullptr;
+	if (!TeamSubsystem)
+	{
+		return;
+	}
+
+	int32 GatheredTeam = INDEX_NONE;
+	for (const FNetViewer& CurViewer : Params.Viewers)
+	{
+		const int32 ViewerTeam = TeamSubsystem->FindTeamFromObject(CurViewer.InViewer);
+		if (ViewerTeam == INDEX_NONE || ViewerTeam == GatheredTeam)
+		{
+			continue;
+		}
+
+		if (FActorRepListRefView* List = TeamActors.Find(ViewerTeam))
+		{
+			if (List->Num() > 0)
+			{
+				Params.OutGatheredReplicationLists.AddReplicationActorList(*List);
+
+				CastChecked<ULyraReplicationGraph>(GetOuter())->GetConnectionStats(Params.ConnectionManager).TeamActors += List->Num();
+				INC_DWORD_STAT_BY(STAT_LyraRepGraph_TeamActors, List->Num());
+			}
+		}
+
+		GatheredTeam = ViewerTeam;
+	}
+}
+
+void ULyraReplicationGraphNode_TeamRelevant::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+
+	for (const TPair<int32, FActorRepListRefView>& Pair : TeamActors)
+	{
+		LogActorRepList(DebugInfo, FString::Printf(TEXT("Team[%d]"), Pair.Key), Pair.Value);
+	}
+
+	DebugInfo.PopIndent();
+}
+
+// ------------------------------------------------------------------------------
+
+ULyraReplicationGraphNode_LODReplicationPeriod::ULyraReplicationGraphNode_LODReplicationPeriod()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void ULyraReplicationGraphNode_LODReplicationPeriod::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	const ILyraReplicationLODInterface* LODInterface = Cast<ILyraReplicationLODInterface>(ActorInfo.GetActor());
+	if (!LODInterface || ActorIndices.Contains(ActorInfo.Actor))
+	{
+		return;
+	}
+
+	FLODActor& Entry = Actors.AddDefaulted_GetRef();
+	Entry.Actor = ActorInfo.Actor;
+	Entry.LODInterface = LODInterface;
+	Entry.BasePeriodFrame = FMath::Max((int32)GraphGlobals->GlobalActorReplicationInfoMap->GetClassInfo(ActorInfo.Class).ReplicationPeriodFrame, 1);
+	Entry.LOD = 0;
+
+	ActorIndices.Add(ActorInfo.Actor, Actors.Num() - 1);
+}
+
+bool ULyraReplicationGraphNode_LODReplicationPeriod::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	int32 Index = INDEX_NONE;
+	if (!ActorIndices.RemoveAndCopyValue(ActorInfo.Actor, Index))
+	{
+		return false;
+	}
+
+	Actors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Actors.IsValidIndex(Index))
+	{
+		ActorIndices.FindChecked(Actors[Index].Actor) = Index;
+	}
+
+	return true;
+}
+
+void ULyraReplicationGraphNode_LODReplicationPeriod::NotifyResetAllNetworkActors()
+{
+	Actors.Reset();
+	ActorIndices.Reset();
+	RefreshCursor = 0;
+}
+
+void ULyraReplicationGraphNode_LODReplicationPeriod::PrepareForReplication()
+{
+	if (Actors.Num() == 0)
+	{
+		return;
+	}
+
+	ULyraReplicationGraph* LyraGraph = CastChecked<ULyraReplicationGraph>(GetOuter());
+
+	// Polling is time sliced: every actor is looked at once per RefreshFrames frames
+	const int32 NumToRefresh = FMath::Min(FMath::DivideAndRoundUp(Actors.Num(), RefreshFrames), Actors.Num());
+	for (int32 i = 0; i < NumToRefresh; ++i)
+	{
+		RefreshCursor = (RefreshCursor + 1) % Actors.Num();
+		FLODActor& Entry = Actors[RefreshCursor];
+
+		const int32 LOD = FMath::Clamp(Entry.LODInterface->GetReplicationLOD(), 0, 15);
+		if (LOD == Entry.LOD)
+		{
+			continue;
+		}
+
+		Entry.LOD = LOD;
+
+		const int32 Period = FMath::Max(FMath::Min(Entry.BasePeriodFrame << LOD, MaxPeriodFrames), Entry.BasePeriodFrame);
+		LyraGraph->SetActorReplicationPeriod(Entry.Actor, (uint16)FMath::Min(Period, (int32)MAX_uint16));
+
+		NumPeriodChanges++;
+		INC_DWORD_STAT(STAT_LyraRepGraph_LODPeriodChanges);
+	}
+}
+
+void ULyraReplicationGraphNode_LODReplicationPeriod::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+
+	for (const FLODActor& Entry : Actors)
+	{
+		DebugInfo.Log(FString::Printf(TEXT("%s LOD %d"), *GetActorRepListTypeDebugString(Entry.Actor), Entry.LOD));
+	}
+
+	DebugInfo.PopIndent();
+}
+
+// ------------------------------------------------------------------------------
+
 void ULyraReplicationGraph::PrintRepNodePolicies()
 {
 	UEnum* Enum = StaticEnum<EClassRepNodeMapping>();
@@ -977,6 +1689,44 @@ FAutoConsoleCommandWithWorldAndArgs LyraPrintRepNodePoliciesCmd(TEXT("Lyra.RepGr
 	})
 );
 
+void ULyraReplicationGraph::PrintConnectionStats() const
+{
+	GLog->Logf(TEXT("===================================="));
+	GLog->Logf(TEXT("Lyra Replication Connection Stats"));
+	GLog->Logf(TEXT("===================================="));
+
+	GLog->Logf(TEXT("ServerReplicateActors: last %.3fms, avg %.3fms, p95 %.3fms, max %.3fms over %d frames"),
+		TimingStats.LastMs, TimingStats.GetAverageMs(), TimingStats.GetPercentileMs(0.95f), TimingStats.MaxMs, TimingStats.NumFrames);
+
+	for (UNetReplicationGraphConnection* ConnManager : Connections)
+	{
+		const FLyraRepGraphConnectionStats* Stats = ConnectionStats.Find(ConnManager);
+		if (!Stats)
+		{
+			GLog->Logf(TEXT("%-40s --> not gathered last frame"), *GetNameSafe(ConnManager));
+			continue;
+		}
+
+		GLog->Logf(TEXT("%-40s --> %d actors (AlwaysRelevant %d, Chunks %d in range/%d settled/%d actors, Team %d)"), *GetNameSafe(ConnManager),
+			Stats->GetTotalActors(), Stats->AlwaysRelevantActors, Stats->ChunksInRange, Stats->SettledChunks, Stats->ChunkActors, Stats->TeamActors);
+	}
+}
+
+FAutoConsoleCommandWithWorldAndArgs LyraPrintConnectionStatsCmd(TEXT("Lyra.RepGraph.PrintConnectionStats"), TEXT("Prints the actors gathered by the Lyra nodes for each connection last frame and the server replication time. 'reset' clears the timing."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const bool bReset = Args.Num() > 0 && Args[0] == TEXT("reset");
+		for (TObjectIterator<ULyraReplicationGraph> It; It; ++It)
+		{
+			It->PrintConnectionStats();
+			if (bReset)
+			{
+				It->ResetTimingStats();
+			}
+		}
+	})
+);
+
 // ------------------------------------------------------------------------------
 
 FAutoConsoleCommandWithWorldAndArgs ChangeFrequencyBucketsCmd(TEXT("Lyra.RepGraph.FrequencyBuckets"), TEXT("Resets frequency bucket count."), FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray< FString >& Args, UWorld* World) 
@@ -7,9 +7,48 @@
 #include "LyraReplicationGraph.generated.h"
 
 class AGameplayDebuggerCategoryReplicator;
+class ILyraReplicationLODInterface;
+class ULyraReplicationGraphNode_ChunkedDormancy;
+class ULyraReplicationGraphNode_LODReplicationPeriod;
+class ULyraReplicationGraphNode_TeamRelevant;
+class ULyraTeamSubsystem;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogLyraRepGraph, Display, All);
 
+/** Actor counts gathered for one connection during the last replication frame. See Lyra.RepGraph.PrintConnectionStats */
+struct FLyraRepGraphConnectionStats
+{
+	int32 AlwaysRelevantActors = 0;
+	int32 ChunksInRange = 0;
+	int32 ChunkActors = 0;
+	/** Chunks whose dormant list was skipped because every actor in it is already dormant on (or out of range of) the connection */
+	int32 SettledChunks = 0;
+	int32 TeamActors = 0;
+
+	int32 GetTotalActors() const { return AlwaysRelevantActors + ChunkActors + TeamActors; }
+};
+
+/** Server time spent in ULyraReplicationGraph::ServerReplicateActors, collected until reset */
+struct FLyraRepGraphTimingStats
+{
+	int32 NumFrames = 0;
+	double LastMs = 0.0;
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+
+	/** Kept for percentiles, capped at MaxSamples (about 10 minutes at 60Hz) */
+	TArray<float> SamplesMs;
+	static constexpr int32 MaxSamples = 36000;
+
+	void AddSample(double Ms);
+	void Reset();
+
+	double GetAverageMs() const { return NumFrames > 0 ? TotalMs / NumFrames : 0.0; }
+
+	/** @param Percentile in [0, 1] */
+	double GetPercentileMs(float Percentile) const;
+};
+
 /** Lyra Replication Graph implementation. See additional notes in LyraReplicationGraph.cpp! */
 UCLASS(transient, config=Engine)
 class ULyraReplicationGraph : public UReplicationGraph
@@ -26,6 +65,7 @@ public:
 	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
 	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
 	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
 
 	UPROPERTY()
 	TArray<TObjectPtr<UClass>>	AlwaysRelevantClasses;
@@ -36,13 +76,32 @@ public:
 	UPROPERTY()
 	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
 
+	UPROPERTY()
+	TObjectPtr<ULyraReplicationGraphNode_ChunkedDormancy> ChunkNode;
+
+	UPROPERTY()
+	TObjectPtr<ULyraReplicationGraphNode_TeamRelevant> TeamNode;
+
+	UPROPERTY()
+	TObjectPtr<ULyraReplicationGraphNode_LODReplicationPeriod> LODNode;
+
 	TMap<FName, FActorRepListRefView> AlwaysRelevantStreamingLevelActors;
 
+	/** Stats of the current replication frame for this connection. Nodes add to it while gathering */
+	FLyraRepGraphConnectionStats& GetConnectionStats(const UNetReplicationGraphConnection& ConnectionManager);
+
+	const FLyraRepGraphTimingStats& GetTimingStats() const { return TimingStats; }
+	void ResetTimingStats() { TimingStats.Reset(); }
+
+	/** Overrides the replication period of a single actor, globally and for every connection that already tracks it */
+	void SetActorReplicationPeriod(FActorRepListType Actor, uint16 ReplicationPeriodFrame);
+
 #if WITH_GAMEPLAY_DEBUGGER
 	void OnGameplayDebuggerOwnerChange(AGameplayDebuggerCategoryReplicator* Debugger, APlayerController* OldOwner);
 #endif
 
 	void PrintRepNodePolicies();
+	void PrintConnectionStats() const;
 
 private:
 	void AddClassRepInfo(UClass* Class, EClassRepNodeMapping Mapping);
@@ -61,6 +120,10 @@ private:
 
 	/** Classes that had their replication settings explictly set by code in ULyraReplicationGraph::InitGlobalActorClassSettings */
 	TArray<UClass*> ExplicitlySetClasses;
+
+	TMap<TObjectKey<UNetReplicationGraphConnection>, FLyraRepGraphConnectionStats> ConnectionStats;
+
+	FLyraRepGraphTimingStats TimingStats;
 };
 
 UCLASS()
@@ -120,4 +183,148 @@ private:
 	
 	TArray<FActorRepListRefView> ReplicationActorLists;
 	FActorRepListRefView ForceNetUpdateReplicationActorList;
-};
\ No newline at end of file
+};
+
+/**
+	Spatialization for placed actors that never move and stay dormant most of the time (buildings, placeables). Actors are bucketed by world chunk and each
+	chunk keeps its awake and dormant actors in separate lists. Awake lists are gathered every frame for chunks in range. A dormant list is gathered for a
+	connection until all of its actors went dormant on that connection (or are beyond their cull distance), then skipped until the chunk changes
+	(actor added, dormancy change or flush) or the viewer moves by more than ResettleDistance.
+*/
+UCLASS()
+class ULyraReplicationGraphNode_ChunkedDormancy : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& Actor) override { }
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override;
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+	void AddChunkedActor(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo);
+	void RemoveChunkedActor(const FNewReplicatedActorInfo& ActorInfo);
+
+	float ChunkSize = 6400.f;
+	float CullDistance = 20000.f;
+	float ResettleDistance = 1000.f;
+
+private:
+	struct FChunk
+	{
+		FActorRepListRefView AwakeActors;
+		FActorRepListRefView DormantActors;
+
+		/** Changes whenever the dormant list needs to be sent again. Unique across chunks so a recreated chunk never matches a stale settled entry */
+		uint32 Version = 0;
+	};
+
+	struct FSettledChunk
+	{
+		uint32 Version = 0;
+		FVector ViewLocation = FVector::ZeroVector;
+	};
+
+	FIntPoint GetChunkCoord(const FVector& Location) const;
+	FChunk* FindActorChunk(FActorRepListType Actor);
+	void MarkChunkChanged(FChunk& Chunk) { Chunk.Version = ++LastChunkVersion; }
+
+	bool AreDormantActorsSettled(const FChunk& Chunk, UNetReplicationGraphConnection& ConnectionManager, const FVector& ViewLocation) const;
+
+	void OnNetDormancyChange(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, ENetDormancy NewValue, ENetDormancy OldValue);
+	void OnNetDormancyFlush(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo);
+
+	TMap<FIntPoint, FChunk> Chunks;
+	TMap<FActorRepListType, FIntPoint> ActorChunks;
+
+	/** Per connection, the chunks whose dormant list currently does not need to be gathered */
+	TMap<TObjectKey<UNetReplicationGraphConnection>, TMap<FIntPoint, FSettledChunk>> SettledChunksPerConnection;
+
+	uint32 LastChunkVersion = 0;
+};
+
+/**
+	Actors only relevant to the players of their own team (party-only actors: party markers, shared containers...). Actors are sorted into one list per
+	team, connections gather the list of their viewer's team. Team membership is polled in a round robin over TeamRefreshFrames frames since actors
+	usually get their team after they are added to the graph. Actors without a team are not replicated.
+*/
+UCLASS()
+class ULyraReplicationGraphNode_TeamRelevant : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	ULyraReplicationGraphNode_TeamRelevant();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+
+	virtual void PrepareForReplication() override;
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+	int32 RefreshFrames = 30;
+
+private:
+	void RefreshActorTeam(FActorRepListType Actor, const ULyraTeamSubsystem& TeamSubsystem);
+
+	TMap<int32, FActorRepListRefView> TeamActors;
+	TMap<FActorRepListType, int32> ActorTeams;
+
+	/** All actors, for the round robin refresh */
+	TArray<FActorRepListType> Actors;
+	int32 RefreshCursor = 0;
+
+	/** Added since the last PrepareForReplication, refreshed right away */
+	TArray<FActorRepListType> NewActors;
+};
+
+/**
+	Drives the replication period of actors implementing ILyraReplicationLODInterface (monsters). This node does not gather anything, the actors are
+	replicated by the GridNode: it polls their LOD over RefreshFrames frames and, when it changes, sets their period to the class period doubled for each
+	LOD level, capped at MaxPeriodFrames.
+*/
+UCLASS()
+class ULyraReplicationGraphNode_LODReplicationPeriod : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	ULyraReplicationGraphNode_LODReplicationPeriod();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+
+	virtual void PrepareForReplication() override;
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override { }
+
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+	int32 RefreshFrames = 10;
+	int32 MaxPeriodFrames = 32;
+
+	/** Number of period changes applied since the node was created */
+	int32 GetNumPeriodChanges() const { return NumPeriodChanges; }
+
+private:
+	struct FLODActor
+	{
+		FActorRepListType Actor = nullptr;
+		const ILyraReplicationLODInterface* LODInterface = nullptr;
+		int32 BasePeriodFrame = 1;
+		int32 LOD = 0;
+	};
+
+	TArray<FLODActor> Actors;
+	TMap<FActorRepListType, int32> ActorIndices;
+	int32 RefreshCursor = 0;
+	int32 NumPeriodChanges = 0;
+};
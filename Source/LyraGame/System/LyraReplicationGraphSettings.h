@@ -59,6 +59,30 @@ public:
 	UPROPERTY(EditAnywhere, Category = DynamicSpatialFrequency, meta = (ConsoleVariable = "Lyra.RepGraph.DynamicActorFrequencyBuckets"))
 	int32 DynamicActorFrequencyBuckets = 3;
 
+	// Size of the buckets used for Spatialize_Chunked actors. Matches the world generator chunk size by default (64 cells of 100cm).
+	UPROPERTY(EditAnywhere, Category = Chunks, meta = (ForceUnits=cm, ConsoleVariable = "Lyra.RepGraph.Chunk.Size"))
+	float ChunkSize = 6400.0f;
+
+	// Chunks farther than this from every viewer of a connection are not gathered for it.
+	UPROPERTY(EditAnywhere, Category = Chunks, meta = (ForceUnits=cm, ConsoleVariable = "Lyra.RepGraph.Chunk.CullDistance"))
+	float ChunkCullDistance = 20000.0f;
+
+	// How far a viewer can move before chunks whose dormant actors were all sent (or out of range) to it are checked again.
+	UPROPERTY(EditAnywhere, Category = Chunks, meta = (ForceUnits=cm, ConsoleVariable = "Lyra.RepGraph.Chunk.ResettleDistance"))
+	float ChunkResettleDistance = 1000.0f;
+
+	// Frames between two full passes over the team relevant actors to pick up team changes.
+	UPROPERTY(EditAnywhere, Category = Teams, meta = (ConsoleVariable = "Lyra.RepGraph.Team.RefreshFrames"))
+	int32 TeamRefreshFrames = 30;
+
+	// Frames over which the LOD of every Spatialize_LODScaled actor is polled once.
+	UPROPERTY(EditAnywhere, Category = LOD, meta = (ConsoleVariable = "Lyra.RepGraph.LOD.RefreshFrames"))
+	int32 LODRefreshFrames = 10;
+
+	// Upper bound for LOD scaled replication periods.
+	UPROPERTY(EditAnywhere, Category = LOD, meta = (ConsoleVariable = "Lyra.RepGraph.LOD.MaxPeriodFrames"))
+	int32 LODMaxPeriodFrames = 32;
+
 	// Array of Custom Settings for Specific Classes 
 	UPROPERTY(config, EditAnywhere, Category = ReplicationGraph)
 	TArray<FRepGraphActorClassSettings> ClassSettings;
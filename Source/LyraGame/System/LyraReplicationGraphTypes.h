@@ -11,12 +11,15 @@ enum class EClassRepNodeMapping : uint32
 {
 	NotRouted,						// Doesn't map to any node. Used for special case actors that handled by special case nodes (ULyraReplicationGraphNode_PlayerStateFrequencyLimiter)
 	RelevantAllConnections,			// Routes to an AlwaysRelevantNode or AlwaysRelevantStreamingLevelNode node
+	RelevantToTeam,					// Routes to TeamNode: only replicated to connections whose player is on the same team as the actor (party-only actors)
 
 	// ONLY SPATIALIZED Enums below here! See ULyraReplicationGraph::IsSpatialized
 
 	Spatialize_Static,				// Routes to GridNode: these actors don't move and don't need to be updated every frame.
 	Spatialize_Dynamic,				// Routes to GridNode: these actors mode frequently and are updated once per frame.
 	Spatialize_Dormancy,			// Routes to GridNode: While dormant we treat as static. When flushed/not dormant dynamic. Note this is for things that "move while not dormant".
+	Spatialize_Chunked,				// Routes to ChunkNode: placed actors that never move and are dormant most of the time (buildings, placeables). Bucketed by world chunk.
+	Spatialize_LODScaled,			// Routes to GridNode (dynamic) and LODNode: replication period follows ILyraReplicationLODInterface::GetReplicationLOD (monsters).
 };
 
 // Actor Class Settings that can be assigned directly to a Class.  Can also be mapped to a FRepGraphActorTemplateSettings 
@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+
+#include "LyraReplicationLODInterface.generated.h"
+
+/** Implemented by actors whose replication rate should follow a gameplay level of detail (e.g. AI LOD) */
+UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
+class ULyraReplicationLODInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class ILyraReplicationLODInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Current replication level of detail, 0 being the most detailed. Each level doubles the replication period
+	 * of the actor's class (see ULyraReplicationGraphNode_LODReplicationPeriod), up to Lyra.RepGraph.LOD.MaxPeriodFrames.
+	 * Polled on the server, so this should be cheap.
+	 */
+	virtual int32 GetReplicationLOD() const { return 0; }
+};
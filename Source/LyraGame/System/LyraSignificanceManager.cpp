@@ -2,5 +2,414 @@
 
 #include "LyraSignificanceManager.h"
 
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraLogChannels.h"
+#include "Misc/App.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraSignificanceManager)
 
+DECLARE_CYCLE_STAT(TEXT("Lyra Significance Update"), STAT_LyraSignificanceUpdate, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Lyra Significant Objects"), STAT_LyraSignificantObjects, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Lyra Significance Bucket Changes"), STAT_LyraSignificanceBucketChanges, STATGROUP_Game);
+
+namespace LyraSignificanceTags
+{
+	const FName Character(TEXT("Character"));
+	const FName Monster(TEXT("Monster"));
+	const FName Projectile(TEXT("Projectile"));
+	const FName FX(TEXT("FX"));
+}
+
+ULyraSignificanceManager::ULyraSignificanceManager()
+{
+	// AI and network budgets use the result on servers too
+	bCreateOnServer = true;
+	bCreateOnClient = true;
+}
+
+ULyraSignificanceManager* ULyraSignificanceManager::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? USignificanceManager::Get<ULyraSignificanceManager>(World) : nullptr;
+}
+
+void ULyraSignificanceManager::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Nothing else calls Update, so drive it from the world we belong to
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::OnWorldPostActorTick);
+	}
+}
+
+void ULyraSignificanceManager::BeginDestroy()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+
+	Super::BeginDestroy();
+}
+
+void ULyraSignificanceManager::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld() || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	TArray<FTransform, TInlineAllocator<4>> Viewpoints;
+	GatherViewpoints(*World, Viewpoints);
+	Update(Viewpoints);
+}
+
+void ULyraSignificanceManager::GatherViewpoints(UWorld& World, TArray<FTransform, TInlineAllocator<4>>& OutViewpoints) const
+{
+	// Servers score against every player so server side budgets (AI, replication) can use the result
+	const bool bAllPlayers = World.GetNetMode() != NM_Client;
+
+	for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || (!bAllPlayers && !PC->IsLocalController()))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutViewpoints.Emplace(ViewRotation, ViewLocation);
+	}
+}
+
+void ULyraSignificanceManager::Update(TArrayView<const FTransform> Viewpoints)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LyraSignificanceUpdate);
+
+	Super::Update(Viewpoints);
+
+	ScoreObjects(Viewpoints);
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+void ULyraSignificanceManager::RegisterSignificantObject(UObject* Object, FName Tag, float BoundsRadius, FLyraSignificanceBucketChanged OnBucketChanged)
+{
+	AActor* Actor = Cast<AActor>(Object);
+	USceneComponent* Component = Cast<USceneComponent>(Object);
+	if (!Actor && !Component)
+	{
+		UE_LOG(LogLyra, Warning, TEXT("ULyraSignificanceManager: %s is neither an actor nor a scene component and cannot be scored"), *GetNameSafe(Object));
+		return;
+	}
+
+	if (ObjectIndices.Contains(Object))
+	{
+		UnregisterSignificantObject(Object);
+	}
+
+	FSignificantObject& Entry = Objects.AddDefaulted_GetRef();
+	Entry.Object = Object;
+	Entry.RawObject = Object;
+	Entry.Actor = Actor;
+	Entry.Component = Component;
+	Entry.Tag = Tag;
+	Entry.BoundsRadius = FMath::Max(BoundsRadius, 1.f);
+	Entry.OnBucketChanged = MoveTemp(OnBucketChanged);
+
+	// Start where nothing is degraded, the first pass moves it to its real bucket
+	Entry.Bucket = ELyraSignificanceBucket::Highest;
+
+	ObjectIndices.Add(Object, Objects.Num() - 1);
+	SET_DWORD_STAT(STAT_LyraSignificantObjects, Objects.Num());
+}
+
+void ULyraSignificanceManager::UnregisterSignificantObject(UObject* Object)
+{
+	int32 Index = INDEX_NONE;
+	if (!ObjectIndices.RemoveAndCopyValue(Object, Index))
+	{
+		return;
+	}
+
+	Objects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Objects.IsValidIndex(Index))
+	{
+		ObjectIndices.FindChecked(Objects[Index].RawObject) = Index;
+	}
+
+	SET_DWORD_STAT(STAT_LyraSignificantObjects, Objects.Num());
+}
+
+void ULyraSignificanceManager::RemoveStaleObjects()
+{
+	for (int32 Index = Objects.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Objects[Index].Object.IsValid())
+		{
+			UE_LOG(LogLyra, Verbose, TEXT("ULyraSignificanceManager: an object with tag %s was destroyed without being unregistered"), *Objects[Index].Tag.ToString());
+
+			ObjectIndices.Remove(Objects[Index].RawObject);
+			Objects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			if (Objects.IsValidIndex(Index))
+			{
+				ObjectIndices.FindChecked(Objects[Index].RawObject) = Index;
+			}
+		}
+	}
+}
+
+void ULyraSignificanceManager::SetObjectInCombat(const UObject* Object, bool bInCombat)
+{
+	if (const int32* Index = ObjectIndices.Find(Object))
+	{
+		Objects[*Index].bInCombat = bInCombat;
+	}
+}
+
+// ============================================================================
+// Scoring
+// ============================================================================
+
+void ULyraSignificanceManager::ScoreObjects(TArrayView<const FTransform> Viewpoints)
+{
+	RemoveStaleObjects();
+
+	NumViewpoints = Viewpoints.Num();
+
+	const int32 NumObjects = Objects.Num();
+	ScoringInputs.SetNum(NumObjects, EAllowShrinking::No);
+	ScoringOutputs.SetNum(NumObjects, EAllowShrinking::No);
+
+	// Gather on the game thread, this is the only part that touches the objects
+	const bool bCanRender = FApp::CanEverRender();
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		const FSignificantObject& Entry = Objects[Index];
+		FScoringInput& Input = ScoringInputs[Index];
+
+		Input.BoundsRadius = Entry.BoundsRadius;
+		Input.bInCombat = Entry.bInCombat;
+
+		if (Entry.Actor)
+		{
+			Input.Location = Entry.Actor->GetActorLocation();
+			Input.bRecentlyRendered = !bCanRender || Entry.Actor->WasRecentlyRendered(RecentlyRenderedTolerance);
+		}
+		else
+		{
+			Input.Location = Entry.Component->GetComponentLocation();
+
+			const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Entry.Component);
+			Input.bRecentlyRendered = !bCanRender || !Primitive || Primitive->WasRecentlyRendered(RecentlyRenderedTolerance);
+		}
+	}
+
+	FViewConstants ViewConstants;
+	const float HalfFOVRadians = FMath::DegreesToRadians(FMath::Clamp(ViewFieldOfView, 1.f, 179.f) * 0.5f);
+	ViewConstants.CosHalfFOV = FMath::Cos(HalfFOVRadians);
+	ViewConstants.TanHalfFOV = FMath::Tan(HalfFOVRadians);
+
+	// Score, pure math on the gathered inputs
+	if (NumObjects >= MinObjectsForParallelScoring)
+	{
+		ParallelFor(NumObjects, [this, Viewpoints, &ViewConstants](int32 Index)
+		{
+			ScoringOutputs[Index] = ScoreObject(ScoringInputs[Index], Viewpoints, ViewConstants);
+		});
+	}
+	else
+	{
+		for (int32 Index = 0; Index < NumObjects; ++Index)
+		{
+			ScoringOutputs[Index] = ScoreObject(ScoringInputs[Index], Viewpoints, ViewConstants);
+		}
+	}
+
+	// Publish. Callbacks run once every result is stored since they may register or unregister objects
+	struct FPendingChange
+	{
+		FLyraSignificanceBucketChanged Callback;
+		ELyraSignificanceBucket OldBucket;
+		ELyraSignificanceBucket NewBucket;
+	};
+	TArray<FPendingChange, TInlineAllocator<32>> PendingChanges;
+
+	FMemory::Memzero(BucketCounts);
+
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		FSignificantObject& Entry = Objects[Index];
+		const FScoringOutput& Output = ScoringOutputs[Index];
+
+		Entry.DistanceSq = Output.DistanceSq;
+		Entry.bVisible = Output.bVisible;
+
+		if (Entry.Bucket != Output.Bucket)
+		{
+			if (Entry.OnBucketChanged.IsBound())
+			{
+				PendingChanges.Add({ Entry.OnBucketChanged, Entry.Bucket, Output.Bucket });
+			}
+			Entry.Bucket = Output.Bucket;
+			INC_DWORD_STAT(STAT_LyraSignificanceBucketChanges);
+		}
+
+		BucketCounts[(uint8)Entry.Bucket]++;
+	}
+
+	for (FPendingChange& Change : PendingChanges)
+	{
+		Change.Callback.ExecuteIfBound(Change.OldBucket, Change.NewBucket);
+	}
+}
+
+ULyraSignificanceManager::FScoringOutput ULyraSignificanceManager::ScoreObject(const FScoringInput& Input, TArrayView<const FTransform> Viewpoints, const FViewConstants& ViewConstants) const
+{
+	FScoringOutput Output;
+	if (Viewpoints.Num() == 0)
+	{
+		return Output;
+	}
+
+	bool bInView = false;
+	for (const FTransform& Viewpoint : Viewpoints)
+	{
+		const FVector ToObject = Input.Location - Viewpoint.GetLocation();
+		const float DistanceSq = (float)ToObject.SizeSquared();
+		Output.DistanceSq = FMath::Min(Output.DistanceSq, DistanceSq);
+
+		if (bInView)
+		{
+			continue;
+		}
+
+		if (DistanceSq <= FMath::Square(Input.BoundsRadius))
+		{
+			bInView = true;
+			continue;
+		}
+
+		// Widen the cone by the angular size of the bounds so large objects at the edge still count
+		const float Distance = FMath::Sqrt(DistanceSq);
+		const float CosToObject = (float)FVector::DotProduct(ToObject / Distance, Viewpoint.GetUnitAxis(EAxis::X));
+		bInView = CosToObject >= ViewConstants.CosHalfFOV - Input.BoundsRadius / Distance;
+	}
+
+	const float Distance = FMath::Sqrt(Output.DistanceSq);
+	const float ScreenSize = Input.BoundsRadius / FMath::Max(Distance * ViewConstants.TanHalfFOV, 1.f);
+
+	int32 Bucket = (int32)GetBucketForDistance(Distance);
+
+	Output.bVisible = bInView && Input.bRecentlyRendered;
+	if (!Output.bVisible)
+	{
+		Bucket++;
+	}
+
+	if (ScreenSize < MinScreenSize)
+	{
+		Bucket++;
+	}
+
+	if (Input.bInCombat)
+	{
+		Bucket--;
+	}
+
+	Output.Bucket = (ELyraSignificanceBucket)FMath::Clamp(Bucket, 0, (int32)ELyraSignificanceBucket::Lowest);
+	return Output;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+const ULyraSignificanceManager::FSignificantObject* ULyraSignificanceManager::FindObject(const UObject* Object) const
+{
+	const int32* Index = ObjectIndices.Find(Object);
+	return Index ? &Objects[*Index] : nullptr;
+}
+
+ELyraSignificanceBucket ULyraSignificanceManager::GetBucket(const UObject* Object) const
+{
+	const FSignificantObject* Entry = FindObject(Object);
+	return Entry ? Entry->Bucket : ELyraSignificanceBucket::Highest;
+}
+
+ELyraSignificanceBucket ULyraSignificanceManager::GetBucketForDistance(float Distance) const
+{
+	for (int32 Index = 0; Index < BucketDistances.Num(); ++Index)
+	{
+		if (Distance <= BucketDistances[Index])
+		{
+			return (ELyraSignificanceBucket)FMath::Min(Index, (int32)ELyraSignificanceBucket::Lowest);
+		}
+	}
+	return (ELyraSignificanceBucket)FMath::Min(BucketDistances.Num(), (int32)ELyraSignificanceBucket::Lowest);
+}
+
+float ULyraSignificanceManager::GetDistanceToNearestViewpoint(const UObject* Object) const
+{
+	const FSignificantObject* Entry = FindObject(Object);
+	return (Entry && Entry->DistanceSq < MAX_flt) ? FMath::Sqrt(Entry->DistanceSq) : MAX_flt;
+}
+
+bool ULyraSignificanceManager::IsObjectVisible(const UObject* Object) const
+{
+	const FSignificantObject* Entry = FindObject(Object);
+	return Entry && Entry->bVisible;
+}
+
+float ULyraSignificanceManager::GetBucketBudgetScale(ELyraSignificanceBucket Bucket) const
+{
+	return BucketBudgetScales.IsValidIndex((int32)Bucket) ? BucketBudgetScales[(int32)Bucket] : 1.f;
+}
+
+float ULyraSignificanceManager::GetBudgetScale(const UObject* Object)
+{
+	const ULyraSignificanceManager* Manager = Get(Object);
+	return Manager ? Manager->GetBucketBudgetScale(Manager->GetBucket(Object)) : 1.f;
+}
+
+ELyraSignificanceBucket ULyraSignificanceManager::GetSignificanceBucket(const UObject* Object)
+{
+	const ULyraSignificanceManager* Manager = Get(Object);
+	return Manager ? Manager->GetBucket(Object) : ELyraSignificanceBucket::Highest;
+}
+
+void ULyraSignificanceManager::PrintSignificance() const
+{
+	const UEnum* BucketEnum = StaticEnum<ELyraSignificanceBucket>();
+
+	UE_LOG(LogLyra, Log, TEXT("Significance for %s: %d objects, %d viewpoints"), *GetPathNameSafe(GetWorld()), Objects.Num(), NumViewpoints);
+	for (uint8 Bucket = 0; Bucket < (uint8)ELyraSignificanceBucket::MAX; ++Bucket)
+	{
+		UE_LOG(LogLyra, Log, TEXT("  %-8s %d"), *BucketEnum->GetNameStringByValue(Bucket), BucketCounts[Bucket]);
+	}
+
+	for (const FSignificantObject& Entry : Objects)
+	{
+		UE_LOG(LogLyra, Log, TEXT("  [%s] %-40s %-8s %.0fcm%s%s"), *Entry.Tag.ToString(), *GetNameSafe(Entry.Object.Get()),
+			*BucketEnum->GetNameStringByValue((int64)Entry.Bucket), Entry.DistanceSq < MAX_flt ? FMath::Sqrt(Entry.DistanceSq) : -1.f,
+			Entry.bVisible ? TEXT(" visible") : TEXT(""), Entry.bInCombat ? TEXT(" combat") : TEXT(""));
+	}
+}
+
+static FAutoConsoleCommandWithWorld LyraPrintSignificanceCmd(TEXT("Lyra.Significance.Print"), TEXT("Prints the significance bucket of every registered object"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const ULyraSignificanceManager* Manager = ULyraSignificanceManager::Get(World))
+		{
+			Manager->PrintSignificance();
+		}
+	}));
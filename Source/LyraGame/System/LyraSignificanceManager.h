@@ -6,11 +6,196 @@
 
 #include "LyraSignificanceManager.generated.h"
 
+#define UE_API LYRAGAME_API
+
+class AActor;
 class UObject;
+class USceneComponent;
+class UWorld;
+
+/** Shared significance result, from most to least significant. Budgets (animation, AI, network, FX) map these to their own levels. */
+UENUM(BlueprintType)
+enum class ELyraSignificanceBucket : uint8
+{
+	Highest,
+	High,
+	Medium,
+	Low,
+	Lowest,
 
-UCLASS()
+	MAX UMETA(Hidden)
+};
+
+/** Tags objects are registered with. Budgets usually only care about one or two of them */
+namespace LyraSignificanceTags
+{
+	extern UE_API const FName Character;
+	extern UE_API const FName Monster;
+	extern UE_API const FName Projectile;
+	extern UE_API const FName FX;
+}
+
+DECLARE_DELEGATE_TwoParams(FLyraSignificanceBucketChanged, ELyraSignificanceBucket /*OldBucket*/, ELyraSignificanceBucket /*NewBucket*/);
+
+/**
+ * ULyraSignificanceManager
+ *
+ *	The one place that decides how much an object matters to the players. Objects are registered by tag (characters, monsters,
+ *	projectiles, FX) and scored once per frame in a single batched pass against every viewpoint:
+ *	 - distance to the nearest viewpoint picks the base bucket (BucketDistances)
+ *	 - objects that are not visible (outside every view cone, or not rendered recently) drop one bucket
+ *	 - objects smaller than MinScreenSize on screen drop one more bucket
+ *	 - objects flagged in combat move up one bucket
+ *
+ *	Viewpoints are the local players on clients. On servers every player is a viewpoint so AI and network budgets can use the result.
+ *	Consumers either poll GetBucket / GetBudgetScale or pass a callback at registration, which runs on the game thread when the bucket changes.
+ *	Objects registered through the USignificanceManager API keep working, they are updated before the batched pass.
+ */
+UCLASS(MinimalAPI, Config = Game)
 class ULyraSignificanceManager : public USignificanceManager
 {
 	GENERATED_BODY()
 
+public:
+	UE_API ULyraSignificanceManager();
+
+	static UE_API ULyraSignificanceManager* Get(const UObject* WorldContextObject);
+
+	//~UObject interface
+	UE_API virtual void PostInitProperties() override;
+	UE_API virtual void BeginDestroy() override;
+	//~End of UObject interface
+
+	//~USignificanceManager interface
+	UE_API virtual void Update(TArrayView<const FTransform> Viewpoints) override;
+	//~End of USignificanceManager interface
+
+	/**
+	 * Starts scoring an actor or a scene component (e.g. a Niagara component).
+	 * @param BoundsRadius used for the screen size test
+	 * @param OnBucketChanged optional, called on the game thread after the batched pass when the bucket changes
+	 */
+	UE_API void RegisterSignificantObject(UObject* Object, FName Tag, float BoundsRadius, FLyraSignificanceBucketChanged OnBucketChanged = FLyraSignificanceBucketChanged());
+	UE_API void UnregisterSignificantObject(UObject* Object);
+
+	bool IsSignificantObjectRegistered(const UObject* Object) const { return ObjectIndices.Contains(Object); }
+
+	/** Combat moves an object up one bucket */
+	UE_API void SetObjectInCombat(const UObject* Object, bool bInCombat);
+
+	/** Highest for objects that are not registered: nothing degrades what is not scored */
+	UE_API ELyraSignificanceBucket GetBucket(const UObject* Object) const;
+
+	/** Base bucket for a distance alone (BucketDistances), before visibility, screen size and combat are applied */
+	UE_API ELyraSignificanceBucket GetBucketForDistance(float Distance) const;
+
+	/** Distance to the nearest viewpoint as of the last update, MAX_flt when unknown */
+	UE_API float GetDistanceToNearestViewpoint(const UObject* Object) const;
+
+	/** Inside a view cone and rendered recently (or in view, on servers) as of the last update */
+	UE_API bool IsObjectVisible(const UObject* Object) const;
+
+	/** Fraction of its full budget an object should use, from BucketBudgetScales */
+	UE_API float GetBucketBudgetScale(ELyraSignificanceBucket Bucket) const;
+
+	/** Budget scale for an object, 1 when no significance manager is around. Meant for hooks like trace or tick budgets. */
+	UFUNCTION(BlueprintPure, Category = "Lyra|Significance")
+	static UE_API float GetBudgetScale(const UObject* Object);
+
+	UFUNCTION(BlueprintPure, Category = "Lyra|Significance")
+	static UE_API ELyraSignificanceBucket GetSignificanceBucket(const UObject* Object);
+
+	int32 GetNumSignificantObjects() const { return Objects.Num(); }
+	int32 GetNumInBucket(ELyraSignificanceBucket Bucket) const { return BucketCounts[(uint8)Bucket]; }
+	int32 GetNumViewpoints() const { return NumViewpoints; }
+
+	UE_API void PrintSignificance() const;
+
+protected:
+	/** Distance (cm) up to which an object is in bucket N. Farther than the last entry is Lowest */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	TArray<float> BucketDistances = { 1500.f, 3000.f, 5000.f, 8000.f };
+
+	/** Budget scale per bucket, Highest first */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	TArray<float> BucketBudgetScales = { 1.f, 0.75f, 0.5f, 0.25f, 0.1f };
+
+	/** Projected radius (fraction of the half screen) under which an object drops one bucket */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	float MinScreenSize = 0.01f;
+
+	/** Viewpoints are transforms only, the view cone uses this field of view */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	float ViewFieldOfView = 100.f;
+
+	/** Seconds since the last render after which an object in view is considered occluded */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	float RecentlyRenderedTolerance = 0.5f;
+
+	/** Objects are scored in parallel once there are more than this */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	int32 MinObjectsForParallelScoring = 128;
+
+private:
+	struct FSignificantObject
+	{
+		TWeakObjectPtr<UObject> Object;
+		const UObject* RawObject = nullptr;
+		AActor* Actor = nullptr;
+		USceneComponent* Component = nullptr;
+		FName Tag;
+		float BoundsRadius = 100.f;
+		bool bInCombat = false;
+
+		float DistanceSq = MAX_flt;
+		bool bVisible = false;
+		ELyraSignificanceBucket Bucket = ELyraSignificanceBucket::Lowest;
+
+		FLyraSignificanceBucketChanged OnBucketChanged;
+	};
+
+	/** Per object inputs gathered on the game thread before scoring */
+	struct FScoringInput
+	{
+		FVector Location = FVector::ZeroVector;
+		float BoundsRadius = 100.f;
+		bool bInCombat = false;
+		bool bRecentlyRendered = true;
+	};
+
+	struct FScoringOutput
+	{
+		float DistanceSq = MAX_flt;
+		bool bVisible = false;
+		ELyraSignificanceBucket Bucket = ELyraSignificanceBucket::Lowest;
+	};
+
+	/** View cone terms shared by every object of a pass */
+	struct FViewConstants
+	{
+		float CosHalfFOV = 0.f;
+		float TanHalfFOV = 1.f;
+	};
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void GatherViewpoints(UWorld& World, TArray<FTransform, TInlineAllocator<4>>& OutViewpoints) const;
+
+	void ScoreObjects(TArrayView<const FTransform> Viewpoints);
+	FScoringOutput ScoreObject(const FScoringInput& Input, TArrayView<const FTransform> Viewpoints, const FViewConstants& ViewConstants) const;
+	void RemoveStaleObjects();
+
+	const FSignificantObject* FindObject(const UObject* Object) const;
+
+	TArray<FSignificantObject> Objects;
+	TMap<const UObject*, int32> ObjectIndices;
+
+	TArray<FScoringInput> ScoringInputs;
+	TArray<FScoringOutput> ScoringOutputs;
+
+	int32 BucketCounts[(uint8)ELyraSignificanceBucket::MAX] = {};
+	int32 NumViewpoints = 0;
+
+	FDelegateHandle PostActorTickHandle;
 };
+
+#undef UE_API
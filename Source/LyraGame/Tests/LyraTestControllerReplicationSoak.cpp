@@ -0,0 +1,201 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tests/LyraTestControllerReplicationSoak.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Performance/LyraPerformanceStatSubsystem.h"
+#include "System/LyraReplicationGraph.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraTestControllerReplicationSoak)
+
+DEFINE_LOG_CATEGORY_STATIC(LogLyraReplicationSoak, Log, All);
+
+void ULyraTestControllerReplicationSoak::OnInit()
+{
+	Super::OnInit();
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("RepSoakClients="), NumClients);
+	FParse::Value(CommandLine, TEXT("RepSoakWarmup="), WarmUpSeconds);
+	FParse::Value(CommandLine, TEXT("RepSoakDuration="), DurationSeconds);
+	FParse::Value(CommandLine, TEXT("RepSoakClientTimeout="), ClientTimeoutSeconds);
+	FParse::Value(CommandLine, TEXT("RepSoakBudgetMs="), BudgetMs);
+	FParse::Value(CommandLine, TEXT("RepSoakCapture="), CaptureName);
+
+	if (CaptureName.IsEmpty())
+	{
+		CaptureName = FString::Printf(TEXT("RepSoak_%dClients"), NumClients);
+	}
+
+	StartTime = PhaseStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogLyraReplicationSoak, Display, TEXT("Replication soak: %d clients, %.0fs warm up, %.0fs measured, budget %.2fms"), NumClients, WarmUpSeconds, DurationSeconds, BudgetMs);
+}
+
+void ULyraTestControllerReplicationSoak::OnTick(float TimeDelta)
+{
+	Super::OnTick(TimeDelta);
+
+	const UWorld* World = GetWorld();
+	if (!World || Phase == ESoakPhase::Done)
+	{
+		return;
+	}
+
+	const ENetMode NetMode = World->GetNetMode();
+	if (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer)
+	{
+		TickServer();
+	}
+	else
+	{
+		TickClient();
+	}
+}
+
+ULyraReplicationGraph* ULyraTestControllerReplicationSoak::FindReplicationGraph() const
+{
+	const UWorld* World = GetWorld();
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	return NetDriver ? Cast<ULyraReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+}
+
+ULyraPerformanceStatSubsystem* ULyraTestControllerReplicationSoak::GetPerformanceStats() const
+{
+	const UWorld* World = GetWorld();
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULyraPerformanceStatSubsystem>() : nullptr;
+}
+
+int32 ULyraTestControllerReplicationSoak::GetNumClientConnections() const
+{
+	const UWorld* World = GetWorld();
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	return NetDriver ? NetDriver->ClientConnections.Num() : 0;
+}
+
+void ULyraTestControllerReplicationSoak::TickServer()
+{
+	const double Now = FPlatformTime::Seconds();
+	const int32 NumConnections = GetNumClientConnections();
+
+	switch (Phase)
+	{
+		case ESoakPhase::WaitingForClients:
+		{
+			if (NumConnections >= NumClients)
+			{
+				UE_LOG(LogLyraReplicationSoak, Display, TEXT("%d clients connected, warming up"), NumConnections);
+				Phase = ESoakPhase::WarmUp;
+				PhaseStartTime = Now;
+			}
+			else if (Now - PhaseStartTime > ClientTimeoutSeconds)
+			{
+				UE_LOG(LogLyraReplicationSoak, Error, TEXT("Only %d of %d clients connected after %.0fs"), NumConnections, NumClients, ClientTimeoutSeconds);
+				Phase = ESoakPhase::Done;
+				EndTest(1);
+			}
+			break;
+		}
+
+		case ESoakPhase::WarmUp:
+		{
+			if (Now - PhaseStartTime >= WarmUpSeconds)
+			{
+				ULyraReplicationGraph* Graph = FindReplicationGraph();
+				if (!Graph)
+				{
+					UE_LOG(LogLyraReplicationSoak, Error, TEXT("The game net driver does not use ULyraReplicationGraph, enable it in the replication graph settings"));
+					Phase = ESoakPhase::Done;
+					EndTest(1);
+					break;
+				}
+
+				Graph->ResetTimingStats();
+				MinConnectionsDuringSoak = NumConnections;
+				Phase = ESoakPhase::Measuring;
+
+				if (ULyraPerformanceStatSubsystem* PerfStats = GetPerformanceStats())
+				{
+					PerfStats->StartCapture(CaptureName);
+				}
+				PhaseStartTime = Now;
+			}
+			break;
+		}
+
+		case ESoakPhase::Measuring:
+		{
+			const ULyraReplicationGraph* Graph = FindReplicationGraph();
+			if (!Graph)
+			{
+				UE_LOG(LogLyraReplicationSoak, Error, TEXT("Replication graph went away during the soak"));
+				Phase = ESoakPhase::Done;
+				EndTest(1);
+				break;
+			}
+
+			MinConnectionsDuringSoak = FMath::Min(MinConnectionsDuringSoak, NumConnections);
+			if (UNetDriver* NetDriver = GetWorld()->GetNetDriver())
+			{
+				MaxReplicatedActors = FMath::Max(MaxReplicatedActors, NetDriver->GetNetworkObjectList().GetActiveObjects().Num());
+			}
+
+			if (Now - PhaseStartTime >= DurationSeconds)
+			{
+				ReportAndEnd(*Graph);
+			}
+			break;
+		}
+
+		default:
+			break;
+	}
+}
+
+void ULyraTestControllerReplicationSoak::TickClient()
+{
+	// Clients only generate load. Give the server enough time to finish and leave on our own in case nobody closes us.
+	const double MaxClientTime = ClientTimeoutSeconds + WarmUpSeconds + DurationSeconds + 60.0;
+	if (FPlatformTime::Seconds() - StartTime >= MaxClientTime)
+	{
+		Phase = ESoakPhase::Done;
+		EndTest(0);
+	}
+}
+
+void ULyraTestControllerReplicationSoak::ReportAndEnd(const ULyraReplicationGraph& Graph)
+{
+	const FLyraRepGraphTimingStats& Timing = Graph.GetTimingStats();
+	const double P95 = Timing.GetPercentileMs(0.95f);
+
+	UE_LOG(LogLyraReplicationSoak, Display, TEXT("Replication soak results: %d frames, %d-%d clients, up to %d replicated actors"),
+		Timing.NumFrames, MinConnectionsDuringSoak, GetNumClientConnections(), MaxReplicatedActors);
+	UE_LOG(LogLyraReplicationSoak, Display, TEXT("ServerReplicateActors: avg %.3fms, p50 %.3fms, p95 %.3fms, p99 %.3fms, max %.3fms"),
+		Timing.GetAverageMs(), Timing.GetPercentileMs(0.5f), P95, Timing.GetPercentileMs(0.99f), Timing.MaxMs);
+
+	Graph.PrintConnectionStats();
+
+	// Frame and game thread percentiles, hitches and time windows go to Saved/Profiling/LyraPerformance for comparison across builds
+	if (ULyraPerformanceStatSubsystem* PerfStats = GetPerformanceStats())
+	{
+		PerfStats->StopCapture(CaptureName);
+	}
+
+	bool bPassed = Timing.NumFrames > 0 && MinConnectionsDuringSoak >= NumClients;
+	UE_CLOG(MinConnectionsDuringSoak < NumClients, LogLyraReplicationSoak, Error, TEXT("Clients disconnected during the soak (%d of %d left)"), MinConnectionsDuringSoak, NumClients);
+
+	if (BudgetMs > 0.f && P95 > BudgetMs)
+	{
+		UE_LOG(LogLyraReplicationSoak, Error, TEXT("p95 replication time %.3fms is over the %.3fms budget"), P95, BudgetMs);
+		bPassed = false;
+	}
+
+	Phase = ESoakPhase::Done;
+	EndTest(bPassed ? 0 : 1);
+}
@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GauntletTestController.h"
+
+#include "LyraTestControllerReplicationSoak.generated.h"
+
+class ULyraPerformanceStatSubsystem;
+class ULyraReplicationGraph;
+
+/**
+ * Headless replication soak test. Run the server and every client with this controller, clients with -nullrhi:
+ *
+ *   -gauntlet=LyraTestControllerReplicationSoak -RepSoakClients=16 -RepSoakDuration=300
+ *
+ * The server waits for RepSoakClients connections, lets the game warm up for RepSoakWarmup seconds, then records the time
+ * spent in ULyraReplicationGraph::ServerReplicateActors for RepSoakDuration seconds and logs avg/p50/p95/p99/max.
+ * With -RepSoakBudgetMs=X the test fails when p95 is above X. Clients exit on their own once the server is done.
+ * The measured phase is also a ULyraPerformanceStatSubsystem capture (-RepSoakCapture=<Name>, RepSoak_<N>Clients by default).
+ * Requires the replication graph to be enabled (ULyraReplicationGraphSettings::bDisableReplicationGraph).
+ */
+UCLASS()
+class ULyraTestControllerReplicationSoak : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+protected:
+	//~UGauntletTestController interface
+	virtual void OnInit() override;
+	virtual void OnTick(float TimeDelta) override;
+	//~End of UGauntletTestController interface
+
+private:
+	enum class ESoakPhase : uint8
+	{
+		WaitingForClients,
+		WarmUp,
+		Measuring,
+		Done
+	};
+
+	ULyraReplicationGraph* FindReplicationGraph() const;
+	int32 GetNumClientConnections() const;
+	ULyraPerformanceStatSubsystem* GetPerformanceStats() const;
+
+	void TickServer();
+	void TickClient();
+	void ReportAndEnd(const ULyraReplicationGraph& Graph);
+
+	ESoakPhase Phase = ESoakPhase::WaitingForClients;
+	double PhaseStartTime = 0.0;
+	double StartTime = 0.0;
+
+	int32 NumClients = 4;
+	float WarmUpSeconds = 10.f;
+	float DurationSeconds = 300.f;
+	float ClientTimeoutSeconds = 300.f;
+	float BudgetMs = 0.f;
+	FString CaptureName;
+
+	int32 MinConnectionsDuringSoak = 0;
+	int32 MaxReplicatedActors = 0;
+};
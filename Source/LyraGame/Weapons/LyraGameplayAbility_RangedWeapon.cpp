@@ -7,6 +7,8 @@
 #include "AIController.h"
 #include "NativeGameplayTags.h"
 #include "Weapons/LyraWeaponStateComponent.h"
+#include "Weapons/LyraLagCompensationSubsystem.h"
+#include "GameFramework/GameStateBase.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystem/LyraGameplayAbilityTargetData_SingleTargetHit.h"
 #include "DrawDebugHelpers.h"
@@ -503,17 +505,24 @@ void ULyraGameplayAbility_RangedWeapon::OnTargetDataReadyCallback(const FGamepla
 			{
 				if (Controller->GetLocalRole() == ROLE_Authority)
 				{
+					TArray<uint8> HitReplaces;
+
+					// Don't trust hits claimed by remote clients, re-check them against where the targets were when the shot was fired
+					if (!CurrentActorInfo->IsLocallyControlled())
+					{
+						ValidateClientTargetData(LocalTargetDataHandle, /*out*/ HitReplaces);
+					}
+
 					// Confirm hit markers
 					if (ULyraWeaponStateComponent* WeaponStateComponent = Controller->FindComponentByClass<ULyraWeaponStateComponent>())
 					{
-						TArray<uint8> HitReplaces;
 						for (uint8 i = 0; (i < LocalTargetDataHandle.Num()) && (i < 255); ++i)
 						{
 							if (FGameplayAbilityTargetData_SingleTargetHit* SingleTargetHit = static_cast<FGameplayAbilityTargetData_SingleTargetHit*>(LocalTargetDataHandle.Get(i)))
 							{
 								if (SingleTargetHit->bHitReplaced)
 								{
-									HitReplaces.Add(i);
+									HitReplaces.AddUnique(i);
 								}
 							}
 						}
@@ -549,6 +558,68 @@ void ULyraGameplayAbility_RangedWeapon::OnTargetDataReadyCallback(const FGamepla
 	MyAbilityComponent->ConsumeClientReplicatedTargetData(CurrentSpecHandle, CurrentActivationInfo.GetActivationPredictionKey());
 }
 
+void ULyraGameplayAbility_RangedWeapon::ValidateClientTargetData(FGameplayAbilityTargetDataHandle& TargetData, OUT TArray<uint8>& OutRejectedHitIndices) const
+{
+	ULyraLagCompensationSubsystem* LagCompensation = UWorld::GetSubsystem<ULyraLagCompensationSubsystem>(GetWorld());
+	if ((LagCompensation == nullptr) || !LagCompensation->IsLagCompensationActive())
+	{
+		return;
+	}
+
+	const ULyraRangedWeaponInstance* WeaponData = GetWeaponInstance();
+	check(WeaponData);
+	const APawn* Shooter = Cast<APawn>(GetAvatarActorFromActorInfo());
+
+	// Bullets of the same cartridge are contiguous in the target data, validate each cartridge as one batch
+	const int32 NumEntries = FMath::Min(TargetData.Num(), 255);
+	int32 CartridgeStart = 0;
+	while (CartridgeStart < NumEntries)
+	{
+		const FLyraGameplayAbilityTargetData_SingleTargetHit* FirstHit = static_cast<const FLyraGameplayAbilityTargetData_SingleTargetHit*>(TargetData.Get(CartridgeStart));
+		const int32 CartridgeID = (FirstHit != nullptr) ? FirstHit->CartridgeID : INDEX_NONE;
+		const double ShotTimestamp = (FirstHit != nullptr) ? FirstHit->Timestamp : 0.0;
+
+		TArray<FLyraLagCompensatedHit, TInlineAllocator<16>> CartridgeHits;
+		TArray<FLyraGameplayAbilityTargetData_SingleTargetHit*, TInlineAllocator<16>> CartridgeEntries;
+
+		int32 CartridgeEnd = CartridgeStart;
+		for (; CartridgeEnd < NumEntries; ++CartridgeEnd)
+		{
+			FLyraGameplayAbilityTargetData_SingleTargetHit* SingleTargetHit = static_cast<FLyraGameplayAbilityTargetData_SingleTargetHit*>(TargetData.Get(CartridgeEnd));
+			if ((SingleTargetHit == nullptr) || (SingleTargetHit->CartridgeID != CartridgeID))
+			{
+				break;
+			}
+
+			CartridgeHits.Emplace(&SingleTargetHit->HitResult);
+			CartridgeEntries.Add(SingleTargetHit);
+		}
+
+		if (CartridgeHits.Num() > 0)
+		{
+			LagCompensation->ValidateCartridge(Shooter, ShotTimestamp, WeaponData->GetMaxDamageRange(), CartridgeHits);
+
+			for (int32 HitIndex = 0; HitIndex < CartridgeHits.Num(); ++HitIndex)
+			{
+				if (CartridgeHits[HitIndex].Result != ELyraLagCompensationResult::Accepted)
+				{
+					// Keep the trace so tracers still line up, but remove the target so no effects get applied
+					FHitResult& RejectedHit = CartridgeEntries[HitIndex]->HitResult;
+					RejectedHit.HitObjectHandle = FActorInstanceHandle();
+					RejectedHit.Component.Reset();
+					RejectedHit.PhysMaterial.Reset();
+					RejectedHit.bBlockingHit = false;
+
+					OutRejectedHitIndices.AddUnique((uint8)(CartridgeStart + HitIndex));
+				}
+			}
+		}
+
+		// Always make progress, even past entries that aren't single target hits
+		CartridgeStart = FMath::Max(CartridgeEnd, CartridgeStart + 1);
+	}
+}
+
 void ULyraGameplayAbility_RangedWeapon::StartRangedWeaponTargeting()
 {
 	check(CurrentActorInfo);
@@ -576,11 +647,16 @@ void ULyraGameplayAbility_RangedWeapon::StartRangedWeaponTargeting()
 	{
 		const int32 CartridgeID = FMath::Rand();
 
+		// Stamp the shot with our estimate of the server's clock so the server can rewind targets to what we saw
+		const AGameStateBase* GameState = GetWorld()->GetGameState();
+		const double Timestamp = (GameState != nullptr) ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+
 		for (const FHitResult& FoundHit : FoundHits)
 		{
 			FLyraGameplayAbilityTargetData_SingleTargetHit* NewTargetData = new FLyraGameplayAbilityTargetData_SingleTargetHit();
 			NewTargetData->HitResult = FoundHit;
 			NewTargetData->CartridgeID = CartridgeID;
+			NewTargetData->Timestamp = Timestamp;
 
 			TargetData.Add(NewTargetData);
 		}
@@ -111,6 +111,10 @@ protected:
 
 	void OnTargetDataReadyCallback(const FGameplayAbilityTargetDataHandle& InData, FGameplayTag ApplicationTag);
 
+	// Server-side validation of client-claimed hits against pawns rewound to the shot time
+	// Rejected hits are stripped of their hit actor so no effects are applied, and their indices are added to OutRejectedHitIndices
+	void ValidateClientTargetData(FGameplayAbilityTargetDataHandle& TargetData, OUT TArray<uint8>& OutRejectedHitIndices) const;
+
 	UFUNCTION(BlueprintCallable)
 	void StartRangedWeaponTargeting();
 
@@ -0,0 +1,466 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraLagCompensationSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "LyraLogChannels.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraLagCompensationSubsystem)
+
+namespace LyraConsoleVariables
+{
+	static bool bEnableLagCompensation = true;
+	static FAutoConsoleVariableRef CVarEnableLagCompensation(
+		TEXT("lyra.Weapon.LagCompensation.Enable"),
+		bEnableLagCompensation,
+		TEXT("Should the server validate client weapon hits against rewound pawn positions"),
+		ECVF_Default);
+
+	static float LagCompensationMaxRewindTime = 0.25f;
+	static FAutoConsoleVariableRef CVarLagCompensationMaxRewindTime(
+		TEXT("lyra.Weapon.LagCompensation.MaxRewindTime"),
+		LagCompensationMaxRewindTime,
+		TEXT("How far back in time (in seconds) the server is willing to rewind pawns to validate a shot"),
+		ECVF_Default);
+
+	static float LagCompensationSnapshotInterval = 1.0f / 60.0f;
+	static FAutoConsoleVariableRef CVarLagCompensationSnapshotInterval(
+		TEXT("lyra.Weapon.LagCompensation.SnapshotInterval"),
+		LagCompensationSnapshotInterval,
+		TEXT("Minimum time (in seconds) between two recorded pawn snapshots"),
+		ECVF_Default);
+
+	static int32 LagCompensationMaxTrackedPawns = 64;
+	static FAutoConsoleVariableRef CVarLagCompensationMaxTrackedPawns(
+		TEXT("lyra.Weapon.LagCompensation.MaxTrackedPawns"),
+		LagCompensationMaxTrackedPawns,
+		TEXT("Upper bound on the number of pawns recorded per tick, keeps the per-tick cost bounded"),
+		ECVF_Default);
+
+	static float LagCompensationHitTolerance = 40.0f;
+	static FAutoConsoleVariableRef CVarLagCompensationHitTolerance(
+		TEXT("lyra.Weapon.LagCompensation.HitTolerance"),
+		LagCompensationHitTolerance,
+		TEXT("Extra distance (in uu) around the rewound collision cylinder that still counts as a hit (covers limbs outside the capsule)"),
+		ECVF_Default);
+
+	static float LagCompensationMaxOriginError = 250.0f;
+	static FAutoConsoleVariableRef CVarLagCompensationMaxOriginError(
+		TEXT("lyra.Weapon.LagCompensation.MaxOriginError"),
+		LagCompensationMaxOriginError,
+		TEXT("Maximum distance (in uu) between a claimed trace start and the shooter's rewound location"),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorld CmdDumpLagCompensationStats(
+		TEXT("lyra.Weapon.LagCompensation.DumpStats"),
+		TEXT("Prints the server hit validation accept/reject counters"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (const ULyraLagCompensationSubsystem* Subsystem = UWorld::GetSubsystem<ULyraLagCompensationSubsystem>(World))
+			{
+				const FLyraLagCompensationStats& Stats = Subsystem->GetStats();
+				const int64 TotalHits = Stats.GetTotalHits();
+
+				UE_LOG(LogLyra, Log, TEXT("Lag compensation: %d tracked pawns, %lld cartridges, %lld hits (%lld rejected, %lld clamped timestamps, avg rewind %.1f ms)"),
+					Stats.TrackedPawns,
+					Stats.CartridgesValidated,
+					TotalHits,
+					Stats.GetRejectedHits(),
+					Stats.TimestampsClamped,
+					(TotalHits > 0) ? (Stats.TotalRewindSeconds * 1000.0 / TotalHits) : 0.0);
+				UE_LOG(LogLyra, Log, TEXT("  Accepted=%lld Origin=%lld Range=%lld MissedTarget=%lld Occluded=%lld"),
+					Stats.HitsByResult[(int32)ELyraLagCompensationResult::Accepted],
+					Stats.HitsByResult[(int32)ELyraLagCompensationResult::RejectedOrigin],
+					Stats.HitsByResult[(int32)ELyraLagCompensationResult::RejectedRange],
+					Stats.HitsByResult[(int32)ELyraLagCompensationResult::RejectedMissedTarget],
+					Stats.HitsByResult[(int32)ELyraLagCompensationResult::RejectedOccluded]);
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorld CmdResetLagCompensationStats(
+		TEXT("lyra.Weapon.LagCompensation.ResetStats"),
+		TEXT("Resets the server hit validation accept/reject counters"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (ULyraLagCompensationSubsystem* Subsystem = UWorld::GetSubsystem<ULyraLagCompensationSubsystem>(World))
+			{
+				Subsystem->ResetStats();
+			}
+		}));
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraLagCompensationHistory
+
+void FLyraLagCompensationHistory::Record(const FLyraLagCompensationSnapshot& Snapshot)
+{
+	check(Snapshots.Num() > 0);
+
+	Snapshots[Head] = Snapshot;
+	Head = (Head + 1) % Snapshots.Num();
+	Count = FMath::Min(Count + 1, Snapshots.Num());
+}
+
+bool FLyraLagCompensationHistory::Sample(double Timestamp, FLyraLagCompensationSnapshot& OutSnapshot) const
+{
+	if (Count == 0)
+	{
+		return false;
+	}
+
+	const int32 Capacity = Snapshots.Num();
+
+	// Walk from newest to oldest, histories are short so this is cheaper than a binary search over a ring
+	const FLyraLagCompensationSnapshot* Newer = nullptr;
+	for (int32 Age = 0; Age < Count; ++Age)
+	{
+		const FLyraLagCompensationSnapshot& Current = Snapshots[(Head - 1 - Age + Capacity) % Capacity];
+		if (Current.Timestamp <= Timestamp)
+		{
+			if (Newer == nullptr)
+			{
+				// Requested time is at or past the newest entry
+				OutSnapshot = Current;
+			}
+			else
+			{
+				const double Span = Newer->Timestamp - Current.Timestamp;
+				const float Alpha = (Span > UE_SMALL_NUMBER) ? (float)((Timestamp - Current.Timestamp) / Span) : 0.0f;
+
+				OutSnapshot.Timestamp = Timestamp;
+				OutSnapshot.Location = FMath::Lerp(Current.Location, Newer->Location, Alpha);
+				OutSnapshot.Rotation = FQuat::Slerp(Current.Rotation, Newer->Rotation, Alpha);
+				OutSnapshot.CollisionRadius = FMath::Lerp(Current.CollisionRadius, Newer->CollisionRadius, Alpha);
+				OutSnapshot.CollisionHalfHeight = FMath::Lerp(Current.CollisionHalfHeight, Newer->CollisionHalfHeight, Alpha);
+			}
+			return true;
+		}
+
+		Newer = &Current;
+	}
+
+	// Requested time is older than anything we have, use the oldest entry
+	OutSnapshot = *Newer;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraLagCompensationStats
+
+int64 FLyraLagCompensationStats::GetTotalHits() const
+{
+	int64 Total = 0;
+	for (int64 Value : HitsByResult)
+	{
+		Total += Value;
+	}
+	return Total;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ULyraLagCompensationSubsystem
+
+ULyraLagCompensationSubsystem::ULyraLagCompensationSubsystem()
+{
+}
+
+void ULyraLagCompensationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Histories.Reserve(LyraConsoleVariables::LagCompensationMaxTrackedPawns);
+	HistoryIndexMap.Reserve(LyraConsoleVariables::LagCompensationMaxTrackedPawns);
+}
+
+void ULyraLagCompensationSubsystem::Deinitialize()
+{
+	Histories.Empty();
+	HistoryIndexMap.Empty();
+
+	Super::Deinitialize();
+}
+
+bool ULyraLagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+TStatId ULyraLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULyraLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+bool ULyraLagCompensationSubsystem::IsLagCompensationActive() const
+{
+	const UWorld* World = GetWorld();
+	return LyraConsoleVariables::bEnableLagCompensation && (World != nullptr) && (World->GetNetMode() != NM_Client) && (World->GetNetMode() != NM_Standalone);
+}
+
+void ULyraLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!IsLagCompensationActive())
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	if ((LastSnapshotTime >= 0.0) && ((Now - LastSnapshotTime) < LyraConsoleVariables::LagCompensationSnapshotInterval))
+	{
+		return;
+	}
+	LastSnapshotTime = Now;
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_LyraLagCompensation_RecordSnapshots);
+	RecordSnapshots();
+}
+
+int32 ULyraLagCompensationSubsystem::GetHistoryCapacity()
+{
+	// Enough entries to cover the rewind window, plus one on each side to interpolate against
+	const float Interval = FMath::Max(LyraConsoleVariables::LagCompensationSnapshotInterval, 1.0f / 240.0f);
+	return FMath::Clamp(FMath::CeilToInt(LyraConsoleVariables::LagCompensationMaxRewindTime / Interval) + 2, 4, 128);
+}
+
+FLyraLagCompensationHistory& ULyraLagCompensationSubsystem::FindOrAddHistory(APawn* Pawn)
+{
+	if (const int32* ExistingIndex = HistoryIndexMap.Find(Pawn))
+	{
+		return Histories[*ExistingIndex];
+	}
+
+	const int32 NewIndex = Histories.AddDefaulted();
+	FLyraLagCompensationHistory& NewHistory = Histories[NewIndex];
+	NewHistory.Pawn = Pawn;
+	NewHistory.PawnKey = Pawn;
+	NewHistory.Snapshots.SetNum(GetHistoryCapacity());
+	HistoryIndexMap.Add(Pawn, NewIndex);
+
+	return NewHistory;
+}
+
+void ULyraLagCompensationSubsystem::RecordSnapshots()
+{
+	UWorld* World = GetWorld();
+	AGameStateBase* GameState = World->GetGameState();
+	if (GameState == nullptr)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	const int32 MaxTrackedPawns = FMath::Max(LyraConsoleVariables::LagCompensationMaxTrackedPawns, 0);
+	int32 NumRecorded = 0;
+
+	for (FLyraLagCompensationHistory& History : Histories)
+	{
+		History.bSeenThisTick = false;
+	}
+
+	for (APlayerState* PlayerState : GameState->PlayerArray)
+	{
+		if (NumRecorded >= MaxTrackedPawns)
+		{
+			break;
+		}
+
+		APawn* Pawn = (PlayerState != nullptr) ? PlayerState->GetPawn() : nullptr;
+		if ((Pawn == nullptr) || Pawn->IsPendingKillPending())
+		{
+			continue;
+		}
+
+		FLyraLagCompensationSnapshot Snapshot;
+		Snapshot.Timestamp = Now;
+		Snapshot.Location = Pawn->GetActorLocation();
+		Snapshot.Rotation = Pawn->GetActorQuat();
+		Pawn->GetSimpleCollisionCylinder(/*out*/ Snapshot.CollisionRadius, /*out*/ Snapshot.CollisionHalfHeight);
+
+		FLyraLagCompensationHistory& History = FindOrAddHistory(Pawn);
+		History.Record(Snapshot);
+		History.bSeenThisTick = true;
+
+		++NumRecorded;
+	}
+
+	RemoveStaleHistories();
+
+	Stats.TrackedPawns = NumRecorded;
+}
+
+void ULyraLagCompensationSubsystem::RemoveStaleHistories()
+{
+	for (int32 Index = Histories.Num() - 1; Index >= 0; --Index)
+	{
+		if (Histories[Index].bSeenThisTick)
+		{
+			continue;
+		}
+
+		HistoryIndexMap.Remove(Histories[Index].PawnKey);
+		Histories.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+		// Fix up the index of the entry that was swapped into this slot
+		if (Histories.IsValidIndex(Index))
+		{
+			HistoryIndexMap.Add(Histories[Index].PawnKey, Index);
+		}
+	}
+}
+
+bool ULyraLagCompensationSubsystem::GetRewoundSnapshot(const APawn* Pawn, double Timestamp, FLyraLagCompensationSnapshot& OutSnapshot) const
+{
+	if (const int32* HistoryIndex = HistoryIndexMap.Find(Pawn))
+	{
+		return Histories[*HistoryIndex].Sample(Timestamp, /*out*/ OutSnapshot);
+	}
+
+	return false;
+}
+
+APawn* ULyraLagCompensationSubsystem::GetHitPawn(const FHitResult& Hit)
+{
+	AActor* HitActor = Hit.HitObjectHandle.FetchActor();
+	if (APawn* HitPawn = Cast<APawn>(HitActor))
+	{
+		return HitPawn;
+	}
+
+	// Something attached to a pawn (e.g., a weapon or cosmetic actor) counts as hitting that pawn
+	return (HitActor != nullptr) ? Cast<APawn>(HitActor->GetAttachParentActor()) : nullptr;
+}
+
+int32 ULyraLagCompensationSubsystem::ValidateCartridge(const APawn* Shooter, double ShotTimestamp, float MaxRange, TArrayView<FLyraLagCompensatedHit> InOutHits)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_LyraLagCompensation_ValidateCartridge);
+
+	UWorld* World = GetWorld();
+	check(World);
+
+	// Clamp the client's claimed time to the window we are willing to rewind
+	const double Now = World->GetTimeSeconds();
+	const double OldestAllowed = Now - LyraConsoleVariables::LagCompensationMaxRewindTime;
+	const double RewindTime = FMath::Clamp(ShotTimestamp, OldestAllowed, Now);
+	if (RewindTime != ShotTimestamp)
+	{
+		++Stats.TimestampsClamped;
+	}
+
+	// Where was the shooter when the shot was fired?
+	FLyraLagCompensationSnapshot ShooterSnapshot;
+	const bool bHasShooterSnapshot = (Shooter != nullptr) && GetRewoundSnapshot(Shooter, RewindTime, /*out*/ ShooterSnapshot);
+	const FVector ShooterLocation = bHasShooterSnapshot ? ShooterSnapshot.Location : ((Shooter != nullptr) ? Shooter->GetActorLocation() : FVector::ZeroVector);
+
+	// Rewind every distinct pawn only once for the whole cartridge
+	TArray<TPair<const APawn*, FLyraLagCompensationSnapshot>, TInlineAllocator<8>> RewoundPawns;
+
+	// The occlusion check only cares about static world geometry, pawns are handled by the rewound shapes
+	FCollisionQueryParams OcclusionParams(SCENE_QUERY_STAT(LyraLagCompensationOcclusion), /*bTraceComplex=*/ false, Shooter);
+	const FCollisionObjectQueryParams OcclusionObjectParams(ECC_WorldStatic);
+
+	const float Tolerance = LyraConsoleVariables::LagCompensationHitTolerance;
+	const float MaxOriginError = LyraConsoleVariables::LagCompensationMaxOriginError;
+	int32 NumAccepted = 0;
+
+	for (FLyraLagCompensatedHit& Claim : InOutHits)
+	{
+		check(Claim.Hit);
+		const FHitResult& Hit = *Claim.Hit;
+		const FVector ImpactPoint = Hit.bBlockingHit ? FVector(Hit.ImpactPoint) : FVector(Hit.TraceEnd);
+
+		Claim.Result = ELyraLagCompensationResult::Accepted;
+
+		if (FVector::DistSquared(Hit.TraceStart, ShooterLocation) > FMath::Square(MaxOriginError))
+		{
+			Claim.Result = ELyraLagCompensationResult::RejectedOrigin;
+		}
+		else if (FVector::DistSquared(Hit.TraceStart, ImpactPoint) > FMath::Square(MaxRange + Tolerance))
+		{
+			Claim.Result = ELyraLagCompensationResult::RejectedRange;
+		}
+		else if (const APawn* HitPawn = GetHitPawn(Hit))
+		{
+			const FLyraLagCompensationSnapshot* TargetSnapshot = nullptr;
+			for (const TPair<const APawn*, FLyraLagCompensationSnapshot>& Entry : RewoundPawns)
+			{
+				if (Entry.Key == HitPawn)
+				{
+					TargetSnapshot = &Entry.Value;
+					break;
+				}
+			}
+
+			if (TargetSnapshot == nullptr)
+			{
+				FLyraLagCompensationSnapshot NewSnapshot;
+				if (!GetRewoundSnapshot(HitPawn, RewindTime, /*out*/ NewSnapshot))
+				{
+					// Untracked pawn (e.g., over the tracking budget), fall back to its present-time shape
+					NewSnapshot.Location = HitPawn->GetActorLocation();
+					NewSnapshot.Rotation = HitPawn->GetActorQuat();
+					HitPawn->GetSimpleCollisionCylinder(/*out*/ NewSnapshot.CollisionRadius, /*out*/ NewSnapshot.CollisionHalfHeight);
+				}
+				TargetSnapshot = &RewoundPawns.Emplace_GetRef(HitPawn, NewSnapshot).Value;
+			}
+
+			// Treat the rewound collision cylinder as a capsule and test it against both the bullet ray and the claimed impact
+			const FVector Axis = TargetSnapshot->Rotation.GetUpVector();
+			const float SegmentHalfLength = FMath::Max(TargetSnapshot->CollisionHalfHeight - TargetSnapshot->CollisionRadius, 0.0f);
+			const FVector CapsuleA = TargetSnapshot->Location - (Axis * SegmentHalfLength);
+			const FVector CapsuleB = TargetSnapshot->Location + (Axis * SegmentHalfLength);
+			const float AllowedDistance = TargetSnapshot->CollisionRadius + Tolerance;
+
+			FVector ClosestOnRay;
+			FVector ClosestOnCapsule;
+			FMath::SegmentDistToSegmentSafe(Hit.TraceStart, Hit.TraceEnd, CapsuleA, CapsuleB, /*out*/ ClosestOnRay, /*out*/ ClosestOnCapsule);
+			const bool bRayHitsCapsule = FVector::DistSquared(ClosestOnRay, ClosestOnCapsule) <= FMath::Square(AllowedDistance);
+
+			const FVector ClosestToImpact = FMath::ClosestPointOnSegment(ImpactPoint, CapsuleA, CapsuleB);
+			const bool bImpactOnCapsule = FVector::DistSquared(ImpactPoint, ClosestToImpact) <= FMath::Square(AllowedDistance);
+
+			if (!bRayHitsCapsule || !bImpactOnCapsule)
+			{
+				Claim.Result = ELyraLagCompensationResult::RejectedMissedTarget;
+			}
+		}
+
+		if ((Claim.Result == ELyraLagCompensationResult::Accepted) && Hit.bBlockingHit)
+		{
+			// Stop just short of the impact so the surface that was actually hit doesn't count as a blocker
+			const FVector ToImpact = ImpactPoint - Hit.TraceStart;
+			const double ToImpactLength = ToImpact.Size();
+			if (ToImpactLength > Tolerance)
+			{
+				const FVector OcclusionEnd = Hit.TraceStart + ToImpact * ((ToImpactLength - Tolerance) / ToImpactLength);
+				if (World->LineTraceTestByObjectType(Hit.TraceStart, OcclusionEnd, OcclusionObjectParams, OcclusionParams))
+				{
+					Claim.Result = ELyraLagCompensationResult::RejectedOccluded;
+				}
+			}
+		}
+
+		++Stats.HitsByResult[(int32)Claim.Result];
+		Stats.TotalRewindSeconds += (Now - RewindTime);
+
+		if (Claim.Result == ELyraLagCompensationResult::Accepted)
+		{
+			++NumAccepted;
+		}
+	}
+
+	++Stats.CartridgesValidated;
+
+	return NumAccepted;
+}
+
+void ULyraLagCompensationSubsystem::ResetStats()
+{
+	const int32 TrackedPawns = Stats.TrackedPawns;
+	Stats = FLyraLagCompensationStats();
+	Stats.TrackedPawns = TrackedPawns;
+}
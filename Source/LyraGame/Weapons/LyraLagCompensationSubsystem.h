@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "LyraLagCompensationSubsystem.generated.h"
+
+class APawn;
+class UObject;
+struct FHitResult;
+
+// Collision state of a single pawn at a single point in (server) time
+struct FLyraLagCompensationSnapshot
+{
+	double Timestamp = 0.0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	float CollisionRadius = 0.0f;
+	float CollisionHalfHeight = 0.0f;
+};
+
+// Ring buffer of recent snapshots for one tracked pawn
+struct FLyraLagCompensationHistory
+{
+	TWeakObjectPtr<APawn> Pawn;
+
+	// Key used in the owning index map, stays valid after the pawn is destroyed
+	TObjectKey<APawn> PawnKey;
+
+	// Fixed-capacity storage, oldest entry is at (Head - Count + Capacity) % Capacity
+	TArray<FLyraLagCompensationSnapshot> Snapshots;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	// Set every tick the pawn is still found in the world, stale histories are culled afterwards
+	bool bSeenThisTick = false;
+
+	void Record(const FLyraLagCompensationSnapshot& Snapshot);
+
+	// Returns the interpolated state at the given time, clamped to the recorded range
+	bool Sample(double Timestamp, FLyraLagCompensationSnapshot& OutSnapshot) const;
+};
+
+// Why a claimed hit was accepted or rejected by the server
+enum class ELyraLagCompensationResult : uint8
+{
+	Accepted,
+
+	// The trace start was too far from where the shooter was at the time of the shot
+	RejectedOrigin,
+
+	// The hit was further away than the weapon can reach
+	RejectedRange,
+
+	// The shot ray did not pass through the target pawn at the rewound time
+	RejectedMissedTarget,
+
+	// World geometry blocks the line between the shooter and the claimed impact
+	RejectedOccluded,
+
+	MAX
+};
+
+// A single bullet claim from a client, validated as part of a cartridge
+struct FLyraLagCompensatedHit
+{
+	FLyraLagCompensatedHit() = default;
+	FLyraLagCompensatedHit(const FHitResult* InHit) : Hit(InHit) { }
+
+	const FHitResult* Hit = nullptr;
+	ELyraLagCompensationResult Result = ELyraLagCompensationResult::Accepted;
+};
+
+// Counters exposed for anti-cheat tuning
+struct FLyraLagCompensationStats
+{
+	int64 CartridgesValidated = 0;
+	int64 HitsByResult[(int32)ELyraLagCompensationResult::MAX] = { };
+
+	// Shots whose client timestamp was outside the rewind window and had to be clamped
+	int64 TimestampsClamped = 0;
+
+	// Sum of all applied rewind amounts, for computing the average
+	double TotalRewindSeconds = 0.0;
+
+	// Number of pawns recorded in the most recent tick
+	int32 TrackedPawns = 0;
+
+	int64 GetTotalHits() const;
+	int64 GetRejectedHits() const { return GetTotalHits() - HitsByResult[(int32)ELyraLagCompensationResult::Accepted]; }
+};
+
+/**
+ * ULyraLagCompensationSubsystem
+ *
+ * Server-side history of pawn collision used to validate client-claimed weapon hits.
+ * Each tick the collision cylinder of every player pawn is recorded into a small ring
+ * buffer; when a client reports hits, the hit pawns are rewound to the client's shot
+ * timestamp and the claims are re-checked against the rewound shapes instead of the
+ * present-time geometry.
+ */
+UCLASS()
+class ULyraLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	ULyraLagCompensationSubsystem();
+
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
+	/** Returns true if hit validation is enabled and this world is recording history */
+	bool IsLagCompensationActive() const;
+
+	/**
+	 * Validates all bullets of a single cartridge fired by Shooter at the given (server) time.
+	 * Every hit pawn is rewound once for the whole cartridge and the per-bullet results are written to InOutHits.
+	 * Returns the number of accepted hits.
+	 */
+	int32 ValidateCartridge(const APawn* Shooter, double ShotTimestamp, float MaxRange, TArrayView<FLyraLagCompensatedHit> InOutHits);
+
+	/** Returns the state of the given pawn at the given time, if it is being tracked */
+	bool GetRewoundSnapshot(const APawn* Pawn, double Timestamp, FLyraLagCompensationSnapshot& OutSnapshot) const;
+
+	const FLyraLagCompensationStats& GetStats() const { return Stats; }
+	void ResetStats();
+
+	/** Returns the pawn that owns the hit component (directly or via attachment), if any */
+	static APawn* GetHitPawn(const FHitResult& Hit);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void RecordSnapshots();
+	FLyraLagCompensationHistory& FindOrAddHistory(APawn* Pawn);
+	void RemoveStaleHistories();
+
+	static int32 GetHistoryCapacity();
+
+private:
+	// Contiguous histories for all tracked pawns, indexed by HistoryIndexMap
+	TArray<FLyraLagCompensationHistory> Histories;
+	TMap<TObjectKey<APawn>, int32> HistoryIndexMap;
+
+	double LastSnapshotTime = -1.0;
+
+	FLyraLagCompensationStats Stats;
+};